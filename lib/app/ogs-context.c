@@ -234,6 +234,16 @@ static int app_context_validation(void)
         return OGS_ERROR;
     }
 
+    if (self.time.timer.wheel_tick < 0) {
+        ogs_error("Timing wheel tick should not be negative");
+        ogs_error("time:");
+        ogs_error("  timer:");
+        ogs_error("    wheel: %lld",
+                (long long)self.time.timer.wheel_tick / 1000);
+
+        return OGS_ERROR;
+    }
+
     return OGS_OK;
 }
 
@@ -394,6 +404,9 @@ int ogs_app_context_parse_config(void)
                             !strcmp(max_key, "enb")) {
                     const char *v = ogs_yaml_iter_value(&max_iter);
                     if (v) self.max.gtp_peer = atoi(v);
+                } else if (!strcmp(max_key, "stream")) {
+                    const char *v = ogs_yaml_iter_value(&max_iter);
+                    if (v) self.max.stream = atoi(v);
                 } else
                     ogs_warn("unknown key `%s`", max_key);
             }
@@ -437,6 +450,13 @@ int ogs_app_context_parse_config(void)
                     const char *v = ogs_yaml_iter_value(&pool_iter);
                     if (v)
                         self.pool.defconfig.cluster_big_pool = atoi(v);
+                } else if (!strcmp(pool_key, "hugepage")) {
+                    self.pool.defconfig.hugepage =
+                        ogs_yaml_iter_bool(&pool_iter);
+                } else if (!strcmp(pool_key, "elastic")) {
+                    ogs_core()->pool.elastic = ogs_yaml_iter_bool(&pool_iter);
+                } else if (!strcmp(pool_key, "trim")) {
+                    ogs_core()->pool.trim = ogs_yaml_iter_bool(&pool_iter);
                 } else
                     ogs_warn("unknown key `%s`", pool_key);
             }
@@ -519,6 +539,24 @@ int ogs_app_context_parse_config(void)
                         } else
                             ogs_warn("unknown key `%s`", msg_key);
                     }
+                } else if (!strcmp(time_key, "timer")) {
+                    ogs_yaml_iter_t timer_iter;
+                    ogs_yaml_iter_recurse(&time_iter, &timer_iter);
+
+                    while (ogs_yaml_iter_next(&timer_iter)) {
+                        const char *timer_key =
+                            ogs_yaml_iter_key(&timer_iter);
+                        ogs_assert(timer_key);
+
+                        if (!strcmp(timer_key, "wheel")) {
+                            const char *v = ogs_yaml_iter_value(&timer_iter);
+                            if (v) {
+                                self.time.timer.wheel_tick =
+                                    ogs_time_from_msec(atoll(v));
+                            }
+                        } else
+                            ogs_warn("unknown key `%s`", timer_key);
+                    }
                 } else if (!strcmp(time_key, "t3502")) {
                     /* handle config in amf */
                 } else if (!strcmp(time_key, "t3512")) {
@@ -95,6 +95,7 @@ typedef struct ogs_app_context_s {
         uint64_t ue;
         uint64_t peer;
         uint64_t gtp_peer;
+        uint64_t stream;    /* HTTP/2 concurrent streams per SBI client */
     } max;
 
     struct {
@@ -166,6 +167,10 @@ typedef struct ogs_app_context_s {
             ogs_time_t complete_delay;
         } handover;
 
+        struct {
+            ogs_time_t wheel_tick; /* 0 : Red-black tree */
+        } timer;
+
     } time;
 
     struct metrics {
@@ -141,7 +141,11 @@ int ogs_app_initialize(
      */
     ogs_app()->queue = ogs_queue_create(ogs_app()->pool.event);
     ogs_assert(ogs_app()->queue);
-    ogs_app()->timer_mgr = ogs_timer_mgr_create(ogs_app()->pool.timer);
+    if (ogs_app()->time.timer.wheel_tick)
+        ogs_app()->timer_mgr = ogs_timer_mgr_create_wheel(
+                ogs_app()->pool.timer, ogs_app()->time.timer.wheel_tick);
+    else
+        ogs_app()->timer_mgr = ogs_timer_mgr_create(ogs_app()->pool.timer);
     ogs_assert(ogs_app()->timer_mgr);
     ogs_app()->pollset = ogs_pollset_create(ogs_app()->pool.socket);
     ogs_assert(ogs_app()->pollset);
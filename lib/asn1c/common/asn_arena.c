@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <asn_internal.h>
+
+/*
+ * The first chunk is in thread-local storage, so decoding a usual NGAP or
+ * S1AP message needs no allocation. A message larger than that, or a
+ * second message decoded while the first is still alive, takes chunks
+ * from the heap.
+ */
+#define ASN_ARENA_CHUNK_SIZE    8192
+#define ASN_ARENA_MAX           8   /* Decoded structures alive per thread */
+
+#define ASN_ARENA_ALIGN(__size) (((__size) + 7) & ~((size_t)7))
+
+typedef struct asn_arena_chunk_s {
+    struct asn_arena_chunk_s *next;
+    size_t size;
+    size_t used;
+} asn_arena_chunk_t;
+
+#define ASN_ARENA_CHUNK_DATA(__chunk) ((uint8_t *)((__chunk) + 1))
+
+typedef struct asn_arena_s {
+    const void *owner;
+    asn_arena_chunk_t *head;    /* Newest chunk first */
+    void *last;                 /* Last block, which can grow in place */
+} asn_arena_t;
+
+static OGS_THREAD_LOCAL union {
+    asn_arena_chunk_t chunk;
+    uint64_t align;
+    uint8_t buf[ASN_ARENA_CHUNK_SIZE];
+} static_chunk;
+static OGS_THREAD_LOCAL int static_chunk_used;
+
+static OGS_THREAD_LOCAL asn_arena_t arena_array[ASN_ARENA_MAX];
+static OGS_THREAD_LOCAL int num_of_arena;
+static OGS_THREAD_LOCAL asn_arena_t *current;
+
+static asn_arena_t *arena_find(const void *owner)
+{
+    int i;
+
+    for (i = 0; i < ASN_ARENA_MAX; i++)
+        if (arena_array[i].owner == owner)
+            return &arena_array[i];
+
+    return NULL;
+}
+
+static void arena_free(asn_arena_t *arena)
+{
+    asn_arena_chunk_t *chunk = NULL, *next = NULL;
+
+    for (chunk = arena->head; chunk; chunk = next) {
+        next = chunk->next;
+        if (chunk == &static_chunk.chunk)
+            static_chunk_used = 0;
+        else
+            ogs_free(chunk);
+    }
+
+    memset(arena, 0, sizeof(*arena));
+    num_of_arena--;
+}
+
+static asn_arena_chunk_t *arena_chunk_add(asn_arena_t *arena, size_t need)
+{
+    asn_arena_chunk_t *chunk = NULL;
+    size_t size;
+
+    if (!static_chunk_used &&
+        need <= sizeof(static_chunk) - sizeof(asn_arena_chunk_t)) {
+        chunk = &static_chunk.chunk;
+        chunk->size = sizeof(static_chunk) - sizeof(asn_arena_chunk_t);
+        static_chunk_used = 1;
+    } else {
+        size = ogs_max(need,
+                ASN_ARENA_CHUNK_SIZE - sizeof(asn_arena_chunk_t));
+        chunk = ogs_malloc(sizeof(asn_arena_chunk_t) + size);
+        if (!chunk)
+            return NULL;
+        chunk->size = size;
+    }
+
+    chunk->used = 0;
+    chunk->next = arena->head;
+    arena->head = chunk;
+
+    return chunk;
+}
+
+int ogs_asn_arena_begin(const void *owner)
+{
+    asn_arena_t *arena = NULL;
+
+    ogs_assert(owner);
+    ogs_assert(!current);
+
+    /* Decoded again without ogs_asn_free() */
+    arena = arena_find(owner);
+    if (arena)
+        arena_free(arena);
+
+    arena = arena_find(NULL);
+    if (!arena)
+        return 0;
+
+    arena->owner = owner;
+    num_of_arena++;
+
+    current = arena;
+
+    return 1;
+}
+
+void ogs_asn_arena_end(void)
+{
+    current = NULL;
+}
+
+int ogs_asn_arena_release(const void *owner)
+{
+    asn_arena_t *arena = NULL;
+
+    ogs_assert(owner);
+
+    if (num_of_arena == 0)
+        return 0;
+
+    arena = arena_find(owner);
+    if (!arena)
+        return 0;
+
+    if (arena == current)
+        current = NULL;
+    arena_free(arena);
+
+    return 1;
+}
+
+int ogs_asn_arena_active(void)
+{
+    return current != NULL;
+}
+
+void *ogs_asn_arena_malloc(size_t size)
+{
+    asn_arena_chunk_t *chunk = NULL;
+    ogs_asn_block_t *block = NULL;
+    size_t need;
+
+    ogs_assert(current);
+
+    need = sizeof(ogs_asn_block_t) + ASN_ARENA_ALIGN(size);
+
+    chunk = current->head;
+    if (!chunk || chunk->size - chunk->used < need) {
+        chunk = arena_chunk_add(current, need);
+        if (!chunk)
+            return NULL;
+    }
+
+    block = (ogs_asn_block_t *)(ASN_ARENA_CHUNK_DATA(chunk) + chunk->used);
+    block->arena = current;
+    block->size = size;
+    chunk->used += need;
+
+    current->last = block + 1;
+
+    return current->last;
+}
+
+void *ogs_asn_arena_realloc(void *oldptr, size_t size)
+{
+    asn_arena_chunk_t *chunk = NULL;
+    ogs_asn_block_t *block = NULL;
+    size_t grow;
+    void *ptr = NULL;
+
+    ogs_assert(current);
+
+    if (!oldptr)
+        return ogs_asn_arena_malloc(size);
+
+    block = (ogs_asn_block_t *)oldptr - 1;
+    ogs_assert(block->arena == current);
+    if (size <= block->size)
+        return oldptr;
+
+    /* Grow the last block in place */
+    chunk = current->head;
+    grow = ASN_ARENA_ALIGN(size) - ASN_ARENA_ALIGN(block->size);
+    if (oldptr == current->last && chunk->size - chunk->used >= grow) {
+        chunk->used += grow;
+        block->size = size;
+        return oldptr;
+    }
+
+    ptr = ogs_asn_arena_malloc(size);
+    if (!ptr)
+        return NULL;
+    memcpy(ptr, oldptr, block->size);
+
+    return ptr;
+}
+
+int ogs_asn_arena_local(const void *arena)
+{
+    uintptr_t p = (uintptr_t)arena;
+
+    return p >= (uintptr_t)&arena_array[0] &&
+        p < (uintptr_t)&arena_array[ASN_ARENA_MAX];
+}
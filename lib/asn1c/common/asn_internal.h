@@ -42,9 +42,55 @@ int get_asn1c_environment_version(void);	/* Run-time version */
 #else
 #include "proto/ogs-proto.h"
 
+/*
+ * Arena for decoding (asn_arena.c)
+ *
+ * Between ogs_asn_arena_begin() and ogs_asn_arena_end(), the allocations
+ * of this thread are served from a bump arena owned by the decoded
+ * structure, and FREEMEM() of arena memory does nothing.
+ * ogs_asn_arena_release() then frees the whole structure at once,
+ * so it should be called by the thread that decoded it.
+ *
+ * Every block is prefixed with a header naming the arena it came from,
+ * or NULL for the heap, so FREEMEM() needs no lookup.
+ */
+typedef struct ogs_asn_block_s {
+    void *arena;
+    size_t size;
+} ogs_asn_block_t;
+
+int ogs_asn_arena_begin(const void *owner);
+void ogs_asn_arena_end(void);
+int ogs_asn_arena_release(const void *owner);
+
+void *ogs_asn_arena_malloc(size_t size);
+void *ogs_asn_arena_realloc(void *oldptr, size_t size);
+int ogs_asn_arena_local(const void *arena);
+int ogs_asn_arena_active(void);
+
+static ogs_inline void *ogs_asn_heap_alloc(
+        ogs_asn_block_t *oldblock, size_t size)
+{
+    ogs_asn_block_t *block = NULL;
+
+    block = ogs_realloc(oldblock, sizeof(*block) + size);
+    if (!block)
+        return NULL;
+
+    block->arena = NULL;
+    block->size = size;
+
+    return block + 1;
+}
+
 static ogs_inline void *ogs_asn_malloc(size_t size, const char *file_line)
 {
-    void *ptr = ogs_malloc(size);
+    void *ptr = NULL;
+
+    if (ogs_asn_arena_active())
+        ptr = ogs_asn_arena_malloc(size);
+    else
+        ptr = ogs_asn_heap_alloc(NULL, size);
     if (!ptr) {
         ogs_fatal("asn_malloc() failed in `%s`", file_line);
         ogs_assert_if_reached();
@@ -55,18 +101,29 @@ static ogs_inline void *ogs_asn_malloc(size_t size, const char *file_line)
 static ogs_inline void *ogs_asn_calloc(
         size_t nmemb, size_t size, const char *file_line)
 {
-    void *ptr = ogs_calloc(nmemb, size);
-    if (!ptr) {
-        ogs_fatal("asn_calloc() failed in `%s`", file_line);
-        ogs_assert_if_reached();
-    }
+    void *ptr = NULL;
+
+    ptr = ogs_asn_malloc(nmemb * size, file_line);
+    memset(ptr, 0, nmemb * size);
 
     return ptr;
 }
 static ogs_inline void *ogs_asn_realloc(
         void *oldptr, size_t size, const char *file_line)
 {
-    void *ptr = ogs_realloc(oldptr, size);
+    ogs_asn_block_t *block = NULL;
+    void *ptr = NULL;
+
+    if (ogs_asn_arena_active())
+        ptr = ogs_asn_arena_realloc(oldptr, size);
+    else {
+        if (oldptr) {
+            block = (ogs_asn_block_t *)oldptr - 1;
+            /* A decoded structure is not grown after decoding */
+            ogs_assert(!block->arena);
+        }
+        ptr = ogs_asn_heap_alloc(block, size);
+    }
     if (!ptr) {
         ogs_fatal("asn_realloc() failed in `%s`", file_line);
         ogs_assert_if_reached();
@@ -74,11 +131,27 @@ static ogs_inline void *ogs_asn_realloc(
 
     return ptr;
 }
+static ogs_inline void ogs_asn_freemem(void *ptr)
+{
+    ogs_asn_block_t *block = NULL;
+
+    if (!ptr)
+        return;
+
+    block = (ogs_asn_block_t *)ptr - 1;
+    if (block->arena) {
+        /* Freed with the arena, which belongs to the decoding thread */
+        ogs_assert(ogs_asn_arena_local(block->arena));
+        return;
+    }
+
+    ogs_free(block);
+}
 
 #define CALLOC(nmemb, size) ogs_asn_calloc(nmemb, size, OGS_FILE_LINE)
 #define MALLOC(size) ogs_asn_malloc(size, OGS_FILE_LINE)
 #define REALLOC(oldptr, size) ogs_asn_realloc(oldptr, size, OGS_FILE_LINE)
-#define FREEMEM(ptr) ogs_free(ptr)
+#define FREEMEM(ptr) ogs_asn_freemem(ptr)
 
 #endif
 
@@ -19,32 +19,38 @@
 
 #include "message.h"
 
+/*
+ * APER is encoded into a per-thread buffer first, and then copied
+ * into a packet buffer of the encoded size.
+ */
+static OGS_THREAD_LOCAL uint8_t encode_buffer[OGS_MAX_SDU_LEN];
+
 ogs_pkbuf_t *ogs_asn_encode(const asn_TYPE_descriptor_t *td, void *sptr)
 {
     asn_enc_rval_t enc_ret = {0};
     ogs_pkbuf_t *pkbuf = NULL;
+    size_t len;
 
     ogs_assert(td);
     ogs_assert(sptr);
 
-    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
-    if (!pkbuf) {
-        ogs_error("ogs_pkbuf_alloc() failed");
-        return NULL;
-    }
-    ogs_pkbuf_put(pkbuf, OGS_MAX_SDU_LEN);
-
     enc_ret = aper_encode_to_buffer(td, NULL,
-                    sptr, pkbuf->data, OGS_MAX_SDU_LEN);
+                    sptr, encode_buffer, sizeof(encode_buffer));
     ogs_asn_free(td, sptr);
 
     if (enc_ret.encoded < 0) {
         ogs_error("Failed to encode ASN-PDU [%d]", (int)enc_ret.encoded);
-        ogs_pkbuf_free(pkbuf);
         return NULL;
     }
 
-    ogs_pkbuf_trim(pkbuf, ((enc_ret.encoded + 7) >> 3));
+    len = (enc_ret.encoded + 7) >> 3;
+
+    pkbuf = ogs_pkbuf_alloc(NULL, len);
+    if (!pkbuf) {
+        ogs_error("ogs_pkbuf_alloc() failed");
+        return NULL;
+    }
+    ogs_pkbuf_put_data(pkbuf, encode_buffer, len);
 
     return pkbuf;
 }
@@ -53,6 +59,7 @@ int ogs_asn_decode(const asn_TYPE_descriptor_t *td,
         void *struct_ptr, size_t struct_size, ogs_pkbuf_t *pkbuf)
 {
     asn_dec_rval_t dec_ret = {0};
+    int arena = 0;
 
     ogs_assert(td);
     ogs_assert(struct_ptr);
@@ -62,12 +69,25 @@ int ogs_asn_decode(const asn_TYPE_descriptor_t *td,
     ogs_assert(pkbuf->len);
 
     memset(struct_ptr, 0, struct_size);
+
+    /*
+     * The decoded structure is allocated from an arena,
+     * and ogs_asn_free() releases it at once.
+     * If every arena is in use, fall back to the heap.
+     */
+    arena = ogs_asn_arena_begin(struct_ptr);
     dec_ret = aper_decode(NULL, td, (void **)&struct_ptr,
             pkbuf->data, pkbuf->len, 0, 0);
+    if (arena)
+        ogs_asn_arena_end();
 
     if (dec_ret.code != RC_OK) {
         ogs_warn("Failed to decode ASN-PDU [code:%d,consumed:%d]",
                 dec_ret.code, (int)dec_ret.consumed);
+        if (arena) {
+            ogs_asn_arena_release(struct_ptr);
+            memset(struct_ptr, 0, struct_size);
+        }
         return OGS_ERROR;
     }
 
@@ -79,5 +99,8 @@ void ogs_asn_free(const asn_TYPE_descriptor_t *td, void *sptr)
     ogs_assert(td);
     ogs_assert(sptr);
 
+    if (ogs_asn_arena_release(sptr))
+        return;
+
     ASN_STRUCT_FREE_CONTENTS_ONLY(*td, sptr);
 }
@@ -60,6 +60,7 @@
 #include "core/ogs-env.h"
 #include "core/ogs-fsm.h"
 #include "core/ogs-hash.h"
+#include "core/ogs-ihash.h"
 #include "core/ogs-misc.h"
 #include "core/ogs-getopt.h"
 #include "core/ogs-file.h"
@@ -92,6 +93,11 @@ typedef struct {
         int pool;
     } tlv;
 
+    struct {
+        bool elastic;
+        bool trim;
+    } pool;
+
 } ogs_core_context_t;
 
 void ogs_core_initialize(void);
@@ -45,18 +45,69 @@ const ogs_pollset_actions_t ogs_epoll_actions = {
     ogs_notify_pollset,
 };
 
+/*
+ * Polls are found by indexing map[] with the fd, not by hashing.
+ *
+ * The generation is bumped whenever an fd is added to the epoll set, and
+ * is carried in epoll_event.data with the fd. An event for an fd that
+ * was removed and reused while handling the same batch is dropped.
+ */
+#define EPOLL_DATA(fd, generation) \
+    (((uint64_t)(generation) << 32) | (uint32_t)(fd))
+#define EPOLL_DATA_FD(data)             ((ogs_socket_t)(uint32_t)(data))
+#define EPOLL_DATA_GENERATION(data)     ((uint32_t)((data) >> 32))
+
 struct epoll_map_s {
     ogs_poll_t *read;
     ogs_poll_t *write;
+    uint32_t generation;
 };
 
 struct epoll_context_s {
     int epfd;
 
-    ogs_hash_t *map_hash;
+    struct epoll_map_s *map;
+    unsigned int map_size;
     struct epoll_event *event_list;
 };
 
+static struct epoll_map_s *epoll_map_find(
+        struct epoll_context_s *context, ogs_socket_t fd)
+{
+    if (fd < 0 || (unsigned int)fd >= context->map_size)
+        return NULL;
+
+    return &context->map[fd];
+}
+
+static struct epoll_map_s *epoll_map_get(
+        struct epoll_context_s *context, ogs_socket_t fd)
+{
+    struct epoll_map_s *map = NULL;
+    unsigned int size;
+
+    ogs_assert(fd >= 0);
+
+    if ((unsigned int)fd >= context->map_size) {
+        size = context->map_size ? context->map_size : 1;
+        while (size <= (unsigned int)fd)
+            size <<= 1;
+
+        map = ogs_realloc(context->map, size * sizeof(*map));
+        if (!map) {
+            ogs_error("ogs_realloc() failed");
+            return NULL;
+        }
+        memset(map + context->map_size, 0,
+                (size - context->map_size) * sizeof(*map));
+
+        context->map = map;
+        context->map_size = size;
+    }
+
+    return &context->map[fd];
+}
+
 static void epoll_init(ogs_pollset_t *pollset)
 {
     struct epoll_context_s *context = NULL;
@@ -70,8 +121,9 @@ static void epoll_init(ogs_pollset_t *pollset)
             pollset->capacity, sizeof(struct epoll_event));
     ogs_assert(context->event_list);
 
-    context->map_hash = ogs_hash_make();
-    ogs_assert(context->map_hash);
+    context->map_size = pollset->capacity;
+    context->map = ogs_calloc(context->map_size, sizeof(struct epoll_map_s));
+    ogs_assert(context->map);
 
     context->epfd = epoll_create(pollset->capacity);
     ogs_assert(context->epfd >= 0);
@@ -90,7 +142,7 @@ static void epoll_cleanup(ogs_pollset_t *pollset)
     ogs_notify_final(pollset);
     close(context->epfd);
     ogs_free(context->event_list);
-    ogs_hash_destroy(context->map_hash);
+    ogs_free(context->map);
 
     ogs_free(context);
 }
@@ -109,16 +161,13 @@ static int epoll_add(ogs_poll_t *poll)
     context = pollset->context;
     ogs_assert(context);
 
-    map = ogs_hash_get(context->map_hash, &poll->fd, sizeof(poll->fd));
-    if (!map) {
-        map = ogs_calloc(1, sizeof(*map));
-        if (!map) {
-            ogs_error("ogs_calloc() failed");
-            return OGS_ERROR;
-        }
+    map = epoll_map_get(context, poll->fd);
+    if (!map)
+        return OGS_ERROR;
 
+    if (!map->read && !map->write) {
         op = EPOLL_CTL_ADD;
-        ogs_hash_set(context->map_hash, &poll->fd, sizeof(poll->fd), map);
+        map->generation++;
     } else {
         op = EPOLL_CTL_MOD;
     }
@@ -135,7 +184,7 @@ static int epoll_add(ogs_poll_t *poll)
         ee.events |= (EPOLLIN|EPOLLRDHUP);
     if (map->write)
         ee.events |= EPOLLOUT;
-    ee.data.fd = poll->fd;
+    ee.data.u64 = EPOLL_DATA(poll->fd, map->generation);
 
     rv = epoll_ctl(context->epfd, op, poll->fd, &ee);
     if (rv < 0) {
@@ -161,7 +210,7 @@ static int epoll_remove(ogs_poll_t *poll)
     context = pollset->context;
     ogs_assert(context);
 
-    map = ogs_hash_get(context->map_hash, &poll->fd, sizeof(poll->fd));
+    map = epoll_map_find(context, poll->fd);
     ogs_assert(map);
 
     if (poll->when & OGS_POLLIN)
@@ -179,13 +228,10 @@ static int epoll_remove(ogs_poll_t *poll)
 
     if (map->read || map->write) {
         op = EPOLL_CTL_MOD;
-        ee.data.fd = poll->fd;
+        ee.data.u64 = EPOLL_DATA(poll->fd, map->generation);
     } else {
         op = EPOLL_CTL_DEL;
         ee.data.fd = INVALID_SOCKET;
-
-        ogs_hash_set(context->map_hash, &poll->fd, sizeof(poll->fd), NULL);
-        ogs_free(map);
     }
 
     rv = epoll_ctl(context->epfd, op, poll->fd, &ee);
@@ -221,6 +267,7 @@ static int epoll_process(ogs_pollset_t *pollset, ogs_time_t timeout)
 
     for (i = 0; i < num_of_poll; i++) {
         struct epoll_map_s *map = NULL;
+        uint64_t data;
         uint32_t received;
         short when = 0;
         ogs_socket_t fd;
@@ -245,11 +292,13 @@ static int epoll_process(ogs_pollset_t *pollset, ogs_time_t timeout)
         if (!when)
             continue;
 
-        fd = context->event_list[i].data.fd;
+        data = context->event_list[i].data.u64;
+        fd = EPOLL_DATA_FD(data);
         ogs_assert(fd != INVALID_SOCKET);
 
-        map = ogs_hash_get(context->map_hash, &fd, sizeof(fd));
-        if (!map) continue;
+        map = epoll_map_find(context, fd);
+        if (!map || map->generation != EPOLL_DATA_GENERATION(data))
+            continue;
 
         if (map->read && map->write && map->read == map->write) {
             map->read->handler(when, map->read->fd, map->read->data);
@@ -258,11 +307,13 @@ static int epoll_process(ogs_pollset_t *pollset, ogs_time_t timeout)
                 map->read->handler(when, map->read->fd, map->read->data);
 
             /*
-             * map->read->handler() can call ogs_remove_epoll()
+             * map->read->handler() can call ogs_remove_epoll(),
+             * or add another fd which may move map[].
              * So, we need to check map instance
              */
-            map = ogs_hash_get(context->map_hash, &fd, sizeof(fd));
-            if (!map) continue;
+            map = epoll_map_find(context, fd);
+            if (!map || map->generation != EPOLL_DATA_GENERATION(data))
+                continue;
 
             if ((when & OGS_POLLOUT) && map->write)
                 map->write->handler(when, map->write->fd, map->write->data);
@@ -42,6 +42,7 @@ typedef DWORD ogs_err_t;
 #define OGS_ECONNREFUSED            WSAECONNREFUSED
 #define OGS_EBADF                   WSAEBADF
 #define OGS_EAGAIN                  WSAEWOULDBLOCK
+#define OGS_EINTR                   WSAEINTR
 
 #define ogs_errno                   GetLastError()
 #define ogs_set_errno(err)          SetLastError(err)
@@ -66,6 +67,7 @@ typedef int ogs_err_t;
 #else
 #define OGS_EAGAIN                  EAGAIN
 #endif
+#define OGS_EINTR                   EINTR
 
 #define ogs_errno                   errno
 #define ogs_socket_errno            errno
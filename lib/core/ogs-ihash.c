@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-core.h"
+
+#define INITIAL_SIZE    16      /* tunable == 2^n */
+#define REHASH_STEP     64      /* Slots moved per ogs_ihash_set() */
+
+/* An empty slot has val == NULL */
+typedef struct ogs_ihash_slot_s {
+    uint64_t            key;
+    const void          *val;
+} ogs_ihash_slot_t;
+
+typedef struct ogs_ihash_table_s {
+    ogs_ihash_slot_t    *slot;
+    unsigned int        mask;
+    unsigned int        count;
+} ogs_ihash_table_t;
+
+struct ogs_ihash_s {
+    ogs_ihash_table_t   cur;
+    ogs_ihash_table_t   old;        /* Being moved to cur while growing */
+    unsigned int        rehash_start;
+    unsigned int        rehash_index;
+    uint64_t            seed;
+};
+
+static ogs_inline unsigned int hash_key(const ogs_ihash_t *ht, uint64_t key)
+{
+    key ^= ht->seed;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return (unsigned int)key;
+}
+
+static void table_init(ogs_ihash_table_t *t, unsigned int size)
+{
+    t->slot = ogs_calloc(size, sizeof(ogs_ihash_slot_t));
+    ogs_assert(t->slot);
+    t->mask = size - 1;
+    t->count = 0;
+}
+
+static void table_final(ogs_ihash_table_t *t)
+{
+    if (t->slot)
+        ogs_free(t->slot);
+    memset(t, 0, sizeof(*t));
+}
+
+/* Probe distance of the entry at index i from its home slot */
+static ogs_inline unsigned int table_dist(const ogs_ihash_t *ht,
+        const ogs_ihash_table_t *t, unsigned int i)
+{
+    return (i - hash_key(ht, t->slot[i].key)) & t->mask;
+}
+
+static int table_find(const ogs_ihash_t *ht,
+        const ogs_ihash_table_t *t, uint64_t key)
+{
+    unsigned int i, dist;
+
+    if (!t->count)
+        return -1;
+
+    for (i = hash_key(ht, key) & t->mask, dist = 0;
+            t->slot[i].val; i = (i + 1) & t->mask, dist++) {
+        if (t->slot[i].key == key)
+            return i;
+        /* A richer entry is never placed after a poorer one */
+        if (table_dist(ht, t, i) < dist)
+            break;
+    }
+
+    return -1;
+}
+
+/* The caller makes sure the key is not in the table and there is room */
+static void table_insert(const ogs_ihash_t *ht,
+        ogs_ihash_table_t *t, uint64_t key, const void *val)
+{
+    ogs_ihash_slot_t entry, tmp;
+    unsigned int i, dist, d;
+
+    entry.key = key;
+    entry.val = val;
+
+    for (i = hash_key(ht, key) & t->mask, dist = 0;
+            t->slot[i].val; i = (i + 1) & t->mask, dist++) {
+        d = table_dist(ht, t, i);
+        if (d < dist) {
+            /* Take from the rich : swap and carry on with the evicted */
+            tmp = t->slot[i];
+            t->slot[i] = entry;
+            entry = tmp;
+            dist = d;
+        }
+    }
+
+    t->slot[i] = entry;
+    t->count++;
+}
+
+/* Backward shift deletion : no tombstones are left behind */
+static void table_delete(const ogs_ihash_t *ht,
+        ogs_ihash_table_t *t, unsigned int i)
+{
+    unsigned int next;
+
+    for (next = (i + 1) & t->mask;
+            t->slot[next].val && table_dist(ht, t, next) != 0;
+            i = next, next = (next + 1) & t->mask)
+        t->slot[i] = t->slot[next];
+
+    t->slot[i].key = 0;
+    t->slot[i].val = NULL;
+    t->count--;
+}
+
+/*
+ * Move about 'step' slots of the old table into the current one.
+ *
+ * A whole cluster is moved at once, so the entries left in the old table
+ * are still found by probing. The walk starts at an empty slot,
+ * so that no cluster wraps around the end of the walk.
+ */
+static void rehash_step(ogs_ihash_t *ht, unsigned int step)
+{
+    ogs_ihash_table_t *old = &ht->old;
+    ogs_ihash_slot_t *slot = NULL;
+    unsigned int i;
+
+    while (old->slot && step) {
+        if (old->count == 0 || ht->rehash_index > old->mask) {
+            table_final(old);
+            break;
+        }
+
+        i = (ht->rehash_start + ht->rehash_index) & old->mask;
+        if (!old->slot[i].val) {
+            ht->rehash_index++;
+            step--;
+            continue;
+        }
+
+        for (slot = &old->slot[i]; slot->val; slot = &old->slot[i]) {
+            table_insert(ht, &ht->cur, slot->key, slot->val);
+            slot->key = 0;
+            slot->val = NULL;
+            old->count--;
+
+            ht->rehash_index++;
+            i = (i + 1) & old->mask;
+            if (step) step--;
+        }
+    }
+}
+
+static void grow(ogs_ihash_t *ht)
+{
+    unsigned int i;
+
+    /* Finish the previous rehash first, if any */
+    rehash_step(ht, (unsigned int)-1);
+    ogs_assert(ht->old.slot == NULL);
+
+    ht->old = ht->cur;
+    table_init(&ht->cur, (ht->old.mask + 1) << 1);
+
+    for (i = 0; ht->old.slot[i].val; i++)
+        ;
+    ht->rehash_start = i;
+    ht->rehash_index = 0;
+}
+
+ogs_ihash_t *ogs_ihash_make(void)
+{
+    ogs_ihash_t *ht = NULL;
+
+    ht = ogs_calloc(1, sizeof(*ht));
+    if (!ht) {
+        ogs_error("ogs_calloc() failed");
+        return NULL;
+    }
+
+    table_init(&ht->cur, INITIAL_SIZE);
+    ht->seed = ((uint64_t)ogs_random32() << 32) | ogs_random32();
+
+    return ht;
+}
+
+void ogs_ihash_destroy(ogs_ihash_t *ht)
+{
+    ogs_assert(ht);
+
+    table_final(&ht->cur);
+    table_final(&ht->old);
+    ogs_free(ht);
+}
+
+void ogs_ihash_set(ogs_ihash_t *ht, uint64_t key, const void *val)
+{
+    int i;
+
+    ogs_assert(ht);
+
+    rehash_step(ht, REHASH_STEP);
+
+    i = table_find(ht, &ht->cur, key);
+    if (i >= 0) {
+        if (val)
+            ht->cur.slot[i].val = val;
+        else
+            table_delete(ht, &ht->cur, i);
+        return;
+    }
+
+    if (ht->old.slot) {
+        i = table_find(ht, &ht->old, key);
+        if (i >= 0)
+            table_delete(ht, &ht->old, i);
+    }
+
+    if (!val)
+        return;
+
+    /* Keep the load factor under 3/4 */
+    if ((ht->cur.count + 1) * 4 > (ht->cur.mask + 1) * 3)
+        grow(ht);
+
+    table_insert(ht, &ht->cur, key, val);
+}
+
+void *ogs_ihash_get(ogs_ihash_t *ht, uint64_t key)
+{
+    int i;
+
+    ogs_assert(ht);
+
+    i = table_find(ht, &ht->cur, key);
+    if (i >= 0)
+        return (void *)ht->cur.slot[i].val;
+
+    if (ht->old.slot) {
+        i = table_find(ht, &ht->old, key);
+        if (i >= 0)
+            return (void *)ht->old.slot[i].val;
+    }
+
+    return NULL;
+}
+
+unsigned int ogs_ihash_count(ogs_ihash_t *ht)
+{
+    ogs_assert(ht);
+    return ht->cur.count + ht->old.count;
+}
+
+void ogs_ihash_clear(ogs_ihash_t *ht)
+{
+    ogs_assert(ht);
+
+    table_final(&ht->old);
+    memset(ht->cur.slot, 0, sizeof(ogs_ihash_slot_t) * (ht->cur.mask + 1));
+    ht->cur.count = 0;
+}
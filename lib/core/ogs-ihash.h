@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_CORE_INSIDE) && !defined(OGS_CORE_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_IHASH_H
+#define OGS_IHASH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Integer-keyed hash table
+ *
+ * For fixed-width keys such as TEID, SEID, IPv4 address,
+ * IPv6 /64 prefix or file descriptor.
+ *
+ * - Open addressing with Robin Hood probing. Keys and values are stored
+ *   inline, so there is no allocation per entry.
+ * - The table grows incrementally. Each ogs_ihash_set() moves a few
+ *   entries to the new table, so no single call rehashes everything.
+ * - As with ogs_hash_set(), a NULL value deletes the key.
+ */
+
+typedef struct ogs_ihash_s ogs_ihash_t;
+
+ogs_ihash_t *ogs_ihash_make(void);
+void ogs_ihash_destroy(ogs_ihash_t *ht);
+
+void ogs_ihash_set(ogs_ihash_t *ht, uint64_t key, const void *val);
+void *ogs_ihash_get(ogs_ihash_t *ht, uint64_t key);
+
+unsigned int ogs_ihash_count(ogs_ihash_t *ht);
+void ogs_ihash_clear(ogs_ihash_t *ht);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_IHASH_H */
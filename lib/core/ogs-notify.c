@@ -32,6 +32,8 @@
 
 static void ogs_drain_pollset(short when, ogs_socket_t fd, void *data);
 
+void (*ogs_notify_drain_hook)(ogs_pollset_t *pollset);
+
 void ogs_notify_init(ogs_pollset_t *pollset)
 {
 #if !defined(HAVE_EVENTFD)
@@ -48,7 +50,7 @@ void ogs_notify_init(ogs_pollset_t *pollset)
 #endif
 
     pollset->notify.poll = ogs_pollset_add(pollset, OGS_POLLIN,
-            pollset->notify.fd[0], ogs_drain_pollset, NULL);
+            pollset->notify.fd[0], ogs_drain_pollset, pollset);
     ogs_assert(pollset->notify.poll);
 }
 
@@ -76,6 +78,13 @@ int ogs_notify_pollset(ogs_pollset_t *pollset)
 
     ogs_assert(pollset);
 
+    /*
+     * One write is enough until the pollset thread drains it.
+     * Events queued in the meantime are popped after the poll returns.
+     */
+    if (__atomic_exchange_n(&pollset->notify.pending, 1, __ATOMIC_SEQ_CST))
+        return OGS_OK;
+
 #if defined(HAVE_EVENTFD)
     r = write(pollset->notify.fd[0], (void*)&msg, sizeof(msg));
 #else
@@ -84,6 +93,7 @@ int ogs_notify_pollset(ogs_pollset_t *pollset)
 
     if (r < 0) {
         ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno, "notify failed");
+        __atomic_store_n(&pollset->notify.pending, 0, __ATOMIC_SEQ_CST);
         return OGS_ERROR;
     }
 
@@ -92,6 +102,7 @@ int ogs_notify_pollset(ogs_pollset_t *pollset)
 
 static void ogs_drain_pollset(short when, ogs_socket_t fd, void *data)
 {
+    ogs_pollset_t *pollset = data;
     ssize_t r;
 #if defined(HAVE_EVENTFD)
     uint64_t msg;
@@ -100,7 +111,15 @@ static void ogs_drain_pollset(short when, ogs_socket_t fd, void *data)
 #endif
 
     ogs_assert(when == OGS_POLLIN);
+    ogs_assert(pollset);
 
+    /*
+     * Drain first, then clear 'pending'. A producer that notifies in
+     * between sees 'pending' set and skips the write, but its event was
+     * pushed before that, so it is popped after the poll returns.
+     * Clearing first would let the read consume the producer's write
+     * while 'pending' stays set, and no later notify would ever write.
+     */
 #if defined(HAVE_EVENTFD)
     r = read(fd, (char *)&msg, sizeof(msg));
 #else
@@ -109,4 +128,9 @@ static void ogs_drain_pollset(short when, ogs_socket_t fd, void *data)
     if (r < 0) {
         ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno, "drain failed");
     }
+
+    if (ogs_notify_drain_hook)
+        ogs_notify_drain_hook(pollset);
+
+    __atomic_store_n(&pollset->notify.pending, 0, __ATOMIC_RELEASE);
 }
@@ -32,6 +32,9 @@ void ogs_notify_init(ogs_pollset_t *pollset);
 void ogs_notify_final(ogs_pollset_t *pollset);
 int ogs_notify_pollset(ogs_pollset_t *pollset);
 
+/* Called between reading the notification and clearing it (for testing) */
+extern void (*ogs_notify_drain_hook)(ogs_pollset_t *pollset);
+
 #ifdef __cplusplus
 }
 #endif
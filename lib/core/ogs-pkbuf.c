@@ -17,12 +17,17 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include "core-config-private.h"
+
+#if HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
 #include "ogs-core.h"
 
 #undef OGS_LOG_DOMAIN
 #define OGS_LOG_DOMAIN __ogs_mem_domain
 
-#if OGS_USE_TALLOC == 0
 #define OGS_CLUSTER_128_SIZE    128
 #define OGS_CLUSTER_256_SIZE    256
 #define OGS_CLUSTER_512_SIZE    512
@@ -31,6 +36,8 @@
 #define OGS_CLUSTER_8192_SIZE   8192
 #define OGS_CLUSTER_32768_SIZE  32768
 
+#if OGS_USE_TALLOC == 0
+
 /*
  *
  * In lib/core/ogs-kqueue.c:69
@@ -48,7 +55,6 @@ typedef uint8_t ogs_cluster_128_t[OGS_CLUSTER_128_SIZE];
 typedef uint8_t ogs_cluster_256_t[OGS_CLUSTER_256_SIZE];
 typedef uint8_t ogs_cluster_512_t[OGS_CLUSTER_512_SIZE];
 typedef uint8_t ogs_cluster_1024_t[OGS_CLUSTER_1024_SIZE];
-typedef uint8_t ogs_cluster_2048_t[OGS_CLUSTER_2048_SIZE];
 typedef uint8_t ogs_cluster_8192_t[OGS_CLUSTER_8192_SIZE];
 typedef uint8_t ogs_cluster_32768_t[OGS_CLUSTER_32768_SIZE];
 typedef uint8_t ogs_cluster_big_t[OGS_CLUSTER_BIG_SIZE];
@@ -57,11 +63,23 @@ OGS_STATIC_ASSERT(sizeof(ogs_cluster_128_t) % sizeof(void *) == 0);
 OGS_STATIC_ASSERT(sizeof(ogs_cluster_256_t) % sizeof(void *) == 0);
 OGS_STATIC_ASSERT(sizeof(ogs_cluster_512_t) % sizeof(void *) == 0);
 OGS_STATIC_ASSERT(sizeof(ogs_cluster_1024_t) % sizeof(void *) == 0);
-OGS_STATIC_ASSERT(sizeof(ogs_cluster_2048_t) % sizeof(void *) == 0);
 OGS_STATIC_ASSERT(sizeof(ogs_cluster_8192_t) % sizeof(void *) == 0);
 OGS_STATIC_ASSERT(sizeof(ogs_cluster_32768_t) % sizeof(void *) == 0);
 OGS_STATIC_ASSERT(sizeof(ogs_cluster_big_t) % sizeof(void *) == 0);
 
+/*
+ * The most common 2048-byte cluster comes with its pkbuf header
+ * in a single object. The header and the cluster are released together
+ * when the last reference to the cluster goes away.
+ */
+typedef struct ogs_pkbuf_2048_s {
+    ogs_pkbuf_t pkbuf;
+    ogs_cluster_t cluster;
+    uint8_t buffer[OGS_CLUSTER_2048_SIZE];
+} ogs_pkbuf_2048_t;
+
+OGS_STATIC_ASSERT(sizeof(ogs_pkbuf_2048_t) % sizeof(void *) == 0);
+
 typedef struct ogs_pkbuf_pool_s {
     OGS_POOL(pkbuf, ogs_pkbuf_t);
     OGS_POOL(cluster, ogs_cluster_t);
@@ -70,11 +88,16 @@ typedef struct ogs_pkbuf_pool_s {
     OGS_POOL(cluster_256, ogs_cluster_256_t);
     OGS_POOL(cluster_512, ogs_cluster_512_t);
     OGS_POOL(cluster_1024, ogs_cluster_1024_t);
-    OGS_POOL(cluster_2048, ogs_cluster_2048_t);
+    OGS_POOL(pkbuf_2048, ogs_pkbuf_2048_t);
     OGS_POOL(cluster_8192, ogs_cluster_8192_t);
     OGS_POOL(cluster_32768, ogs_cluster_32768_t);
     OGS_POOL(cluster_big, ogs_cluster_big_t);
 
+    struct {
+        void *array;
+        size_t len;
+    } hugepage;
+
     ogs_thread_mutex_t mutex;
 } ogs_pkbuf_pool_t;
 
@@ -84,8 +107,51 @@ static ogs_pkbuf_pool_t *default_pool = NULL;
 static ogs_cluster_t *cluster_alloc(
         ogs_pkbuf_pool_t *pool, unsigned int size);
 static void cluster_free(ogs_pkbuf_pool_t *pool, ogs_cluster_t *cluster);
+
+static void pkbuf_2048_pool_init(
+        ogs_pkbuf_pool_t *pool, int size, bool hugepage);
+static void pkbuf_2048_pool_final(ogs_pkbuf_pool_t *pool);
+#else
+/* talloc is not thread-safe, so the 2048-byte buffers are guarded */
+static ogs_thread_mutex_t talloc_mutex;
 #endif
 
+/*
+ * Per-thread Magazine
+ *
+ * The 2048-byte buffers are cached per thread, so that the datapath
+ * does not take the pool lock for each packet. An empty magazine is
+ * refilled, and a full one is drained, by half under the lock.
+ *
+ * Magazines are kept in a static array rather than in thread-local
+ * storage, so that the pool can take back the buffers cached by
+ * a thread which has already exited. When a thread exits, its magazine
+ * is drained and the slot is given to the next thread.
+ */
+#define OGS_PKBUF_MAX_MAGAZINE      64
+#define OGS_PKBUF_MAGAZINE_SIZE     64
+#define OGS_PKBUF_MAGAZINE_BATCH    (OGS_PKBUF_MAGAZINE_SIZE / 2)
+
+typedef struct ogs_pkbuf_magazine_s {
+    bool used;
+    ogs_pkbuf_pool_t *pool;
+
+    int count;
+    ogs_pkbuf_t *pkbuf[OGS_PKBUF_MAGAZINE_SIZE];
+} ogs_pkbuf_magazine_t;
+
+static ogs_pkbuf_magazine_t magazine_array[OGS_PKBUF_MAX_MAGAZINE];
+static ogs_thread_mutex_t magazine_mutex;
+static ogs_thread_key_t magazine_key;
+
+/* 0 : Not yet assigned, -1 : No magazine left */
+static OGS_THREAD_LOCAL int magazine_id = 0;
+
+static ogs_pkbuf_t *pkbuf_2048_alloc(ogs_pkbuf_pool_t *pool);
+static void pkbuf_2048_free(ogs_pkbuf_pool_t *pool, ogs_pkbuf_t *pkbuf);
+static void magazine_drain_all(ogs_pkbuf_pool_t *pool);
+static void magazine_release(void *data);
+
 void *ogs_pkbuf_put_data(
         ogs_pkbuf_t *pkbuf, const void *data, unsigned int len)
 {
@@ -99,13 +165,22 @@ void ogs_pkbuf_init(void)
 {
 #if OGS_USE_TALLOC == 0
     ogs_pool_init(&pkbuf_pool, ogs_core()->pkbuf.pool);
+#else
+    ogs_thread_mutex_init(&talloc_mutex);
 #endif
+    ogs_thread_mutex_init(&magazine_mutex);
+    ogs_assert(ogs_thread_key_create(&magazine_key, magazine_release) ==
+            OGS_OK);
 }
 
 void ogs_pkbuf_final(void)
 {
+    ogs_thread_key_delete(magazine_key);
+    ogs_thread_mutex_destroy(&magazine_mutex);
 #if OGS_USE_TALLOC == 0
     ogs_pool_final(&pkbuf_pool);
+#else
+    ogs_thread_mutex_destroy(&talloc_mutex);
 #endif
 }
 
@@ -160,13 +235,13 @@ ogs_pkbuf_pool_t *ogs_pkbuf_pool_create(ogs_pkbuf_config_t *config)
         config->cluster_32768_pool + config->cluster_big_pool;
 
     ogs_pool_init(&pool->pkbuf, tmp);
-    ogs_pool_init(&pool->cluster, tmp);
+    ogs_pool_init(&pool->cluster, tmp - config->cluster_2048_pool);
 
     ogs_pool_init(&pool->cluster_128, config->cluster_128_pool);
     ogs_pool_init(&pool->cluster_256, config->cluster_256_pool);
     ogs_pool_init(&pool->cluster_512, config->cluster_512_pool);
     ogs_pool_init(&pool->cluster_1024, config->cluster_1024_pool);
-    ogs_pool_init(&pool->cluster_2048, config->cluster_2048_pool);
+    pkbuf_2048_pool_init(pool, config->cluster_2048_pool, config->hugepage);
     ogs_pool_init(&pool->cluster_8192, config->cluster_8192_pool);
     ogs_pool_init(&pool->cluster_32768, config->cluster_32768_pool);
     ogs_pool_init(&pool->cluster_big, config->cluster_big_pool);
@@ -195,6 +270,8 @@ ogs_pkbuf_pool_t *ogs_pkbuf_pool_create(ogs_pkbuf_config_t *config)
 
 void ogs_pkbuf_pool_destroy(ogs_pkbuf_pool_t *pool)
 {
+    magazine_drain_all(pool);
+
 #if OGS_USE_TALLOC == 0
     ogs_assert(pool);
 
@@ -205,7 +282,7 @@ void ogs_pkbuf_pool_destroy(ogs_pkbuf_pool_t *pool)
     ogs_pool_final(&pool->cluster_256);
     ogs_pool_final(&pool->cluster_512);
     ogs_pool_final(&pool->cluster_1024);
-    ogs_pool_final(&pool->cluster_2048);
+    pkbuf_2048_pool_final(pool);
     ogs_pool_final(&pool->cluster_8192);
     ogs_pool_final(&pool->cluster_32768);
     ogs_pool_final(&pool->cluster_big);
@@ -222,10 +299,22 @@ ogs_pkbuf_t *ogs_pkbuf_alloc_debug(
 #if OGS_USE_TALLOC
     ogs_pkbuf_t *pkbuf = NULL;
 
-    pkbuf = ogs_talloc_zero_size(pool, sizeof(*pkbuf) + size, file_line);
-    if (!pkbuf) {
-        ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
-        return NULL;
+    if (pool && size > OGS_CLUSTER_1024_SIZE &&
+            size <= OGS_CLUSTER_2048_SIZE) {
+        pkbuf = pkbuf_2048_alloc(pool);
+        if (!pkbuf) {
+            ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
+            return NULL;
+        }
+        /* A cached buffer is zeroed like a new one from talloc */
+        memset(pkbuf, 0, sizeof(*pkbuf) + size);
+        pkbuf->pool = pool;
+    } else {
+        pkbuf = ogs_talloc_zero_size(pool, sizeof(*pkbuf) + size, file_line);
+        if (!pkbuf) {
+            ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
+            return NULL;
+        }
     }
 
     pkbuf->head = pkbuf->_data;
@@ -247,22 +336,42 @@ ogs_pkbuf_t *ogs_pkbuf_alloc_debug(
         pool = default_pool;
     ogs_assert(pool);
 
-    ogs_thread_mutex_lock(&pool->mutex);
+    if (size > OGS_CLUSTER_1024_SIZE && size <= OGS_CLUSTER_2048_SIZE) {
+        ogs_pkbuf_2048_t *object = NULL;
 
-    cluster = cluster_alloc(pool, size);
-    if (!cluster) {
-        ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
-        ogs_thread_mutex_unlock(&pool->mutex);
-        return NULL;
-    }
+        pkbuf = pkbuf_2048_alloc(pool);
+        if (!pkbuf) {
+            ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
+            return NULL;
+        }
+        memset(pkbuf, 0, sizeof(*pkbuf));
+
+        object = ogs_container_of(pkbuf, ogs_pkbuf_2048_t, pkbuf);
+        cluster = &object->cluster;
+        memset(cluster, 0, sizeof(*cluster));
+
+        cluster->buffer = object->buffer;
+        cluster->size = OGS_CLUSTER_2048_SIZE;
+    } else {
+        ogs_thread_mutex_lock(&pool->mutex);
+
+        cluster = cluster_alloc(pool, size);
+        if (!cluster) {
+            ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
+            ogs_thread_mutex_unlock(&pool->mutex);
+            return NULL;
+        }
+
+        ogs_pool_alloc(&pool->pkbuf, &pkbuf);
 
-    ogs_pool_alloc(&pool->pkbuf, &pkbuf);
-    if (!pkbuf) {
-        ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
         ogs_thread_mutex_unlock(&pool->mutex);
-        return NULL;
+
+        if (!pkbuf) {
+            ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
+            return NULL;
+        }
+        memset(pkbuf, 0, sizeof(*pkbuf));
     }
-    memset(pkbuf, 0, sizeof(*pkbuf));
 
     OGS_OBJECT_REF(cluster);
 
@@ -279,8 +388,6 @@ ogs_pkbuf_t *ogs_pkbuf_alloc_debug(
 
     pkbuf->pool = pool;
 
-    ogs_thread_mutex_unlock(&pool->mutex);
-
     return pkbuf;
 #endif
 }
@@ -288,28 +395,54 @@ ogs_pkbuf_t *ogs_pkbuf_alloc_debug(
 void ogs_pkbuf_free(ogs_pkbuf_t *pkbuf)
 {
 #if OGS_USE_TALLOC
-    ogs_talloc_free(pkbuf, OGS_FILE_LINE);
+    ogs_assert(pkbuf);
+
+    /* Only the 2048-byte buffers are allocated with the pool set */
+    if (pkbuf->pool)
+        pkbuf_2048_free(pkbuf->pool, pkbuf);
+    else
+        ogs_talloc_free(pkbuf, OGS_FILE_LINE);
 #else
     ogs_pkbuf_pool_t *pool = NULL;
     ogs_cluster_t *cluster = NULL;
+    bool embedded = false;
     ogs_assert(pkbuf);
 
     pool = pkbuf->pool;
     ogs_assert(pool);
 
-    ogs_thread_mutex_lock(&pool->mutex);
-
     cluster = pkbuf->cluster;
     ogs_assert(cluster);
 
-    if (OGS_OBJECT_IS_REF(cluster))
-        OGS_OBJECT_UNREF(cluster);
-    else
-        cluster_free(pool, pkbuf->cluster);
+    if (cluster->size == OGS_CLUSTER_2048_SIZE) {
+        ogs_pkbuf_2048_t *object =
+            ogs_container_of(cluster, ogs_pkbuf_2048_t, cluster);
+        embedded = (pkbuf == &object->pkbuf);
+    }
 
-    ogs_pool_free(&pool->pkbuf, pkbuf);
+    /*
+     * The copies share the cluster and can be freed by other threads,
+     * so the reference count is dropped atomically. Only the last one
+     * releases the cluster.
+     */
+    if (__atomic_sub_fetch(
+                &cluster->reference_count, 1, __ATOMIC_ACQ_REL) == 0) {
+        if (embedded) {
+            /* The header lives in the cluster : no lock is needed */
+            pkbuf_2048_free(pool, pkbuf);
+            return;
+        }
 
-    ogs_thread_mutex_unlock(&pool->mutex);
+        ogs_thread_mutex_lock(&pool->mutex);
+        cluster_free(pool, cluster);
+        ogs_pool_free(&pool->pkbuf, pkbuf);
+        ogs_thread_mutex_unlock(&pool->mutex);
+
+    } else if (!embedded) {
+        ogs_thread_mutex_lock(&pool->mutex);
+        ogs_pool_free(&pool->pkbuf, pkbuf);
+        ogs_thread_mutex_unlock(&pool->mutex);
+    }
 #endif
 }
 
@@ -332,7 +465,7 @@ ogs_pkbuf_t *ogs_pkbuf_copy_debug(ogs_pkbuf_t *pkbuf, const char *file_line)
     }
 
 #if OGS_USE_TALLOC
-    newbuf = ogs_pkbuf_alloc_debug(NULL, size, file_line);
+    newbuf = ogs_pkbuf_alloc_debug(pkbuf->pool, size, file_line);
     if (!newbuf) {
         ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
         return NULL;
@@ -363,9 +496,10 @@ ogs_pkbuf_t *ogs_pkbuf_copy_debug(ogs_pkbuf_t *pkbuf, const char *file_line)
     ogs_assert(newbuf);
     memcpy(newbuf, pkbuf, sizeof *pkbuf);
 
-    OGS_OBJECT_REF(newbuf->cluster);
-
     ogs_thread_mutex_unlock(&pool->mutex);
+
+    __atomic_add_fetch(
+            &newbuf->cluster->reference_count, 1, __ATOMIC_RELAXED);
 #endif
 
     return newbuf;
@@ -411,13 +545,6 @@ static ogs_cluster_t *cluster_alloc(
             return NULL;
         }
         cluster->size = OGS_CLUSTER_1024_SIZE;
-    } else if (size <= OGS_CLUSTER_2048_SIZE) {
-        ogs_pool_alloc(&pool->cluster_2048, (ogs_cluster_2048_t**)&buffer);
-        if (!buffer) {
-            ogs_error("ogs_pool_alloc() failed");
-            return NULL;
-        }
-        cluster->size = OGS_CLUSTER_2048_SIZE;
     } else if (size <= OGS_CLUSTER_8192_SIZE) {
         ogs_pool_alloc(&pool->cluster_8192, (ogs_cluster_8192_t**)&buffer);
         if (!buffer) {
@@ -455,6 +582,11 @@ static void cluster_free(ogs_pkbuf_pool_t *pool, ogs_cluster_t *cluster)
     ogs_assert(cluster->buffer);
 
     switch (cluster->size) {
+    case OGS_CLUSTER_2048_SIZE:
+        /* The header went back to its own pool with the cluster */
+        ogs_pool_free(&pool->pkbuf_2048,
+                ogs_container_of(cluster, ogs_pkbuf_2048_t, cluster));
+        return;
     case OGS_CLUSTER_128_SIZE:
         ogs_pool_free(&pool->cluster_128, (ogs_cluster_128_t*)cluster->buffer);
         break;
@@ -468,10 +600,6 @@ static void cluster_free(ogs_pkbuf_pool_t *pool, ogs_cluster_t *cluster)
         ogs_pool_free(
                 &pool->cluster_1024, (ogs_cluster_1024_t*)cluster->buffer);
         break;
-    case OGS_CLUSTER_2048_SIZE:
-        ogs_pool_free(
-                &pool->cluster_2048, (ogs_cluster_2048_t*)cluster->buffer);
-        break;
     case OGS_CLUSTER_8192_SIZE:
         ogs_pool_free(
                 &pool->cluster_8192, (ogs_cluster_8192_t*)cluster->buffer);
@@ -490,3 +618,265 @@ static void cluster_free(ogs_pkbuf_pool_t *pool, ogs_cluster_t *cluster)
     ogs_pool_free(&pool->cluster, cluster);
 }
 #endif
+
+#if OGS_USE_TALLOC == 0
+static void *hugepage_alloc(size_t *len)
+{
+#if defined(MAP_HUGETLB)
+    void *array = NULL;
+    size_t hugepage_size = 2 * 1024 * 1024;
+
+    ogs_assert(len);
+
+    *len = ((*len + hugepage_size - 1) / hugepage_size) * hugepage_size;
+
+    array = mmap(NULL, *len, PROT_READ|PROT_WRITE,
+            MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+    if (array != MAP_FAILED)
+        return array;
+
+    ogs_warn("No hugepages reserved, try transparent hugepages");
+
+    array = mmap(NULL, *len, PROT_READ|PROT_WRITE,
+            MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (array == MAP_FAILED) {
+        ogs_error("mmap() failed");
+        return NULL;
+    }
+#if defined(MADV_HUGEPAGE)
+    madvise(array, *len, MADV_HUGEPAGE);
+#endif
+
+    return array;
+#else
+    ogs_warn("Hugepages are not supported");
+    return NULL;
+#endif
+}
+
+static void pkbuf_2048_pool_init(
+        ogs_pkbuf_pool_t *pool, int size, bool hugepage)
+{
+    ogs_pkbuf_2048_t *array = NULL;
+    size_t len;
+
+    ogs_assert(pool);
+
+    if (hugepage == true && size > 0) {
+        len = sizeof(ogs_pkbuf_2048_t) * size;
+        array = hugepage_alloc(&len);
+        if (array) {
+            ogs_pool_init_with_array(&pool->pkbuf_2048, size, array);
+
+            pool->hugepage.array = array;
+            pool->hugepage.len = len;
+            return;
+        }
+    }
+
+    ogs_pool_init(&pool->pkbuf_2048, size);
+}
+
+static void pkbuf_2048_pool_final(ogs_pkbuf_pool_t *pool)
+{
+    ogs_assert(pool);
+
+    ogs_pool_final(&pool->pkbuf_2048);
+
+    if (pool->hugepage.array) {
+#if defined(MAP_HUGETLB)
+        munmap(pool->hugepage.array, pool->hugepage.len);
+#endif
+        pool->hugepage.array = NULL;
+    }
+}
+
+/* Called with the lock held */
+static ogs_pkbuf_t *pkbuf_2048_get(ogs_pkbuf_pool_t *pool)
+{
+    ogs_pkbuf_2048_t *object = NULL;
+
+    ogs_pool_alloc(&pool->pkbuf_2048, &object);
+    if (!object)
+        return NULL;
+
+    return &object->pkbuf;
+}
+
+static void pkbuf_2048_put(ogs_pkbuf_pool_t *pool, ogs_pkbuf_t *pkbuf)
+{
+    ogs_pool_free(&pool->pkbuf_2048,
+            ogs_container_of(pkbuf, ogs_pkbuf_2048_t, pkbuf));
+}
+
+#define pkbuf_lock(pool) ogs_thread_mutex_lock(&(pool)->mutex)
+#define pkbuf_unlock(pool) ogs_thread_mutex_unlock(&(pool)->mutex)
+#else
+static ogs_pkbuf_t *pkbuf_2048_get(ogs_pkbuf_pool_t *pool)
+{
+    return ogs_talloc_zero_size(pool,
+            sizeof(ogs_pkbuf_t) + OGS_CLUSTER_2048_SIZE, OGS_FILE_LINE);
+}
+
+static void pkbuf_2048_put(ogs_pkbuf_pool_t *pool, ogs_pkbuf_t *pkbuf)
+{
+    ogs_talloc_free(pkbuf, OGS_FILE_LINE);
+}
+
+#define pkbuf_lock(pool) ogs_thread_mutex_lock(&talloc_mutex)
+#define pkbuf_unlock(pool) ogs_thread_mutex_unlock(&talloc_mutex)
+#endif
+
+static ogs_pkbuf_magazine_t *magazine_get(ogs_pkbuf_pool_t *pool)
+{
+    ogs_pkbuf_magazine_t *magazine = NULL;
+
+    if (ogs_unlikely(magazine_id == 0)) {
+        int i;
+
+        magazine_id = -1;
+
+        ogs_thread_mutex_lock(&magazine_mutex);
+        for (i = 0; i < OGS_PKBUF_MAX_MAGAZINE; i++) {
+            if (magazine_array[i].used == false) {
+                magazine_array[i].used = true;
+                magazine_id = i + 1;
+                break;
+            }
+        }
+        ogs_thread_mutex_unlock(&magazine_mutex);
+
+        /* magazine_release() is called when the thread exits */
+        if (magazine_id > 0)
+            ogs_thread_key_set(
+                    magazine_key, &magazine_array[magazine_id-1]);
+    }
+
+    if (magazine_id < 0)
+        return NULL;
+
+    magazine = &magazine_array[magazine_id-1];
+    if (magazine->pool != pool) {
+        /* Each thread caches the buffers of one pool at a time */
+        if (magazine->count)
+            return NULL;
+        magazine->pool = pool;
+    }
+
+    return magazine;
+}
+
+static ogs_pkbuf_t *pkbuf_2048_alloc(ogs_pkbuf_pool_t *pool)
+{
+    ogs_pkbuf_magazine_t *magazine = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+
+    ogs_assert(pool);
+
+    magazine = magazine_get(pool);
+    if (!magazine) {
+        pkbuf_lock(pool);
+        pkbuf = pkbuf_2048_get(pool);
+        pkbuf_unlock(pool);
+
+        return pkbuf;
+    }
+
+    if (magazine->count == 0) {
+        pkbuf_lock(pool);
+        while (magazine->count < OGS_PKBUF_MAGAZINE_BATCH) {
+            pkbuf = pkbuf_2048_get(pool);
+            if (!pkbuf)
+                break;
+            magazine->pkbuf[magazine->count++] = pkbuf;
+        }
+        pkbuf_unlock(pool);
+
+        if (magazine->count == 0)
+            return NULL;
+    }
+
+    return magazine->pkbuf[--magazine->count];
+}
+
+static void pkbuf_2048_free(ogs_pkbuf_pool_t *pool, ogs_pkbuf_t *pkbuf)
+{
+    ogs_pkbuf_magazine_t *magazine = NULL;
+
+    ogs_assert(pool);
+    ogs_assert(pkbuf);
+
+    magazine = magazine_get(pool);
+    if (!magazine) {
+        pkbuf_lock(pool);
+        pkbuf_2048_put(pool, pkbuf);
+        pkbuf_unlock(pool);
+
+        return;
+    }
+
+    if (magazine->count == OGS_PKBUF_MAGAZINE_SIZE) {
+        pkbuf_lock(pool);
+        while (magazine->count > OGS_PKBUF_MAGAZINE_BATCH)
+            pkbuf_2048_put(pool, magazine->pkbuf[--magazine->count]);
+        pkbuf_unlock(pool);
+    }
+
+    magazine->pkbuf[magazine->count++] = pkbuf;
+}
+
+/*
+ * Take back the buffers cached by all threads.
+ * No other thread should be using the pool at this point.
+ */
+static void magazine_drain_all(ogs_pkbuf_pool_t *pool)
+{
+    int i;
+
+    if (!pool)
+        return;
+
+    ogs_thread_mutex_lock(&magazine_mutex);
+
+    for (i = 0; i < OGS_PKBUF_MAX_MAGAZINE; i++) {
+        ogs_pkbuf_magazine_t *magazine = &magazine_array[i];
+
+        if (magazine->pool != pool)
+            continue;
+
+        pkbuf_lock(pool);
+        while (magazine->count)
+            pkbuf_2048_put(pool, magazine->pkbuf[--magazine->count]);
+        pkbuf_unlock(pool);
+
+        magazine->pool = NULL;
+    }
+
+    ogs_thread_mutex_unlock(&magazine_mutex);
+}
+
+static void magazine_release(void *data)
+{
+    ogs_pkbuf_magazine_t *magazine = data;
+    ogs_pkbuf_pool_t *pool = NULL;
+
+    ogs_assert(magazine);
+
+    ogs_thread_mutex_lock(&magazine_mutex);
+
+    pool = magazine->pool;
+    if (pool) {
+        pkbuf_lock(pool);
+        while (magazine->count)
+            pkbuf_2048_put(pool, magazine->pkbuf[--magazine->count]);
+        pkbuf_unlock(pool);
+
+        magazine->pool = NULL;
+    }
+    magazine->used = false;
+
+    /* The exiting thread falls back to the pool lock from now on */
+    magazine_id = -1;
+
+    ogs_thread_mutex_unlock(&magazine_mutex);
+}
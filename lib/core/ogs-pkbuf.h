@@ -71,6 +71,9 @@ typedef struct ogs_pkbuf_config_s {
     int cluster_8192_pool;
     int cluster_32768_pool;
     int cluster_big_pool;
+
+    /* Back the 2048-byte buffers with hugepages */
+    bool hugepage;
 } ogs_pkbuf_config_t;
 
 void ogs_pkbuf_init(void);
@@ -0,0 +1,389 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core-config-private.h"
+
+#if HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
+#include "ogs-core.h"
+
+#undef OGS_LOG_DOMAIN
+#define OGS_LOG_DOMAIN __ogs_mem_domain
+
+/*
+ * A slab is a power-of-two sized block aligned to its size, so the slab
+ * of a node is found from the address alone without touching the node.
+ * ogs_pool_cycle() can then be called with a stale pointer even if its
+ * slab has been unmapped.
+ */
+#define SLAB_MIN_BYTES      (64*1024)
+#define SLAB_MIN_ITEMS      16
+
+typedef struct slab_s {
+    ogs_lnode_t lnode;      /* In the partial list */
+    bool partial;
+
+    uint8_t *base;
+    int no;
+
+    int avail;
+    int head, tail;
+    int *free;              /* Ring of free offsets */
+    uint8_t *used;
+} slab_t;
+
+struct ogs_pool_slab_s {
+    const char *name;
+
+    size_t elsize;
+    int size;
+
+    int chunk;              /* Items per slab */
+    size_t bytes;           /* Bytes per slab */
+    unsigned int shift;     /* log2(bytes) */
+
+    int num_of_slab;
+    slab_t **slab;
+    ogs_ihash_t *addr;      /* (base >> shift) -> slab */
+
+    ogs_list_t partial;     /* Slabs with free items */
+
+    int live, hwm;
+    int empty;
+    bool trim;
+};
+
+static void *slab_map(size_t bytes)
+{
+#if HAVE_SYS_MMAN_H
+    uint8_t *mem = NULL, *aligned = NULL;
+    size_t head, tail;
+
+    mem = mmap(NULL, bytes * 2, PROT_READ|PROT_WRITE,
+            MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        ogs_error("mmap() failed [%d]", errno);
+        return NULL;
+    }
+
+    aligned = (uint8_t *)
+        (((uintptr_t)mem + bytes - 1) & ~((uintptr_t)bytes - 1));
+    head = aligned - mem;
+    tail = bytes - head;
+    if (head)
+        munmap(mem, head);
+    if (tail)
+        munmap(aligned + bytes, tail);
+
+    return aligned;
+#elif defined(_WIN32)
+    void *mem = _aligned_malloc(bytes, bytes);
+    if (!mem)
+        ogs_error("_aligned_malloc() failed");
+
+    return mem;
+#else
+    void *mem = NULL;
+
+    if (posix_memalign(&mem, bytes, bytes) != 0) {
+        ogs_error("posix_memalign() failed");
+        return NULL;
+    }
+
+    return mem;
+#endif
+}
+
+static void slab_unmap(void *mem, size_t bytes)
+{
+#if HAVE_SYS_MMAN_H
+    munmap(mem, bytes);
+#elif defined(_WIN32)
+    _aligned_free(mem);
+#else
+    free(mem);
+#endif
+}
+
+ogs_pool_slab_t *ogs_pool_slab_create(
+        const char *name, size_t elsize, int size, bool trim)
+{
+    ogs_pool_slab_t *slab = NULL;
+
+    ogs_assert(name);
+    ogs_assert(elsize);
+    ogs_assert(size > 0);
+
+    slab = calloc(1, sizeof(*slab));
+    if (!slab) {
+        ogs_error("calloc() failed");
+        return NULL;
+    }
+
+    slab->name = name;
+    slab->elsize = elsize;
+    slab->size = size;
+    slab->trim = trim;
+
+    slab->chunk = ogs_max(SLAB_MIN_BYTES / elsize, SLAB_MIN_ITEMS);
+    slab->chunk = ogs_min(slab->chunk, size);
+
+    slab->bytes = 4096;
+    slab->shift = 12;
+    while (slab->bytes < slab->chunk * elsize) {
+        slab->bytes <<= 1;
+        slab->shift++;
+    }
+    /* Fill the rest of the slab */
+    slab->chunk = ogs_min(slab->bytes / elsize, size);
+
+    slab->num_of_slab = (size + slab->chunk - 1) / slab->chunk;
+    slab->slab = calloc(slab->num_of_slab, sizeof(slab_t *));
+    if (!slab->slab) {
+        ogs_error("calloc() failed");
+        free(slab);
+        return NULL;
+    }
+
+    slab->addr = ogs_ihash_make();
+    ogs_assert(slab->addr);
+
+    ogs_list_init(&slab->partial);
+
+    return slab;
+}
+
+static slab_t *slab_add(ogs_pool_slab_t *slab)
+{
+    slab_t *s = NULL;
+    int i, no;
+
+    for (no = 0; no < slab->num_of_slab; no++)
+        if (!slab->slab[no])
+            break;
+    if (no == slab->num_of_slab)
+        return NULL;
+
+    s = calloc(1, sizeof(*s) + slab->chunk * (sizeof(int) + 1));
+    if (!s) {
+        ogs_error("calloc() failed");
+        return NULL;
+    }
+    s->free = (int *)(s + 1);
+    s->used = (uint8_t *)(s->free + slab->chunk);
+
+    s->base = slab_map(slab->bytes);
+    if (!s->base) {
+        free(s);
+        return NULL;
+    }
+
+    s->no = no;
+    s->avail = ogs_min(slab->chunk, slab->size - no * slab->chunk);
+    s->head = s->tail = 0;
+    for (i = 0; i < s->avail; i++)
+        s->free[i] = i;
+
+    slab->slab[no] = s;
+    ogs_ihash_set(slab->addr, (uintptr_t)s->base >> slab->shift, s);
+
+    ogs_list_add(&slab->partial, s);
+    s->partial = true;
+
+    slab->live++;
+    slab->empty++;
+    if (slab->live > slab->hwm) {
+        slab->hwm = slab->live;
+        ogs_info("'%s[%d]' grows to %d slabs : %d items, %zu KB",
+                slab->name, slab->size, slab->live,
+                ogs_min(slab->live * slab->chunk, slab->size),
+                slab->live * slab->bytes / 1024);
+    }
+
+    return s;
+}
+
+static void slab_remove(ogs_pool_slab_t *slab, slab_t *s)
+{
+    if (s->partial)
+        ogs_list_remove(&slab->partial, s);
+
+    ogs_ihash_set(slab->addr, (uintptr_t)s->base >> slab->shift, NULL);
+    slab->slab[s->no] = NULL;
+
+    slab_unmap(s->base, slab->bytes);
+    free(s);
+
+    slab->live--;
+    slab->empty--;
+}
+
+void ogs_pool_slab_destroy(ogs_pool_slab_t *slab)
+{
+    int i;
+
+    ogs_assert(slab);
+
+    for (i = 0; i < slab->num_of_slab; i++) {
+        slab_t *s = slab->slab[i];
+        if (s) {
+            slab_unmap(s->base, slab->bytes);
+            free(s);
+        }
+    }
+
+    ogs_ihash_destroy(slab->addr);
+    free(slab->slab);
+    free(slab);
+}
+
+static ogs_inline int slab_capacity(ogs_pool_slab_t *slab, slab_t *s)
+{
+    return ogs_min(slab->chunk, slab->size - s->no * slab->chunk);
+}
+
+void *ogs_pool_slab_alloc(ogs_pool_slab_t *slab)
+{
+    slab_t *s = NULL;
+    int offset, capacity;
+
+    ogs_assert(slab);
+
+    /* The slab which has been partial for the longest time */
+    s = ogs_list_first(&slab->partial);
+    if (!s) {
+        s = slab_add(slab);
+        if (!s)
+            return NULL;
+    }
+
+    capacity = slab_capacity(slab, s);
+    if (s->avail == capacity)
+        slab->empty--;
+
+    offset = s->free[s->head];
+    s->head = (s->head + 1) % capacity;
+    s->avail--;
+    s->used[offset] = 1;
+
+    if (s->avail == 0) {
+        ogs_list_remove(&slab->partial, s);
+        s->partial = false;
+    }
+
+    return s->base + offset * slab->elsize;
+}
+
+static ogs_inline slab_t *slab_of(ogs_pool_slab_t *slab, const void *node)
+{
+    return ogs_ihash_get(slab->addr, (uintptr_t)node >> slab->shift);
+}
+
+void ogs_pool_slab_free(ogs_pool_slab_t *slab, void *node)
+{
+    slab_t *s = NULL;
+    int offset, capacity;
+
+    ogs_assert(slab);
+    ogs_assert(node);
+
+    s = slab_of(slab, node);
+    ogs_assert(s);
+
+    capacity = slab_capacity(slab, s);
+
+    /*
+     * Like the static pool, a freed offset goes to the tail of the ring,
+     * so the index is reused as late as possible. The index is used as
+     * a protocol ID (SEID, TEID, NGAP/S1AP ID) and by ogs_pool_cycle().
+     */
+    offset = ((uint8_t *)node - s->base) / slab->elsize;
+    ogs_assert(s->used[offset]);
+    s->used[offset] = 0;
+    s->free[s->tail] = offset;
+    s->tail = (s->tail + 1) % capacity;
+    s->avail++;
+
+    if (s->partial == false) {
+        ogs_list_add(&slab->partial, s);
+        s->partial = true;
+    }
+
+    if (s->avail == capacity) {
+        slab->empty++;
+        /* Keep one empty slab */
+        if (slab->trim == true && slab->empty > 1)
+            slab_remove(slab, s);
+    }
+}
+
+ogs_index_t ogs_pool_slab_index(ogs_pool_slab_t *slab, const void *node)
+{
+    slab_t *s = NULL;
+
+    ogs_assert(slab);
+
+    s = slab_of(slab, node);
+    if (!s)
+        return 0;
+
+    return s->no * slab->chunk +
+        ((const uint8_t *)node - s->base) / slab->elsize + 1;
+}
+
+void *ogs_pool_slab_find(ogs_pool_slab_t *slab, ogs_index_t index)
+{
+    slab_t *s = NULL;
+    int offset;
+
+    ogs_assert(slab);
+
+    if (index == 0 || index > slab->size)
+        return NULL;
+
+    s = slab->slab[(index - 1) / slab->chunk];
+    if (!s)
+        return NULL;
+
+    offset = (index - 1) % slab->chunk;
+    if (!s->used[offset])
+        return NULL;
+
+    return s->base + offset * slab->elsize;
+}
+
+int ogs_pool_slab_count(ogs_pool_slab_t *slab)
+{
+    ogs_assert(slab);
+    return slab->live;
+}
+
+int ogs_pool_slab_hwm(ogs_pool_slab_t *slab)
+{
+    ogs_assert(slab);
+    return slab->hwm;
+}
+
+size_t ogs_pool_slab_bytes(ogs_pool_slab_t *slab)
+{
+    ogs_assert(slab);
+    return slab->live * slab->bytes;
+}
@@ -30,68 +30,153 @@ extern "C" {
 
 typedef unsigned int ogs_index_t;
 
+/*
+ * Elastic Pool
+ *
+ * ogs_pool_elastic_init() does not reserve the whole pool up front
+ * when `pool.elastic` is set in the configuration. Objects are allocated
+ * from slabs which are mapped on demand. Indexes stay stable, so
+ * ogs_pool_index()/ogs_pool_find()/ogs_pool_cycle() work as usual.
+ * With `pool.trim`, a slab that becomes empty is unmapped,
+ * keeping one empty slab to avoid mapping/unmapping at a boundary.
+ *
+ * The pool must not be accessed through array/free/index directly.
+ */
+typedef struct ogs_pool_slab_s ogs_pool_slab_t;
+
+ogs_pool_slab_t *ogs_pool_slab_create(
+        const char *name, size_t elsize, int size, bool trim);
+void ogs_pool_slab_destroy(ogs_pool_slab_t *slab);
+void *ogs_pool_slab_alloc(ogs_pool_slab_t *slab);
+void ogs_pool_slab_free(ogs_pool_slab_t *slab, void *node);
+ogs_index_t ogs_pool_slab_index(ogs_pool_slab_t *slab, const void *node);
+void *ogs_pool_slab_find(ogs_pool_slab_t *slab, ogs_index_t index);
+int ogs_pool_slab_count(ogs_pool_slab_t *slab);
+int ogs_pool_slab_hwm(ogs_pool_slab_t *slab);
+size_t ogs_pool_slab_bytes(ogs_pool_slab_t *slab);
+
 #define OGS_POOL(pool, type) \
     struct { \
         const char *name; \
         int head, tail; \
         int size, avail; \
         type **free, *array, **index; \
+        int hwm; \
+        ogs_pool_slab_t *slab; \
+        bool external; \
     } pool
 
 #define ogs_pool_init(pool, _size) do { \
+    (pool)->array = malloc(sizeof(*(pool)->array) * _size); \
+    ogs_assert((pool)->array); \
+    ogs_pool_init_with_array(pool, _size, (pool)->array); \
+    (pool)->external = false; \
+} while (0)
+
+/*
+ * The objects are taken from _array, which is owned by the caller
+ * and must outlive the pool. ogs_pool_final() does not release it.
+ */
+#define ogs_pool_init_with_array(pool, _size, _array) do { \
     int i; \
     (pool)->name = #pool; \
     (pool)->free = malloc(sizeof(*(pool)->free) * _size); \
     ogs_assert((pool)->free); \
-    (pool)->array = malloc(sizeof(*(pool)->array) * _size); \
+    (pool)->array = (_array); \
     ogs_assert((pool)->array); \
     (pool)->index = malloc(sizeof(*(pool)->index) * _size); \
     ogs_assert((pool)->index); \
     (pool)->size = (pool)->avail = _size; \
     (pool)->head = (pool)->tail = 0; \
+    (pool)->hwm = 0; \
+    (pool)->slab = NULL; \
+    (pool)->external = true; \
     for (i = 0; i < _size; i++) { \
         (pool)->free[i] = &((pool)->array[i]); \
         (pool)->index[i] = NULL; \
     } \
 } while (0)
 
+#define ogs_pool_elastic_init(__pool, _size) do { \
+    if (ogs_core()->pool.elastic == true) { \
+        (__pool)->name = #__pool; \
+        (__pool)->free = NULL; \
+        (__pool)->array = NULL; \
+        (__pool)->index = NULL; \
+        (__pool)->size = (__pool)->avail = _size; \
+        (__pool)->head = (__pool)->tail = 0; \
+        (__pool)->hwm = 0; \
+        (__pool)->external = false; \
+        (__pool)->slab = ogs_pool_slab_create(#__pool, \
+                sizeof(*(__pool)->array), _size, ogs_core()->pool.trim); \
+        ogs_assert((__pool)->slab); \
+    } else { \
+        ogs_pool_init(__pool, _size); \
+    } \
+} while (0)
+
 #define ogs_pool_final(pool) do { \
     if (((pool)->size != (pool)->avail)) \
         ogs_error("%d in '%s[%d]' were not released.", \
                 (pool)->size - (pool)->avail, (pool)->name, (pool)->size); \
-    free((pool)->free); \
-    free((pool)->array); \
-    free((pool)->index); \
+    if ((pool)->slab) { \
+        ogs_info("'%s[%d]' : %d used at most, %d slabs at most", \
+                (pool)->name, (pool)->size, (pool)->hwm, \
+                ogs_pool_slab_hwm((pool)->slab)); \
+        ogs_pool_slab_destroy((pool)->slab); \
+    } else { \
+        free((pool)->free); \
+        if ((pool)->external == false) \
+            free((pool)->array); \
+        free((pool)->index); \
+    } \
 } while (0)
 
-#define ogs_pool_index(pool, node) (((node) - (pool)->array)+1)
+#define ogs_pool_index(pool, node) \
+    ((pool)->slab ? ogs_pool_slab_index((pool)->slab, (node)) : \
+        ((node) - (pool)->array)+1)
 #define ogs_pool_find(pool, _index) \
-    (_index > 0 && _index <= (pool)->size) ? (pool)->index[_index-1] : NULL
+    ((pool)->slab ? ogs_pool_slab_find((pool)->slab, (_index)) : \
+        (_index > 0 && _index <= (pool)->size) ? \
+            (pool)->index[_index-1] : NULL)
 #define ogs_pool_cycle(pool, node) \
     ogs_pool_find((pool), ogs_pool_index((pool), (node)))
 
 #define ogs_pool_alloc(pool, node) do { \
     *(node) = NULL; \
     if ((pool)->avail > 0) { \
-        (pool)->avail--; \
-        *(node) = (void*)(pool)->free[(pool)->head]; \
-        (pool)->free[(pool)->head] = NULL; \
-        (pool)->head = ((pool)->head + 1) % ((pool)->size); \
-        (pool)->index[ogs_pool_index(pool, *(node))-1] = *(node); \
+        if ((pool)->slab) { \
+            *(node) = ogs_pool_slab_alloc((pool)->slab); \
+            if (*(node)) \
+                (pool)->avail--; \
+        } else { \
+            (pool)->avail--; \
+            *(node) = (void*)(pool)->free[(pool)->head]; \
+            (pool)->free[(pool)->head] = NULL; \
+            (pool)->head = ((pool)->head + 1) % ((pool)->size); \
+            (pool)->index[ogs_pool_index(pool, *(node))-1] = *(node); \
+        } \
+        if ((pool)->size - (pool)->avail > (pool)->hwm) \
+            (pool)->hwm = (pool)->size - (pool)->avail; \
     } \
 } while (0)
 
 #define ogs_pool_free(pool, node) do { \
     if ((pool)->avail < (pool)->size) { \
         (pool)->avail++; \
-        (pool)->free[(pool)->tail] = (void*)(node); \
-        (pool)->tail = ((pool)->tail + 1) % ((pool)->size); \
-        (pool)->index[ogs_pool_index(pool, node)-1] = NULL; \
+        if ((pool)->slab) { \
+            ogs_pool_slab_free((pool)->slab, (node)); \
+        } else { \
+            (pool)->free[(pool)->tail] = (void*)(node); \
+            (pool)->tail = ((pool)->tail + 1) % ((pool)->size); \
+            (pool)->index[ogs_pool_index(pool, node)-1] = NULL; \
+        } \
     } \
 } while (0)
 
 #define ogs_pool_size(pool) ((pool)->size)
 #define ogs_pool_avail(pool) ((pool)->avail)
+#define ogs_pool_hwm(pool) ((pool)->hwm)
 
 #define ogs_index_init(pool, _size) do { \
     int i; \
@@ -104,6 +189,9 @@ typedef unsigned int ogs_index_t;
     ogs_assert((pool)->index); \
     (pool)->size = (pool)->avail = _size; \
     (pool)->head = (pool)->tail = 0; \
+    (pool)->hwm = 0; \
+    (pool)->slab = NULL; \
+    (pool)->external = false; \
     for (i = 0; i < _size; i++) { \
         (pool)->free[i] = &((pool)->array[i]); \
         (pool)->index[i] = NULL; \
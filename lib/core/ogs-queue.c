@@ -37,62 +37,77 @@
 #undef OGS_LOG_DOMAIN
 #define OGS_LOG_DOMAIN __ogs_event_domain
 
+/*
+ * Bounded ring in the style of Dmitry Vyukov's MPMC queue. Each cell
+ * carries a sequence number which tells a producer that the cell is free
+ * for position 'in', and a consumer that it has been filled for position
+ * 'out', so push and pop only need a compare-and-swap on their own
+ * position.
+ *
+ * The mutex and the condition variables are used only when a caller
+ * blocks on a full or an empty queue.
+ */
+#define QUEUE_CACHE_LINE 64
+
+typedef struct queue_cell_s {
+    uint64_t            seq;
+    void                *data;
+} queue_cell_t;
+
 typedef struct ogs_queue_s {
-    void              **data;
-    unsigned int        nelts; /**< # elements */
-    unsigned int        in;    /**< next empty location */
-    unsigned int        out;   /**< next filled location */
+    queue_cell_t        *cell;
     unsigned int        bounds;/**< max size of queue */
+    int                 terminated;
+
+    uint8_t             pad0[QUEUE_CACHE_LINE];
+    uint64_t            in;    /**< next position to push */
+    uint8_t             pad1[QUEUE_CACHE_LINE - sizeof(uint64_t)];
+    uint64_t            out;   /**< next position to pop */
+    uint8_t             pad2[QUEUE_CACHE_LINE - sizeof(uint64_t)];
+
     unsigned int        full_waiters;
     unsigned int        empty_waiters;
+    unsigned int        interrupt_generation;
     ogs_thread_mutex_t  one_big_mutex;
     ogs_thread_cond_t   not_empty;
     ogs_thread_cond_t   not_full;
-    int                 terminated;
 } ogs_queue_t;
 
-/**
- * Detects when the ogs_queue_t is full. This utility function is expected
- * to be called from within critical sections, and is not threadsafe.
- */
-#define ogs_queue_full(queue) ((queue)->nelts == (queue)->bounds)
-
-/**
- * Detects when the ogs_queue_t is empty. This utility function is expected
- * to be called from within critical sections, and is not threadsafe.
- */
-#define ogs_queue_empty(queue) ((queue)->nelts == 0)
-
-/**
- * Callback routine that is called to destroy this
- * ogs_queue_t when its pool is destroyed.
- */
 ogs_queue_t *ogs_queue_create(unsigned int capacity)
 {
+    unsigned int i;
     ogs_queue_t *queue = ogs_calloc(1, sizeof *queue);
     if (!queue) {
         ogs_error("ogs_calloc() failed");
         return NULL;
     }
     ogs_assert(queue);
+    ogs_assert(capacity);
 
     ogs_thread_mutex_init(&queue->one_big_mutex);
     ogs_thread_cond_init(&queue->not_empty);
     ogs_thread_cond_init(&queue->not_full);
 
-    queue->data = ogs_calloc(1, capacity * sizeof(void*));
-    if (!queue->data) {
-        ogs_error("ogs_calloc[capacity:%d, sizeof(void*):%d] failed",
-                (int)capacity, (int)sizeof(void*));
+    queue->cell = ogs_calloc(capacity, sizeof(queue_cell_t));
+    if (!queue->cell) {
+        ogs_error("ogs_calloc[capacity:%d, sizeof(queue_cell_t):%d] failed",
+                (int)capacity, (int)sizeof(queue_cell_t));
+        ogs_thread_cond_destroy(&queue->not_empty);
+        ogs_thread_cond_destroy(&queue->not_full);
+        ogs_thread_mutex_destroy(&queue->one_big_mutex);
+        ogs_free(queue);
         return NULL;
     }
+    for (i = 0; i < capacity; i++)
+        queue->cell[i].seq = i;
+
     queue->bounds = capacity;
-    queue->nelts = 0;
     queue->in = 0;
     queue->out = 0;
     queue->terminated = 0;
     queue->full_waiters = 0;
     queue->empty_waiters = 0;
+    queue->interrupt_generation = 0;
 
     return queue;
 }
@@ -101,7 +116,7 @@ void ogs_queue_destroy(ogs_queue_t *queue)
 {
     ogs_assert(queue);
 
-    ogs_free(queue->data);
+    ogs_free(queue->cell);
 
     ogs_thread_cond_destroy(&queue->not_empty);
     ogs_thread_cond_destroy(&queue->not_full);
@@ -110,64 +125,164 @@ void ogs_queue_destroy(ogs_queue_t *queue)
     ogs_free(queue);
 }
 
-static int queue_push(ogs_queue_t *queue, void *data, ogs_time_t timeout)
+static ogs_inline int queue_terminated(ogs_queue_t *queue)
 {
+    return __atomic_load_n(&queue->terminated, __ATOMIC_ACQUIRE);
+}
+
+static int queue_trypush(ogs_queue_t *queue, void *data)
+{
+    queue_cell_t *cell = NULL;
+    uint64_t pos, seq;
+    int64_t diff;
+
+    pos = __atomic_load_n(&queue->in, __ATOMIC_RELAXED);
+    for ( ;; ) {
+        cell = &queue->cell[pos % queue->bounds];
+        seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        diff = (int64_t)(seq - pos);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&queue->in, &pos, pos + 1,
+                        1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break;
+        } else if (diff < 0) {
+            return OGS_RETRY; /* full */
+        } else {
+            pos = __atomic_load_n(&queue->in, __ATOMIC_RELAXED);
+        }
+    }
+
+    cell->data = data;
+    __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+
+    return OGS_OK;
+}
+
+static int queue_trypop(ogs_queue_t *queue, void **data)
+{
+    queue_cell_t *cell = NULL;
+    uint64_t pos, seq;
+    int64_t diff;
+
+    pos = __atomic_load_n(&queue->out, __ATOMIC_RELAXED);
+    for ( ;; ) {
+        cell = &queue->cell[pos % queue->bounds];
+        seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        diff = (int64_t)(seq - (pos + 1));
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&queue->out, &pos, pos + 1,
+                        1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break;
+        } else if (diff < 0) {
+            return OGS_RETRY; /* empty */
+        } else {
+            pos = __atomic_load_n(&queue->out, __ATOMIC_RELAXED);
+        }
+    }
+
+    *data = cell->data;
+    __atomic_store_n(&cell->seq, pos + queue->bounds, __ATOMIC_RELEASE);
+
+    return OGS_OK;
+}
+
+/*
+ * Pairs with the fence in queue_wait(). Either the waiter sees the cell
+ * we have just released, or we see the waiter and signal it under the
+ * mutex it holds until it sleeps.
+ */
+static void queue_wakeup(ogs_queue_t *queue,
+        unsigned int *waiters, ogs_thread_cond_t *cond)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(waiters, __ATOMIC_RELAXED) == 0)
+        return;
+
+    ogs_thread_mutex_lock(&queue->one_big_mutex);
+    ogs_trace("signal");
+    ogs_thread_cond_signal(cond);
+    ogs_thread_mutex_unlock(&queue->one_big_mutex);
+}
+
+static int queue_wait(ogs_queue_t *queue, bool push, void **data,
+        ogs_time_t timeout)
+{
+    unsigned int *waiters = NULL;
+    ogs_thread_cond_t *cond = NULL;
+    ogs_time_t deadline = 0, remain;
+    unsigned int generation;
     int rv;
 
-    if (queue->terminated) {
-        return OGS_DONE; /* no more elements ever again */
+    if (push) {
+        waiters = &queue->full_waiters;
+        cond = &queue->not_full;
+    } else {
+        waiters = &queue->empty_waiters;
+        cond = &queue->not_empty;
     }
 
+    if (timeout > 0)
+        deadline = ogs_get_monotonic_time() + timeout;
+
     ogs_thread_mutex_lock(&queue->one_big_mutex);
+    __atomic_add_fetch(waiters, 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    /* Both are changed only with one_big_mutex held */
+    generation = queue->interrupt_generation;
 
-    if (ogs_queue_full(queue)) {
-        if (!timeout) {
-            ogs_thread_mutex_unlock(&queue->one_big_mutex);
-            return OGS_RETRY;
+    for ( ;; ) {
+        if (queue_terminated(queue)) {
+            rv = OGS_DONE; /* no more elements ever again */
+            break;
         }
-        if (!queue->terminated) {
-            queue->full_waiters++;
-            if (timeout > 0) {
-                rv = ogs_thread_cond_timedwait(&queue->not_full,
-                                               &queue->one_big_mutex,
-                                               timeout);
-            }
-            else {
-                rv = ogs_thread_cond_wait(&queue->not_full,
-                                          &queue->one_big_mutex);
-            }
-            queue->full_waiters--;
-            if (rv != OGS_OK) {
-                ogs_thread_mutex_unlock(&queue->one_big_mutex);
-                return rv;
-            }
+
+        if (queue->interrupt_generation != generation) {
+            rv = OGS_ERROR; /* woken up by ogs_queue_interrupt_all() */
+            break;
         }
-        /* If we wake up and it's still empty, then we were interrupted */
-        if (ogs_queue_full(queue)) {
-            ogs_warn("queue full (intr)");
-            ogs_thread_mutex_unlock(&queue->one_big_mutex);
-            if (queue->terminated) {
-                return OGS_DONE; /* no more elements ever again */
-            }
-            else {
-                return OGS_ERROR;
+
+        rv = push ? queue_trypush(queue, *data) : queue_trypop(queue, data);
+        if (rv == OGS_OK)
+            break;
+
+        if (timeout > 0) {
+            remain = deadline - ogs_get_monotonic_time();
+            if (remain <= 0) {
+                rv = OGS_TIMEUP;
+                break;
             }
+            rv = ogs_thread_cond_timedwait(
+                    cond, &queue->one_big_mutex, remain);
+        } else {
+            rv = ogs_thread_cond_wait(cond, &queue->one_big_mutex);
         }
+        if (rv == OGS_ERROR)
+            break;
     }
 
-    queue->data[queue->in] = data;
-    queue->in++;
-    if (queue->in >= queue->bounds)
-        queue->in -= queue->bounds;
-    queue->nelts++;
+    __atomic_sub_fetch(waiters, 1, __ATOMIC_RELAXED);
+    ogs_thread_mutex_unlock(&queue->one_big_mutex);
+
+    return rv;
+}
+
+static int queue_push(ogs_queue_t *queue, void *data, ogs_time_t timeout)
+{
+    int rv;
 
-    if (queue->empty_waiters) {
-        ogs_trace("signal !empty");
-        ogs_thread_cond_signal(&queue->not_empty);
+    if (queue_terminated(queue)) {
+        return OGS_DONE; /* no more elements ever again */
     }
 
-    ogs_thread_mutex_unlock(&queue->one_big_mutex);
-    return OGS_OK;
+    rv = queue_trypush(queue, data);
+    if (rv == OGS_RETRY && timeout)
+        rv = queue_wait(queue, true, &data, timeout);
+
+    if (rv == OGS_OK)
+        queue_wakeup(queue, &queue->empty_waiters, &queue->not_empty);
+
+    return rv;
 }
 
 int ogs_queue_push(ogs_queue_t *queue, void *data)
@@ -191,10 +306,11 @@ int ogs_queue_timedpush(ogs_queue_t *queue, void *data, ogs_time_t timeout)
 }
 
 /**
- * not thread safe
+ * approximate while other threads push or pop
  */
 unsigned int ogs_queue_size(ogs_queue_t *queue) {
-    return queue->nelts;
+    return __atomic_load_n(&queue->in, __ATOMIC_RELAXED) -
+        __atomic_load_n(&queue->out, __ATOMIC_RELAXED);
 }
 
 /**
@@ -208,60 +324,18 @@ static int queue_pop(ogs_queue_t *queue, void **data, ogs_time_t timeout)
 {
     int rv;
 
-    if (queue->terminated) {
+    if (queue_terminated(queue)) {
         return OGS_DONE; /* no more elements ever again */
     }
 
-    ogs_thread_mutex_lock(&queue->one_big_mutex);
-
-    /* Keep waiting until we wake up and find that the queue is not empty. */
-    if (ogs_queue_empty(queue)) {
-        if (!timeout) {
-            ogs_thread_mutex_unlock(&queue->one_big_mutex);
-            return OGS_RETRY;
-        }
-        if (!queue->terminated) {
-            queue->empty_waiters++;
-            if (timeout > 0) {
-                rv = ogs_thread_cond_timedwait(&queue->not_empty,
-                                               &queue->one_big_mutex,
-                                               timeout);
-            }
-            else {
-                rv = ogs_thread_cond_wait(&queue->not_empty,
-                                          &queue->one_big_mutex);
-            }
-            queue->empty_waiters--;
-            if (rv != OGS_OK) {
-                ogs_thread_mutex_unlock(&queue->one_big_mutex);
-                return rv;
-            }
-        }
-        /* If we wake up and it's still empty, then we were interrupted */
-        if (ogs_queue_empty(queue)) {
-            ogs_warn("queue empty (intr)");
-            ogs_thread_mutex_unlock(&queue->one_big_mutex);
-            if (queue->terminated) {
-                return OGS_DONE; /* no more elements ever again */
-            } else {
-                return OGS_ERROR;
-            }
-        }
-    } 
-
-    *data = queue->data[queue->out];
-    queue->nelts--;
+    rv = queue_trypop(queue, data);
+    if (rv == OGS_RETRY && timeout)
+        rv = queue_wait(queue, false, data, timeout);
 
-    queue->out++;
-    if (queue->out >= queue->bounds)
-        queue->out -= queue->bounds;
-    if (queue->full_waiters) {
-        ogs_trace("signal !full");
-        ogs_thread_cond_signal(&queue->not_full);
-    }
+    if (rv == OGS_OK)
+        queue_wakeup(queue, &queue->full_waiters, &queue->not_full);
 
-    ogs_thread_mutex_unlock(&queue->one_big_mutex);
-    return OGS_OK;
+    return rv;
 }
 
 int ogs_queue_pop(ogs_queue_t *queue, void **data)
@@ -279,11 +353,43 @@ int ogs_queue_timedpop(ogs_queue_t *queue, void **data, ogs_time_t timeout)
     return queue_pop(queue, data, timeout);
 }
 
+/**
+ * Retrieves up to 'max' items without blocking. The number of items
+ * is placed into 'num'. Returns OGS_RETRY if the queue is empty.
+ */
+int ogs_queue_trypop_bulk(ogs_queue_t *queue,
+        void **data, unsigned int max, unsigned int *num)
+{
+    unsigned int i;
+
+    ogs_assert(data);
+    ogs_assert(num);
+
+    *num = 0;
+
+    if (queue_terminated(queue)) {
+        return OGS_DONE; /* no more elements ever again */
+    }
+
+    for (i = 0; i < max; i++)
+        if (queue_trypop(queue, &data[i]) != OGS_OK)
+            break;
+
+    if (i == 0)
+        return OGS_RETRY;
+
+    *num = i;
+    queue_wakeup(queue, &queue->full_waiters, &queue->not_full);
+
+    return OGS_OK;
+}
+
 int ogs_queue_interrupt_all(ogs_queue_t *queue)
 {
     ogs_debug("interrupt all");
     ogs_thread_mutex_lock(&queue->one_big_mutex);
 
+    queue->interrupt_generation++;
     ogs_thread_cond_broadcast(&queue->not_empty);
     ogs_thread_cond_broadcast(&queue->not_full);
 
@@ -300,9 +406,8 @@ int ogs_queue_term(ogs_queue_t *queue)
      * we could end up setting it and waking everybody up just after a 
      * would-be popper checks it but right before they block
      */
-    queue->terminated = 1;
+    __atomic_store_n(&queue->terminated, 1, __ATOMIC_RELEASE);
     ogs_thread_mutex_unlock(&queue->one_big_mutex);
 
     return ogs_queue_interrupt_all(queue);
 }
-
@@ -57,6 +57,9 @@ int ogs_queue_trypop(ogs_queue_t *queue, void **data);
 int ogs_queue_timedpush(ogs_queue_t *queue, void *data, ogs_time_t timeout);
 int ogs_queue_timedpop(ogs_queue_t *queue, void **data, ogs_time_t timeout);
 
+int ogs_queue_trypop_bulk(ogs_queue_t *queue,
+        void **data, unsigned int max, unsigned int *num);
+
 unsigned int ogs_queue_size(ogs_queue_t *queue);
 
 int ogs_queue_interrupt_all(ogs_queue_t *queue);
@@ -69,6 +69,35 @@ static ogs_inline int ogs_thread_cond_timedwait(
 #define ogs_thread_cond_destroy (void)pthread_cond_destroy
 #define ogs_thread_id_t pthread_t
 #define ogs_thread_join(_n) pthread_join((_n), NULL)
+#define ogs_thread_rwlock_t pthread_rwlock_t
+static ogs_inline void ogs_thread_rwlock_init(pthread_rwlock_t *rwlock)
+{
+#if defined(__GLIBC__)
+    /* Do not let a steady stream of readers starve the writer */
+    pthread_rwlockattr_t attr;
+
+    pthread_rwlockattr_init(&attr);
+    pthread_rwlockattr_setkind_np(&attr,
+            PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+    (void)pthread_rwlock_init(rwlock, &attr);
+    pthread_rwlockattr_destroy(&attr);
+#else
+    (void)pthread_rwlock_init(rwlock, NULL);
+#endif
+}
+#define ogs_thread_rwlock_rdlock (void)pthread_rwlock_rdlock
+#define ogs_thread_rwlock_rdunlock (void)pthread_rwlock_unlock
+#define ogs_thread_rwlock_wrlock (void)pthread_rwlock_wrlock
+#define ogs_thread_rwlock_wrunlock (void)pthread_rwlock_unlock
+#define ogs_thread_rwlock_destroy (void)pthread_rwlock_destroy
+#define ogs_thread_key_t pthread_key_t
+static ogs_inline int ogs_thread_key_create(
+        pthread_key_t *key, void (*destructor)(void *))
+{
+    return pthread_key_create(key, destructor) == 0 ? OGS_OK : OGS_ERROR;
+}
+#define ogs_thread_key_delete (void)pthread_key_delete
+#define ogs_thread_key_set (void)pthread_setspecific
 #else
 #define ogs_thread_mutex_t CRITICAL_SECTION
 #define ogs_thread_mutex_init InitializeCriticalSection
@@ -103,6 +132,23 @@ static ogs_inline int ogs_thread_cond_destroy(ogs_thread_cond_t *_ignored)
 {
    return 0;
 }
+#define ogs_thread_rwlock_t SRWLOCK
+#define ogs_thread_rwlock_init InitializeSRWLock
+#define ogs_thread_rwlock_rdlock AcquireSRWLockShared
+#define ogs_thread_rwlock_rdunlock ReleaseSRWLockShared
+#define ogs_thread_rwlock_wrlock AcquireSRWLockExclusive
+#define ogs_thread_rwlock_wrunlock ReleaseSRWLockExclusive
+#define ogs_thread_rwlock_destroy(_n) (void)(_n)
+/* Fiber local storage calls the destructor when the thread exits */
+#define ogs_thread_key_t DWORD
+static ogs_inline int ogs_thread_key_create(
+        DWORD *key, void (*destructor)(void *))
+{
+    *key = FlsAlloc((PFLS_CALLBACK_FUNCTION)destructor);
+    return *key == FLS_OUT_OF_INDEXES ? OGS_ERROR : OGS_OK;
+}
+#define ogs_thread_key_delete (void)FlsFree
+#define ogs_thread_key_set (void)FlsSetValue
 #endif
 
 typedef struct ogs_thread_s ogs_thread_t;
@@ -22,9 +22,41 @@
 #undef OGS_LOG_DOMAIN
 #define OGS_LOG_DOMAIN __ogs_event_domain
 
+/*
+ * Hierarchical timing wheel
+ *
+ * Level 0 has one slot per tick for the next 256 ticks. Each upper level
+ * has 64 slots covering 64 times the range of the level below. When
+ * level 0 wraps around, the next slot of the upper level is cascaded
+ * down. Timers further than 2^32 ticks away are clamped to the last level.
+ */
+#define WHEEL_ROOT_BITS     8
+#define WHEEL_NODE_BITS     6
+#define WHEEL_ROOT_SIZE     (1 << WHEEL_ROOT_BITS)
+#define WHEEL_NODE_SIZE     (1 << WHEEL_NODE_BITS)
+#define WHEEL_ROOT_MASK     (WHEEL_ROOT_SIZE - 1)
+#define WHEEL_NODE_MASK     (WHEEL_NODE_SIZE - 1)
+#define WHEEL_NUM_OF_NODE   4
+
+#define WHEEL_SHIFT(__lEVEL) (WHEEL_ROOT_BITS + (__lEVEL) * WHEEL_NODE_BITS)
+#define WHEEL_INDEX(__wHEEL, __lEVEL) \
+    (((__wHEEL)->current >> WHEEL_SHIFT(__lEVEL)) & WHEEL_NODE_MASK)
+
+typedef struct ogs_timer_wheel_s {
+    ogs_time_t tick;
+    ogs_time_t base;
+    uint64_t current; /* Next tick to be expired */
+    unsigned int count;
+
+    ogs_list_t root[WHEEL_ROOT_SIZE];
+    ogs_list_t node[WHEEL_NUM_OF_NODE][WHEEL_NODE_SIZE];
+} ogs_timer_wheel_t;
+
 typedef struct ogs_timer_mgr_s {
     OGS_POOL(pool, ogs_timer_t);
     ogs_rbtree_t tree;
+
+    ogs_timer_wheel_t *wheel;
 } ogs_timer_mgr_t;
 
 static void add_timer_node(
@@ -52,6 +84,165 @@ static void add_timer_node(
     ogs_rbtree_insert_color(tree, timer);
 }
 
+static void wheel_link(ogs_timer_wheel_t *wheel, ogs_timer_t *timer)
+{
+    uint64_t expires, delta;
+    ogs_list_t *slot = NULL;
+
+    ogs_assert(wheel);
+    ogs_assert(timer);
+
+    expires = timer->expires;
+    if (expires < wheel->current)
+        expires = wheel->current;
+
+    delta = expires - wheel->current;
+    if (delta < WHEEL_ROOT_SIZE) {
+        slot = &wheel->root[expires & WHEEL_ROOT_MASK];
+    } else if (delta < (1ULL << WHEEL_SHIFT(1))) {
+        slot = &wheel->node[0][(expires >> WHEEL_SHIFT(0)) & WHEEL_NODE_MASK];
+    } else if (delta < (1ULL << WHEEL_SHIFT(2))) {
+        slot = &wheel->node[1][(expires >> WHEEL_SHIFT(1)) & WHEEL_NODE_MASK];
+    } else if (delta < (1ULL << WHEEL_SHIFT(3))) {
+        slot = &wheel->node[2][(expires >> WHEEL_SHIFT(2)) & WHEEL_NODE_MASK];
+    } else {
+        if (delta >= (1ULL << WHEEL_SHIFT(4)))
+            expires = wheel->current + (1ULL << WHEEL_SHIFT(4)) - 1;
+        slot = &wheel->node[3][(expires >> WHEEL_SHIFT(3)) & WHEEL_NODE_MASK];
+    }
+
+    timer->slot = slot;
+    ogs_list_add(slot, &timer->lnode);
+}
+
+static void wheel_unlink(ogs_timer_t *timer)
+{
+    ogs_assert(timer);
+    ogs_assert(timer->slot);
+
+    ogs_list_remove(timer->slot, &timer->lnode);
+    timer->slot = NULL;
+}
+
+static void add_timer_wheel(
+        ogs_timer_wheel_t *wheel, ogs_timer_t *timer, ogs_time_t duration)
+{
+    ogs_assert(wheel);
+    ogs_assert(timer);
+
+    timer->timeout = ogs_get_monotonic_time() + duration;
+
+    /* Round up so that the timer never fires before its timeout */
+    if (timer->timeout > wheel->base)
+        timer->expires =
+            (timer->timeout - wheel->base + wheel->tick - 1) / wheel->tick;
+    else
+        timer->expires = 0;
+
+    wheel_link(wheel, timer);
+    wheel->count++;
+}
+
+static void delete_timer_wheel(ogs_timer_wheel_t *wheel, ogs_timer_t *timer)
+{
+    ogs_assert(wheel);
+    ogs_assert(timer);
+
+    wheel_unlink(timer);
+    ogs_assert(wheel->count);
+    wheel->count--;
+}
+
+/* Re-distribute the timers in the slot to the lower levels */
+static unsigned int wheel_cascade(
+        ogs_timer_wheel_t *wheel, int level, unsigned int index)
+{
+    ogs_list_t *slot = NULL;
+    ogs_lnode_t *lnode = NULL;
+
+    ogs_assert(wheel);
+
+    slot = &wheel->node[level][index];
+    while ((lnode = ogs_list_first(slot)) != NULL) {
+        ogs_timer_t *timer = ogs_list_entry(lnode, ogs_timer_t, lnode);
+        wheel_unlink(timer);
+        wheel_link(wheel, timer);
+    }
+
+    return index;
+}
+
+/* Move all timers due at `now` from the wheel to the expired list */
+static void wheel_collect(
+        ogs_timer_wheel_t *wheel, uint64_t now, ogs_list_t *expired)
+{
+    ogs_assert(wheel);
+    ogs_assert(expired);
+
+    if (wheel->count == 0) {
+        /* Nothing to cascade, jump to the current tick */
+        if (wheel->current <= now)
+            wheel->current = now + 1;
+        return;
+    }
+
+    while (wheel->current <= now) {
+        unsigned int index = wheel->current & WHEEL_ROOT_MASK;
+        ogs_list_t *slot = &wheel->root[index];
+        ogs_lnode_t *lnode = NULL;
+
+        if (!index &&
+            !wheel_cascade(wheel, 0, WHEEL_INDEX(wheel, 0)) &&
+            !wheel_cascade(wheel, 1, WHEEL_INDEX(wheel, 1)) &&
+            !wheel_cascade(wheel, 2, WHEEL_INDEX(wheel, 2)))
+            wheel_cascade(wheel, 3, WHEEL_INDEX(wheel, 3));
+
+        wheel->current++;
+
+        while ((lnode = ogs_list_first(slot)) != NULL) {
+            ogs_timer_t *timer = ogs_list_entry(lnode, ogs_timer_t, lnode);
+            wheel_unlink(timer);
+            timer->slot = expired;
+            ogs_list_add(expired, &timer->lnode);
+        }
+    }
+}
+
+static ogs_time_t wheel_next(ogs_timer_wheel_t *wheel)
+{
+    uint64_t next;
+    ogs_time_t current, timeout;
+    int i;
+
+    ogs_assert(wheel);
+
+    if (wheel->count == 0)
+        return OGS_INFINITE_TIME;
+
+    /*
+     * Look for the first pending slot in level 0 until it wraps around.
+     * If there is none, wake up at the next cascade. This may be
+     * earlier than the next timer, but never later.
+     */
+    next = (wheel->current | WHEEL_ROOT_MASK) + 1;
+    for (i = 0; i < WHEEL_ROOT_SIZE; i++) {
+        uint64_t tick = wheel->current + i;
+        if (ogs_list_first(&wheel->root[tick & WHEEL_ROOT_MASK])) {
+            next = tick;
+            break;
+        }
+        if (((tick + 1) & WHEEL_ROOT_MASK) == 0)
+            break;
+    }
+
+    current = ogs_get_monotonic_time();
+    timeout = wheel->base + (ogs_time_t)next * wheel->tick;
+    if (timeout > current)
+        return timeout - current;
+
+    return OGS_NO_WAIT_TIME;
+}
+
 ogs_timer_mgr_t *ogs_timer_mgr_create(unsigned int capacity)
 {
     ogs_timer_mgr_t *manager = ogs_calloc(1, sizeof *manager);
@@ -65,10 +256,39 @@ ogs_timer_mgr_t *ogs_timer_mgr_create(unsigned int capacity)
     return manager;
 }
 
+ogs_timer_mgr_t *ogs_timer_mgr_create_wheel(
+        unsigned int capacity, ogs_time_t tick)
+{
+    ogs_timer_mgr_t *manager = NULL;
+
+    ogs_assert(tick > 0);
+
+    manager = ogs_timer_mgr_create(capacity);
+    if (!manager) {
+        ogs_error("ogs_timer_mgr_create() failed");
+        return NULL;
+    }
+
+    manager->wheel = ogs_calloc(1, sizeof *manager->wheel);
+    if (!manager->wheel) {
+        ogs_error("ogs_calloc() failed");
+        ogs_timer_mgr_destroy(manager);
+        return NULL;
+    }
+
+    manager->wheel->tick = tick;
+    manager->wheel->base = ogs_get_monotonic_time();
+
+    return manager;
+}
+
 void ogs_timer_mgr_destroy(ogs_timer_mgr_t *manager)
 {
     ogs_assert(manager);
 
+    if (manager->wheel)
+        ogs_free(manager->wheel);
+
     ogs_pool_final(&manager->pool);
     ogs_free(manager);
 }
@@ -132,6 +352,15 @@ void ogs_timer_start_debug(
         ogs_assert_if_reached();
     }
 
+    if (manager->wheel) {
+        if (timer->running == true)
+            delete_timer_wheel(manager->wheel, timer);
+
+        timer->running = true;
+        add_timer_wheel(manager->wheel, timer, duration);
+        return;
+    }
+
     if (timer->running == true)
         ogs_rbtree_delete(&manager->tree, timer);
 
@@ -156,7 +385,11 @@ void ogs_timer_stop_debug(ogs_timer_t *timer, const char *file_line)
         return;
 
     timer->running = false;
-    ogs_rbtree_delete(&manager->tree, timer);
+
+    if (manager->wheel)
+        delete_timer_wheel(manager->wheel, timer);
+    else
+        ogs_rbtree_delete(&manager->tree, timer);
 }
 
 bool ogs_timer_running(ogs_timer_t *timer)
@@ -171,6 +404,9 @@ ogs_time_t ogs_timer_mgr_next(ogs_timer_mgr_t *manager)
     ogs_rbnode_t *rbnode = NULL;
     ogs_assert(manager);
 
+    if (manager->wheel)
+        return wheel_next(manager->wheel);
+
     current = ogs_get_monotonic_time();
     rbnode = ogs_rbtree_first(&manager->tree);
     if (rbnode) {
@@ -197,6 +433,27 @@ void ogs_timer_mgr_expire(ogs_timer_mgr_t *manager)
 
     current = ogs_get_monotonic_time();
 
+    if (manager->wheel) {
+        ogs_timer_wheel_t *wheel = manager->wheel;
+
+        if (current < wheel->base)
+            return;
+
+        wheel_collect(wheel, (current - wheel->base) / wheel->tick, &list);
+
+        /*
+         * The callback may stop or restart any timer in the list,
+         * which unlinks it from here. So always take the first one.
+         */
+        while ((lnode = ogs_list_first(&list)) != NULL) {
+            this = ogs_rb_entry(lnode, ogs_timer_t, lnode);
+            ogs_timer_stop(this);
+            if (this->cb)
+                this->cb(this->data);
+        }
+        return;
+    }
+
     ogs_rbtree_for_each(&manager->tree, rbnode) {
         this = ogs_rb_entry(rbnode, ogs_timer_t, rbnode);
 
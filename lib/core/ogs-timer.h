@@ -33,6 +33,10 @@ typedef struct ogs_timer_s {
     ogs_rbnode_t rbnode;
     ogs_lnode_t lnode;
 
+    /* Timing wheel slot that lnode is linked into */
+    ogs_list_t *slot;
+    uint64_t expires;
+
     void (*cb)(void*);
     void *data;
 
@@ -42,6 +46,12 @@ typedef struct ogs_timer_s {
 } ogs_timer_t;
 
 ogs_timer_mgr_t *ogs_timer_mgr_create(unsigned int capacity);
+/*
+ * Hierarchical timing wheel instead of the red-black tree.
+ * Start/Stop is O(1), but a timer may fire up to one tick late.
+ */
+ogs_timer_mgr_t *ogs_timer_mgr_create_wheel(
+        unsigned int capacity, ogs_time_t tick);
 void ogs_timer_mgr_destroy(ogs_timer_mgr_t *manager);
 
 ogs_timer_t *ogs_timer_add(
@@ -17,6 +17,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include "core-config-private.h"
+
 #include "ogs-core.h"
 
 #undef OGS_LOG_DOMAIN
@@ -44,6 +46,13 @@ ogs_sock_t *ogs_udp_server(
             addr = addr->next;
             continue;
         }
+        if (option.so_reuseport) {
+            if (ogs_reuseport(new->fd, 1) != OGS_OK) {
+                ogs_sock_destroy(new);
+                addr = addr->next;
+                continue;
+            }
+        }
         if (ogs_sock_bind(new, addr) != OGS_OK) {
             ogs_sock_destroy(new);
             addr = addr->next;
@@ -143,3 +152,126 @@ int ogs_udp_connect(ogs_sock_t *sock, ogs_sockaddr_t *sa_list)
 
     return OGS_OK;
 }
+
+/*
+ * Receive up to 'vlen' datagrams with a single system call.
+ *
+ * Each pkbuf must be prepared by the caller with ogs_pkbuf_put(), so that
+ * pkbuf->len is the room available for one datagram. On return, the first
+ * N pkbufs are trimmed to the received size and from[0..N-1] are filled.
+ *
+ * Returns the number of datagrams received, or -1 on failure.
+ */
+int ogs_recvmmsg(ogs_socket_t fd, ogs_pkbuf_t **pkbuf,
+        ogs_sockaddr_t *from, int vlen, int flags)
+{
+#if HAVE_RECVMMSG
+    struct mmsghdr msg[OGS_MAX_NUM_OF_MMSG];
+    struct iovec iov[OGS_MAX_NUM_OF_MMSG];
+    int i, n;
+
+    ogs_assert(fd != INVALID_SOCKET);
+    ogs_assert(pkbuf);
+    ogs_assert(from);
+    ogs_assert(vlen > 0 && vlen <= OGS_MAX_NUM_OF_MMSG);
+
+    memset(msg, 0, sizeof(msg[0]) * vlen);
+    for (i = 0; i < vlen; i++) {
+        ogs_assert(pkbuf[i]);
+
+        iov[i].iov_base = pkbuf[i]->data;
+        iov[i].iov_len = pkbuf[i]->len;
+
+        memset(&from[i], 0, sizeof from[i]);
+        msg[i].msg_hdr.msg_name = &from[i].sa;
+        msg[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+        msg[i].msg_hdr.msg_iov = &iov[i];
+        msg[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    n = recvmmsg(fd, msg, vlen, flags, NULL);
+    if (n <= 0)
+        return -1;
+
+    for (i = 0; i < n; i++)
+        ogs_pkbuf_trim(pkbuf[i], msg[i].msg_len);
+
+    return n;
+#else
+    ssize_t size;
+    int n;
+
+    ogs_assert(fd != INVALID_SOCKET);
+    ogs_assert(pkbuf);
+    ogs_assert(from);
+    ogs_assert(vlen > 0 && vlen <= OGS_MAX_NUM_OF_MMSG);
+
+    for (n = 0; n < vlen; n++) {
+        ogs_assert(pkbuf[n]);
+
+        size = ogs_recvfrom(fd, pkbuf[n]->data, pkbuf[n]->len,
+                n ? (flags | MSG_DONTWAIT) : flags, &from[n]);
+        if (size <= 0)
+            break;
+
+        ogs_pkbuf_trim(pkbuf[n], size);
+    }
+
+    return n ? n : -1;
+#endif
+}
+
+/*
+ * Send 'vlen' datagrams with a single system call.
+ * to[i] is the destination of pkbuf[i].
+ *
+ * Returns the number of datagrams sent, or -1 on failure.
+ */
+int ogs_sendmmsg(ogs_socket_t fd, ogs_pkbuf_t **pkbuf,
+        ogs_sockaddr_t **to, int vlen, int flags)
+{
+#if HAVE_SENDMMSG
+    struct mmsghdr msg[OGS_MAX_NUM_OF_MMSG];
+    struct iovec iov[OGS_MAX_NUM_OF_MMSG];
+    int i;
+
+    ogs_assert(fd != INVALID_SOCKET);
+    ogs_assert(pkbuf);
+    ogs_assert(to);
+    ogs_assert(vlen > 0 && vlen <= OGS_MAX_NUM_OF_MMSG);
+
+    memset(msg, 0, sizeof(msg[0]) * vlen);
+    for (i = 0; i < vlen; i++) {
+        ogs_assert(pkbuf[i]);
+        ogs_assert(to[i]);
+
+        iov[i].iov_base = pkbuf[i]->data;
+        iov[i].iov_len = pkbuf[i]->len;
+
+        msg[i].msg_hdr.msg_name = &to[i]->sa;
+        msg[i].msg_hdr.msg_namelen = ogs_sockaddr_len(to[i]);
+        msg[i].msg_hdr.msg_iov = &iov[i];
+        msg[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    return sendmmsg(fd, msg, vlen, flags);
+#else
+    ssize_t sent;
+    int n;
+
+    ogs_assert(fd != INVALID_SOCKET);
+    ogs_assert(pkbuf);
+    ogs_assert(to);
+    ogs_assert(vlen > 0 && vlen <= OGS_MAX_NUM_OF_MMSG);
+
+    for (n = 0; n < vlen; n++) {
+        ogs_assert(pkbuf[n]);
+
+        sent = ogs_sendto(fd, pkbuf[n]->data, pkbuf[n]->len, flags, to[n]);
+        if (sent < 0 || sent != pkbuf[n]->len)
+            break;
+    }
+
+    return n ? n : -1;
+#endif
+}
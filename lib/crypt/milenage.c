@@ -56,15 +56,18 @@ int milenage_f1(const uint8_t *opc, const uint8_t *k,
     const uint8_t *amf, uint8_t *mac_a, uint8_t *mac_s)
 {
 	uint8_t tmp1[16], tmp2[16], tmp3[16];
+	uint32_t rk[OGS_AES_RKLENGTH(128)];
+	int nrounds;
 	int i;
 #if 1 /* R1-R5 issues1153 */
     uint8_t r1 = 64;
 #endif
 
+	nrounds = ogs_aes_setup_enc(rk, k, 128);
+
 	for (i = 0; i < 16; i++)
 		tmp1[i] = _rand[i] ^ opc[i];
-	if (aes_128_encrypt_block(k, tmp1, tmp1))
-		return -1;
+	ogs_aes_encrypt(rk, nrounds, tmp1, tmp1);
 
 	/* tmp2 = IN1 = SQN || AMF || SQN || AMF */
 	os_memcpy(tmp2, sqn, 6);
@@ -86,8 +89,7 @@ int milenage_f1(const uint8_t *opc, const uint8_t *k,
 	/* XOR with c1 (= ..00, i.e., NOP) */
 
 	/* f1 || f1* = E_K(tmp3) XOR OP_c */
-	if (aes_128_encrypt_block(k, tmp3, tmp1))
-		return -1;
+	ogs_aes_encrypt(rk, nrounds, tmp3, tmp1);
 	for (i = 0; i < 16; i++)
 		tmp1[i] ^= opc[i];
 	if (mac_a)
@@ -115,6 +117,8 @@ int milenage_f2345(const uint8_t *opc, const uint8_t *k,
     uint8_t *ik, uint8_t *ak, uint8_t *akstar)
 {
 	uint8_t tmp1[16], tmp2[16], tmp3[16];
+	uint32_t rk[OGS_AES_RKLENGTH(128)];
+	int nrounds;
 	int i;
 
 #if 1 /* R1-R5 issues1153 */
@@ -124,11 +128,12 @@ int milenage_f2345(const uint8_t *opc, const uint8_t *k,
     uint8_t r5 = 96;
 #endif
 
+	nrounds = ogs_aes_setup_enc(rk, k, 128);
+
 	/* tmp2 = TEMP = E_K(RAND XOR OP_C) */
 	for (i = 0; i < 16; i++)
 		tmp1[i] = _rand[i] ^ opc[i];
-	if (aes_128_encrypt_block(k, tmp1, tmp2))
-		return -1;
+	ogs_aes_encrypt(rk, nrounds, tmp1, tmp2);
 
 	/* OUT2 = E_K(rot(TEMP XOR OP_C, r2) XOR c2) XOR OP_C */
 	/* OUT3 = E_K(rot(TEMP XOR OP_C, r3) XOR c3) XOR OP_C */
@@ -145,8 +150,7 @@ int milenage_f2345(const uint8_t *opc, const uint8_t *k,
 #endif
 	tmp1[15] ^= 1; /* XOR c2 (= ..01) */
 	/* f5 || f2 = E_K(tmp1) XOR OP_c */
-	if (aes_128_encrypt_block(k, tmp1, tmp3))
-		return -1;
+	ogs_aes_encrypt(rk, nrounds, tmp1, tmp3);
 	for (i = 0; i < 16; i++)
 		tmp3[i] ^= opc[i];
 	if (res)
@@ -164,8 +168,7 @@ int milenage_f2345(const uint8_t *opc, const uint8_t *k,
         ShiftBits(r3, tmp1, tmp2, opc);
 #endif
 		tmp1[15] ^= 2; /* XOR c3 (= ..02) */
-		if (aes_128_encrypt_block(k, tmp1, ck))
-			return -1;
+		ogs_aes_encrypt(rk, nrounds, tmp1, ck);
 		for (i = 0; i < 16; i++)
 			ck[i] ^= opc[i];
 	}
@@ -180,8 +183,7 @@ int milenage_f2345(const uint8_t *opc, const uint8_t *k,
         ShiftBits(r4, tmp1, tmp2, opc);
 #endif
 		tmp1[15] ^= 4; /* XOR c4 (= ..04) */
-		if (aes_128_encrypt_block(k, tmp1, ik))
-			return -1;
+		ogs_aes_encrypt(rk, nrounds, tmp1, ik);
 		for (i = 0; i < 16; i++)
 			ik[i] ^= opc[i];
 	}
@@ -196,8 +198,7 @@ int milenage_f2345(const uint8_t *opc, const uint8_t *k,
         ShiftBits(r5, tmp1, tmp2, opc);
 #endif
 		tmp1[15] ^= 8; /* XOR c5 (= ..08) */
-		if (aes_128_encrypt_block(k, tmp1, tmp1))
-			return -1;
+		ogs_aes_encrypt(rk, nrounds, tmp1, tmp1);
 		for (i = 0; i < 6; i++)
 			akstar[i] = tmp1[i] ^ opc[i];
 	}
@@ -224,25 +225,112 @@ void milenage_generate(const uint8_t *opc, const uint8_t *amf,
     uint8_t *autn, uint8_t *ik, uint8_t *ck, uint8_t *ak, 
     uint8_t *res, size_t *res_len)
 {
-	int i;
-	uint8_t mac_a[8];
+	milenage_vector_t vector;
 
 	if (*res_len < 8) {
 		*res_len = 0;
 		return;
 	}
-	if (milenage_f1(opc, k, _rand, sqn, amf, mac_a, NULL) ||
-	    milenage_f2345(opc, k, _rand, res, ck, ik, ak, NULL)) {
-		*res_len = 0;
-		return;
-	}
+
+	vector.opc = opc;
+	vector.amf = amf;
+	vector.k = k;
+	vector.sqn = sqn;
+	vector._rand = _rand;
+	milenage_generate_vectors(&vector, 1);
+
 	*res_len = 8;
 
-	/* AUTN = (SQN ^ AK) || AMF || MAC */
-	for (i = 0; i < 6; i++)
-		autn[i] = sqn[i] ^ ak[i];
-	os_memcpy(autn + 6, amf, 2);
-	os_memcpy(autn + 8, mac_a, 8);
+	os_memcpy(autn, vector.autn, 16);
+	if (ik)
+		os_memcpy(ik, vector.ik, 16);
+	if (ck)
+		os_memcpy(ck, vector.ck, 16);
+	os_memcpy(ak, vector.ak, 6);
+	if (res)
+		os_memcpy(res, vector.res, 8);
+}
+
+/**
+ * milenage_generate_vectors - Generate AKA AUTN,IK,CK,AK,RES of num vectors
+ * @vector: Array of vectors with opc, amf, k, sqn and _rand filled
+ * @num: Number of vectors
+ *
+ * This is milenage_generate() of each vector, but all the AES blocks that
+ * do not depend on each other are encrypted with ogs_aes_encrypt_multi().
+ * Each vector needs TEMP = E_K(RAND XOR OP_C) first, and then OUT1-OUT4
+ * can be computed at the same time. The vectors can have different K.
+ */
+#define MILENAGE_BATCH 4
+void milenage_generate_vectors(milenage_vector_t *vector, int num)
+{
+	uint32_t rk[MILENAGE_BATCH][OGS_AES_RKLENGTH(128)];
+	const uint32_t *rks[MILENAGE_BATCH*4];
+	uint8_t in[MILENAGE_BATCH*4][16], out[MILENAGE_BATCH*4][16];
+	uint8_t temp[MILENAGE_BATCH][16];
+	uint8_t in1[16];
+	milenage_vector_t *v;
+	int nrounds = 0;
+	int base, n, i, j;
+
+	ogs_assert(vector);
+
+	for (base = 0; base < num; base += MILENAGE_BATCH) {
+		v = vector + base;
+		n = ogs_min(num - base, MILENAGE_BATCH);
+
+		/* TEMP = E_K(RAND XOR OP_C) */
+		for (i = 0; i < n; i++) {
+			if (i > 0 && v[i].k == v[i-1].k)
+				rks[i] = rks[i-1];
+			else {
+				nrounds = ogs_aes_setup_enc(rk[i], v[i].k, 128);
+				rks[i] = rk[i];
+			}
+			for (j = 0; j < 16; j++)
+				in[i][j] = v[i]._rand[j] ^ v[i].opc[j];
+		}
+		ogs_aes_encrypt_multi(rks, nrounds, in[0], temp[0], n);
+
+		/* OUT1 = E_K(TEMP XOR rot(IN1 XOR OP_C, r1) XOR c1) XOR OP_C
+		 * OUTx = E_K(rot(TEMP XOR OP_C, rx) XOR cx) XOR OP_C, x = 2,3,4 */
+		for (i = n-1; i >= 0; i--) {
+			os_memcpy(in1, v[i].sqn, 6);
+			os_memcpy(in1 + 6, v[i].amf, 2);
+			os_memcpy(in1 + 8, in1, 8);
+			ShiftBits(64, in[4*i], in1, v[i].opc);
+			for (j = 0; j < 16; j++)
+				in[4*i][j] ^= temp[i][j];
+
+			ShiftBits(0, in[4*i+1], temp[i], v[i].opc);
+			in[4*i+1][15] ^= 1;
+			ShiftBits(32, in[4*i+2], temp[i], v[i].opc);
+			in[4*i+2][15] ^= 2;
+			ShiftBits(64, in[4*i+3], temp[i], v[i].opc);
+			in[4*i+3][15] ^= 4;
+
+			for (j = 0; j < 4; j++)
+				rks[4*i+j] = rks[i];
+		}
+		ogs_aes_encrypt_multi(rks, nrounds, in[0], out[0], 4*n);
+
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < 16; j++) {
+				out[4*i][j] ^= v[i].opc[j];
+				out[4*i+1][j] ^= v[i].opc[j];
+				v[i].ck[j] = out[4*i+2][j] ^ v[i].opc[j];
+				v[i].ik[j] = out[4*i+3][j] ^ v[i].opc[j];
+			}
+			os_memcpy(v[i].res, out[4*i+1] + 8, 8); /* f2 */
+			os_memcpy(v[i].ak, out[4*i+1], 6); /* f5 */
+
+			/* AUTN = (SQN ^ AK) || AMF || MAC */
+			for (j = 0; j < 6; j++)
+				v[i].autn[j] = v[i].sqn[j] ^ v[i].ak[j];
+			os_memcpy(v[i].autn + 6, v[i].amf, 2);
+			os_memcpy(v[i].autn + 8, out[4*i], 8); /* f1 */
+		}
+	}
 }
 
 /**
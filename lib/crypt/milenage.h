@@ -17,10 +17,27 @@
 extern "C" {
 #endif
 
+typedef struct milenage_vector_s {
+    /* Input */
+    const uint8_t *opc;
+    const uint8_t *amf;
+    const uint8_t *k;
+    const uint8_t *sqn;
+    const uint8_t *_rand;
+
+    /* Output */
+    uint8_t autn[16];
+    uint8_t ik[16];
+    uint8_t ck[16];
+    uint8_t ak[6];
+    uint8_t res[8];
+} milenage_vector_t;
+
 void milenage_generate(const uint8_t *opc, const uint8_t *amf, 
     const uint8_t *k, const uint8_t *sqn, const uint8_t *_rand, 
     uint8_t *autn, uint8_t *ik, uint8_t *ck, uint8_t *ak,
     uint8_t *res, size_t *res_len);
+void milenage_generate_vectors(milenage_vector_t *vector, int num);
 int milenage_auts(const uint8_t *opc, const uint8_t *k, 
     const uint8_t *_rand, const uint8_t *auts, uint8_t *sqn);
 int gsm_milenage(const uint8_t *opc, const uint8_t *k, 
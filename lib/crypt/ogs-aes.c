@@ -27,6 +27,12 @@
 
 #include "ogs-crypt.h"
 
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <wmmintrin.h>
+#include <tmmintrin.h>
+#define OGS_AES_HAVE_AESNI 1
+#endif
+
 #define FULL_UNROLL
 
 static const uint32_t Te0[256] =
@@ -727,6 +733,103 @@ static const uint32_t rcon[] =
                          (ciphertext)[2] = (uint8_t)((st) >>  8); \
                          (ciphertext)[3] = (uint8_t)(st); }
 
+#if OGS_AES_HAVE_AESNI
+/*
+ * AES-NI backend
+ *
+ * The key schedule is kept in the format of the T-table code, so that
+ * rk from ogs_aes_setup_enc()/ogs_aes_setup_dec() works with both.
+ * Each 32-bit word of rk is the big-endian load of 4 key bytes,
+ * so it is byte-swapped into the AES-NI round key.
+ *
+ * ogs_aes_setup_dec() returns the key schedule of the equivalent inverse
+ * cipher (reversed, InvMixColumns applied), which is what AESDEC expects.
+ */
+static int aesni_supported(void)
+{
+    return __builtin_cpu_supports("aes") && __builtin_cpu_supports("ssse3");
+}
+
+#define AESNI_BSWAP32 \
+    _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3)
+
+/* The round keys are loaded as they are used, instead of being copied
+ * into a local array whose unused tail the compiler cannot reason about */
+__attribute__((target("aes,ssse3")))
+static inline __m128i aesni_round_key(const uint32_t *rk, int r)
+{
+    return _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i *)(rk + 4*r)), AESNI_BSWAP32);
+}
+
+__attribute__((target("aes,ssse3")))
+static void aesni_encrypt(const uint32_t *rk, int nrounds,
+        const uint8_t in[16], uint8_t out[16])
+{
+    __m128i x;
+    int r;
+
+    x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in),
+            aesni_round_key(rk, 0));
+    for (r = 1; r < nrounds; r++)
+        x = _mm_aesenc_si128(x, aesni_round_key(rk, r));
+    x = _mm_aesenclast_si128(x, aesni_round_key(rk, nrounds));
+
+    _mm_storeu_si128((__m128i *)out, x);
+}
+
+__attribute__((target("aes,ssse3")))
+static void aesni_decrypt(const uint32_t *rk, int nrounds,
+        const uint8_t in[16], uint8_t out[16])
+{
+    __m128i x;
+    int r;
+
+    x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in),
+            aesni_round_key(rk, 0));
+    for (r = 1; r < nrounds; r++)
+        x = _mm_aesdec_si128(x, aesni_round_key(rk, r));
+    x = _mm_aesdeclast_si128(x, aesni_round_key(rk, nrounds));
+
+    _mm_storeu_si128((__m128i *)out, x);
+}
+
+/* 4 blocks are interleaved to hide the latency of AESENC */
+__attribute__((target("aes,ssse3")))
+static void aesni_encrypt_x4(const uint32_t *const rk[4], int nrounds,
+        const uint8_t *in, uint8_t *out)
+{
+    __m128i bswap = AESNI_BSWAP32;
+    __m128i x0, x1, x2, x3;
+    int r;
+
+#define AESNI_KEY(__i, __r) _mm_shuffle_epi8( \
+        _mm_loadu_si128((const __m128i *)(rk[__i] + 4*(__r))), bswap)
+
+    x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + 0)), AESNI_KEY(0, 0));
+    x1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + 16)), AESNI_KEY(1, 0));
+    x2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + 32)), AESNI_KEY(2, 0));
+    x3 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + 48)), AESNI_KEY(3, 0));
+    for (r = 1; r < nrounds; r++) {
+        x0 = _mm_aesenc_si128(x0, AESNI_KEY(0, r));
+        x1 = _mm_aesenc_si128(x1, AESNI_KEY(1, r));
+        x2 = _mm_aesenc_si128(x2, AESNI_KEY(2, r));
+        x3 = _mm_aesenc_si128(x3, AESNI_KEY(3, r));
+    }
+    x0 = _mm_aesenclast_si128(x0, AESNI_KEY(0, nrounds));
+    x1 = _mm_aesenclast_si128(x1, AESNI_KEY(1, nrounds));
+    x2 = _mm_aesenclast_si128(x2, AESNI_KEY(2, nrounds));
+    x3 = _mm_aesenclast_si128(x3, AESNI_KEY(3, nrounds));
+
+#undef AESNI_KEY
+
+    _mm_storeu_si128((__m128i *)(out + 0), x0);
+    _mm_storeu_si128((__m128i *)(out + 16), x1);
+    _mm_storeu_si128((__m128i *)(out + 32), x2);
+    _mm_storeu_si128((__m128i *)(out + 48), x3);
+}
+#endif
+
 /**
  * Expand the cipher key into the encryption key schedule.
  *
@@ -871,6 +974,12 @@ void ogs_aes_encrypt(const uint32_t *rk, int nrounds, const uint8_t plaintext[16
   #ifndef FULL_UNROLL
     int r;
   #endif /* ?FULL_UNROLL */
+#if OGS_AES_HAVE_AESNI
+  if (aesni_supported()) {
+    aesni_encrypt(rk, nrounds, plaintext, ciphertext);
+    return;
+  }
+#endif
   /*
    * map byte array block to cipher state
    * and add initial round key:
@@ -1053,6 +1162,12 @@ void ogs_aes_decrypt(const uint32_t *rk, int nrounds, const uint8_t ciphertext[1
   #ifndef FULL_UNROLL
     int r;
   #endif /* ?FULL_UNROLL */
+#if OGS_AES_HAVE_AESNI
+  if (aesni_supported()) {
+    aesni_decrypt(rk, nrounds, ciphertext, plaintext);
+    return;
+  }
+#endif
 
   /*
   * map byte array block to cipher state
@@ -1229,6 +1344,25 @@ void ogs_aes_decrypt(const uint32_t *rk, int nrounds, const uint8_t ciphertext[1
   PUTU32(plaintext + 12, s3);
 }
 
+void ogs_aes_encrypt_multi(const uint32_t *const rk[], int nrounds,
+        const uint8_t *in, uint8_t *out, int num)
+{
+    int i = 0;
+
+    ogs_assert(rk);
+    ogs_assert(in);
+    ogs_assert(out);
+
+#if OGS_AES_HAVE_AESNI
+    if (aesni_supported()) {
+        for (; i + 4 <= num; i += 4)
+            aesni_encrypt_x4(rk + i, nrounds, in + 16*i, out + 16*i);
+    }
+#endif
+    for (; i < num; i++)
+        ogs_aes_encrypt(rk[i], nrounds, in + 16*i, out + 16*i);
+}
+
 int ogs_aes_cbc_encrypt(const uint8_t *key, const uint32_t keybits,
         uint8_t *ivec, const uint8_t *in, const uint32_t inlen,
         uint8_t *out, uint32_t *outlen)
@@ -1409,10 +1543,13 @@ int ogs_aes_ctr128_encrypt(const uint8_t *key,
         uint8_t *out)
 {
     uint8_t ecount_buf[16];
+    uint8_t counter[4*16], ecount[4*16];
+    const uint32_t *rks[4];
     uint32_t len = inlen;
 
     uint32_t rk[OGS_AES_RKLENGTH(OGS_AES_MAX_KEY_BITS)];
     int nrounds;
+    int i, num;
 
     uint32_t n = 0;
     size_t l = 0;
@@ -1433,16 +1570,26 @@ int ogs_aes_ctr128_encrypt(const uint8_t *key,
         n = (n + 1) % 16;
     }
 
+    /* The counter blocks are encrypted 4 at a time */
+    for (i = 0; i < 4; i++)
+        rks[i] = rk;
+
     while (len >= 16) 
     {
-        ogs_aes_encrypt(rk, nrounds, ivec, ecount_buf);
-        ctr128_inc_aligned(ivec);
-        for (n = 0; n < 16; n += sizeof(size_t))
-            *(size_t *)(out + n) =
-                *(size_t *)(in + n) ^ *(size_t *)(ecount_buf + n);
-        len -= 16;
-        out += 16;
-        in += 16;
+        num = ogs_min(len / 16, 4);
+        for (i = 0; i < num; i++) {
+            memcpy(counter + 16*i, ivec, 16);
+            ctr128_inc_aligned(ivec);
+        }
+        ogs_aes_encrypt_multi(rks, nrounds, counter, ecount, num);
+        for (i = 0; i < num; i++) {
+            for (n = 0; n < 16; n += sizeof(size_t))
+                *(size_t *)(out + n) =
+                    *(size_t *)(in + n) ^ *(size_t *)(ecount + 16*i + n);
+            len -= 16;
+            out += 16;
+            in += 16;
+        }
         n = 0;
     }
     if (len) 
@@ -51,6 +51,13 @@ void ogs_aes_encrypt(const uint32_t *rk, int nrounds,
 void ogs_aes_decrypt(const uint32_t *rk, int nrounds,
         const uint8_t ciphertext[16], uint8_t plaintext[16]);
 
+/*
+ * Encrypt num consecutive 16-byte blocks, the i-th with the key schedule
+ * rk[i]. With AES-NI, the blocks are processed in parallel.
+ */
+void ogs_aes_encrypt_multi(const uint32_t *const rk[], int nrounds,
+        const uint8_t *in, uint8_t *out, int num);
+
 int ogs_aes_cbc_encrypt(const uint8_t *key,
         const uint32_t keybits, uint8_t *ivec,
         const uint8_t *in, const uint32_t inlen,
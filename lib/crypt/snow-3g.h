@@ -15,6 +15,17 @@ typedef uint8_t u8;
 typedef uint32_t u32;
 typedef uint64_t u64;
 
+/* The LFSR(S0-S15) and FSM(R1-R3) state.
+* The LFSR is a ring buffer : S(i) is lfsr[(pos + i) % 16]
+* so that the registers are not moved at every clock.
+*/
+
+typedef struct snow_3g_ctx_s {
+    u32 lfsr[16];
+    u32 pos;
+    u32 r1, r2, r3;
+} snow_3g_ctx_t;
+
 /* Initialization.
 * Input k[4]: Four 32-bit words making up 128-bit key.
 * Input IV[4]: Four 32-bit words making 128-bit initialization variable.
@@ -22,7 +33,7 @@ typedef uint64_t u64;
 * See Section 4.1.
 */
 
-void snow_3g_initialize(u32 k[4], u32 IV[4]);
+void snow_3g_initialize(snow_3g_ctx_t *ctx, u32 k[4], u32 IV[4]);
 
 /* Generation of Keystream.
 * input n: number of 32-bit words of keystream.
@@ -32,7 +43,7 @@ void snow_3g_initialize(u32 k[4], u32 IV[4]);
 * See section 4.2.
 */
 
-void snow_3g_generate_key_stream(u32 n, u32 *z);
+void snow_3g_generate_key_stream(snow_3g_ctx_t *ctx, u32 n, u32 *z);
 
 /* f8.
 * Input key: 128 bit Confidentiality Key.
@@ -65,6 +76,12 @@ void snow_3g_f8( u8 *key, u32 count, u32 bearer, u32 dir,
 void snow_3g_f9( u8* key, u32 count, u32 fresh, u32 dir,
                  u8 *data, u64 length, u8 *out);
 
+/* Input enable: 0 makes f9 use the portable GF(2^64) multiplication
+* even when the CPU has PCLMULQDQ, so that the two can be compared.
+*/
+
+void snow_3g_use_pclmul(int enable);
+
 #ifdef __cplusplus
 }
 #endif
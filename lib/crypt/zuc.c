@@ -3,51 +3,20 @@
  *--------------------------------------------*/
 #include "zuc.h"
 
-u32 AddM(u32 a, u32 b);
-void LFSRWithInitialisationMode(u32 u);
-void LFSRWithWorkMode(void);
-void BitReorganization(void);
-u32 L1(u32 X);
-u32 L2(u32 X);
-u32 F(void);
-void ZUC(u8* k, u8* iv, u32* ks, u32 len);
-u32 GET_WORD(u32 * DATA, u32 i);
-u8 GET_BIT(u8 * DATA, u32 i);
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <wmmintrin.h>
+#define ZUC_HAVE_PCLMUL 1
+#endif
 
 /*--------------------------------------------
  * ZUC keystream generator algorithm
  *------------------------------------------*/
 
-/* the state registers of LFSR */ 
-static u32 LFSR_S0;
-static u32 LFSR_S1;
-static u32 LFSR_S2;
-static u32 LFSR_S3;
-static u32 LFSR_S4;
-static u32 LFSR_S5;
-static u32 LFSR_S6;
-static u32 LFSR_S7;
-static u32 LFSR_S8;
-static u32 LFSR_S9;
-static u32 LFSR_S10;
-static u32 LFSR_S11;
-static u32 LFSR_S12;
-static u32 LFSR_S13;
-static u32 LFSR_S14;
-static u32 LFSR_S15;
-
-/* the registers of F */
-static u32 F_R1;
-static u32 F_R2;
-
-/* the outputs of BitReorganization */
-static u32 BRC_X0;
-static u32 BRC_X1;
-static u32 BRC_X2;
-static u32 BRC_X3;
+/* the state registers of LFSR */
+#define LFSR_S(ctx, i) ((ctx)->lfsr[((ctx)->pos + (i)) & 15])
 
 /* the s-boxes */ 
-static u8 S0[256] = {
+static const u8 S0[256] = {
 0x3e,0x72,0x5b,0x47,0xca,0xe0,0x00,0x33,0x04,0xd1,0x54,0x98,0x09,0xb9,0x6d,0xcb,
 0x7b,0x1b,0xf9,0x32,0xaf,0x9d,0x6a,0xa5,0xb8,0x2d,0xfc,0x1d,0x08,0x53,0x03,0x90,
 0x4d,0x4e,0x84,0x99,0xe4,0xce,0xd9,0x91,0xdd,0xb6,0x85,0x48,0x8b,0x29,0x6e,0xac,
@@ -66,7 +35,7 @@ static u8 S0[256] = {
 0x8d,0x27,0x1a,0xdb,0x81,0xb3,0xa0,0xf4,0x45,0x7a,0x19,0xdf,0xee,0x78,0x34,0x60
 }; 
 
-static u8 S1[256] =  {
+static const u8 S1[256] =  {
 0x55,0xc2,0x63,0x71,0x3b,0xc8,0x47,0x86,0x9f,0x3c,0xda,0x5b,0x29,0xaa,0xfd,0x77,
 0x8c,0xc5,0x94,0x0c,0xa6,0x1a,0x13,0x00,0xe3,0xa8,0x16,0x72,0x40,0xf9,0xf8,0x42,
 0x44,0x26,0x68,0x96,0x81,0xd9,0x45,0x3e,0x10,0x76,0xc6,0xa7,0x8b,0x39,0x43,0xe1,
@@ -86,196 +55,136 @@ static u8 S1[256] =  {
 };
  
 /* the constants D */
-static u32 EK_d[16] = {
+static const u32 EK_d[16] = {
 0x44D7, 0x26BC, 0x626B, 0x135E, 0x5789, 0x35E2, 0x7135, 0x09AF,
 0x4D78, 0x2F13, 0x6BC4, 0x1AF1, 0x5E26, 0x3C4D, 0x789A, 0x47AC
 };
 
 /* c = a + b mod (2^31 - 1) */
-u32 AddM(u32 a, u32 b)
+static ogs_inline u32 AddM(u32 a, u32 b)
 {
 	u32 c = a + b;
 	return (c & 0x7FFFFFFF) + (c >> 31);
 }
 
-/* LFSR with initialization mode */
+/* LFSR with initialization mode (u) or work mode (u = 0) */
 #define MulByPow2(x, k) ((((x) << k) | ((x) >> (31 - k))) & 0x7FFFFFFF)
-void LFSRWithInitialisationMode(u32 u)
+static ogs_inline void LFSRClock(zuc_ctx_t *ctx, u32 u)
 {
-	u32 f, v;
-	f = LFSR_S0;
-	
-	v = MulByPow2(LFSR_S0, 8);
-	f = AddM(f, v);
-	v = MulByPow2(LFSR_S4, 20);
-	f = AddM(f, v);
-	v = MulByPow2(LFSR_S10, 21);
-	f = AddM(f, v);
-	v = MulByPow2(LFSR_S13, 17);
-	f = AddM(f, v);
-	v = MulByPow2(LFSR_S15, 15);
-	f = AddM(f, v);
-	
-	f = AddM(f, u);
-	
-	/* update the state */
-	LFSR_S0 = LFSR_S1;
-	LFSR_S1 = LFSR_S2;
-	LFSR_S2 = LFSR_S3;
-	LFSR_S3 = LFSR_S4;
-	LFSR_S4 = LFSR_S5;
-	LFSR_S5 = LFSR_S6;
-	LFSR_S6 = LFSR_S7;
-	LFSR_S7 = LFSR_S8;
-	LFSR_S8 = LFSR_S9;
-	LFSR_S9 = LFSR_S10;
-	LFSR_S10 = LFSR_S11;
-	LFSR_S11 = LFSR_S12;
-	LFSR_S12 = LFSR_S13;
-	LFSR_S13 = LFSR_S14;
-	LFSR_S14 = LFSR_S15;
-	LFSR_S15 = f;
-}
+	u32 s0 = LFSR_S(ctx, 0);
+	u32 f = s0;
 
-/* LFSR with work mode */
-void LFSRWithWorkMode(void)
-{
-	u32 f, v;
-	f = LFSR_S0;
-	
-	v = MulByPow2(LFSR_S0, 8);
-	f = AddM(f, v);
-	v = MulByPow2(LFSR_S4, 20);
-	f = AddM(f, v);
-	v = MulByPow2(LFSR_S10, 21);
-	f = AddM(f, v);
-	v = MulByPow2(LFSR_S13, 17);
-	f = AddM(f, v);
-	v = MulByPow2(LFSR_S15, 15);
-	f = AddM(f, v);
-	
-	/* update the state */
-	LFSR_S0 = LFSR_S1;
-	LFSR_S1 = LFSR_S2;
-	LFSR_S2 = LFSR_S3;
-	LFSR_S3 = LFSR_S4;
-	LFSR_S4 = LFSR_S5;
-	LFSR_S5 = LFSR_S6;
-	LFSR_S6 = LFSR_S7;
-	LFSR_S7 = LFSR_S8;
-	LFSR_S8 = LFSR_S9;
-	LFSR_S9 = LFSR_S10;
-	LFSR_S10 = LFSR_S11;
-	LFSR_S11 = LFSR_S12;
-	LFSR_S12 = LFSR_S13;
-	LFSR_S13 = LFSR_S14;
-	LFSR_S14 = LFSR_S15;
-	LFSR_S15 = f;
+	f = AddM(f, MulByPow2(s0, 8));
+	f = AddM(f, MulByPow2(LFSR_S(ctx, 4), 20));
+	f = AddM(f, MulByPow2(LFSR_S(ctx, 10), 21));
+	f = AddM(f, MulByPow2(LFSR_S(ctx, 13), 17));
+	f = AddM(f, MulByPow2(LFSR_S(ctx, 15), 15));
+	if (u)
+		f = AddM(f, u);
+
+	/* update the state : S0 is dropped and its slot becomes S15 */
+	ctx->pos = (ctx->pos + 1) & 15;
+	LFSR_S(ctx, 15) = f;
 }
 
 /* BitReorganization */
-void BitReorganization(void)
+static ogs_inline void BitReorganization(zuc_ctx_t *ctx)
 {
-	BRC_X0 = ((LFSR_S15 & 0x7FFF8000) << 1) | (LFSR_S14 & 0xFFFF);
-	BRC_X1 = ((LFSR_S11 & 0xFFFF) << 16) | (LFSR_S9 >> 15);
-	BRC_X2 = ((LFSR_S7 & 0xFFFF) << 16) | (LFSR_S5 >> 15);
-	BRC_X3 = ((LFSR_S2 & 0xFFFF) << 16) | (LFSR_S0 >> 15);
+	ctx->x0 = ((LFSR_S(ctx, 15) & 0x7FFF8000) << 1) |
+		(LFSR_S(ctx, 14) & 0xFFFF);
+	ctx->x1 = ((LFSR_S(ctx, 11) & 0xFFFF) << 16) | (LFSR_S(ctx, 9) >> 15);
+	ctx->x2 = ((LFSR_S(ctx, 7) & 0xFFFF) << 16) | (LFSR_S(ctx, 5) >> 15);
+	ctx->x3 = ((LFSR_S(ctx, 2) & 0xFFFF) << 16) | (LFSR_S(ctx, 0) >> 15);
 }
 
 #define ROT(a, k) (((a) << k) | ((a) >> (32 - k)))
 
 /* L1 */
-u32 L1(u32 X)
+static ogs_inline u32 L1(u32 X)
 {
 	return (X ^ ROT(X, 2) ^ ROT(X, 10) ^ ROT(X, 18) ^ ROT(X, 24));
 }
 
 /* L2 */
-u32 L2(u32 X)
+static ogs_inline u32 L2(u32 X)
 {
 	return (X ^ ROT(X, 8) ^ ROT(X, 14) ^ ROT(X, 22) ^ ROT(X, 30));
 }
 
 #define MAKEU32(a, b, c, d) (((u32)(a) << 24) | ((u32)(b) << 16) | ((u32)(c) << 8) | ((u32)(d)))
 /* F */
-u32 F(void)
+static ogs_inline u32 F(zuc_ctx_t *ctx)
 {
 	u32 W, W1, W2, u, v;
-	
-	W  = (BRC_X0 ^ F_R1) + F_R2;
-	W1 = F_R1 + BRC_X1;
-	W2 = F_R2 ^ BRC_X2;
-	
+
+	W  = (ctx->x0 ^ ctx->r1) + ctx->r2;
+	W1 = ctx->r1 + ctx->x1;
+	W2 = ctx->r2 ^ ctx->x2;
+
 	u = L1((W1 << 16) | (W2 >> 16));
 	v = L2((W2 << 16) | (W1 >> 16));
-	
-	F_R1 = MAKEU32(S0[u >> 24], S1[(u >> 16) & 0xFF],
+
+	ctx->r1 = MAKEU32(S0[u >> 24], S1[(u >> 16) & 0xFF],
 	S0[(u >> 8) & 0xFF], S1[u & 0xFF]);
-	F_R2 = MAKEU32(S0[v >> 24], S1[(v >> 16) & 0xFF],
+	ctx->r2 = MAKEU32(S0[v >> 24], S1[(v >> 16) & 0xFF],
 	S0[(v >> 8) & 0xFF], S1[v & 0xFF]);
-	
+
 	return W;
 }
 
 #define MAKEU31(a, b, c) (((u32)(a) << 23) | ((u32)(b) << 8) | (u32)(c))
 /* initialize */
-void zuc_initialize(u8* k, u8* iv)
+void zuc_initialize(zuc_ctx_t *ctx, u8* k, u8* iv)
 {
-	u32 w, nCount;
+	u32 w, i;
+
+	ogs_assert(ctx);
 
 	/* expand key */
-	LFSR_S0 = MAKEU31(k[0], EK_d[0], iv[0]);
-	LFSR_S1 = MAKEU31(k[1], EK_d[1], iv[1]);
-	LFSR_S2 = MAKEU31(k[2], EK_d[2], iv[2]);
-	LFSR_S3 = MAKEU31(k[3], EK_d[3], iv[3]);
-	LFSR_S4 = MAKEU31(k[4], EK_d[4], iv[4]);
-	LFSR_S5 = MAKEU31(k[5], EK_d[5], iv[5]);
-	LFSR_S6 = MAKEU31(k[6], EK_d[6], iv[6]);
-	LFSR_S7 = MAKEU31(k[7], EK_d[7], iv[7]);
-	LFSR_S8 = MAKEU31(k[8], EK_d[8], iv[8]);
-	LFSR_S9 = MAKEU31(k[9], EK_d[9], iv[9]);
-	LFSR_S10 = MAKEU31(k[10], EK_d[10], iv[10]);
-	LFSR_S11 = MAKEU31(k[11], EK_d[11], iv[11]);
-	LFSR_S12 = MAKEU31(k[12], EK_d[12], iv[12]);
-	LFSR_S13 = MAKEU31(k[13], EK_d[13], iv[13]);
-	LFSR_S14 = MAKEU31(k[14], EK_d[14], iv[14]);
-	LFSR_S15 = MAKEU31(k[15], EK_d[15], iv[15]);
+	ctx->pos = 0;
+	for (i = 0; i < 16; i++)
+		ctx->lfsr[i] = MAKEU31(k[i], EK_d[i], iv[i]);
 
 	/* set F_R1 and F_R2 to zero */
-	F_R1 = 0;
-	F_R2 = 0;
-	nCount = 32;
-	while (nCount > 0)
+	ctx->r1 = 0;
+	ctx->r2 = 0;
+	for (i = 0; i < 32; i++)
 	{
-		BitReorganization();
-		w = F();
-		LFSRWithInitialisationMode(w >> 1);
-		nCount --;
+		BitReorganization(ctx);
+		w = F(ctx);
+		LFSRClock(ctx, w >> 1);
 	}
 }
 
-void zuc_generate_key_stream(u32* pKeystream, u32 KeystreamLen)
+/* The first step of the working stage before the keystream words */
+static ogs_inline void KeyStreamStart(zuc_ctx_t *ctx)
 {
-	int i;
-	BitReorganization();
-	F(); 			/* discard the output of F */
-	LFSRWithWorkMode();
-	
-	for (i = 0; i < KeystreamLen; i ++)
-	{
-		BitReorganization();
-		pKeystream[i] = F() ^ BRC_X3;
-		LFSRWithWorkMode();
-	}
+	BitReorganization(ctx);
+	F(ctx); 			/* discard the output of F */
+	LFSRClock(ctx, 0);
 }
 
-/* The ZUC algorithm, see ref. [3]*/
-void ZUC(u8* k, u8* iv, u32* ks, u32 len)
+static ogs_inline u32 KeyStreamWord(zuc_ctx_t *ctx)
 {
-	/* The initialization of ZUC, see page 17 of ref. [3]*/
-	zuc_initialize(k, iv);
-	/*  The procedure of generating keystream of ZUC, see page 18 of ref. [3]*/
-	zuc_generate_key_stream(ks, len);
+	u32 z;
+
+	BitReorganization(ctx);
+	z = F(ctx) ^ ctx->x3;
+	LFSRClock(ctx, 0);
+
+	return z;
+}
+
+void zuc_generate_key_stream(zuc_ctx_t *ctx,
+        u32* pKeystream, u32 KeystreamLen)
+{
+	u32 i;
+
+	ogs_assert(ctx);
+
+	KeyStreamStart(ctx);
+	for (i = 0; i < KeystreamLen; i ++)
+		pKeystream[i] = KeyStreamWord(ctx);
 }
 /* end of ZUC.c */
 
@@ -286,54 +195,62 @@ void ZUC(u8* k, u8* iv, u32* ks, u32 len)
 /*
  * EEA3: LTE Encryption Algorithm 3
  * EEA3.c
+ *
+ * The keystream is generated word by word while M is processed,
+ * so no buffer is allocated. M and C may be the same buffer.
 */
-void zuc_eea3(u8* CK, u32 COUNT, u32 BEARER, u32 DIRECTION, 
+void zuc_eea3(u8* CK, u32 COUNT, u32 BEARER, u32 DIRECTION,
 				   u32 LENGTH, u8* M, u8* C)
 {
-	u32 *z, L, L8, i;
+	zuc_ctx_t ctx;
+	u32 z, L8, i, j;
 	u8 	IV[16];
 	u32 lastbits = (8-(LENGTH%8))%8;
-    
-	L 	= (LENGTH+31)/32;
-	z 	= (u32 *) ogs_malloc(L*sizeof(u32));
-    ogs_assert(z);
-    
+
 	L8 	= (LENGTH+7)/8;
-	
+
 	IV[0]	= (COUNT>>24) & 0xFF;
 	IV[1]	= (COUNT>>16) & 0xFF;
 	IV[2]	= (COUNT>>8)  & 0xFF;
 	IV[3]	=  COUNT      & 0xFF;
-	
+
 	IV[4]	= ((BEARER << 3) | ((DIRECTION&1)<<2)) & 0xFC;
 	IV[5]	= 0;
 	IV[6]	= 0;
 	IV[7]	= 0;
-	
+
 	IV[8]	= IV[0];
 	IV[9]	= IV[1];
 	IV[10]	= IV[2];
 	IV[11]	= IV[3];
-	
+
 	IV[12]	= IV[4];
 	IV[13]	= IV[5];
 	IV[14]	= IV[6];
 	IV[15]	= IV[7];
-	
-	ZUC(CK, IV, z, L);
-	
-	for (i=0; i<L8; i++)
-    {
-		C[i] = M[i] ^ ((z[i/4] >> (3-i%4)*8) & 0xff);
-    }
+
+	zuc_initialize(&ctx, CK, IV);
+	KeyStreamStart(&ctx);
+
+	for (i = 0; i + 4 <= L8; i += 4)
+	{
+		z = KeyStreamWord(&ctx);
+		C[i+0] = M[i+0] ^ (u8)(z >> 24);
+		C[i+1] = M[i+1] ^ (u8)(z >> 16);
+		C[i+2] = M[i+2] ^ (u8)(z >> 8);
+		C[i+3] = M[i+3] ^ (u8)(z);
+	}
+	if (i < L8)
+	{
+		z = KeyStreamWord(&ctx);
+		for (j = 0; i < L8; i++, j++)
+			C[i] = M[i] ^ (u8)(z >> (24 - 8*j));
+	}
 
 	/* zero last bits of data in case its length is not  word-aligned (32 bits)
 	   this is an addition to the C reference code, which did not handle it */
 	if (lastbits)
-        i--;
-		C[i] &= 0x100 - (1<<lastbits);
-	
-	ogs_free(z);
+		C[L8-1] &= 0x100 - (1<<lastbits);
 }
 /* end of EEA3.c */
 
@@ -344,62 +261,133 @@ void zuc_eea3(u8* CK, u32 COUNT, u32 BEARER, u32 DIRECTION,
 /*
  * EIA3: LTE Integrity computation algorithm
  * EIA3.c
+ *
+ * The reference code XORs GET_WORD(z, i) into T for each set bit i of M.
+ * For the 32 bits of the message word j, the words come from the 64-bit
+ * K = z[j] || z[j+1], and T ^= the upper half of (K << k) for each set
+ * bit k (from the MSB). This is the bits 32..63 of the carry-less product
+ * of K and the bit-reversed message word.
 */
-u32 GET_WORD(u32 * DATA, u32 i)
+
+#if ZUC_HAVE_PCLMUL
+static ogs_inline u32 bitrev32(u32 x)
 {
-	u32 WORD, ti;
-	ti	= i % 32;
-	if (ti == 0)
-		WORD = DATA[i/32];
-	else
-		WORD = (DATA[i/32]<<ti) | (DATA[i/32+1]>>(32-ti));
-	return WORD;
+	x = ((x >> 1) & 0x55555555) | ((x & 0x55555555) << 1);
+	x = ((x >> 2) & 0x33333333) | ((x & 0x33333333) << 2);
+	x = ((x >> 4) & 0x0F0F0F0F) | ((x & 0x0F0F0F0F) << 4);
+	return __builtin_bswap32(x);
+}
+
+__attribute__((target("pclmul,sse2")))
+static u32 eia3_word_clmul(uint64_t K, u32 m)
+{
+	__m128i x = _mm_clmulepi64_si128(
+			_mm_cvtsi64_si128(K), _mm_cvtsi32_si128(bitrev32(m)), 0x00);
+	return (u32)(_mm_cvtsi128_si64(x) >> 32);
 }
+#endif
 
-u8 GET_BIT(u8 * DATA, u32 i)
+static ogs_inline u32 eia3_word(uint64_t K, u32 m)
 {
-	return (DATA[i/8] & (1<<(7-(i%8)))) ? 1 : 0;
+	u32 T = 0;
+	int k;
+
+	for (k = 0; k < 32; k++)
+		T ^= (u32)((K << k) >> 32) & (0 - ((m >> (31 - k)) & 1));
+
+	return T;
+}
+
+static int pclmul_disabled = 0;
+
+void zuc_use_pclmul(int enable)
+{
+	pclmul_disabled = !enable;
+}
+
+static int has_pclmul(void)
+{
+#if ZUC_HAVE_PCLMUL
+	return !pclmul_disabled && __builtin_cpu_supports("pclmul");
+#else
+	return 0;
+#endif
 }
 
 void zuc_eia3(u8* IK, u32 COUNT, u32 BEARER, u32 DIRECTION,
 				   u32 LENGTH, u8* M, u32* MAC)
 {
-	u32	*z, N, L, T, i;
+	zuc_ctx_t ctx;
+	u32 z0, z1, T, m, i, j, r;
+	uint64_t K;
 	u8 IV[16];
+	int clmul = has_pclmul();
 
 	IV[0]	= (COUNT>>24) & 0xFF;
 	IV[1]	= (COUNT>>16) & 0xFF;
 	IV[2]	= (COUNT>>8) & 0xFF;
 	IV[3]	= COUNT & 0xFF;
-	
+
 	IV[4]	= (BEARER << 3) & 0xF8;
 	IV[5]	= IV[6] = IV[7] = 0;
-	
+
 	IV[8]	= ((COUNT>>24) & 0xFF) ^ ((DIRECTION&1)<<7);
 	IV[9]	= (COUNT>>16) & 0xFF;
 	IV[10]	= (COUNT>>8) & 0xFF;
 	IV[11]	= COUNT & 0xFF;
-	
+
 	IV[12]	= IV[4];
 	IV[13]	= IV[5];
 	IV[14]	= IV[6] ^ ((DIRECTION&1)<<7);
 	IV[15]	= IV[7];
-	
-	N	= LENGTH + 64;
-	L	= (N + 31) / 32;
-	z	= (u32 *) ogs_malloc(L*sizeof(u32));
-    ogs_assert(z);
-	ZUC(IK, IV, z, L);
-	
+
+	zuc_initialize(&ctx, IK, IV);
+	KeyStreamStart(&ctx);
+
+#if ZUC_HAVE_PCLMUL
+#define EIA3_WORD(__K, __m) \
+	(clmul ? eia3_word_clmul(__K, __m) : eia3_word(__K, __m))
+#else
+#define EIA3_WORD(__K, __m) eia3_word(__K, __m)
+#endif
+
 	T = 0;
-	for (i=0; i<LENGTH; i++) {
-		if (GET_BIT(M,i)) {
-			T ^= GET_WORD(z,i);
-		}
+	z0 = KeyStreamWord(&ctx);
+	z1 = KeyStreamWord(&ctx);
+
+	for (i = 0; i < LENGTH / 32; i++)
+	{
+		m = ((u32)M[4*i] << 24) | ((u32)M[4*i+1] << 16) |
+			((u32)M[4*i+2] << 8) | (u32)M[4*i+3];
+		K = (uint64_t)z0 << 32 | z1;
+		if (m)
+			T ^= EIA3_WORD(K, m);
+		z0 = z1;
+		z1 = KeyStreamWord(&ctx);
 	}
-	T ^= GET_WORD(z,LENGTH);
-	
-	*MAC = T ^ z[L-1];
-	ogs_free(z);
+
+	r = LENGTH % 32;
+	if (r)
+	{
+		/* the remaining bits of M : only the valid bytes are read */
+		m = 0;
+		for (j = 0; j < (r + 7) / 8; j++)
+			m |= (u32)M[4*i+j] << (24 - 8*j);
+		m &= 0xFFFFFFFF << (32 - r);
+
+		K = (uint64_t)z0 << 32 | z1;
+		T ^= EIA3_WORD(K, m);
+
+		/* GET_WORD(z, LENGTH) and the last word z[L-1] */
+		T ^= (u32)((K << r) >> 32);
+		*MAC = T ^ KeyStreamWord(&ctx);
+	}
+	else
+	{
+		T ^= z0;
+		*MAC = T ^ z1;
+	}
+
+#undef EIA3_WORD
 }
 /* end of EIA3.c */
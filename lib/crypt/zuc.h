@@ -21,15 +21,27 @@ extern "C" {
 typedef uint8_t u8;
 typedef uint32_t u32;
 
+/*
+ * The state of ZUC : LFSR(S0-S15), F(R1, R2) and BitReorganization(X0-X3)
+ * The LFSR is a ring buffer : S(i) is lfsr[(pos + i) % 16]
+ */
+typedef struct zuc_ctx_s {
+    u32 lfsr[16];
+    u32 pos;
+    u32 r1, r2;
+    u32 x0, x1, x2, x3;
+} zuc_ctx_t;
+
 /*
  * ZUC keystream generator
  * k: secret key (input, 16 bytes)
  * iv: initialization vector (input, 16 bytes)
  * Keystream: produced keystream (output, variable length)
- * KeystreamLen: length in bits requested for the keystream (input)
+ * KeystreamLen: length in 32-bit words requested for the keystream (input)
 */
-void zuc_initialize(u8* k, u8* iv);
-void zuc_generate_key_stream(u32* pKeystream, u32 KeystreamLen);
+void zuc_initialize(zuc_ctx_t *ctx, u8* k, u8* iv);
+void zuc_generate_key_stream(zuc_ctx_t *ctx,
+        u32* pKeystream, u32 KeystreamLen);
 
 /*
  * CK: ciphering key
@@ -55,6 +67,12 @@ void zuc_eea3(u8* CK, u32 COUNT, u32 BEARER, u32 DIRECTION,
 void zuc_eia3(u8* IK, u32 COUNT, u32 BEARER, u32 DIRECTION,
 		           u32 LENGTH, u8* M, u32* MAC);
 
+/*
+ * enable: 0 makes EIA3 use the portable loop even when the CPU has
+ * PCLMULQDQ, so that the two can be compared.
+*/
+void zuc_use_pclmul(int enable);
+
 #ifdef __cplusplus
 }
 #endif
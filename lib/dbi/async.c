@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-dbi.h"
+
+#define OGS_DBI_ASYNC_MAX_THREAD    64
+#define OGS_DBI_ASYNC_QUEUE_SIZE    8192
+
+static struct {
+    bool initialized;
+
+    ogs_queue_t *request_queue;
+    ogs_queue_t *done_queue;
+
+    ogs_socket_t fd[2];
+    ogs_poll_t *poll;
+
+    int num_of_thread;
+    ogs_thread_t *thread[OGS_DBI_ASYNC_MAX_THREAD];
+} self;
+
+static void async_main(void *data)
+{
+    ogs_dbi_request_t *request = NULL;
+    char buf[1];
+    int rv;
+
+    for ( ;; ) {
+        rv = ogs_queue_pop(self.request_queue, (void **)&request);
+        if (rv == OGS_DONE) /* ogs_dbi_async_final() */
+            break;
+        if (rv != OGS_OK) {
+            ogs_error("ogs_queue_pop() failed [%d]", rv);
+            break;
+        }
+
+        ogs_assert(request);
+        ogs_assert(request->exec);
+        request->rv = request->exec(request);
+
+        rv = ogs_queue_push(self.done_queue, request);
+        if (rv != OGS_OK) {
+            ogs_error("ogs_queue_push() failed [%d]", rv);
+            break;
+        }
+
+        /* The socket is non-blocking. If it is full, it is readable. */
+        buf[0] = 0;
+        send(self.fd[1], buf, 1, 0);
+    }
+}
+
+static void async_done(short when, ogs_socket_t fd, void *data)
+{
+    ogs_dbi_request_t *request = NULL;
+    unsigned char buf[1024];
+    ssize_t r;
+
+    ogs_assert(when == OGS_POLLIN);
+
+    r = recv(fd, (char *)buf, sizeof(buf), 0);
+    if (r < 0)
+        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno, "recv() failed");
+
+    while (ogs_queue_trypop(self.done_queue, (void **)&request) == OGS_OK) {
+        ogs_assert(request);
+        if (request->done)
+            request->done(request);
+    }
+}
+
+int ogs_dbi_async_init(ogs_pollset_t *pollset, int num_of_thread)
+{
+    int i, rv;
+
+    ogs_assert(pollset);
+    ogs_assert(self.initialized == false);
+
+    if (num_of_thread <= 0)
+        return OGS_OK;
+
+    if (num_of_thread > OGS_DBI_ASYNC_MAX_THREAD) {
+        ogs_warn("Too many DB threads [%d > %d]",
+                num_of_thread, OGS_DBI_ASYNC_MAX_THREAD);
+        num_of_thread = OGS_DBI_ASYNC_MAX_THREAD;
+    }
+
+    memset(&self, 0, sizeof(self));
+
+    self.request_queue = ogs_queue_create(OGS_DBI_ASYNC_QUEUE_SIZE);
+    ogs_assert(self.request_queue);
+    self.done_queue = ogs_queue_create(OGS_DBI_ASYNC_QUEUE_SIZE);
+    ogs_assert(self.done_queue);
+
+    rv = ogs_socketpair(AF_SOCKPAIR, SOCK_STREAM, 0, self.fd);
+    ogs_assert(rv == OGS_OK);
+    rv = ogs_nonblocking(self.fd[0]);
+    ogs_assert(rv == OGS_OK);
+    rv = ogs_nonblocking(self.fd[1]);
+    ogs_assert(rv == OGS_OK);
+
+    self.poll = ogs_pollset_add(
+            pollset, OGS_POLLIN, self.fd[0], async_done, NULL);
+    ogs_assert(self.poll);
+
+    for (i = 0; i < num_of_thread; i++) {
+        self.thread[i] = ogs_thread_create(async_main, NULL);
+        ogs_assert(self.thread[i]);
+    }
+    self.num_of_thread = num_of_thread;
+
+    self.initialized = true;
+
+    ogs_info("DB threads [%d]", num_of_thread);
+
+    return OGS_OK;
+}
+
+void ogs_dbi_async_final(void)
+{
+    ogs_dbi_request_t *request = NULL;
+    int i;
+
+    if (self.initialized == false)
+        return;
+
+    ogs_queue_term(self.request_queue);
+    for (i = 0; i < self.num_of_thread; i++)
+        ogs_thread_destroy(self.thread[i]);
+
+    /*
+     * The requests which are not started yet are dropped,
+     * but the ones which are already done are completed.
+     */
+    while (ogs_queue_trypop(self.done_queue, (void **)&request) == OGS_OK) {
+        ogs_assert(request);
+        if (request->done)
+            request->done(request);
+    }
+
+    ogs_pollset_remove(self.poll);
+    ogs_closesocket(self.fd[0]);
+    ogs_closesocket(self.fd[1]);
+
+    ogs_queue_destroy(self.request_queue);
+    ogs_queue_destroy(self.done_queue);
+
+    memset(&self, 0, sizeof(self));
+}
+
+bool ogs_dbi_async_enabled(void)
+{
+    return self.initialized;
+}
+
+int ogs_dbi_async_submit(ogs_dbi_request_t *request)
+{
+    int rv;
+
+    ogs_assert(request);
+    ogs_assert(request->exec);
+
+    if (self.initialized == false) {
+        ogs_error("DB threads are not running");
+        return OGS_ERROR;
+    }
+
+    rv = ogs_queue_trypush(self.request_queue, request);
+    if (rv != OGS_OK) {
+        ogs_error("ogs_queue_trypush() failed [%d]", rv);
+        return OGS_ERROR;
+    }
+
+    return OGS_OK;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_DBI_INSIDE) && !defined(OGS_DBI_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_DBI_ASYNC_H
+#define OGS_DBI_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Run the DB requests in the DB threads.
+ *
+ * exec() is called in one of the DB threads and may block on the DB.
+ * Then, done() is called in the thread polling the pollset given
+ * to ogs_dbi_async_init(), with the result of exec() in 'rv'.
+ *
+ * The request is owned by the caller. It must stay valid until done().
+ */
+typedef struct ogs_dbi_request_s ogs_dbi_request_t;
+
+typedef int (*ogs_dbi_exec_f)(ogs_dbi_request_t *request);
+typedef void (*ogs_dbi_done_f)(ogs_dbi_request_t *request);
+
+struct ogs_dbi_request_s {
+    ogs_dbi_exec_f exec;
+    ogs_dbi_done_f done;
+    void *data;
+
+    int rv;
+};
+
+int ogs_dbi_async_init(ogs_pollset_t *pollset, int num_of_thread);
+void ogs_dbi_async_final(void);
+
+bool ogs_dbi_async_enabled(void);
+int ogs_dbi_async_submit(ogs_dbi_request_t *request);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_DBI_ASYNC_H */
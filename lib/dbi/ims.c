@@ -23,6 +23,8 @@ int ogs_dbi_msisdn_data(
         char *imsi_or_msisdn_bcd, ogs_msisdn_data_t *msisdn_data)
 {
     int rv = OGS_OK;
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
     mongoc_cursor_t *cursor = NULL;
     bson_t *query = NULL;
     bson_error_t error;
@@ -42,6 +44,8 @@ int ogs_dbi_msisdn_data(
     /* msisdn_data should be initialized to zero */
     ogs_assert(memcmp(msisdn_data, &zero_data, sizeof(zero_data)) == 0);
 
+    collection = ogs_mongoc_subscriber_pop(&client);
+
     query = BCON_NEW("$or",
             "[",
                 "{", "imsi", BCON_UTF8(imsi_or_msisdn_bcd), "}",
@@ -49,9 +53,9 @@ int ogs_dbi_msisdn_data(
             "]");
 #if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
     cursor = mongoc_collection_find_with_opts(
-            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
+            collection, query, NULL, NULL);
 #else
-    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
+    cursor = mongoc_collection_find(collection,
             MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
 #endif
 
@@ -113,6 +117,7 @@ int ogs_dbi_msisdn_data(
 out:
     if (query) bson_destroy(query);
     if (cursor) mongoc_cursor_destroy(cursor);
+    if (collection) ogs_mongoc_subscriber_push(client, collection);
 
     return rv;
 }
@@ -120,6 +125,8 @@ out:
 int ogs_dbi_ims_data(char *supi, ogs_ims_data_t *ims_data)
 {
     int rv = OGS_OK;
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
     mongoc_cursor_t *cursor = NULL;
     bson_t *query = NULL;
     bson_error_t error;
@@ -147,12 +154,14 @@ int ogs_dbi_ims_data(char *supi, ogs_ims_data_t *ims_data)
     supi_id = ogs_id_get_value(supi);
     ogs_assert(supi_id);
 
+    collection = ogs_mongoc_subscriber_pop(&client);
+
     query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
 #if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
     cursor = mongoc_collection_find_with_opts(
-            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
+            collection, query, NULL, NULL);
 #else
-    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
+    cursor = mongoc_collection_find(collection,
             MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
 #endif
 
@@ -206,6 +215,7 @@ int ogs_dbi_ims_data(char *supi, ogs_ims_data_t *ims_data)
 out:
     if (query) bson_destroy(query);
     if (cursor) mongoc_cursor_destroy(cursor);
+    if (collection) ogs_mongoc_subscriber_push(client, collection);
 
     ogs_free(supi_type);
     ogs_free(supi_id);
@@ -84,6 +84,7 @@ int ogs_mongoc_init(const char *db_uri)
     bson_iter_t iter;
 
     const mongoc_uri_t *uri;
+    mongoc_uri_t *pool_uri = NULL;
 
     if (!db_uri) {
         ogs_error("No DB_URI");
@@ -117,6 +118,25 @@ int ogs_mongoc_init(const char *db_uri)
     self.database = mongoc_client_get_database(self.client, self.name);
     ogs_assert(self.database);
 
+    /*
+     * The client above is not thread-safe and is used only in
+     * the main thread(server status, change stream). The queries are
+     * done with the clients from this pool, so that they can run
+     * in parallel. The size is limited with 'maxPoolSize' in DB URI.
+     */
+    pool_uri = mongoc_uri_new(db_uri);
+    ogs_assert(pool_uri);
+    self.pool = mongoc_client_pool_new(pool_uri);
+    mongoc_uri_destroy(pool_uri);
+    if (!self.pool) {
+        ogs_error("mongoc_client_pool_new() failed [%s]", self.masked_db_uri);
+        return OGS_ERROR;
+    }
+
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 4
+    mongoc_client_pool_set_error_api(self.pool, 2);
+#endif
+
     if (!ogs_mongoc_mongoc_client_get_server_status(
                 self.client, NULL, &reply, &error)) {
         ogs_warn("Failed to connect to server [%s]", self.masked_db_uri);
@@ -134,6 +154,10 @@ int ogs_mongoc_init(const char *db_uri)
 
 void ogs_mongoc_final(void)
 {
+    if (self.pool) {
+        mongoc_client_pool_destroy(self.pool);
+        self.pool = NULL;
+    }
     if (self.database) {
         mongoc_database_destroy(self.database);
         self.database = NULL;
@@ -158,6 +182,35 @@ ogs_mongoc_t *ogs_mongoc(void)
     return &self;
 }
 
+mongoc_collection_t *ogs_mongoc_subscriber_pop(mongoc_client_t **client)
+{
+    mongoc_collection_t *collection = NULL;
+
+    ogs_assert(client);
+    ogs_assert(self.pool);
+    ogs_assert(self.name);
+
+    *client = mongoc_client_pool_pop(self.pool);
+    ogs_assert(*client);
+
+    collection = mongoc_client_get_collection(
+            *client, self.name, "subscribers");
+    ogs_assert(collection);
+
+    return collection;
+}
+
+void ogs_mongoc_subscriber_push(
+        mongoc_client_t *client, mongoc_collection_t *collection)
+{
+    ogs_assert(client);
+    ogs_assert(collection);
+    ogs_assert(self.pool);
+
+    mongoc_collection_destroy(collection);
+    mongoc_client_pool_push(self.pool, client);
+}
+
 int ogs_dbi_init(const char *db_uri)
 {
     int rv;
@@ -37,6 +37,9 @@ typedef struct ogs_mongoc_s {
     void *client;
     void *database;
 
+    /* Clients for the DB threads(HSS/UDR/PCF) */
+    void *pool;
+
 #if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 9
     mongoc_change_stream_t *stream;
 #endif
@@ -52,6 +55,15 @@ int ogs_mongoc_init(const char *db_uri);
 void ogs_mongoc_final(void);
 ogs_mongoc_t *ogs_mongoc(void);
 
+/*
+ * Take a client from the pool and get the 'subscribers' collection.
+ * It can be called from any thread. Give it back with
+ * ogs_mongoc_subscriber_push().
+ */
+mongoc_collection_t *ogs_mongoc_subscriber_pop(mongoc_client_t **client);
+void ogs_mongoc_subscriber_push(
+        mongoc_client_t *client, mongoc_collection_t *collection);
+
 int ogs_dbi_init(const char *db_uri);
 void ogs_dbi_final(void);
 
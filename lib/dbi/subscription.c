@@ -19,58 +19,21 @@
 
 #include "ogs-dbi.h"
 
-int ogs_dbi_auth_info(char *supi, ogs_dbi_auth_info_t *auth_info)
+static int auth_info_from_document(
+        const bson_t *document, ogs_dbi_auth_info_t *auth_info)
 {
-    int rv = OGS_OK;
-    mongoc_cursor_t *cursor = NULL;
-    bson_t *query = NULL;
-    bson_error_t error;
-    const bson_t *document;
     bson_iter_t iter;
     bson_iter_t inner_iter;
     char buf[OGS_KEY_LEN];
     char *utf8 = NULL;
     uint32_t length = 0;
 
-    char *supi_type = NULL;
-    char *supi_id = NULL;
-
-    ogs_assert(supi);
+    ogs_assert(document);
     ogs_assert(auth_info);
 
-    supi_type = ogs_id_get_type(supi);
-    ogs_assert(supi_type);
-    supi_id = ogs_id_get_value(supi);
-    ogs_assert(supi_id);
-
-    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
-#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
-    cursor = mongoc_collection_find_with_opts(
-            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
-#else
-    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
-            MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
-#endif
-
-    if (!mongoc_cursor_next(cursor, &document)) {
-        ogs_info("[%s] Cannot find IMSI in DB", supi);
-
-        rv = OGS_ERROR;
-        goto out;
-    }
-
-    if (mongoc_cursor_error(cursor, &error)) {
-        ogs_error("Cursor Failure: %s", error.message);
-
-        rv = OGS_ERROR;
-        goto out;
-    }
-
     if (!bson_iter_init_find(&iter, document, "security")) {
         ogs_error("No 'security' field in this document");
-
-        rv = OGS_ERROR;
-        goto out;
+        return OGS_ERROR;
     }
 
     memset(auth_info, 0, sizeof(ogs_dbi_auth_info_t));
@@ -104,9 +67,214 @@ int ogs_dbi_auth_info(char *supi, ogs_dbi_auth_info_t *auth_info)
         }
     }
 
+    return OGS_OK;
+}
+
+/*
+ * Run findAndModify() with the update and get the 'security' field
+ * of the document before(_new = false) or after(_new = true) the update.
+ */
+static int find_and_modify_security(mongoc_collection_t *collection,
+        char *supi, const bson_t *query, const bson_t *update, bool _new,
+        ogs_dbi_auth_info_t *auth_info)
+{
+    int rv = OGS_OK;
+    bson_t *fields = NULL;
+    bson_t reply;
+    bson_t value;
+    bson_error_t error;
+    bson_iter_t iter;
+    const uint8_t *data = NULL;
+    uint32_t length = 0;
+
+    ogs_assert(collection);
+    ogs_assert(supi);
+    ogs_assert(query);
+    ogs_assert(update);
+    ogs_assert(auth_info);
+
+    fields = BCON_NEW("security", BCON_INT32(1));
+
+    if (!mongoc_collection_find_and_modify(collection, query, NULL, update,
+            fields, false, false, _new, &reply, &error)) {
+        ogs_error("mongoc_collection_find_and_modify() failure: %s",
+                error.message);
+
+        rv = OGS_ERROR;
+        goto out;
+    }
+
+    if (!bson_iter_init_find(&iter, &reply, "value") ||
+        !BSON_ITER_HOLDS_DOCUMENT(&iter)) {
+        ogs_info("[%s] Cannot find IMSI in DB", supi);
+
+        rv = OGS_ERROR;
+        goto out;
+    }
+
+    bson_iter_document(&iter, &length, &data);
+    if (!bson_init_static(&value, data, length)) {
+        ogs_error("bson_init_static() failed");
+
+        rv = OGS_ERROR;
+        goto out;
+    }
+
+    rv = auth_info_from_document(&value, auth_info);
+
+out:
+    bson_destroy(&reply);
+    bson_destroy(fields);
+
+    return rv;
+}
+
+/*
+ * SQN is a 48-bit counter. It is incremented with $inc, so it can
+ * go over OGS_MAX_SQN. Only in that (very rare) case, the wrap-around is
+ * done with the second update.
+ */
+static int wrap_sqn(mongoc_collection_t *collection, const bson_t *query)
+{
+    int rv = OGS_OK;
+    bson_t *update = NULL;
+    bson_error_t error;
+    uint64_t max_sqn = OGS_MAX_SQN;
+
+    ogs_assert(collection);
+    ogs_assert(query);
+
+    update = BCON_NEW("$bit",
+            "{",
+                "security.sqn",
+                "{", "and", BCON_INT64(max_sqn), "}",
+            "}");
+    if (!mongoc_collection_update(collection,
+            MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
+        ogs_error("mongoc_collection_update() failure: %s", error.message);
+
+        rv = OGS_ERROR;
+    }
+
+    bson_destroy(update);
+
+    return rv;
+}
+
+int ogs_dbi_auth_info(char *supi, ogs_dbi_auth_info_t *auth_info)
+{
+    int rv = OGS_OK;
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
+    mongoc_cursor_t *cursor = NULL;
+    bson_t *query = NULL;
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
+    bson_t *opts = NULL;
+#else
+    bson_t *fields = NULL;
+#endif
+    bson_error_t error;
+    const bson_t *document;
+
+    char *supi_type = NULL;
+    char *supi_id = NULL;
+
+    ogs_assert(supi);
+    ogs_assert(auth_info);
+
+    supi_type = ogs_id_get_type(supi);
+    ogs_assert(supi_type);
+    supi_id = ogs_id_get_value(supi);
+    ogs_assert(supi_id);
+
+    collection = ogs_mongoc_subscriber_pop(&client);
+
+    /* Only the 'security' field is needed */
+    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
+    opts = BCON_NEW("projection", "{", "security", BCON_INT32(1), "}");
+    cursor = mongoc_collection_find_with_opts(
+            collection, query, opts, NULL);
+#else
+    fields = BCON_NEW("security", BCON_INT32(1));
+    cursor = mongoc_collection_find(collection,
+            MONGOC_QUERY_NONE, 0, 0, 0, query, fields, NULL);
+#endif
+
+    if (!mongoc_cursor_next(cursor, &document)) {
+        ogs_info("[%s] Cannot find IMSI in DB", supi);
+
+        rv = OGS_ERROR;
+        goto out;
+    }
+
+    if (mongoc_cursor_error(cursor, &error)) {
+        ogs_error("Cursor Failure: %s", error.message);
+
+        rv = OGS_ERROR;
+        goto out;
+    }
+
+    rv = auth_info_from_document(document, auth_info);
+
 out:
     if (query) bson_destroy(query);
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
+    if (opts) bson_destroy(opts);
+#else
+    if (fields) bson_destroy(fields);
+#endif
     if (cursor) mongoc_cursor_destroy(cursor);
+    if (collection) ogs_mongoc_subscriber_push(client, collection);
+
+    ogs_free(supi_type);
+    ogs_free(supi_id);
+
+    return rv;
+}
+
+int ogs_dbi_auth_info_increment_sqn(
+        char *supi, ogs_dbi_auth_info_t *auth_info)
+{
+    int rv = OGS_OK;
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
+    bson_t *query = NULL;
+    bson_t *update = NULL;
+
+    char *supi_type = NULL;
+    char *supi_id = NULL;
+
+    ogs_assert(supi);
+    ogs_assert(auth_info);
+
+    supi_type = ogs_id_get_type(supi);
+    ogs_assert(supi_type);
+    supi_id = ogs_id_get_value(supi);
+    ogs_assert(supi_id);
+
+    collection = ogs_mongoc_subscriber_pop(&client);
+
+    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
+    update = BCON_NEW("$inc",
+            "{",
+                "security.sqn", BCON_INT64(32),
+            "}");
+
+    /* Read the SQN and increment it in the same operation */
+    rv = find_and_modify_security(
+            collection, supi, query, update, false, auth_info);
+    if (rv != OGS_OK)
+        goto out;
+
+    if (auth_info->sqn + 32 > OGS_MAX_SQN)
+        rv = wrap_sqn(collection, query);
+    auth_info->sqn &= OGS_MAX_SQN;
+
+out:
+    if (query) bson_destroy(query);
+    if (update) bson_destroy(update);
+    if (collection) ogs_mongoc_subscriber_push(client, collection);
 
     ogs_free(supi_type);
     ogs_free(supi_id);
@@ -117,6 +285,8 @@ out:
 int ogs_dbi_update_sqn(char *supi, uint64_t sqn)
 {
     int rv = OGS_OK;
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
     bson_t *query = NULL;
     bson_t *update = NULL;
     bson_error_t error;
@@ -131,13 +301,15 @@ int ogs_dbi_update_sqn(char *supi, uint64_t sqn)
     supi_id = ogs_id_get_value(supi);
     ogs_assert(supi_id);
 
+    collection = ogs_mongoc_subscriber_pop(&client);
+
     query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
     update = BCON_NEW("$set",
             "{",
                 "security.sqn", BCON_INT64(sqn),
             "}");
 
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
+    if (!mongoc_collection_update(collection,
             MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
         ogs_error("mongoc_collection_update() failure: %s", error.message);
 
@@ -146,6 +318,7 @@ int ogs_dbi_update_sqn(char *supi, uint64_t sqn)
 
     if (query) bson_destroy(query);
     if (update) bson_destroy(update);
+    if (collection) ogs_mongoc_subscriber_push(client, collection);
 
     ogs_free(supi_type);
     ogs_free(supi_id);
@@ -156,6 +329,8 @@ int ogs_dbi_update_sqn(char *supi, uint64_t sqn)
 int ogs_dbi_update_imeisv(char *supi, char *imeisv)
 {
     int rv = OGS_OK;
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
     bson_t *query = NULL;
     bson_t *update = NULL;
     bson_error_t error;
@@ -173,12 +348,14 @@ int ogs_dbi_update_imeisv(char *supi, char *imeisv)
     ogs_debug("SUPI type: %s, SUPI id: %s, imeisv: %s",
             supi_type, supi_id, imeisv);
 
+    collection = ogs_mongoc_subscriber_pop(&client);
+
     query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
     update = BCON_NEW("$set",
             "{",
                 "imeisv", BCON_UTF8(imeisv),
             "}");
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
+    if (!mongoc_collection_update(collection,
             MONGOC_UPDATE_UPSERT, query, update, NULL, &error)) {
         ogs_error("mongoc_collection_update() failure: %s", error.message);
 
@@ -187,6 +364,7 @@ int ogs_dbi_update_imeisv(char *supi, char *imeisv)
 
     if (query) bson_destroy(query);
     if (update) bson_destroy(update);
+    if (collection) ogs_mongoc_subscriber_push(client, collection);
 
     ogs_free(supi_type);
     ogs_free(supi_id);
@@ -198,6 +376,8 @@ int ogs_dbi_update_mme(char *supi, char *mme_host, char *mme_realm,
     bool purge_flag)
 {
     int rv = OGS_OK;
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
     bson_t *query = NULL;
     bson_t *update = NULL;
     bson_error_t error;
@@ -215,6 +395,8 @@ int ogs_dbi_update_mme(char *supi, char *mme_host, char *mme_realm,
     ogs_debug("SUPI type: %s, SUPI id: %s, mme_host: %s, mme_realm: %s",
             supi_type, supi_id, mme_host, mme_realm);
 
+    collection = ogs_mongoc_subscriber_pop(&client);
+
     query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
     update = BCON_NEW("$set",
             "{",
@@ -223,7 +405,7 @@ int ogs_dbi_update_mme(char *supi, char *mme_host, char *mme_realm,
                 "mme_timestamp", BCON_INT64(ogs_time_now()),
                 "purge_flag", BCON_BOOL(purge_flag),
             "}");
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
+    if (!mongoc_collection_update(collection,
             MONGOC_UPDATE_UPSERT, query, update, NULL, &error)) {
         ogs_error("mongoc_collection_update() failure: %s", error.message);
 
@@ -232,6 +414,7 @@ int ogs_dbi_update_mme(char *supi, char *mme_host, char *mme_realm,
 
     if (query) bson_destroy(query);
     if (update) bson_destroy(update);
+    if (collection) ogs_mongoc_subscriber_push(client, collection);
 
     ogs_free(supi_type);
     ogs_free(supi_id);
@@ -242,10 +425,11 @@ int ogs_dbi_update_mme(char *supi, char *mme_host, char *mme_realm,
 int ogs_dbi_increment_sqn(char *supi)
 {
     int rv = OGS_OK;
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
     bson_t *query = NULL;
     bson_t *update = NULL;
-    bson_error_t error;
-    uint64_t max_sqn = OGS_MAX_SQN;
+    ogs_dbi_auth_info_t auth_info;
 
     char *supi_type = NULL;
     char *supi_id = NULL;
@@ -257,35 +441,26 @@ int ogs_dbi_increment_sqn(char *supi)
     supi_id = ogs_id_get_value(supi);
     ogs_assert(supi_id);
 
+    collection = ogs_mongoc_subscriber_pop(&client);
+
     query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
     update = BCON_NEW("$inc",
             "{",
                 "security.sqn", BCON_INT64(32),
             "}");
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
-            MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
-        ogs_error("mongoc_collection_update() failure: %s", error.message);
 
-        rv = OGS_ERROR;
+    rv = find_and_modify_security(
+            collection, supi, query, update, true, &auth_info);
+    if (rv != OGS_OK)
         goto out;
-    }
-    bson_destroy(update);
-
-    update = BCON_NEW("$bit",
-            "{",
-                "security.sqn", 
-                "{", "and", BCON_INT64(max_sqn), "}",
-            "}");
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
-            MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
-        ogs_error("mongoc_collection_update() failure: %s", error.message);
 
-        rv = OGS_ERROR;
-    }
+    if (auth_info.sqn > OGS_MAX_SQN)
+        rv = wrap_sqn(collection, query);
 
 out:
     if (query) bson_destroy(query);
     if (update) bson_destroy(update);
+    if (collection) ogs_mongoc_subscriber_push(client, collection);
 
     ogs_free(supi_type);
     ogs_free(supi_id);
@@ -297,6 +472,8 @@ int ogs_dbi_subscription_data(char *supi,
         ogs_subscription_data_t *subscription_data)
 {
     int rv = OGS_OK;
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
     mongoc_cursor_t *cursor = NULL;
     bson_t *query = NULL;
     bson_error_t error;
@@ -325,12 +502,14 @@ int ogs_dbi_subscription_data(char *supi,
     supi_id = ogs_id_get_value(supi);
     ogs_assert(supi_id);
 
+    collection = ogs_mongoc_subscriber_pop(&client);
+
     query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
 #if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
     cursor = mongoc_collection_find_with_opts(
-            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
+            collection, query, NULL, NULL);
 #else
-    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
+    cursor = mongoc_collection_find(collection,
             MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
 #endif
 
@@ -784,6 +963,7 @@ int ogs_dbi_subscription_data(char *supi,
 out:
     if (query) bson_destroy(query);
     if (cursor) mongoc_cursor_destroy(cursor);
+    if (collection) ogs_mongoc_subscriber_push(client, collection);
 
     ogs_free(supi_type);
     ogs_free(supi_id);
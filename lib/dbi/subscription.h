@@ -39,6 +39,13 @@ typedef struct ogs_dbi_auth_info_s {
 } ogs_dbi_auth_info_t;
 
 int ogs_dbi_auth_info(char *supi, ogs_dbi_auth_info_t *auth_info);
+/*
+ * Get the authentication info and increment SQN in the DB
+ * with one findAndModify command. auth_info->sqn is the value
+ * before the increment.
+ */
+int ogs_dbi_auth_info_increment_sqn(
+        char *supi, ogs_dbi_auth_info_t *auth_info);
 int ogs_dbi_update_sqn(char *supi, uint64_t sqn);
 int ogs_dbi_increment_sqn(char *supi);
 int ogs_dbi_update_imeisv(char *supi, char *imeisv);
@@ -76,6 +76,13 @@ typedef struct ogs_gtp_node_s {
 
     ogs_list_t      local_list;
     ogs_list_t      remote_list;
+    ogs_ihash_t     *xact_hash;     /* hash table for Transaction(ORG+XID) */
+
+    struct {
+        ogs_timer_t *timer;         /* Expires the earliest deadline */
+        ogs_list_t  response_list;  /* Deadlines in order of expiration */
+        ogs_list_t  holding_list;
+    } xact_timer;
 } ogs_gtp_node_t;
 
 typedef struct ogs_gtpu_resource_s {
@@ -129,6 +129,139 @@ int ogs_gtp_sendto(ogs_gtp_node_t *gnode, ogs_pkbuf_t *pkbuf)
     return OGS_OK;
 }
 
+/*
+ * GTP-U Transmit Batch
+ *
+ * While a batch is started, ogs_gtp2_send_user_plane() does not call
+ * sendto() for each packet. The packets are queued here, and
+ * ogs_gtp_tx_batch_flush() sends them with one sendmmsg() per socket.
+ *
+ * The batch is kept per thread, so that each UPF datapath worker
+ * can run its own batch.
+ */
+static OGS_THREAD_LOCAL struct {
+    bool started;
+    int num;
+
+    ogs_socket_t fd[OGS_MAX_NUM_OF_MMSG];
+    ogs_sockaddr_t addr[OGS_MAX_NUM_OF_MMSG];
+    ogs_pkbuf_t *pkbuf[OGS_MAX_NUM_OF_MMSG];
+} tx_batch;
+
+#define TX_BATCH_MAX_RETRY 3
+
+static void tx_batch_send(void)
+{
+    ogs_pkbuf_t *pkbuf[OGS_MAX_NUM_OF_MMSG];
+    ogs_sockaddr_t *to[OGS_MAX_NUM_OF_MMSG];
+    bool sent[OGS_MAX_NUM_OF_MMSG];
+    ogs_socket_t fd;
+    ogs_err_t err;
+    int i, j, n, rv, done, dropped, retry;
+
+    memset(sent, 0, sizeof(sent));
+
+    for (i = 0; i < tx_batch.num; i++) {
+        if (sent[i] == true)
+            continue;
+
+        /* Gather all packets for the same socket, keeping the order */
+        fd = tx_batch.fd[i];
+        n = 0;
+        for (j = i; j < tx_batch.num; j++) {
+            if (sent[j] == true || tx_batch.fd[j] != fd)
+                continue;
+
+            pkbuf[n] = tx_batch.pkbuf[j];
+            to[n] = &tx_batch.addr[j];
+            n++;
+
+            sent[j] = true;
+        }
+
+        /*
+         * sendmmsg() stops at the first packet it cannot send.
+         * The rest is sent again from there. A packet that fails with
+         * an error other than EAGAIN/EINTR is dropped alone. EAGAIN is
+         * retried a few times before the remaining packets are dropped.
+         */
+        done = dropped = retry = 0;
+        while (done < n) {
+            rv = ogs_sendmmsg(fd, pkbuf + done, to + done, n - done, 0);
+            if (rv > 0) {
+                done += rv;
+                retry = 0;
+                continue;
+            }
+
+            err = ogs_socket_errno;
+            if (rv < 0 && err == OGS_EINTR)
+                continue;
+            if (rv < 0 && err == OGS_EAGAIN) {
+                if (retry++ < TX_BATCH_MAX_RETRY)
+                    continue;
+                dropped += n - done;
+                break;
+            }
+
+            ogs_log_message(OGS_LOG_ERROR, err,
+                    "ogs_sendmmsg(%u, %d) failed [%d]", fd, n - done, rv);
+            dropped++;
+            done++;
+        }
+
+        if (dropped)
+            ogs_warn("%d of %d packets dropped on socket %u", dropped, n, fd);
+    }
+
+    for (i = 0; i < tx_batch.num; i++)
+        ogs_pkbuf_free(tx_batch.pkbuf[i]);
+
+    tx_batch.num = 0;
+}
+
+void ogs_gtp_tx_batch_start(void)
+{
+    ogs_assert(tx_batch.started == false);
+    ogs_assert(tx_batch.num == 0);
+
+    tx_batch.started = true;
+}
+
+bool ogs_gtp_tx_batch_started(void)
+{
+    return tx_batch.started;
+}
+
+/* The pkbuf will be freed by ogs_gtp_tx_batch_flush() */
+int ogs_gtp_tx_batch_add(ogs_gtp_node_t *gnode, ogs_pkbuf_t *pkbuf)
+{
+    ogs_assert(tx_batch.started == true);
+    ogs_assert(gnode);
+    ogs_assert(gnode->sock);
+    ogs_assert(pkbuf);
+
+    if (tx_batch.num == OGS_MAX_NUM_OF_MMSG)
+        tx_batch_send();
+
+    tx_batch.fd[tx_batch.num] = gnode->sock->fd;
+    memcpy(&tx_batch.addr[tx_batch.num], &gnode->addr, sizeof(gnode->addr));
+    tx_batch.pkbuf[tx_batch.num] = pkbuf;
+    tx_batch.num++;
+
+    return OGS_OK;
+}
+
+void ogs_gtp_tx_batch_flush(void)
+{
+    ogs_assert(tx_batch.started == true);
+
+    if (tx_batch.num)
+        tx_batch_send();
+
+    tx_batch.started = false;
+}
+
 void ogs_gtp_send_error_message(
         ogs_gtp_xact_t *xact, uint32_t teid, uint8_t type, uint8_t cause_value)
 {
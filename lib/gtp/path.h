@@ -72,6 +72,11 @@ int ogs_gtp_connect(ogs_sock_t *ipv4, ogs_sock_t *ipv6, ogs_gtp_node_t *gnode);
 int ogs_gtp_send(ogs_gtp_node_t *gnode, ogs_pkbuf_t *pkbuf);
 int ogs_gtp_sendto(ogs_gtp_node_t *gnode, ogs_pkbuf_t *pkbuf);
 
+void ogs_gtp_tx_batch_start(void);
+bool ogs_gtp_tx_batch_started(void);
+int ogs_gtp_tx_batch_add(ogs_gtp_node_t *gnode, ogs_pkbuf_t *pkbuf);
+void ogs_gtp_tx_batch_flush(void);
+
 void ogs_gtp_send_error_message(
         ogs_gtp_xact_t *xact, uint32_t teid, uint8_t type, uint8_t cause_value);
 
@@ -113,6 +113,10 @@ int ogs_gtp2_send_user_plane(
 
     ogs_debug("SEND GTP-U[%d] to Peer[%s] : TEID[0x%x]",
             gtp_hdesc->type, OGS_ADDR(&gnode->addr, buf), gtp_hdesc->teid);
+
+    if (ogs_gtp_tx_batch_started() == true)
+        return ogs_gtp_tx_batch_add(gnode, pkbuf);
+
     rv = ogs_gtp_sendto(gnode, pkbuf);
     if (rv != OGS_OK) {
         if (ogs_socket_errno != OGS_EAGAIN) {
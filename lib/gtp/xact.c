@@ -21,6 +21,9 @@
 #include "ogs-gtp.h"
 #include "ogs-app.h"
 
+#define GTP_XACT_KEY(__oRG, __vER, __xID) \
+    (((uint64_t)(__oRG) << 40) | ((uint64_t)(__vER) << 32) | (__xID))
+
 typedef enum {
     GTP_XACT_UNKNOWN_STAGE,
     GTP_XACT_INITIAL_STAGE,
@@ -40,15 +43,25 @@ static int ogs_gtp_xact_delete(ogs_gtp_xact_t *xact);
 static int ogs_gtp_xact_update_rx(ogs_gtp_xact_t *xact, uint8_t type);
 static ogs_gtp_xact_t *ogs_gtp_xact_find_by_xid(
         ogs_gtp_node_t *gnode, uint8_t type, uint8_t gtp_version, uint32_t xid);
+static void ogs_gtp_xact_add(ogs_gtp_xact_t *xact);
+
+static void xact_timer_start(ogs_gtp_xact_t *xact,
+        ogs_gtp_xact_timer_t *tm, ogs_time_t duration);
+static void xact_timer_stop(ogs_gtp_xact_t *xact, ogs_gtp_xact_timer_t *tm);
+static void node_timer_update(ogs_gtp_node_t *gnode);
+static void node_timeout(void *data);
 
 static void response_timeout(void *data);
 static void holding_timeout(void *data);
 
+/* GTP node whose timer is being expired in node_timeout() */
+static ogs_gtp_node_t *expiring_node = NULL;
+
 int ogs_gtp_xact_init(void)
 {
     ogs_assert(ogs_gtp_xact_initialized == 0);
 
-    ogs_pool_init(&pool, ogs_app()->pool.xact);
+    ogs_pool_elastic_init(&pool, ogs_app()->pool.xact);
 
     g_xact_id = 0;
 
@@ -90,18 +103,10 @@ ogs_gtp_xact_t *ogs_gtp1_xact_local_create(ogs_gtp_node_t *gnode,
     xact->cb = cb;
     xact->data = data;
 
-    xact->tm_response = ogs_timer_add(
-            ogs_app()->timer_mgr, response_timeout, xact);
-    ogs_assert(xact->tm_response);
-    xact->response_rcount = ogs_app()->time.message.gtp.n3_response_rcount,
+    xact->response_rcount = ogs_app()->time.message.gtp.n3_response_rcount;
+    xact->holding_rcount = ogs_app()->time.message.gtp.n3_holding_rcount;
 
-    xact->tm_holding = ogs_timer_add(
-            ogs_app()->timer_mgr, holding_timeout, xact);
-    ogs_assert(xact->tm_holding);
-    xact->holding_rcount = ogs_app()->time.message.gtp.n3_holding_rcount,
-
-    ogs_list_add(xact->org == OGS_GTP_LOCAL_ORIGINATOR ?
-            &xact->gnode->local_list : &xact->gnode->remote_list, xact);
+    ogs_gtp_xact_add(xact);
 
     rv = ogs_gtp1_xact_update_tx(xact, hdesc, pkbuf);
     if (rv != OGS_OK) {
@@ -148,18 +153,10 @@ ogs_gtp_xact_t *ogs_gtp_xact_local_create(ogs_gtp_node_t *gnode,
     xact->cb = cb;
     xact->data = data;
 
-    xact->tm_response = ogs_timer_add(
-            ogs_app()->timer_mgr, response_timeout, xact);
-    ogs_assert(xact->tm_response);
-    xact->response_rcount = ogs_app()->time.message.gtp.n3_response_rcount,
+    xact->response_rcount = ogs_app()->time.message.gtp.n3_response_rcount;
+    xact->holding_rcount = ogs_app()->time.message.gtp.n3_holding_rcount;
 
-    xact->tm_holding = ogs_timer_add(
-            ogs_app()->timer_mgr, holding_timeout, xact);
-    ogs_assert(xact->tm_holding);
-    xact->holding_rcount = ogs_app()->time.message.gtp.n3_holding_rcount,
-
-    ogs_list_add(xact->org == OGS_GTP_LOCAL_ORIGINATOR ?
-            &xact->gnode->local_list : &xact->gnode->remote_list, xact);
+    ogs_gtp_xact_add(xact);
 
     rv = ogs_gtp_xact_update_tx(xact, hdesc, pkbuf);
     if (rv != OGS_OK) {
@@ -195,18 +192,10 @@ static ogs_gtp_xact_t *ogs_gtp_xact_remote_create(ogs_gtp_node_t *gnode, uint8_t
             OGS_GTP1_SQN_TO_XID(sqn) : OGS_GTP2_SQN_TO_XID(sqn);
     xact->gnode = gnode;
 
-    xact->tm_response = ogs_timer_add(
-            ogs_app()->timer_mgr, response_timeout, xact);
-    ogs_assert(xact->tm_response);
-    xact->response_rcount = ogs_app()->time.message.gtp.n3_response_rcount,
+    xact->response_rcount = ogs_app()->time.message.gtp.n3_response_rcount;
+    xact->holding_rcount = ogs_app()->time.message.gtp.n3_holding_rcount;
 
-    xact->tm_holding = ogs_timer_add(
-            ogs_app()->timer_mgr, holding_timeout, xact);
-    ogs_assert(xact->tm_holding);
-    xact->holding_rcount = ogs_app()->time.message.gtp.n3_holding_rcount,
-
-    ogs_list_add(xact->org == OGS_GTP_LOCAL_ORIGINATOR ?
-            &xact->gnode->local_list : &xact->gnode->remote_list, xact);
+    ogs_gtp_xact_add(xact);
 
     ogs_debug("[%d] %s Create  peer [%s]:%d",
             xact->xid,
@@ -230,6 +219,18 @@ void ogs_gtp_xact_delete_all(ogs_gtp_node_t *gnode)
         ogs_gtp_xact_delete(xact);
     ogs_list_for_each_safe(&gnode->remote_list, next_xact, xact)
         ogs_gtp_xact_delete(xact);
+
+    if (gnode->xact_hash) {
+        ogs_ihash_destroy(gnode->xact_hash);
+        gnode->xact_hash = NULL;
+    }
+    if (gnode->xact_timer.timer) {
+        ogs_timer_delete(gnode->xact_timer.timer);
+        gnode->xact_timer.timer = NULL;
+    }
+
+    if (expiring_node == gnode)
+        expiring_node = NULL;
 }
 
 int ogs_gtp1_xact_update_tx(ogs_gtp_xact_t *xact,
@@ -477,10 +478,8 @@ static int ogs_gtp_xact_update_rx(ogs_gtp_xact_t *xact, uint8_t type)
 
                 pkbuf = xact->seq[2].pkbuf;
                 if (pkbuf) {
-                    if (xact->tm_holding)
-                        ogs_timer_start(xact->tm_holding,
-                                ogs_app()->time.message.
-                                    gtp.t3_holding_duration);
+                    xact_timer_start(xact, &xact->tm_holding,
+                            ogs_app()->time.message.gtp.t3_holding_duration);
 
                     ogs_warn("[%d] %s Request Duplicated. Retransmit!"
                             " for step %d type %d peer [%s]:%d",
@@ -513,9 +512,8 @@ static int ogs_gtp_xact_update_rx(ogs_gtp_xact_t *xact, uint8_t type)
                 return OGS_ERROR;
             }
 
-            if (xact->tm_holding)
-                ogs_timer_start(xact->tm_holding,
-                        ogs_app()->time.message.gtp.t3_holding_duration);
+            xact_timer_start(xact, &xact->tm_holding,
+                    ogs_app()->time.message.gtp.t3_holding_duration);
 
             break;
 
@@ -543,10 +541,8 @@ static int ogs_gtp_xact_update_rx(ogs_gtp_xact_t *xact, uint8_t type)
 
                 pkbuf = xact->seq[1].pkbuf;
                 if (pkbuf) {
-                    if (xact->tm_holding)
-                        ogs_timer_start(xact->tm_holding,
-                                ogs_app()->time.message.
-                                    gtp.t3_holding_duration);
+                    xact_timer_start(xact, &xact->tm_holding,
+                            ogs_app()->time.message.gtp.t3_holding_duration);
 
                     ogs_warn("[%d] %s Request Duplicated. Retransmit!"
                             " for step %d type %d peer [%s]:%d",
@@ -578,9 +574,8 @@ static int ogs_gtp_xact_update_rx(ogs_gtp_xact_t *xact, uint8_t type)
                 ogs_error("invalid step[%d]", xact->step);
                 return OGS_ERROR;
             }
-            if (xact->tm_holding)
-                ogs_timer_start(xact->tm_holding,
-                        ogs_app()->time.message.gtp.t3_holding_duration);
+            xact_timer_start(xact, &xact->tm_holding,
+                    ogs_app()->time.message.gtp.t3_holding_duration);
 
             break;
 
@@ -606,8 +601,7 @@ static int ogs_gtp_xact_update_rx(ogs_gtp_xact_t *xact, uint8_t type)
         return OGS_ERROR;
     }
 
-    if (xact->tm_response)
-        ogs_timer_stop(xact->tm_response);
+    xact_timer_stop(xact, &xact->tm_response);
 
     /* Save Message type of this step */
     xact->seq[xact->step].type = type;
@@ -651,9 +645,8 @@ int ogs_gtp_xact_commit(ogs_gtp_xact_t *xact)
                 return OGS_ERROR;
             }
 
-            if (xact->tm_response)
-                ogs_timer_start(xact->tm_response,
-                        ogs_app()->time.message.gtp.t3_response_duration);
+            xact_timer_start(xact, &xact->tm_response,
+                    ogs_app()->time.message.gtp.t3_response_duration);
 
             break;
 
@@ -693,9 +686,8 @@ int ogs_gtp_xact_commit(ogs_gtp_xact_t *xact)
                 ogs_gtp_xact_delete(xact);
                 return OGS_ERROR;
             }
-            if (xact->tm_response)
-                ogs_timer_start(xact->tm_response,
-                        ogs_app()->time.message.gtp.t3_response_duration);
+            xact_timer_start(xact, &xact->tm_response,
+                    ogs_app()->time.message.gtp.t3_response_duration);
 
             break;
 
@@ -754,9 +746,8 @@ static void response_timeout(void *data)
     if (--xact->response_rcount > 0) {
         ogs_pkbuf_t *pkbuf = NULL;
 
-        if (xact->tm_response)
-            ogs_timer_start(xact->tm_response,
-                    ogs_app()->time.message.gtp.t3_response_duration);
+        xact_timer_start(xact, &xact->tm_response,
+                ogs_app()->time.message.gtp.t3_response_duration);
 
         pkbuf = xact->seq[xact->step-1].pkbuf;
         ogs_assert(pkbuf);
@@ -803,9 +794,8 @@ static void holding_timeout(void *data)
             OGS_PORT(&xact->gnode->addr));
 
     if (--xact->holding_rcount > 0) {
-        if (xact->tm_holding)
-            ogs_timer_start(xact->tm_holding,
-                    ogs_app()->time.message.gtp.t3_holding_duration);
+        xact_timer_start(xact, &xact->tm_holding,
+                ogs_app()->time.message.gtp.t3_holding_duration);
     } else {
         ogs_debug("[%d] %s Delete Transaction "
                 "for step %d type %d peer [%s]:%d",
@@ -1031,7 +1021,7 @@ static ogs_gtp_xact_t *ogs_gtp_xact_find_by_xid(
 {
     char buf[OGS_ADDRSTRLEN];
 
-    ogs_list_t *list = NULL;
+    uint8_t org;
     ogs_gtp_xact_t *xact = NULL;
     ogs_gtp_xact_stage_t stage;
 
@@ -1044,15 +1034,15 @@ static ogs_gtp_xact_t *ogs_gtp_xact_find_by_xid(
 
     switch (stage) {
     case GTP_XACT_INITIAL_STAGE:
-        list = &gnode->remote_list;
+        org = OGS_GTP_REMOTE_ORIGINATOR;
         break;
     case GTP_XACT_INTERMEDIATE_STAGE:
-        list = &gnode->local_list;
+        org = OGS_GTP_LOCAL_ORIGINATOR;
         break;
     case GTP_XACT_FINAL_STAGE:
         switch (gtp_version) {
         case 1:
-            list = &gnode->local_list; // FIXME: is this correct?
+            org = OGS_GTP_LOCAL_ORIGINATOR; // FIXME: is this correct?
             break;
         case 2:
         default:
@@ -1060,12 +1050,12 @@ static ogs_gtp_xact_t *ogs_gtp_xact_find_by_xid(
                 if (type == OGS_GTP2_MODIFY_BEARER_FAILURE_INDICATION_TYPE ||
                     type == OGS_GTP2_DELETE_BEARER_FAILURE_INDICATION_TYPE ||
                     type == OGS_GTP2_BEARER_RESOURCE_FAILURE_INDICATION_TYPE) {
-                    list = &gnode->local_list;
+                    org = OGS_GTP_LOCAL_ORIGINATOR;
                 } else {
-                    list = &gnode->remote_list;
+                    org = OGS_GTP_REMOTE_ORIGINATOR;
                 }
             } else {
-                list = &gnode->local_list;
+                org = OGS_GTP_LOCAL_ORIGINATOR;
             }
             break;
         }
@@ -1076,17 +1066,17 @@ static ogs_gtp_xact_t *ogs_gtp_xact_find_by_xid(
         return NULL;
     }
 
-    ogs_assert(list);
-    ogs_list_for_each(list, xact) {
-        if (xact->gtp_version == gtp_version && xact->xid == xid) {
-            ogs_debug("[%d] %s Find GTPv%u peer [%s]:%d",
-                    xact->xid,
-                    xact->org == OGS_GTP_LOCAL_ORIGINATOR ? "LOCAL " : "REMOTE",
-                    xact->gtp_version,
-                    OGS_ADDR(&gnode->addr, buf),
-                    OGS_PORT(&gnode->addr));
-            return xact;
-        }
+    if (gnode->xact_hash)
+        xact = ogs_ihash_get(gnode->xact_hash,
+                GTP_XACT_KEY(org, gtp_version, xid));
+    if (xact) {
+        ogs_debug("[%d] %s Find GTPv%u peer [%s]:%d",
+                xact->xid,
+                xact->org == OGS_GTP_LOCAL_ORIGINATOR ? "LOCAL " : "REMOTE",
+                xact->gtp_version,
+                OGS_ADDR(&gnode->addr, buf),
+                OGS_PORT(&gnode->addr));
+        return xact;
     }
 
     ogs_debug("[%d] Cannot find xact type %u from GTPv%u peer [%s]:%d",
@@ -1139,17 +1129,183 @@ static int ogs_gtp_xact_delete(ogs_gtp_xact_t *xact)
     if (xact->seq[2].pkbuf)
         ogs_pkbuf_free(xact->seq[2].pkbuf);
 
-    if (xact->tm_response)
-        ogs_timer_delete(xact->tm_response);
-    if (xact->tm_holding)
-        ogs_timer_delete(xact->tm_holding);
+    xact_timer_stop(xact, &xact->tm_response);
+    xact_timer_stop(xact, &xact->tm_holding);
 
     if (xact->assoc_xact)
         ogs_gtp_xact_deassociate(xact, xact->assoc_xact);
 
+    ogs_assert(xact->gnode->xact_hash);
+    if (ogs_ihash_get(xact->gnode->xact_hash, GTP_XACT_KEY(
+                    xact->org, xact->gtp_version, xact->xid)) == xact)
+        ogs_ihash_set(xact->gnode->xact_hash, GTP_XACT_KEY(
+                    xact->org, xact->gtp_version, xact->xid), NULL);
+
     ogs_list_remove(xact->org == OGS_GTP_LOCAL_ORIGINATOR ?
             &xact->gnode->local_list : &xact->gnode->remote_list, xact);
     ogs_pool_free(&pool, xact);
 
     return OGS_OK;
 }
+
+static void ogs_gtp_xact_add(ogs_gtp_xact_t *xact)
+{
+    ogs_gtp_node_t *gnode = NULL;
+
+    ogs_assert(xact);
+    gnode = xact->gnode;
+    ogs_assert(gnode);
+
+    if (!gnode->xact_hash) {
+        gnode->xact_hash = ogs_ihash_make();
+        ogs_assert(gnode->xact_hash);
+    }
+    if (!gnode->xact_timer.timer) {
+        gnode->xact_timer.timer = ogs_timer_add(
+                ogs_app()->timer_mgr, node_timeout, gnode);
+        ogs_assert(gnode->xact_timer.timer);
+    }
+
+    ogs_list_add(xact->org == OGS_GTP_LOCAL_ORIGINATOR ?
+            &gnode->local_list : &gnode->remote_list, xact);
+
+    /*
+     * If the XID has wrapped around and the old transaction is still there,
+     * the new one takes over the index.
+     */
+    ogs_ihash_set(gnode->xact_hash,
+            GTP_XACT_KEY(xact->org, xact->gtp_version, xact->xid), xact);
+}
+
+static ogs_list_t *xact_timer_list(
+        ogs_gtp_xact_t *xact, ogs_gtp_xact_timer_t *tm)
+{
+    ogs_assert(xact);
+    ogs_assert(xact->gnode);
+
+    if (tm == &xact->tm_response)
+        return &xact->gnode->xact_timer.response_list;
+    else if (tm == &xact->tm_holding)
+        return &xact->gnode->xact_timer.holding_list;
+
+    ogs_assert_if_reached();
+    return NULL;
+}
+
+static void xact_timer_start(ogs_gtp_xact_t *xact,
+        ogs_gtp_xact_timer_t *tm, ogs_time_t duration)
+{
+    ogs_list_t *list = NULL;
+    ogs_gtp_xact_timer_t *prev = NULL;
+
+    ogs_assert(tm);
+    ogs_assert(duration);
+
+    list = xact_timer_list(xact, tm);
+    ogs_assert(list);
+
+    if (tm->expires)
+        ogs_list_remove(list, tm);
+
+    tm->expires = ogs_get_monotonic_time() + duration;
+
+    /*
+     * All the deadlines in a list are started with the same duration,
+     * so the new one is almost always appended at the end.
+     */
+    ogs_list_reverse_for_each(list, prev) {
+        if (prev->expires <= tm->expires)
+            break;
+    }
+    if (prev)
+        ogs_list_insert_next(list, prev, tm);
+    else
+        ogs_list_prepend(list, tm);
+
+    /* Only the earliest deadline needs the timer of the node */
+    if (ogs_list_first(list) == tm)
+        node_timer_update(xact->gnode);
+}
+
+static void xact_timer_stop(ogs_gtp_xact_t *xact, ogs_gtp_xact_timer_t *tm)
+{
+    ogs_assert(tm);
+
+    if (!tm->expires)
+        return;
+
+    /*
+     * The timer of the node is left as it is.
+     * If it fires earlier than needed, node_timeout() starts it again.
+     */
+    ogs_list_remove(xact_timer_list(xact, tm), tm);
+    tm->expires = 0;
+}
+
+static ogs_gtp_xact_timer_t *node_timer_first(ogs_gtp_node_t *gnode)
+{
+    ogs_gtp_xact_timer_t *first = NULL, *tm = NULL;
+
+    ogs_assert(gnode);
+
+    first = ogs_list_first(&gnode->xact_timer.response_list);
+
+    tm = ogs_list_first(&gnode->xact_timer.holding_list);
+    if (tm && (!first || tm->expires < first->expires))
+        first = tm;
+
+    return first;
+}
+
+static void node_timer_update(ogs_gtp_node_t *gnode)
+{
+    ogs_gtp_xact_timer_t *first = NULL;
+    ogs_time_t now;
+
+    ogs_assert(gnode);
+    ogs_assert(gnode->xact_timer.timer);
+
+    first = node_timer_first(gnode);
+    if (!first) {
+        ogs_timer_stop(gnode->xact_timer.timer);
+        return;
+    }
+
+    now = ogs_get_monotonic_time();
+    ogs_timer_start(gnode->xact_timer.timer,
+            first->expires > now ? first->expires - now : 1);
+}
+
+static void node_timeout(void *data)
+{
+    ogs_gtp_node_t *gnode = data;
+    ogs_gtp_xact_timer_t *tm = NULL;
+    ogs_gtp_xact_t *xact = NULL;
+    ogs_time_t now;
+
+    ogs_assert(gnode);
+
+    now = ogs_get_monotonic_time();
+
+    expiring_node = gnode;
+
+    while ((tm = node_timer_first(gnode)) && tm->expires <= now) {
+        if (tm == ogs_list_first(&gnode->xact_timer.response_list)) {
+            xact = ogs_list_entry(tm, ogs_gtp_xact_t, tm_response);
+            xact_timer_stop(xact, tm);
+            response_timeout(xact);
+        } else {
+            xact = ogs_list_entry(tm, ogs_gtp_xact_t, tm_holding);
+            xact_timer_stop(xact, tm);
+            holding_timeout(xact);
+        }
+
+        /* The node has been removed by the transaction callback */
+        if (expiring_node != gnode)
+            return;
+    }
+
+    expiring_node = NULL;
+
+    node_timer_update(gnode);
+}
@@ -52,6 +52,17 @@ extern "C" {
 #define OGS_GTP1_MIN_XACT_ID             0
 #define OGS_GTP1_MAX_XACT_ID             65535
 
+/**
+ * Transaction timer
+ *
+ * The deadlines are kept in the lists of the GTP node,
+ * and only the earliest one is scheduled on the timer of the node.
+ */
+typedef struct ogs_gtp_xact_timer_s {
+    ogs_lnode_t     lnode;          /**< A node of the deadline list */
+    ogs_time_t      expires;        /**< 0 if the timer is not running */
+} ogs_gtp_xact_timer_t;
+
 /**
  * Transaction context
  */
@@ -81,9 +92,9 @@ typedef struct ogs_gtp_xact_s {
         ogs_pkbuf_t *pkbuf;         /**< Packet history */
     } seq[3];                       /**< history for the each step */
 
-    ogs_timer_t     *tm_response;   /**< Timer waiting for next message */
+    ogs_gtp_xact_timer_t tm_response;  /**< Timer waiting for next message */
     uint8_t         response_rcount;
-    ogs_timer_t     *tm_holding;    /**< Timer waiting for holding message */
+    ogs_gtp_xact_timer_t tm_holding;   /**< Timer waiting for holding message */
     uint8_t         holding_rcount;
 
     uint32_t        local_teid;     /**< Local TEID,
@@ -20,3 +20,250 @@
 #include "ogs-metrics.h"
 
 int __ogs_metrics_domain;
+
+#define FAST_COUNTER_PER_LINE (64 / sizeof(uint64_t))
+
+typedef struct ogs_metrics_fast_s {
+    ogs_lnode_t lnode;
+
+    ogs_metrics_spec_t *spec;
+    unsigned int num_of_id;
+    unsigned int stride; /* Row size, padded to a cache line */
+
+    uint64_t *counter; /* [OGS_METRICS_MAX_FAST_THREAD+1][stride] */
+    uint64_t *folded; /* [num_of_id] */
+    ogs_metrics_inst_t **inst; /* [num_of_id] */
+} ogs_metrics_fast_t;
+
+/*
+ * A thread takes a free row when it first adds to a fast counter,
+ * and gives it back when it exits. The counts stay in the row, so that
+ * the next thread keeps adding to the same totals.
+ *
+ * The last row is shared by the threads which find no free row.
+ * It is updated with an atomic add.
+ */
+#define FAST_SHARED_ROW OGS_METRICS_MAX_FAST_THREAD
+
+static OGS_LIST(fast_list);
+static ogs_thread_mutex_t fast_mutex;
+static ogs_thread_key_t fast_key;
+static bool fast_row_used[OGS_METRICS_MAX_FAST_THREAD];
+static int num_of_fast_row = 0; /* Rows used at least once */
+static int fast_generation = 0;
+
+/* Row of this thread, valid if fast_thread_generation is current */
+static OGS_THREAD_LOCAL int fast_thread_row = 0;
+static OGS_THREAD_LOCAL int fast_thread_generation = 0;
+
+static void fast_row_release(void *data)
+{
+    int row = (int)(intptr_t)data - 1;
+
+    ogs_assert(row >= 0 && row < OGS_METRICS_MAX_FAST_THREAD);
+
+    ogs_thread_mutex_lock(&fast_mutex);
+    fast_row_used[row] = false;
+    ogs_thread_mutex_unlock(&fast_mutex);
+}
+
+static void fast_row_get(void)
+{
+    int i;
+
+    fast_thread_row = FAST_SHARED_ROW;
+
+    ogs_thread_mutex_lock(&fast_mutex);
+    for (i = 0; i < OGS_METRICS_MAX_FAST_THREAD; i++) {
+        if (fast_row_used[i] == false) {
+            fast_row_used[i] = true;
+            fast_thread_row = i;
+            if (i >= num_of_fast_row)
+                num_of_fast_row = i + 1;
+            break;
+        }
+    }
+    fast_thread_generation = fast_generation;
+    ogs_thread_mutex_unlock(&fast_mutex);
+
+    /* fast_row_release() is called when the thread exits */
+    if (fast_thread_row != FAST_SHARED_ROW)
+        ogs_thread_key_set(fast_key, (void *)(intptr_t)(fast_thread_row + 1));
+    else
+        ogs_warn("No fast counter row left [%d], use the shared row",
+                OGS_METRICS_MAX_FAST_THREAD);
+}
+
+void ogs_metrics_fast_init(void)
+{
+    ogs_list_init(&fast_list);
+    ogs_thread_mutex_init(&fast_mutex);
+    ogs_assert(ogs_thread_key_create(&fast_key, fast_row_release) == OGS_OK);
+
+    memset(fast_row_used, 0, sizeof(fast_row_used));
+    num_of_fast_row = 0;
+
+    /* Rows taken before are not valid any more */
+    fast_generation++;
+}
+
+void ogs_metrics_fast_final(void)
+{
+    ogs_metrics_fast_t *fast = NULL, *next_fast = NULL;
+
+    ogs_list_for_each_safe(&fast_list, next_fast, fast)
+        ogs_metrics_fast_free(fast);
+
+    ogs_thread_key_delete(fast_key);
+    ogs_thread_mutex_destroy(&fast_mutex);
+}
+
+ogs_metrics_fast_t *ogs_metrics_fast_new(
+        ogs_metrics_spec_t *spec, unsigned int num_of_id)
+{
+    ogs_metrics_fast_t *fast = NULL;
+
+    ogs_assert(spec);
+    ogs_assert(num_of_id);
+
+    fast = ogs_calloc(1, sizeof(*fast));
+    ogs_assert(fast);
+
+    fast->spec = spec;
+    fast->num_of_id = num_of_id;
+    fast->stride = ((num_of_id + FAST_COUNTER_PER_LINE - 1) /
+            FAST_COUNTER_PER_LINE) * FAST_COUNTER_PER_LINE;
+
+    fast->counter = ogs_calloc(
+            (OGS_METRICS_MAX_FAST_THREAD + 1) * fast->stride,
+            sizeof(uint64_t));
+    ogs_assert(fast->counter);
+    fast->folded = ogs_calloc(num_of_id, sizeof(uint64_t));
+    ogs_assert(fast->folded);
+    fast->inst = ogs_calloc(num_of_id, sizeof(ogs_metrics_inst_t *));
+    ogs_assert(fast->inst);
+
+    /* A spec without label is exported with zero from the start */
+    if (num_of_id == 1)
+        fast->inst[0] = ogs_metrics_inst_new(spec, 0, NULL);
+
+    ogs_thread_mutex_lock(&fast_mutex);
+    ogs_list_add(&fast_list, fast);
+    ogs_thread_mutex_unlock(&fast_mutex);
+
+    return fast;
+}
+
+void ogs_metrics_fast_free(ogs_metrics_fast_t *fast)
+{
+    ogs_assert(fast);
+
+    ogs_thread_mutex_lock(&fast_mutex);
+    ogs_list_remove(&fast_list, fast);
+    ogs_thread_mutex_unlock(&fast_mutex);
+
+    /* Instances are freed with the spec */
+    ogs_free(fast->inst);
+    ogs_free(fast->folded);
+    ogs_free(fast->counter);
+    ogs_free(fast);
+}
+
+void ogs_metrics_fast_add(
+        ogs_metrics_fast_t *fast, unsigned int id, uint64_t val)
+{
+    uint64_t *cell = NULL;
+
+    ogs_assert(fast);
+    ogs_assert(id < fast->num_of_id);
+
+    if (ogs_unlikely(fast_thread_generation != fast_generation))
+        fast_row_get();
+
+    cell = &fast->counter[fast_thread_row * fast->stride + id];
+
+    if (ogs_unlikely(fast_thread_row == FAST_SHARED_ROW)) {
+        __atomic_fetch_add(cell, val, __ATOMIC_RELAXED);
+        return;
+    }
+
+    /*
+     * Only this thread writes to its own row. The store is atomic,
+     * so that the scrape never reads a torn value.
+     */
+    __atomic_store_n(cell,
+            __atomic_load_n(cell, __ATOMIC_RELAXED) + val, __ATOMIC_RELAXED);
+}
+
+/* Called with fast_mutex held */
+static uint64_t fast_sum(ogs_metrics_fast_t *fast, unsigned int id)
+{
+    uint64_t sum;
+    int n;
+
+    sum = __atomic_load_n(
+            &fast->counter[FAST_SHARED_ROW * fast->stride + id],
+            __ATOMIC_RELAXED);
+    for (n = 0; n < num_of_fast_row; n++)
+        sum += __atomic_load_n(
+                &fast->counter[n * fast->stride + id], __ATOMIC_RELAXED);
+
+    return sum;
+}
+
+uint64_t ogs_metrics_fast_get(ogs_metrics_fast_t *fast, unsigned int id)
+{
+    uint64_t sum;
+
+    ogs_assert(fast);
+    ogs_assert(id < fast->num_of_id);
+
+    ogs_thread_mutex_lock(&fast_mutex);
+    sum = fast_sum(fast, id);
+    ogs_thread_mutex_unlock(&fast_mutex);
+
+    return sum;
+}
+
+static void fast_fold(ogs_metrics_fast_t *fast)
+{
+    unsigned int i;
+
+    ogs_assert(fast);
+
+    for (i = 0; i < fast->num_of_id; i++) {
+        uint64_t sum = fast_sum(fast, i), delta;
+
+        delta = sum - fast->folded[i];
+        if (delta == 0)
+            continue;
+
+        if (!fast->inst[i]) {
+            char id_str[16];
+            const char *label_values[] = { id_str };
+
+            ogs_snprintf(id_str, sizeof(id_str), "%u", i);
+            fast->inst[i] = ogs_metrics_inst_new(fast->spec,
+                    fast->num_of_id == 1 ? 0 : 1, label_values);
+            ogs_assert(fast->inst[i]);
+        }
+
+        fast->folded[i] = sum;
+
+        while (delta > INT32_MAX) {
+            ogs_metrics_inst_add(fast->inst[i], INT32_MAX);
+            delta -= INT32_MAX;
+        }
+        ogs_metrics_inst_add(fast->inst[i], (int)delta);
+    }
+}
+
+void ogs_metrics_fast_fold(void)
+{
+    ogs_metrics_fast_t *fast = NULL;
+
+    ogs_thread_mutex_lock(&fast_mutex);
+    ogs_list_for_each(&fast_list, fast)
+        fast_fold(fast);
+    ogs_thread_mutex_unlock(&fast_mutex);
+}
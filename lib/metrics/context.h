@@ -72,6 +72,41 @@ static inline void ogs_metrics_inst_dec(ogs_metrics_inst_t *inst)
     ogs_metrics_inst_add(inst, -1);
 }
 
+/*
+ * Fast Counter
+ *
+ * Counters for the datapath, indexed by a small label id (e.g. QFI 0..63).
+ * Each thread adds to its own cache-line-padded row without any lock,
+ * and the rows are folded into the instances of the spec only when
+ * /metrics is scraped. The label value of an instance is the id itself.
+ * If num_of_id is 1, the spec should have no label.
+ *
+ * A thread takes a row on its first add and gives it back on exit.
+ * If all OGS_METRICS_MAX_FAST_THREAD rows are taken, the thread adds
+ * atomically to a row shared with the other such threads.
+ *
+ * Only counters are supported. Use ogs_metrics_inst_t for the rest.
+ */
+#define OGS_METRICS_MAX_FAST_THREAD 64
+
+typedef struct ogs_metrics_fast_s ogs_metrics_fast_t;
+ogs_metrics_fast_t *ogs_metrics_fast_new(
+        ogs_metrics_spec_t *spec, unsigned int num_of_id);
+void ogs_metrics_fast_free(ogs_metrics_fast_t *fast);
+void ogs_metrics_fast_add(
+        ogs_metrics_fast_t *fast, unsigned int id, uint64_t val);
+static inline void ogs_metrics_fast_inc(
+        ogs_metrics_fast_t *fast, unsigned int id)
+{
+    ogs_metrics_fast_add(fast, id, 1);
+}
+uint64_t ogs_metrics_fast_get(ogs_metrics_fast_t *fast, unsigned int id);
+void ogs_metrics_fast_fold(void);
+
+/* Called by ogs_metrics_context_init() and ogs_metrics_context_final() */
+void ogs_metrics_fast_init(void);
+void ogs_metrics_fast_final(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -79,6 +79,8 @@ void ogs_metrics_context_init(void)
     ogs_list_init(&self.server_list);
     ogs_pool_init(&metrics_server_pool, ogs_app()->pool.nf);
 
+    ogs_metrics_fast_init();
+
     context_initialized = 1;
 }
 
@@ -87,6 +89,8 @@ void ogs_metrics_context_final(void)
     ogs_metrics_spec_t *spec = NULL, *next = NULL;
     ogs_assert(context_initialized == 1);
 
+    ogs_metrics_fast_final();
+
     ogs_list_for_each_entry_safe(&self.spec_list, next, spec, entry) {
         ogs_metrics_spec_free(spec);
     }
@@ -418,6 +422,7 @@ static _MHD_Result mhd_server_access_handler(void *cls, struct MHD_Connection *c
         return ret;
     }
     if (strcmp(url, "/metrics") == 0) {
+        ogs_metrics_fast_fold();
         buf = prom_collector_registry_bridge(PROM_COLLECTOR_REGISTRY_DEFAULT);
         rsp = MHD_create_response_from_buffer(strlen(buf), (void *)buf, MHD_RESPMEM_MUST_FREE);
         ret = MHD_queue_response(connection, MHD_HTTP_OK, rsp);
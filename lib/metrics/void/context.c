@@ -36,12 +36,14 @@ void ogs_metrics_context_init(void)
 {
     ogs_assert(context_initialized == 0);
     ogs_log_install_domain(&__ogs_metrics_domain, "metrics", ogs_core()->log.level);
+    ogs_metrics_fast_init();
     context_initialized = 1;
 }
 
 void ogs_metrics_context_final(void)
 {
     ogs_assert(context_initialized == 1);
+    ogs_metrics_fast_final();
     context_initialized = 0;
 }
 
@@ -50,33 +50,35 @@ void ogs_pfcp_context_init(void)
 
     ogs_pool_init(&ogs_pfcp_node_pool, ogs_app()->pool.nf);
 
-    ogs_pool_init(&ogs_pfcp_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_elastic_init(&ogs_pfcp_sess_pool, ogs_app()->pool.sess);
 
-    ogs_pool_init(&ogs_pfcp_pdr_pool,
+    ogs_pool_elastic_init(&ogs_pfcp_pdr_pool,
             ogs_app()->pool.sess * OGS_MAX_NUM_OF_PDR);
-    ogs_pool_init(&ogs_pfcp_far_pool,
+    ogs_pool_elastic_init(&ogs_pfcp_far_pool,
             ogs_app()->pool.sess * OGS_MAX_NUM_OF_FAR);
-    ogs_pool_init(&ogs_pfcp_urr_pool,
+    ogs_pool_elastic_init(&ogs_pfcp_urr_pool,
             ogs_app()->pool.sess * OGS_MAX_NUM_OF_URR);
-    ogs_pool_init(&ogs_pfcp_qer_pool,
+    ogs_pool_elastic_init(&ogs_pfcp_qer_pool,
             ogs_app()->pool.sess * OGS_MAX_NUM_OF_QER);
-    ogs_pool_init(&ogs_pfcp_bar_pool,
+    ogs_pool_elastic_init(&ogs_pfcp_bar_pool,
             ogs_app()->pool.sess * OGS_MAX_NUM_OF_BAR);
 
-    ogs_pool_init(&ogs_pfcp_rule_pool,
+    ogs_pool_elastic_init(&ogs_pfcp_rule_pool,
             ogs_app()->pool.sess *
             OGS_MAX_NUM_OF_PDR * OGS_MAX_NUM_OF_FLOW_IN_PDR);
 
     ogs_pool_init(&ogs_pfcp_dev_pool, OGS_MAX_NUM_OF_DEV);
     ogs_pool_init(&ogs_pfcp_subnet_pool, OGS_MAX_NUM_OF_SUBNET);
 
-    self.object_teid_hash = ogs_hash_make();
+    self.object_teid_hash = ogs_ihash_make();
     ogs_assert(self.object_teid_hash);
     self.far_f_teid_hash = ogs_hash_make();
     ogs_assert(self.far_f_teid_hash);
     self.far_teid_hash = ogs_hash_make();
     ogs_assert(self.far_teid_hash);
 
+    ogs_thread_mutex_init(&self.buffer_mutex);
+
     context_initialized = 1;
 }
 
@@ -85,12 +87,14 @@ void ogs_pfcp_context_final(void)
     ogs_assert(context_initialized == 1);
 
     ogs_assert(self.object_teid_hash);
-    ogs_hash_destroy(self.object_teid_hash);
+    ogs_ihash_destroy(self.object_teid_hash);
     ogs_assert(self.far_f_teid_hash);
     ogs_hash_destroy(self.far_f_teid_hash);
     ogs_assert(self.far_teid_hash);
     ogs_hash_destroy(self.far_teid_hash);
 
+    ogs_thread_mutex_destroy(&self.buffer_mutex);
+
     ogs_pfcp_dev_remove_all();
     ogs_pfcp_subnet_remove_all();
 
@@ -874,6 +878,7 @@ ogs_pfcp_pdr_t *ogs_pfcp_pdr_add(ogs_pfcp_sess_t *sess)
     pdr->src_if = OGS_PFCP_INTERFACE_UNKNOWN;
 
     pdr->sess = sess;
+    ogs_pfcp_classifier_clear(sess);
     ogs_list_add(&sess->pdr_list, pdr);
 
     return pdr;
@@ -916,21 +921,18 @@ void ogs_pfcp_object_teid_hash_set(
     ogs_assert(pdr);
 
     if (pdr->hash.teid.len)
-        ogs_hash_set(self.object_teid_hash,
-                &pdr->hash.teid.key, pdr->hash.teid.len, NULL);
+        ogs_ihash_set(self.object_teid_hash, pdr->hash.teid.key, NULL);
 
     pdr->hash.teid.key = pdr->f_teid.teid;
     pdr->hash.teid.len = sizeof(pdr->hash.teid.key);
 
     switch(type) {
     case OGS_PFCP_OBJ_PDR_TYPE:
-        ogs_hash_set(self.object_teid_hash,
-                &pdr->hash.teid.key, pdr->hash.teid.len, pdr);
+        ogs_ihash_set(self.object_teid_hash, pdr->hash.teid.key, pdr);
         break;
     case OGS_PFCP_OBJ_SESS_TYPE:
         ogs_assert(pdr->sess);
-        ogs_hash_set(self.object_teid_hash,
-                &pdr->hash.teid.key, pdr->hash.teid.len, pdr->sess);
+        ogs_ihash_set(self.object_teid_hash, pdr->hash.teid.key, pdr->sess);
         break;
     default:
         ogs_fatal("Unknown type [%d]", type);
@@ -940,8 +942,8 @@ void ogs_pfcp_object_teid_hash_set(
 
 ogs_pfcp_object_t *ogs_pfcp_object_find_by_teid(uint32_t teid)
 {
-    return (ogs_pfcp_object_t *)ogs_hash_get(
-            self.object_teid_hash, &teid, sizeof(teid));
+    return (ogs_pfcp_object_t *)ogs_ihash_get(
+            self.object_teid_hash, teid);
 }
 
 int ogs_pfcp_object_count_by_teid(ogs_pfcp_sess_t *sess, uint32_t teid)
@@ -1027,6 +1029,7 @@ void ogs_pfcp_pdr_remove(ogs_pfcp_pdr_t *pdr)
     ogs_list_remove(&pdr->sess->pdr_list, pdr);
 
     ogs_pfcp_rule_remove_all(pdr);
+    ogs_pfcp_classifier_clear(pdr->sess);
 
     if (pdr->hash.teid.len) {
         /*
@@ -1040,8 +1043,7 @@ void ogs_pfcp_pdr_remove(ogs_pfcp_pdr_t *pdr)
          * if the current list has a TEID count of 0, there are no other PDRs.
          */
         if (ogs_pfcp_object_count_by_teid(pdr->sess, pdr->f_teid.teid) == 0)
-            ogs_hash_set(self.object_teid_hash,
-                    &pdr->hash.teid.key, pdr->hash.teid.len, NULL);
+            ogs_ihash_set(self.object_teid_hash, pdr->hash.teid.key, NULL);
     }
 
     if (pdr->dnn)
@@ -1413,6 +1415,8 @@ ogs_pfcp_qer_t *ogs_pfcp_qer_add(ogs_pfcp_sess_t *sess)
     qer->id = *(qer->id_node);
     ogs_assert(qer->id > 0 && qer->id <= OGS_MAX_NUM_OF_QER);
 
+    ogs_thread_mutex_init(&qer->policer.mutex);
+
     qer->sess = sess;
     ogs_list_add(&sess->qer_list, qer);
 
@@ -1462,6 +1466,8 @@ void ogs_pfcp_qer_remove(ogs_pfcp_qer_t *qer)
     if (qer->id_node)
         ogs_pool_free(&qer->sess->qer_id_pool, qer->id_node);
 
+    ogs_thread_mutex_destroy(&qer->policer.mutex);
+
     ogs_pool_free(&ogs_pfcp_qer_pool, qer);
 }
 
@@ -1475,6 +1481,98 @@ void ogs_pfcp_qer_remove_all(ogs_pfcp_sess_t *sess)
         ogs_pfcp_qer_remove(qer);
 }
 
+/*
+ * The bucket holds up to 100ms of traffic at the MBR,
+ * and at least one packet of the maximum size.
+ */
+#define OGS_PFCP_POLICER_BURST_TIME ogs_time_from_msec(100)
+
+static void policer_set_rate(ogs_pfcp_policer_t *policer, uint64_t rate)
+{
+    ogs_assert(policer);
+
+    if (rate == policer->rate)
+        return;
+
+    /* Avoid overflow of bit-microseconds, treat it as no limit */
+    if (rate > UINT64_MAX / 2 / OGS_PFCP_POLICER_BURST_TIME)
+        rate = 0;
+
+    policer->rate = rate;
+    policer->depth = ogs_max(rate * OGS_PFCP_POLICER_BURST_TIME,
+            (uint64_t)OGS_MAX_PKT_LEN * 8 * OGS_USEC_PER_SEC);
+    policer->tokens = policer->depth;
+    policer->last = ogs_get_monotonic_time();
+}
+
+static bool policer_conform(ogs_pfcp_policer_t *policer, unsigned int len)
+{
+    ogs_time_t now, elapsed;
+    uint64_t cost;
+
+    ogs_assert(policer);
+
+    now = ogs_get_monotonic_time();
+    elapsed = now - policer->last;
+    policer->last = now;
+
+    /*
+     * The bucket may hold more than BURST_TIME of traffic at low rates,
+     * so the credit is always taken from the elapsed time.
+     */
+    if (elapsed > 0) {
+        if ((uint64_t)elapsed >
+                (policer->depth - policer->tokens) / policer->rate)
+            policer->tokens = policer->depth;
+        else
+            policer->tokens += elapsed * policer->rate;
+    }
+
+    cost = (uint64_t)len * 8 * OGS_USEC_PER_SEC;
+    if (policer->tokens < cost)
+        return false;
+
+    policer->tokens -= cost;
+    return true;
+}
+
+void ogs_pfcp_qer_update_policer(ogs_pfcp_qer_t *qer)
+{
+    ogs_assert(qer);
+
+    ogs_thread_mutex_lock(&qer->policer.mutex);
+    policer_set_rate(&qer->policer.ul, qer->mbr.uplink);
+    policer_set_rate(&qer->policer.dl, qer->mbr.downlink);
+    ogs_thread_mutex_unlock(&qer->policer.mutex);
+}
+
+int ogs_pfcp_qer_police(ogs_pfcp_qer_t *qer, bool uplink, unsigned int len)
+{
+    ogs_pfcp_policer_t *policer = NULL;
+    bool conform;
+
+    ogs_assert(qer);
+
+    if (uplink) {
+        if (qer->gate_status.uplink != OGS_PFCP_GATE_OPEN)
+            return OGS_PFCP_QER_GATE_CLOSED;
+        policer = &qer->policer.ul;
+    } else {
+        if (qer->gate_status.downlink != OGS_PFCP_GATE_OPEN)
+            return OGS_PFCP_QER_GATE_CLOSED;
+        policer = &qer->policer.dl;
+    }
+
+    if (policer->rate == 0)
+        return OGS_PFCP_QER_PASS;
+
+    ogs_thread_mutex_lock(&qer->policer.mutex);
+    conform = policer_conform(policer, len);
+    ogs_thread_mutex_unlock(&qer->policer.mutex);
+
+    return conform ? OGS_PFCP_QER_PASS : OGS_PFCP_QER_MBR_EXCEEDED;
+}
+
 ogs_pfcp_bar_t *ogs_pfcp_bar_new(ogs_pfcp_sess_t *sess)
 {
     ogs_pfcp_bar_t *bar = NULL;
@@ -1528,6 +1626,9 @@ ogs_pfcp_rule_t *ogs_pfcp_rule_add(ogs_pfcp_pdr_t *pdr)
     rule->pdr = pdr;
     ogs_list_add(&pdr->rule_list, rule);
 
+    ogs_assert(pdr->sess);
+    ogs_pfcp_classifier_clear(pdr->sess);
+
     return rule;
 }
 
@@ -1559,6 +1660,9 @@ void ogs_pfcp_rule_remove(ogs_pfcp_rule_t *rule)
 
     ogs_list_remove(&pdr->rule_list, rule);
     ogs_pool_free(&ogs_pfcp_rule_pool, rule);
+
+    ogs_assert(pdr->sess);
+    ogs_pfcp_classifier_clear(pdr->sess);
 }
 
 void ogs_pfcp_rule_remove_all(ogs_pfcp_pdr_t *pdr)
@@ -1922,6 +2026,8 @@ void ogs_pfcp_pool_final(ogs_pfcp_sess_t *sess)
 {
     ogs_assert(sess);
 
+    ogs_pfcp_classifier_clear(sess);
+
     ogs_index_final(&sess->pdr_id_pool);
     ogs_index_final(&sess->far_id_pool);
     ogs_index_final(&sess->urr_id_pool);
@@ -67,9 +67,12 @@ typedef struct ogs_pfcp_context_s {
     ogs_list_t      dev_list;       /* Tun Device List */
     ogs_list_t      subnet_list;    /* UE Subnet List */
 
-    ogs_hash_t      *object_teid_hash; /* hash table for PFCP OBJ(TEID) */
+    ogs_ihash_t     *object_teid_hash; /* hash table for PFCP OBJ(TEID) */
     ogs_hash_t      *far_f_teid_hash;  /* hash table for FAR(TEID+ADDR) */
     ogs_hash_t      *far_teid_hash; /* hash table for FAR(TEID) */
+
+    /* Serialize FAR packet buffering among user-plane threads */
+    ogs_thread_mutex_t buffer_mutex;
 } ogs_pfcp_context_t;
 
 #define OGS_SETUP_PFCP_NODE(__cTX, __pNODE) \
@@ -89,6 +92,14 @@ typedef struct ogs_pfcp_node_s {
 
     ogs_list_t      local_list;
     ogs_list_t      remote_list;
+    ogs_ihash_t     *xact_hash;     /* hash table for Transaction(ORG+XID) */
+
+    struct {
+        ogs_timer_t *timer;         /* Expires the earliest deadline */
+        ogs_list_t  response_list;  /* Deadlines in order of expiration */
+        ogs_list_t  holding_list;
+        ogs_list_t  delayed_commit_list;
+    } xact_timer;
 
     ogs_fsm_t       sm;             /* A state machine */
     ogs_timer_t     *t_association; /* timer to retry to associate peer node */
@@ -132,6 +143,7 @@ typedef struct ogs_pfcp_far_s ogs_pfcp_far_t;
 typedef struct ogs_pfcp_urr_s ogs_pfcp_urr_t;
 typedef struct ogs_pfcp_qer_s ogs_pfcp_qer_t;
 typedef struct ogs_pfcp_bar_s ogs_pfcp_bar_t;
+typedef struct ogs_pfcp_classifier_s ogs_pfcp_classifier_t;
 
 typedef struct ogs_pfcp_pdr_s {
     ogs_pfcp_object_t       obj;
@@ -266,6 +278,18 @@ typedef struct ogs_pfcp_urr_s {
     ogs_pfcp_sess_t         *sess;
 } ogs_pfcp_urr_t;
 
+/*
+ * Token bucket for the MBR of a QER.
+ * Tokens are kept in bit-microseconds (bps x usecs) and credited
+ * from the elapsed time when a packet arrives.
+ */
+typedef struct ogs_pfcp_policer_s {
+    uint64_t                rate;           /* bps, 0 : No limit */
+    uint64_t                depth;
+    uint64_t                tokens;
+    ogs_time_t              last;
+} ogs_pfcp_policer_t;
+
 typedef struct ogs_pfcp_qer_s {
     ogs_lnode_t             lnode;
 
@@ -278,6 +302,12 @@ typedef struct ogs_pfcp_qer_s {
 
     uint8_t                 qfi;
 
+    struct {
+        ogs_thread_mutex_t  mutex;
+        ogs_pfcp_policer_t  ul;
+        ogs_pfcp_policer_t  dl;
+    } policer;
+
     ogs_pfcp_sess_t         *sess;
 } ogs_pfcp_qer_t;
 
@@ -299,6 +329,8 @@ typedef struct ogs_pfcp_sess_s {
     ogs_list_t          qer_list;       /* QER List */
     ogs_pfcp_bar_t      *bar;           /* BAR Item */
 
+    ogs_pfcp_classifier_t *classifier;  /* SDF Filter Classifier */
+
     OGS_POOL(pdr_id_pool, uint8_t);
     OGS_POOL(far_id_pool, uint8_t);
     OGS_POOL(urr_id_pool, uint8_t);
@@ -444,6 +476,12 @@ ogs_pfcp_qer_t *ogs_pfcp_qer_find_or_add(
 void ogs_pfcp_qer_remove(ogs_pfcp_qer_t *qer);
 void ogs_pfcp_qer_remove_all(ogs_pfcp_sess_t *sess);
 
+#define OGS_PFCP_QER_PASS           0
+#define OGS_PFCP_QER_GATE_CLOSED    1
+#define OGS_PFCP_QER_MBR_EXCEEDED   2
+void ogs_pfcp_qer_update_policer(ogs_pfcp_qer_t *qer);
+int ogs_pfcp_qer_police(ogs_pfcp_qer_t *qer, bool uplink, unsigned int len);
+
 ogs_pfcp_bar_t *ogs_pfcp_bar_new(ogs_pfcp_sess_t *sess);
 void ogs_pfcp_bar_delete(ogs_pfcp_bar_t *bar);
 
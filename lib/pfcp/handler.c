@@ -176,6 +176,11 @@ bool ogs_pfcp_up_handle_association_setup_response(
     return true;
 }
 
+/*
+ * The recvbuf is consumed. It is encapsulated in place using its headroom
+ * and then sent, buffered or freed. If the caller needs the packet again
+ * (e.g. multicast fan-out), it should pass a copy with ogs_pkbuf_copy().
+ */
 bool ogs_pfcp_up_handle_pdr(
         ogs_pfcp_pdr_t *pdr, uint8_t type, ogs_pkbuf_t *recvbuf,
         ogs_pfcp_user_plane_report_t *report)
@@ -194,11 +199,7 @@ bool ogs_pfcp_up_handle_pdr(
 
     memset(report, 0, sizeof(*report));
 
-    sendbuf = ogs_pkbuf_copy(recvbuf);
-    if (!sendbuf) {
-        ogs_error("ogs_pkbuf_copy() failed");
-        return false;
-    }
+    sendbuf = recvbuf;
 
     buffering = false;
 
@@ -223,6 +224,8 @@ bool ogs_pfcp_up_handle_pdr(
 
     if (buffering == true) {
 
+        ogs_thread_mutex_lock(&ogs_pfcp_self()->buffer_mutex);
+
         if (far->num_of_buffered_packet == 0) {
             /* Only the first time a packet is buffered,
              * it reports downlink notifications. */
@@ -231,9 +234,13 @@ bool ogs_pfcp_up_handle_pdr(
 
         if (far->num_of_buffered_packet < OGS_MAX_NUM_OF_PACKET_BUFFER) {
             far->buffered_packet[far->num_of_buffered_packet++] = sendbuf;
-        } else {
-            ogs_pkbuf_free(sendbuf);
+            sendbuf = NULL;
         }
+
+        ogs_thread_mutex_unlock(&ogs_pfcp_self()->buffer_mutex);
+
+        if (sendbuf)
+            ogs_pkbuf_free(sendbuf);
     }
 
     return true;
@@ -1107,6 +1114,8 @@ ogs_pfcp_qer_t *ogs_pfcp_handle_create_qer(ogs_pfcp_sess_t *sess,
     if (message->qos_flow_identifier.presence)
         qer->qfi = message->qos_flow_identifier.u8;
 
+    ogs_pfcp_qer_update_policer(qer);
+
     return qer;
 }
 
@@ -1137,11 +1146,16 @@ ogs_pfcp_qer_t *ogs_pfcp_handle_update_qer(ogs_pfcp_sess_t *sess,
         return NULL;
     }
 
+    if (message->gate_status.presence)
+        qer->gate_status.value = message->gate_status.u8;
+
     if (message->maximum_bitrate.presence)
         ogs_pfcp_parse_bitrate(&qer->mbr, &message->maximum_bitrate);
     if (message->guaranteed_bitrate.presence)
         ogs_pfcp_parse_bitrate(&qer->gbr, &message->guaranteed_bitrate);
 
+    ogs_pfcp_qer_update_policer(qer);
+
     return qer;
 }
 
@@ -109,65 +109,136 @@ static int decode_ipv6_header(
     return OGS_OK;
 }
 
-ogs_pfcp_rule_t *ogs_pfcp_pdr_rule_find_by_packet(
-                    ogs_pfcp_pdr_t *pdr, ogs_pkbuf_t *pkbuf)
+typedef struct rule_match_packet_s {
+    uint8_t proto;
+    int addr_len;
+    uint32_t src_addr[4];
+    uint32_t dst_addr[4];
+    uint16_t src_port;
+    uint16_t dst_port;
+} rule_match_packet_t;
+
+/*
+ * Parse the 5-tuple of the inner IP packet once,
+ * so that each SDF filter does not have to walk the IP header again.
+ */
+static int rule_match_parse_packet(
+        rule_match_packet_t *packet, ogs_pkbuf_t *pkbuf)
 {
     struct ip *ip_h =  NULL;
     struct ip6_hdr *ip6_h = NULL;
-    uint32_t *src_addr = NULL;
-    uint32_t *dst_addr = NULL;
-    int addr_len = 0;
-    uint8_t proto = 0;
     uint16_t ip_hlen = 0;
 
-    ogs_pfcp_rule_t *rule = NULL;
-
+    ogs_assert(packet);
     ogs_assert(pkbuf);
     ogs_assert(pkbuf->len);
     ogs_assert(pkbuf->data);
 
-    ogs_list_for_each(&pdr->rule_list, rule) {
-        int k;
-        uint32_t src_mask[4];
-        uint32_t dst_mask[4];
-        ogs_ipfw_rule_t *ipfw = NULL;
-
-        ipfw = &rule->ipfw;
-        ogs_assert(ipfw);
-
-        ip_h = (struct ip *)pkbuf->data;
-        if (ip_h->ip_v == 4) {
-            ip_h = (struct ip *)pkbuf->data;
-            ip6_h = NULL;
-
-            proto = ip_h->ip_p;
-            ip_hlen = (ip_h->ip_hl)*4;
-
-            src_addr = (void *)&ip_h->ip_src.s_addr;
-            dst_addr = (void *)&ip_h->ip_dst.s_addr;
-            addr_len = OGS_IPV4_LEN;
-        } else if (ip_h->ip_v == 6) {
-            ip_h = NULL;
-            ip6_h = (struct ip6_hdr *)pkbuf->data;
-
-            decode_ipv6_header(ip6_h, &proto, &ip_hlen);
-
-            src_addr = (void *)ip6_h->ip6_src.s6_addr;
-            dst_addr = (void *)ip6_h->ip6_dst.s6_addr;
-            addr_len = OGS_IPV6_LEN;
-        } else {
-            ogs_error("Invalid packet [IP version:%d, Packet Length:%d]",
-                    ip_h->ip_v, pkbuf->len);
-            ogs_log_hexdump(OGS_LOG_ERROR, pkbuf->data, pkbuf->len);
-            continue;
-        }
+    memset(packet, 0, sizeof(*packet));
+
+    ip_h = (struct ip *)pkbuf->data;
+    if (ip_h->ip_v == 4) {
+        packet->proto = ip_h->ip_p;
+        ip_hlen = (ip_h->ip_hl)*4;
+
+        memcpy(packet->src_addr, &ip_h->ip_src.s_addr, OGS_IPV4_LEN);
+        memcpy(packet->dst_addr, &ip_h->ip_dst.s_addr, OGS_IPV4_LEN);
+        packet->addr_len = OGS_IPV4_LEN;
+    } else if (ip_h->ip_v == 6) {
+        ip6_h = (struct ip6_hdr *)pkbuf->data;
+
+        decode_ipv6_header(ip6_h, &packet->proto, &ip_hlen);
+
+        memcpy(packet->src_addr, ip6_h->ip6_src.s6_addr, OGS_IPV6_LEN);
+        memcpy(packet->dst_addr, ip6_h->ip6_dst.s6_addr, OGS_IPV6_LEN);
+        packet->addr_len = OGS_IPV6_LEN;
+    } else {
+        ogs_error("Invalid packet [IP version:%d, Packet Length:%d]",
+                ip_h->ip_v, pkbuf->len);
+        ogs_log_hexdump(OGS_LOG_ERROR, pkbuf->data, pkbuf->len);
+        return OGS_ERROR;
+    }
+
+    if ((packet->proto == IPPROTO_TCP || packet->proto == IPPROTO_UDP) &&
+        pkbuf->len >= ip_hlen + 4) {
+        /* Source and Destination port are at the same offset */
+        struct udphdr *udph = (struct udphdr *)((char *)pkbuf->data + ip_hlen);
+
+        packet->src_port = be16toh(udph->uh_sport);
+        packet->dst_port = be16toh(udph->uh_dport);
+    }
+
+    ogs_debug("PROTO:%d SRC:%08x %08x %08x %08x",
+            packet->proto,
+            be32toh(packet->src_addr[0]), be32toh(packet->src_addr[1]),
+            be32toh(packet->src_addr[2]), be32toh(packet->src_addr[3]));
+    ogs_debug("HLEN:%d  DST:%08x %08x %08x %08x",
+            ip_hlen,
+            be32toh(packet->dst_addr[0]), be32toh(packet->dst_addr[1]),
+            be32toh(packet->dst_addr[2]), be32toh(packet->dst_addr[3]));
+
+    return OGS_OK;
+}
+
+static bool rule_match_port(uint16_t port, uint16_t low, uint16_t high)
+{
+    if (low && port < low)
+        return false;
+    if (high && port > high)
+        return false;
+
+    return true;
+}
+
+static bool rule_match(ogs_ipfw_rule_t *ipfw, rule_match_packet_t *packet)
+{
+    int k;
+
+    ogs_assert(ipfw);
+    ogs_assert(packet);
+
+    for (k = 0; k < packet->addr_len / 4; k++) {
+        if ((packet->src_addr[k] & ipfw->ip.src.mask[k]) !=
+                ipfw->ip.src.addr[k])
+            return false;
+        if ((packet->dst_addr[k] & ipfw->ip.dst.mask[k]) !=
+                ipfw->ip.dst.addr[k])
+            return false;
+    }
+
+    /* Protocol match */
+    if (ipfw->proto == 0) /* IP */
+        return true; /* No need to match port */
+
+    if (ipfw->proto != packet->proto)
+        return false;
 
-        ogs_debug("PROTO:%d SRC:%08x %08x %08x %08x",
-                proto, be32toh(src_addr[0]), be32toh(src_addr[1]),
-                be32toh(src_addr[2]), be32toh(src_addr[3]));
-        ogs_debug("HLEN:%d  DST:%08x %08x %08x %08x",
-                ip_hlen, be32toh(dst_addr[0]), be32toh(dst_addr[1]),
-                be32toh(dst_addr[2]), be32toh(dst_addr[3]));
+    if (ipfw->proto != IPPROTO_TCP && ipfw->proto != IPPROTO_UDP)
+        return true; /* No need to match port */
+
+    return rule_match_port(packet->src_port,
+                ipfw->port.src.low, ipfw->port.src.high) &&
+            rule_match_port(packet->dst_port,
+                ipfw->port.dst.low, ipfw->port.dst.high);
+}
+
+ogs_pfcp_rule_t *ogs_pfcp_pdr_rule_find_by_packet(
+                    ogs_pfcp_pdr_t *pdr, ogs_pkbuf_t *pkbuf)
+{
+    rule_match_packet_t packet;
+    ogs_pfcp_rule_t *rule = NULL;
+
+    ogs_assert(pdr);
+    ogs_assert(pkbuf);
+
+    if (ogs_list_first(&pdr->rule_list) == NULL)
+        return NULL;
+
+    if (rule_match_parse_packet(&packet, pkbuf) != OGS_OK)
+        return NULL;
+
+    ogs_list_for_each(&pdr->rule_list, rule) {
+        ogs_ipfw_rule_t *ipfw = &rule->ipfw;
 
         ogs_debug("PROTO:%d SRC:%d-%d DST:%d-%d",
                 ipfw->proto,
@@ -175,106 +246,273 @@ ogs_pfcp_rule_t *ogs_pfcp_pdr_rule_find_by_packet(
                 ipfw->port.src.high,
                 ipfw->port.dst.low,
                 ipfw->port.dst.high);
-        ogs_debug("SRC:%08x %08x %08x %08x/%08x %08x %08x %08x",
-                be32toh(ipfw->ip.src.addr[0]),
-                be32toh(ipfw->ip.src.addr[1]),
-                be32toh(ipfw->ip.src.addr[2]),
-                be32toh(ipfw->ip.src.addr[3]),
-                be32toh(ipfw->ip.src.mask[0]),
-                be32toh(ipfw->ip.src.mask[1]),
-                be32toh(ipfw->ip.src.mask[2]),
-                be32toh(ipfw->ip.src.mask[3]));
-        ogs_debug("DST:%08x %08x %08x %08x/%08x %08x %08x %08x",
-                be32toh(ipfw->ip.dst.addr[0]),
-                be32toh(ipfw->ip.dst.addr[1]),
-                be32toh(ipfw->ip.dst.addr[2]),
-                be32toh(ipfw->ip.dst.addr[3]),
-                be32toh(ipfw->ip.dst.mask[0]),
-                be32toh(ipfw->ip.dst.mask[1]),
-                be32toh(ipfw->ip.dst.mask[2]),
-                be32toh(ipfw->ip.dst.mask[3]));
-
-        for (k = 0; k < 4; k++) {
-            src_mask[k] = src_addr[k] & ipfw->ip.src.mask[k];
-            dst_mask[k] = dst_addr[k] & ipfw->ip.dst.mask[k];
+
+        if (rule_match(ipfw, &packet) == true)
+            return rule;
+    }
+
+    return NULL;
+}
+
+/*
+ * SDF Filter Classifier (Tuple Space Search)
+ *
+ * All SDF filters of a session are grouped into tuples
+ * with the same protocol and the same source/destination masks.
+ * Each tuple is a hash lookup with the masked addresses of the packet,
+ * so the cost depends on the number of distinct masks in the session
+ * rather than on the number of filters. Port ranges are checked
+ * on the few filters left in the hash chain.
+ *
+ * The result is a bitmap of PDRs (OGS_PFCP_PDR_MASK) that match,
+ * and the caller walks the PDR list in precedence order as before.
+ */
+typedef struct classifier_tuple_s {
+    uint8_t proto;
+    uint32_t src_mask[4];
+    uint32_t dst_mask[4];
+} classifier_tuple_t;
+
+typedef struct classifier_entry_s {
+    int tuple;
+    uint32_t src_addr[4];
+    uint32_t dst_addr[4];
+    struct {
+        uint16_t low;
+        uint16_t high;
+    } src_port, dst_port;
+    uint32_t pdr_mask;
+
+#define CLASSIFIER_IPV4 0
+#define CLASSIFIER_IPV6 1
+    int next[2];
+} classifier_entry_t;
+
+struct ogs_pfcp_classifier_s {
+    uint32_t any_mask; /* PDRs without SDF filter */
+
+    int num_of_tuple;
+    classifier_tuple_t *tuple;
+
+    int num_of_entry;
+    classifier_entry_t *entry;
+
+    uint32_t bucket_mask;
+    int *bucket[2];
+};
+
+static uint32_t classifier_hash(int tuple,
+        const uint32_t *src_addr, const uint32_t *dst_addr, int n)
+{
+    int k;
+    uint32_t h = (tuple + 1) * 0x9e3779b1;
+
+    for (k = 0; k < n; k++) {
+        h = (h ^ src_addr[k]) * 0x01000193;
+        h = (h ^ dst_addr[k]) * 0x01000193;
+    }
+
+    return h ^ (h >> 16);
+}
+
+static int classifier_tuple_find(
+        ogs_pfcp_classifier_t *classifier, ogs_ipfw_rule_t *ipfw)
+{
+    int t;
+    classifier_tuple_t *tuple = NULL;
+
+    for (t = 0; t < classifier->num_of_tuple; t++) {
+        tuple = &classifier->tuple[t];
+        if (tuple->proto == ipfw->proto &&
+            memcmp(tuple->src_mask, ipfw->ip.src.mask,
+                sizeof(tuple->src_mask)) == 0 &&
+            memcmp(tuple->dst_mask, ipfw->ip.dst.mask,
+                sizeof(tuple->dst_mask)) == 0)
+            return t;
+    }
+
+    tuple = &classifier->tuple[classifier->num_of_tuple];
+    tuple->proto = ipfw->proto;
+    memcpy(tuple->src_mask, ipfw->ip.src.mask, sizeof(tuple->src_mask));
+    memcpy(tuple->dst_mask, ipfw->ip.dst.mask, sizeof(tuple->dst_mask));
+
+    return classifier->num_of_tuple++;
+}
+
+int ogs_pfcp_classifier_compile(ogs_pfcp_sess_t *sess)
+{
+    ogs_pfcp_classifier_t *classifier = NULL;
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_rule_t *rule = NULL;
+    int num_of_rule = 0, num_of_bucket = 1;
+    size_t size;
+    int i;
+
+    ogs_assert(sess);
+
+    ogs_pfcp_classifier_clear(sess);
+
+    ogs_list_for_each(&sess->pdr_list, pdr) {
+        if (!pdr->id_node ||
+            *pdr->id_node == 0 || *pdr->id_node > OGS_MAX_NUM_OF_PDR) {
+            ogs_error("Invalid PDR slot [ID:%d]", pdr->id);
+            return OGS_ERROR;
         }
+        num_of_rule += ogs_list_count(&pdr->rule_list);
+    }
+
+    while (num_of_bucket < num_of_rule * 2)
+        num_of_bucket <<= 1;
+
+    size = sizeof(*classifier) +
+        num_of_rule * (sizeof(classifier_tuple_t) +
+                sizeof(classifier_entry_t)) +
+        num_of_bucket * 2 * sizeof(int);
 
-        if (memcmp(src_mask, ipfw->ip.src.addr, addr_len) == 0 &&
-            memcmp(dst_mask, ipfw->ip.dst.addr, addr_len) == 0) {
-            /* Protocol match */
-            if (ipfw->proto == 0) { /* IP */
-                /* No need to match port */
-                return rule;
-            }
-
-            if (ipfw->proto == proto) {
-                if (ipfw->proto == IPPROTO_TCP) {
-                    struct tcphdr *tcph =
-                        (struct tcphdr *)((char *)pkbuf->data + ip_hlen);
-
-                    /* Source port */
-                    if (ipfw->port.src.low &&
-                          be16toh(tcph->th_sport) < ipfw->port.src.low) {
-                        continue;
-                    }
-
-                    if (ipfw->port.src.high &&
-                          be16toh(tcph->th_sport) > ipfw->port.src.high) {
-                        continue;
-                    }
-
-                    /* Dst Port*/
-                    if (ipfw->port.dst.low &&
-                          be16toh(tcph->th_dport) < ipfw->port.dst.low) {
-                        continue;
-                    }
-
-                    if (ipfw->port.dst.high &&
-                          be16toh(tcph->th_dport) > ipfw->port.dst.high) {
-                        continue;
-                    }
-
-                    /* Matched */
-                    return rule;
-
-                } else if (ipfw->proto == IPPROTO_UDP) {
-                    struct udphdr *udph =
-                        (struct udphdr *)((char *)pkbuf->data + ip_hlen);
-
-                    /* Source port */
-                    if (ipfw->port.src.low &&
-                          be16toh(udph->uh_sport) < ipfw->port.src.low) {
-                        continue;
-                    }
-
-                    if (ipfw->port.src.high &&
-                          be16toh(udph->uh_sport) > ipfw->port.src.high) {
-                        continue;
-                    }
-
-                    /* Dst Port*/
-                    if (ipfw->port.dst.low &&
-                          be16toh(udph->uh_dport) < ipfw->port.dst.low) {
-                        continue;
-                    }
-
-                    if (ipfw->port.dst.high &&
-                          be16toh(udph->uh_dport) > ipfw->port.dst.high) {
-                        continue;
-                    }
-
-                    /* Matched */
-                    return rule;
-
-                } else {
-
-                    /* No need to match port */
-                    return rule;
-
-                }
-            }
+    classifier = ogs_calloc(1, size);
+    if (!classifier) {
+        ogs_error("ogs_calloc() failed");
+        return OGS_ERROR;
+    }
+
+    classifier->entry = (classifier_entry_t *)(classifier + 1);
+    classifier->tuple = (classifier_tuple_t *)
+        (classifier->entry + num_of_rule);
+    classifier->bucket[CLASSIFIER_IPV4] = (int *)
+        (classifier->tuple + num_of_rule);
+    classifier->bucket[CLASSIFIER_IPV6] =
+        classifier->bucket[CLASSIFIER_IPV4] + num_of_bucket;
+    classifier->bucket_mask = num_of_bucket - 1;
+
+    for (i = 0; i < num_of_bucket * 2; i++)
+        classifier->bucket[CLASSIFIER_IPV4][i] = -1;
+
+    ogs_list_for_each(&sess->pdr_list, pdr) {
+        if (ogs_list_first(&pdr->rule_list) == NULL) {
+            classifier->any_mask |= OGS_PFCP_PDR_MASK(pdr);
+            continue;
+        }
+
+        ogs_list_for_each(&pdr->rule_list, rule) {
+            ogs_ipfw_rule_t *ipfw = &rule->ipfw;
+            classifier_entry_t *entry = NULL;
+            uint32_t h;
+            int e = classifier->num_of_entry++;
+
+            entry = &classifier->entry[e];
+            entry->tuple = classifier_tuple_find(classifier, ipfw);
+            memcpy(entry->src_addr, ipfw->ip.src.addr,
+                    sizeof(entry->src_addr));
+            memcpy(entry->dst_addr, ipfw->ip.dst.addr,
+                    sizeof(entry->dst_addr));
+            entry->src_port.low = ipfw->port.src.low;
+            entry->src_port.high = ipfw->port.src.high;
+            entry->dst_port.low = ipfw->port.dst.low;
+            entry->dst_port.high = ipfw->port.dst.high;
+            entry->pdr_mask = OGS_PFCP_PDR_MASK(pdr);
+
+            /* IPv4 packets compare the first word of the address only */
+            h = classifier_hash(entry->tuple,
+                    entry->src_addr, entry->dst_addr, 1) &
+                classifier->bucket_mask;
+            entry->next[CLASSIFIER_IPV4] =
+                classifier->bucket[CLASSIFIER_IPV4][h];
+            classifier->bucket[CLASSIFIER_IPV4][h] = e;
+
+            h = classifier_hash(entry->tuple,
+                    entry->src_addr, entry->dst_addr, 4) &
+                classifier->bucket_mask;
+            entry->next[CLASSIFIER_IPV6] =
+                classifier->bucket[CLASSIFIER_IPV6][h];
+            classifier->bucket[CLASSIFIER_IPV6][h] = e;
         }
     }
 
-    return NULL;
+    sess->classifier = classifier;
+
+    return OGS_OK;
+}
+
+void ogs_pfcp_classifier_clear(ogs_pfcp_sess_t *sess)
+{
+    ogs_assert(sess);
+
+    if (sess->classifier) {
+        ogs_free(sess->classifier);
+        sess->classifier = NULL;
+    }
+}
+
+uint32_t ogs_pfcp_classifier_match(
+        ogs_pfcp_classifier_t *classifier, ogs_pkbuf_t *pkbuf)
+{
+    rule_match_packet_t packet;
+    uint32_t matched;
+    int family, n, t, k;
+
+    ogs_assert(classifier);
+    ogs_assert(pkbuf);
+
+    matched = classifier->any_mask;
+    if (classifier->num_of_entry == 0)
+        return matched;
+
+    if (rule_match_parse_packet(&packet, pkbuf) != OGS_OK)
+        return matched;
+
+    if (packet.addr_len == OGS_IPV4_LEN) {
+        family = CLASSIFIER_IPV4;
+        n = 1;
+    } else {
+        family = CLASSIFIER_IPV6;
+        n = 4;
+    }
+
+    for (t = 0; t < classifier->num_of_tuple; t++) {
+        classifier_tuple_t *tuple = &classifier->tuple[t];
+        bool check_port = false;
+        uint32_t src_addr[4], dst_addr[4];
+        uint32_t h;
+        int e;
+
+        if (tuple->proto) {
+            if (tuple->proto != packet.proto)
+                continue;
+            check_port = (tuple->proto == IPPROTO_TCP ||
+                    tuple->proto == IPPROTO_UDP);
+        }
+
+        for (k = 0; k < n; k++) {
+            src_addr[k] = packet.src_addr[k] & tuple->src_mask[k];
+            dst_addr[k] = packet.dst_addr[k] & tuple->dst_mask[k];
+        }
+
+        h = classifier_hash(t, src_addr, dst_addr, n) &
+            classifier->bucket_mask;
+
+        for (e = classifier->bucket[family][h];
+                e >= 0; e = classifier->entry[e].next[family]) {
+            classifier_entry_t *entry = &classifier->entry[e];
+
+            if (entry->tuple != t)
+                continue;
+            if (matched & entry->pdr_mask)
+                continue;
+
+            if (memcmp(entry->src_addr, src_addr, n * 4) != 0 ||
+                memcmp(entry->dst_addr, dst_addr, n * 4) != 0)
+                continue;
+
+            if (check_port &&
+                (rule_match_port(packet.src_port,
+                    entry->src_port.low, entry->src_port.high) == false ||
+                 rule_match_port(packet.dst_port,
+                    entry->dst_port.low, entry->dst_port.high) == false))
+                continue;
+
+            matched |= entry->pdr_mask;
+        }
+    }
+
+    return matched;
 }
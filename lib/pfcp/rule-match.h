@@ -31,6 +31,26 @@ extern "C" {
 ogs_pfcp_rule_t *ogs_pfcp_pdr_rule_find_by_packet(
                     ogs_pfcp_pdr_t *pdr, ogs_pkbuf_t *pkbuf);
 
+/*
+ * SDF Filter Classifier
+ *
+ * ogs_pfcp_classifier_compile() builds the classifier from all PDRs
+ * in the session. Adding or removing a PDR or a rule clears it,
+ * so compile it again once the PFCP request has been handled.
+ *
+ * ogs_pfcp_classifier_match() returns the PDRs matching the packet
+ * as OGS_PFCP_PDR_MASK() bits. PDRs without SDF filters always match.
+ *
+ * The bit is taken from the slot of the PDR in the session (id_node),
+ * not from the PDR ID which is chosen by the CP function.
+ */
+#define OGS_PFCP_PDR_MASK(__pDR) (1U << (*(__pDR)->id_node - 1))
+
+int ogs_pfcp_classifier_compile(ogs_pfcp_sess_t *sess);
+void ogs_pfcp_classifier_clear(ogs_pfcp_sess_t *sess);
+uint32_t ogs_pfcp_classifier_match(
+        ogs_pfcp_classifier_t *classifier, ogs_pkbuf_t *pkbuf);
+
 #ifdef __cplusplus
 }
 #endif
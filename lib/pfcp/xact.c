@@ -23,6 +23,8 @@
 #define PFCP_MIN_XACT_ID             1
 #define PFCP_MAX_XACT_ID             0x800000
 
+#define PFCP_XACT_KEY(__oRG, __xID) (((uint64_t)(__oRG) << 32) | (__xID))
+
 typedef enum {
     PFCP_XACT_UNKNOWN_STAGE,
     PFCP_XACT_INITIAL_STAGE,
@@ -43,17 +45,26 @@ static int ogs_pfcp_xact_delete(ogs_pfcp_xact_t *xact);
 static int ogs_pfcp_xact_update_rx(ogs_pfcp_xact_t *xact, uint8_t type);
 static ogs_pfcp_xact_t *ogs_pfcp_xact_find_by_xid(
         ogs_pfcp_node_t *node, uint8_t type, uint32_t xid);
+static void ogs_pfcp_xact_add(ogs_pfcp_xact_t *xact);
 
+static void xact_timer_start(ogs_pfcp_xact_t *xact,
+        ogs_pfcp_xact_timer_t *tm, ogs_time_t duration);
+static void xact_timer_stop(ogs_pfcp_xact_t *xact, ogs_pfcp_xact_timer_t *tm);
+static void node_timer_update(ogs_pfcp_node_t *node);
+static void node_timeout(void *data);
 
 static void response_timeout(void *data);
 static void holding_timeout(void *data);
 static void delayed_commit_timeout(void *data);
 
+/* PFCP node whose timer is being expired in node_timeout() */
+static ogs_pfcp_node_t *expiring_node = NULL;
+
 int ogs_pfcp_xact_init(void)
 {
     ogs_assert(ogs_pfcp_xact_initialized == 0);
 
-    ogs_pool_init(&pool, ogs_app()->pool.xact);
+    ogs_pool_elastic_init(&pool, ogs_app()->pool.xact);
 
     g_xact_id = 0;
 
@@ -90,22 +101,10 @@ ogs_pfcp_xact_t *ogs_pfcp_xact_local_create(ogs_pfcp_node_t *node,
     xact->cb = cb;
     xact->data = data;
 
-    xact->tm_response = ogs_timer_add(
-            ogs_app()->timer_mgr, response_timeout, xact);
-    ogs_assert(xact->tm_response);
     xact->response_rcount = ogs_app()->time.message.pfcp.n1_response_rcount;
-
-    xact->tm_holding = ogs_timer_add(
-            ogs_app()->timer_mgr, holding_timeout, xact);
-    ogs_assert(xact->tm_holding);
     xact->holding_rcount = ogs_app()->time.message.pfcp.n1_holding_rcount;
 
-    xact->tm_delayed_commit = ogs_timer_add(
-            ogs_app()->timer_mgr, delayed_commit_timeout, xact);
-    ogs_assert(xact->tm_delayed_commit);
-
-    ogs_list_add(xact->org == OGS_PFCP_LOCAL_ORIGINATOR ?
-            &xact->node->local_list : &xact->node->remote_list, xact);
+    ogs_pfcp_xact_add(xact);
 
     ogs_list_init(&xact->pdr_to_create_list);
 
@@ -135,22 +134,10 @@ static ogs_pfcp_xact_t *ogs_pfcp_xact_remote_create(
     xact->xid = OGS_PFCP_SQN_TO_XID(sqn);
     xact->node = node;
 
-    xact->tm_response = ogs_timer_add(
-            ogs_app()->timer_mgr, response_timeout, xact);
-    ogs_assert(xact->tm_response);
     xact->response_rcount = ogs_app()->time.message.pfcp.n1_response_rcount;
-
-    xact->tm_holding = ogs_timer_add(
-            ogs_app()->timer_mgr, holding_timeout, xact);
-    ogs_assert(xact->tm_holding);
     xact->holding_rcount = ogs_app()->time.message.pfcp.n1_holding_rcount;
 
-    xact->tm_delayed_commit = ogs_timer_add(
-            ogs_app()->timer_mgr, delayed_commit_timeout, xact);
-    ogs_assert(xact->tm_delayed_commit);
-
-    ogs_list_add(xact->org == OGS_PFCP_LOCAL_ORIGINATOR ?
-            &xact->node->local_list : &xact->node->remote_list, xact);
+    ogs_pfcp_xact_add(xact);
 
     ogs_debug("[%d] %s Create  peer [%s]:%d",
             xact->xid,
@@ -174,6 +161,18 @@ void ogs_pfcp_xact_delete_all(ogs_pfcp_node_t *node)
         ogs_pfcp_xact_delete(xact);
     ogs_list_for_each_safe(&node->remote_list, next_xact, xact)
         ogs_pfcp_xact_delete(xact);
+
+    if (node->xact_hash) {
+        ogs_ihash_destroy(node->xact_hash);
+        node->xact_hash = NULL;
+    }
+    if (node->xact_timer.timer) {
+        ogs_timer_delete(node->xact_timer.timer);
+        node->xact_timer.timer = NULL;
+    }
+
+    if (expiring_node == node)
+        expiring_node = NULL;
 }
 
 int ogs_pfcp_xact_update_tx(ogs_pfcp_xact_t *xact,
@@ -316,10 +315,8 @@ static int ogs_pfcp_xact_update_rx(ogs_pfcp_xact_t *xact, uint8_t type)
 
                 pkbuf = xact->seq[2].pkbuf;
                 if (pkbuf) {
-                    if (xact->tm_holding)
-                        ogs_timer_start(xact->tm_holding,
-                                ogs_app()->time.message.
-                                    pfcp.t1_holding_duration);
+                    xact_timer_start(xact, &xact->tm_holding,
+                            ogs_app()->time.message.pfcp.t1_holding_duration);
 
                     ogs_warn("[%d] %s Request Duplicated. Retransmit!"
                             " for step %d type %d peer [%s]:%d",
@@ -352,9 +349,8 @@ static int ogs_pfcp_xact_update_rx(ogs_pfcp_xact_t *xact, uint8_t type)
                 return OGS_ERROR;
             }
 
-            if (xact->tm_holding)
-                ogs_timer_start(xact->tm_holding,
-                        ogs_app()->time.message.pfcp.t1_holding_duration);
+            xact_timer_start(xact, &xact->tm_holding,
+                    ogs_app()->time.message.pfcp.t1_holding_duration);
 
             break;
 
@@ -382,10 +378,8 @@ static int ogs_pfcp_xact_update_rx(ogs_pfcp_xact_t *xact, uint8_t type)
 
                 pkbuf = xact->seq[1].pkbuf;
                 if (pkbuf) {
-                    if (xact->tm_holding)
-                        ogs_timer_start(xact->tm_holding,
-                                ogs_app()->time.message.
-                                    pfcp.t1_holding_duration);
+                    xact_timer_start(xact, &xact->tm_holding,
+                            ogs_app()->time.message.pfcp.t1_holding_duration);
 
                     ogs_warn("[%d] %s Request Duplicated. Retransmit!"
                             " for step %d type %d peer [%s]:%d",
@@ -417,9 +411,8 @@ static int ogs_pfcp_xact_update_rx(ogs_pfcp_xact_t *xact, uint8_t type)
                 ogs_error("invalid step[%d] type[%d]", xact->step, type);
                 return OGS_ERROR;
             }
-            if (xact->tm_holding)
-                ogs_timer_start(xact->tm_holding,
-                        ogs_app()->time.message.pfcp.t1_holding_duration);
+            xact_timer_start(xact, &xact->tm_holding,
+                    ogs_app()->time.message.pfcp.t1_holding_duration);
 
             break;
 
@@ -445,8 +438,7 @@ static int ogs_pfcp_xact_update_rx(ogs_pfcp_xact_t *xact, uint8_t type)
         return OGS_ERROR;
     }
 
-    if (xact->tm_response)
-        ogs_timer_stop(xact->tm_response);
+    xact_timer_stop(xact, &xact->tm_response);
 
     /* Save Message type of this step */
     xact->seq[xact->step].type = type;
@@ -486,9 +478,8 @@ int ogs_pfcp_xact_commit(ogs_pfcp_xact_t *xact)
                 return OGS_ERROR;
             }
 
-            if (xact->tm_response)
-                ogs_timer_start(xact->tm_response,
-                        ogs_app()->time.message.pfcp.t1_response_duration);
+            xact_timer_start(xact, &xact->tm_response,
+                    ogs_app()->time.message.pfcp.t1_response_duration);
 
             break;
 
@@ -528,9 +519,8 @@ int ogs_pfcp_xact_commit(ogs_pfcp_xact_t *xact)
                 ogs_pfcp_xact_delete(xact);
                 return OGS_ERROR;
             }
-            if (xact->tm_response)
-                ogs_timer_start(xact->tm_response,
-                        ogs_app()->time.message.pfcp.t1_response_duration);
+            xact_timer_start(xact, &xact->tm_response,
+                    ogs_app()->time.message.pfcp.t1_response_duration);
 
             break;
 
@@ -574,9 +564,8 @@ void ogs_pfcp_xact_delayed_commit(ogs_pfcp_xact_t *xact, ogs_time_t duration)
 {
     ogs_assert(xact);
     ogs_assert(duration);
-    ogs_assert(xact->tm_delayed_commit);
 
-    ogs_timer_start(xact->tm_delayed_commit, duration);
+    xact_timer_start(xact, &xact->tm_delayed_commit, duration);
 }
 
 static void response_timeout(void *data)
@@ -598,9 +587,8 @@ static void response_timeout(void *data)
     if (--xact->response_rcount > 0) {
         ogs_pkbuf_t *pkbuf = NULL;
 
-        if (xact->tm_response)
-            ogs_timer_start(xact->tm_response,
-                    ogs_app()->time.message.pfcp.t1_response_duration);
+        xact_timer_start(xact, &xact->tm_response,
+                ogs_app()->time.message.pfcp.t1_response_duration);
 
         pkbuf = xact->seq[xact->step-1].pkbuf;
         ogs_assert(pkbuf);
@@ -647,9 +635,8 @@ static void holding_timeout(void *data)
             OGS_PORT(&xact->node->addr));
 
     if (--xact->holding_rcount > 0) {
-        if (xact->tm_holding)
-            ogs_timer_start(xact->tm_holding,
-                    ogs_app()->time.message.pfcp.t1_holding_duration);
+        xact_timer_start(xact, &xact->tm_holding,
+                ogs_app()->time.message.pfcp.t1_holding_duration);
     } else {
         ogs_debug("[%d] %s Delete Transaction "
                 "for step %d type %d peer [%s]:%d",
@@ -756,7 +743,7 @@ static ogs_pfcp_xact_t *ogs_pfcp_xact_find_by_xid(
 {
     char buf[OGS_ADDRSTRLEN];
 
-    ogs_list_t *list = NULL;
+    uint8_t org;
     ogs_pfcp_xact_t *xact = NULL;
     ogs_pfcp_xact_stage_t stage;
 
@@ -766,13 +753,13 @@ static ogs_pfcp_xact_t *ogs_pfcp_xact_find_by_xid(
 
     switch (stage) {
     case PFCP_XACT_INITIAL_STAGE:
-        list = &node->remote_list;
+        org = OGS_PFCP_REMOTE_ORIGINATOR;
         break;
     case PFCP_XACT_INTERMEDIATE_STAGE:
-        list = &node->local_list;
+        org = OGS_PFCP_LOCAL_ORIGINATOR;
         break;
     case PFCP_XACT_FINAL_STAGE:
-        list = &node->local_list;
+        org = OGS_PFCP_LOCAL_ORIGINATOR;
         break;
     default:
         ogs_warn("Unexpected stage %u.", stage);
@@ -780,16 +767,15 @@ static ogs_pfcp_xact_t *ogs_pfcp_xact_find_by_xid(
         return NULL;
     }
 
-    ogs_assert(list);
-    ogs_list_for_each(list, xact) {
-        if (xact->xid == xid) {
-            ogs_debug("[%d] %s Find    peer [%s]:%d",
-                xact->xid,
-                xact->org == OGS_PFCP_LOCAL_ORIGINATOR ? "LOCAL " : "REMOTE",
-                OGS_ADDR(&node->addr, buf),
-                OGS_PORT(&node->addr));
-            return xact;
-        }
+    if (node->xact_hash)
+        xact = ogs_ihash_get(node->xact_hash, PFCP_XACT_KEY(org, xid));
+    if (xact) {
+        ogs_debug("[%d] %s Find    peer [%s]:%d",
+            xact->xid,
+            xact->org == OGS_PFCP_LOCAL_ORIGINATOR ? "LOCAL " : "REMOTE",
+            OGS_ADDR(&node->addr, buf),
+            OGS_PORT(&node->addr));
+        return xact;
     }
 
     ogs_debug("[%d] Cannot find xact type %u from PFCP peer [%s]:%d",
@@ -819,12 +805,15 @@ static int ogs_pfcp_xact_delete(ogs_pfcp_xact_t *xact)
     if (xact->seq[2].pkbuf)
         ogs_pkbuf_free(xact->seq[2].pkbuf);
 
-    if (xact->tm_response)
-        ogs_timer_delete(xact->tm_response);
-    if (xact->tm_holding)
-        ogs_timer_delete(xact->tm_holding);
-    if (xact->tm_delayed_commit)
-        ogs_timer_delete(xact->tm_delayed_commit);
+    xact_timer_stop(xact, &xact->tm_response);
+    xact_timer_stop(xact, &xact->tm_holding);
+    xact_timer_stop(xact, &xact->tm_delayed_commit);
+
+    ogs_assert(xact->node->xact_hash);
+    if (ogs_ihash_get(xact->node->xact_hash,
+                PFCP_XACT_KEY(xact->org, xact->xid)) == xact)
+        ogs_ihash_set(xact->node->xact_hash,
+                PFCP_XACT_KEY(xact->org, xact->xid), NULL);
 
     ogs_list_remove(xact->org == OGS_PFCP_LOCAL_ORIGINATOR ?
             &xact->node->local_list : &xact->node->remote_list, xact);
@@ -832,3 +821,174 @@ static int ogs_pfcp_xact_delete(ogs_pfcp_xact_t *xact)
 
     return OGS_OK;
 }
+
+static void ogs_pfcp_xact_add(ogs_pfcp_xact_t *xact)
+{
+    ogs_pfcp_node_t *node = NULL;
+
+    ogs_assert(xact);
+    node = xact->node;
+    ogs_assert(node);
+
+    if (!node->xact_hash) {
+        node->xact_hash = ogs_ihash_make();
+        ogs_assert(node->xact_hash);
+    }
+    if (!node->xact_timer.timer) {
+        node->xact_timer.timer = ogs_timer_add(
+                ogs_app()->timer_mgr, node_timeout, node);
+        ogs_assert(node->xact_timer.timer);
+    }
+
+    ogs_list_add(xact->org == OGS_PFCP_LOCAL_ORIGINATOR ?
+            &node->local_list : &node->remote_list, xact);
+
+    /*
+     * If the XID has wrapped around and the old transaction is still there,
+     * the new one takes over the index.
+     */
+    ogs_ihash_set(node->xact_hash, PFCP_XACT_KEY(xact->org, xact->xid), xact);
+}
+
+static ogs_list_t *xact_timer_list(
+        ogs_pfcp_xact_t *xact, ogs_pfcp_xact_timer_t *tm)
+{
+    ogs_assert(xact);
+    ogs_assert(xact->node);
+
+    if (tm == &xact->tm_response)
+        return &xact->node->xact_timer.response_list;
+    else if (tm == &xact->tm_holding)
+        return &xact->node->xact_timer.holding_list;
+    else if (tm == &xact->tm_delayed_commit)
+        return &xact->node->xact_timer.delayed_commit_list;
+
+    ogs_assert_if_reached();
+    return NULL;
+}
+
+static void xact_timer_start(ogs_pfcp_xact_t *xact,
+        ogs_pfcp_xact_timer_t *tm, ogs_time_t duration)
+{
+    ogs_list_t *list = NULL;
+    ogs_pfcp_xact_timer_t *prev = NULL;
+
+    ogs_assert(tm);
+    ogs_assert(duration);
+
+    list = xact_timer_list(xact, tm);
+    ogs_assert(list);
+
+    if (tm->expires)
+        ogs_list_remove(list, tm);
+
+    tm->expires = ogs_get_monotonic_time() + duration;
+
+    /*
+     * All the deadlines in a list are started with the same duration,
+     * so the new one is almost always appended at the end.
+     */
+    ogs_list_reverse_for_each(list, prev) {
+        if (prev->expires <= tm->expires)
+            break;
+    }
+    if (prev)
+        ogs_list_insert_next(list, prev, tm);
+    else
+        ogs_list_prepend(list, tm);
+
+    /* Only the earliest deadline needs the timer of the node */
+    if (ogs_list_first(list) == tm)
+        node_timer_update(xact->node);
+}
+
+static void xact_timer_stop(ogs_pfcp_xact_t *xact, ogs_pfcp_xact_timer_t *tm)
+{
+    ogs_assert(tm);
+
+    if (!tm->expires)
+        return;
+
+    /*
+     * The timer of the node is left as it is.
+     * If it fires earlier than needed, node_timeout() starts it again.
+     */
+    ogs_list_remove(xact_timer_list(xact, tm), tm);
+    tm->expires = 0;
+}
+
+static ogs_pfcp_xact_timer_t *node_timer_first(ogs_pfcp_node_t *node)
+{
+    ogs_pfcp_xact_timer_t *first = NULL, *tm = NULL;
+
+    ogs_assert(node);
+
+    first = ogs_list_first(&node->xact_timer.response_list);
+
+    tm = ogs_list_first(&node->xact_timer.holding_list);
+    if (tm && (!first || tm->expires < first->expires))
+        first = tm;
+
+    tm = ogs_list_first(&node->xact_timer.delayed_commit_list);
+    if (tm && (!first || tm->expires < first->expires))
+        first = tm;
+
+    return first;
+}
+
+static void node_timer_update(ogs_pfcp_node_t *node)
+{
+    ogs_pfcp_xact_timer_t *first = NULL;
+    ogs_time_t now;
+
+    ogs_assert(node);
+    ogs_assert(node->xact_timer.timer);
+
+    first = node_timer_first(node);
+    if (!first) {
+        ogs_timer_stop(node->xact_timer.timer);
+        return;
+    }
+
+    now = ogs_get_monotonic_time();
+    ogs_timer_start(node->xact_timer.timer,
+            first->expires > now ? first->expires - now : 1);
+}
+
+static void node_timeout(void *data)
+{
+    ogs_pfcp_node_t *node = data;
+    ogs_pfcp_xact_timer_t *tm = NULL;
+    ogs_pfcp_xact_t *xact = NULL;
+    ogs_time_t now;
+
+    ogs_assert(node);
+
+    now = ogs_get_monotonic_time();
+
+    expiring_node = node;
+
+    while ((tm = node_timer_first(node)) && tm->expires <= now) {
+        if (tm == ogs_list_first(&node->xact_timer.response_list)) {
+            xact = ogs_list_entry(tm, ogs_pfcp_xact_t, tm_response);
+            xact_timer_stop(xact, tm);
+            response_timeout(xact);
+        } else if (tm == ogs_list_first(&node->xact_timer.holding_list)) {
+            xact = ogs_list_entry(tm, ogs_pfcp_xact_t, tm_holding);
+            xact_timer_stop(xact, tm);
+            holding_timeout(xact);
+        } else {
+            xact = ogs_list_entry(tm, ogs_pfcp_xact_t, tm_delayed_commit);
+            xact_timer_stop(xact, tm);
+            delayed_commit_timeout(xact);
+        }
+
+        /* The node has been removed by the transaction callback */
+        if (expiring_node != node)
+            return;
+    }
+
+    expiring_node = NULL;
+
+    node_timer_update(node);
+}
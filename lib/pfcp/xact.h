@@ -28,6 +28,17 @@
 extern "C" {
 #endif
 
+/**
+ * Transaction timer
+ *
+ * The deadlines are kept in the lists of the PFCP node,
+ * and only the earliest one is scheduled on the timer of the node.
+ */
+typedef struct ogs_pfcp_xact_timer_s {
+    ogs_lnode_t     lnode;          /**< A node of the deadline list */
+    ogs_time_t      expires;        /**< 0 if the timer is not running */
+} ogs_pfcp_xact_timer_t;
+
 /**
  * Transaction context
  */
@@ -58,12 +69,12 @@ typedef struct ogs_pfcp_xact_s {
         ogs_pkbuf_t *pkbuf;         /**< Packet history */
     } seq[3];                       /**< history for the each step */
 
-    ogs_timer_t     *tm_response;   /**< Timer waiting for next message */
+    ogs_pfcp_xact_timer_t tm_response; /**< Timer waiting for next message */
     uint8_t         response_rcount;
-    ogs_timer_t     *tm_holding;    /**< Timer waiting for holding message */
+    ogs_pfcp_xact_timer_t tm_holding;  /**< Timer waiting for holding message */
     uint8_t         holding_rcount;
 
-    ogs_timer_t     *tm_delayed_commit; /**< Timer waiting for commit xact */
+    ogs_pfcp_xact_timer_t tm_delayed_commit; /**< Timer waiting for commit */
 
     uint64_t        local_seid;     /**< Local SEID,
                                          expected in reply from peer */
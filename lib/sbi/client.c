@@ -34,10 +34,10 @@ typedef struct connection_s {
 
     void *data;
 
-    char *method;
+    char method[16];
 
-    int num_of_header;
-    char **headers;
+    /* Kept while the handle is idle,
+     * so the same headers are not built again */
     struct curl_slist *header_list;
 
     char *content;
@@ -52,6 +52,7 @@ typedef struct connection_s {
     ogs_timer_t *timer;
     CURL *easy;
 
+    ogs_time_t start;
     char error[CURL_ERROR_SIZE];
 
     ogs_sbi_client_t *client;
@@ -74,6 +75,7 @@ static connection_t *connection_add(
 static void connection_remove(connection_t *conn);
 static void connection_free(connection_t *conn);
 static void connection_remove_all(ogs_sbi_client_t *client);
+static void connection_free_idle(ogs_sbi_client_t *client);
 static void connection_timer_expired(void *data);
 
 void ogs_sbi_client_init(int num_of_sockinfo_pool, int num_of_connection_pool)
@@ -132,12 +134,17 @@ ogs_sbi_client_t *ogs_sbi_client_add(
     curl_multi_setopt(multi, CURLMOPT_SOCKETDATA, client);
     curl_multi_setopt(multi, CURLMOPT_TIMERFUNCTION, multi_timer_cb);
     curl_multi_setopt(multi, CURLMOPT_TIMERDATA, client);
+
+    client->max_stream = ogs_app()->max.stream;
+    if (!client->max_stream)
+        client->max_stream = ogs_app()->pool.stream;
 #ifdef CURLMOPT_MAX_CONCURRENT_STREAMS
     curl_multi_setopt(multi, CURLMOPT_MAX_CONCURRENT_STREAMS,
-                        ogs_app()->pool.stream);
+                        (long)client->max_stream);
 #endif
 
     ogs_list_init(&client->connection_list);
+    ogs_list_init(&client->idle_list);
 
     ogs_list_add(&ogs_sbi_self()->client_list, client);
 
@@ -164,7 +171,16 @@ void ogs_sbi_client_remove(ogs_sbi_client_t *client)
 
     ogs_list_remove(&ogs_sbi_self()->client_list, client);
 
+    if (client->stats.request) {
+        char stats[OGS_HUGE_LEN];
+
+        ogs_info("[%s:%d] %s", OGS_ADDR(addr, buf), OGS_PORT(addr),
+                ogs_sbi_client_stats_print(
+                    client, stats, stats + sizeof(stats)));
+    }
+
     connection_remove_all(client);
+    connection_free_idle(client);
 
     ogs_assert(client->t_curl);
     ogs_timer_delete(client->t_curl);
@@ -294,19 +310,25 @@ static char *add_params_to_uri(CURL *easy, char *uri, ogs_hash_t *params)
     return uri;
 }
 
-static connection_t *connection_add(
-        ogs_sbi_client_t *client, ogs_sbi_client_cb_f client_cb,
-        ogs_sbi_request_t *request, void *data)
+/*
+ * The easy handle of a completed request is kept on the idle list of
+ * the client and reset in place for the next one. Its timer and header
+ * list are reused as well.
+ */
+#define MAX_NUM_OF_IDLE_CONNECTION 16
+
+static connection_t *connection_get(ogs_sbi_client_t *client)
 {
-    ogs_hash_index_t *hi;
-    int i;
     connection_t *conn = NULL;
-    CURLMcode rc;
 
     ogs_assert(client);
-    ogs_assert(client_cb);
-    ogs_assert(request);
-    ogs_assert(request->h.method);
+
+    conn = ogs_list_first(&client->idle_list);
+    if (conn) {
+        ogs_list_remove(&client->idle_list, conn);
+        client->num_of_idle--;
+        return conn;
+    }
 
     ogs_pool_alloc(&connection_pool, &conn);
     if (!conn) {
@@ -316,44 +338,171 @@ static connection_t *connection_add(
     memset(conn, 0, sizeof(connection_t));
 
     conn->client = client;
-    conn->client_cb = client_cb;
-    conn->data = data;
 
-    conn->method = ogs_strdup(request->h.method);
-    if (!conn->method) {
-        ogs_error("conn->method is NULL");
+    conn->timer = ogs_timer_add(
+            ogs_app()->timer_mgr, connection_timer_expired, conn);
+    if (!conn->timer) {
+        ogs_error("conn->timer is NULL");
+        connection_free(conn);
+        return NULL;
+    }
+
+    conn->easy = curl_easy_init();
+    if (!conn->easy) {
+        ogs_error("conn->easy is NULL");
         connection_free(conn);
         return NULL;
     }
 
-    conn->num_of_header = ogs_hash_count(request->http.headers);
-    if (conn->num_of_header) {
-        conn->headers = ogs_calloc(conn->num_of_header, sizeof(char *));
-        if (!conn->headers) {
-            ogs_error("conn->headers is NULL");
-            connection_free(conn);
-            return NULL;
+    return conn;
+}
+
+static void connection_put(connection_t *conn)
+{
+    ogs_sbi_client_t *client = NULL;
+
+    ogs_assert(conn);
+    client = conn->client;
+    ogs_assert(client);
+
+    if (client->num_of_idle >=
+            ogs_min(client->max_stream, MAX_NUM_OF_IDLE_CONNECTION)) {
+        connection_free(conn);
+        return;
+    }
+
+    ogs_timer_stop(conn->timer);
+    curl_easy_reset(conn->easy);
+
+    if (conn->content) {
+        ogs_free(conn->content);
+        conn->content = NULL;
+    }
+    if (conn->location) {
+        ogs_free(conn->location);
+        conn->location = NULL;
+    }
+    if (conn->producer_id) {
+        ogs_free(conn->producer_id);
+        conn->producer_id = NULL;
+    }
+    if (conn->memory) {
+        ogs_free(conn->memory);
+        conn->memory = NULL;
+    }
+    conn->size = 0;
+    conn->memory_overflow = false;
+
+    conn->client_cb = NULL;
+    conn->data = NULL;
+
+    ogs_list_add(&client->idle_list, conn);
+    client->num_of_idle++;
+}
+
+static int connection_set_header(
+        connection_t *conn, ogs_sbi_request_t *request, bool expect)
+{
+    ogs_hash_index_t *hi;
+    struct curl_slist *node = NULL;
+    char buf[OGS_HUGE_LEN];
+    int len;
+
+    ogs_assert(conn);
+    ogs_assert(request);
+
+    /* Keep the previous list if the request has the same headers */
+    node = conn->header_list;
+    for (hi = ogs_hash_first(request->http.headers);
+            hi; hi = ogs_hash_next(hi)) {
+        len = ogs_snprintf(buf, sizeof(buf), "%s: %s",
+                (const char *)ogs_hash_this_key(hi),
+                (char *)ogs_hash_this_val(hi));
+        if (len < 0 || len >= sizeof(buf)) {
+            ogs_error("Header too long [%d]", len);
+            return OGS_ERROR;
         }
-        for (hi = ogs_hash_first(request->http.headers), i = 0;
-                hi && i < conn->num_of_header; hi = ogs_hash_next(hi), i++) {
-            const char *key = ogs_hash_this_key(hi);
-            char *val = ogs_hash_this_val(hi);
-
-            conn->headers[i] = ogs_msprintf("%s: %s", key, val);
-            if (!conn->headers[i]) {
-                ogs_error("conn->headers[i=%d] is NULL", i);
-                connection_free(conn);
-                return NULL;
-            }
-            conn->header_list = curl_slist_append(
-                    conn->header_list, conn->headers[i]);
+        if (!node || strcmp(node->data, buf) != 0)
+            break;
+        node = node->next;
+    }
+    if (!hi) {
+        if (expect == true) {
+            if (node && strcmp(node->data, "Expect:") == 0 && !node->next)
+                return OGS_OK;
+        } else if (!node) {
+            return OGS_OK;
         }
     }
 
-    conn->timer = ogs_timer_add(
-            ogs_app()->timer_mgr, connection_timer_expired, conn);
-    if (!conn->timer) {
-        ogs_error("conn->timer is NULL");
+    curl_slist_free_all(conn->header_list);
+    conn->header_list = NULL;
+
+    for (hi = ogs_hash_first(request->http.headers);
+            hi; hi = ogs_hash_next(hi)) {
+        ogs_snprintf(buf, sizeof(buf), "%s: %s",
+                (const char *)ogs_hash_this_key(hi),
+                (char *)ogs_hash_this_val(hi));
+        node = curl_slist_append(conn->header_list, buf);
+        if (!node) {
+            ogs_error("curl_slist_append() failed");
+            return OGS_ERROR;
+        }
+        conn->header_list = node;
+    }
+
+#if 1 /* Disable HTTP/1.1 100 Continue : Use "Expect:" in libcurl */
+    if (expect == true) {
+        node = curl_slist_append(conn->header_list, "Expect:");
+        if (!node) {
+            ogs_error("curl_slist_append() failed");
+            return OGS_ERROR;
+        }
+        conn->header_list = node;
+    }
+#endif
+
+    return OGS_OK;
+}
+
+static connection_t *connection_add(
+        ogs_sbi_client_t *client, ogs_sbi_client_cb_f client_cb,
+        ogs_sbi_request_t *request, void *data)
+{
+    connection_t *conn = NULL;
+    CURLMcode rc;
+    bool custom_request = false;
+
+    ogs_assert(client);
+    ogs_assert(client_cb);
+    ogs_assert(request);
+    ogs_assert(request->h.method);
+
+    if (strlen(request->h.method) >= sizeof(conn->method)) {
+        ogs_error("Invalid HTTP method [%s]", request->h.method);
+        return NULL;
+    }
+
+    conn = connection_get(client);
+    if (!conn) {
+        ogs_error("connection_get() failed");
+        return NULL;
+    }
+
+    conn->client_cb = client_cb;
+    conn->data = data;
+
+    ogs_cpystrn(conn->method, request->h.method, sizeof(conn->method));
+
+    if (strcmp(request->h.method, OGS_SBI_HTTP_METHOD_PUT) == 0 ||
+        strcmp(request->h.method, OGS_SBI_HTTP_METHOD_PATCH) == 0 ||
+        strcmp(request->h.method, OGS_SBI_HTTP_METHOD_DELETE) == 0 ||
+        strcmp(request->h.method, OGS_SBI_HTTP_METHOD_POST) == 0)
+        custom_request = true;
+
+    if (connection_set_header(conn, request,
+                custom_request == true && request->http.content) != OGS_OK) {
+        ogs_error("connection_set_header() failed");
         connection_free(conn);
         return NULL;
     }
@@ -363,13 +512,6 @@ static connection_t *connection_add(
     ogs_timer_start(conn->timer,
             ogs_app()->time.message.sbi.connection_deadline);
 
-    conn->easy = curl_easy_init();
-    if (!conn->easy) {
-        ogs_error("conn->easy is NULL");
-        connection_free(conn);
-        return NULL;
-    }
-
     if (ogs_hash_count(request->http.params)) {
         char *uri = add_params_to_uri(conn->easy,
                             request->h.uri, request->http.params);
@@ -388,11 +530,7 @@ static connection_t *connection_add(
     curl_easy_setopt(conn->easy, CURLOPT_SSL_VERIFYHOST, 0);
 
     /* HTTP Method */
-    if (strcmp(request->h.method, OGS_SBI_HTTP_METHOD_PUT) == 0 ||
-        strcmp(request->h.method, OGS_SBI_HTTP_METHOD_PATCH) == 0 ||
-        strcmp(request->h.method, OGS_SBI_HTTP_METHOD_DELETE) == 0 ||
-        strcmp(request->h.method, OGS_SBI_HTTP_METHOD_POST) == 0) {
-
+    if (custom_request == true) {
         curl_easy_setopt(conn->easy,
                 CURLOPT_CUSTOMREQUEST, request->h.method);
         if (request->http.content) {
@@ -407,12 +545,6 @@ static connection_t *connection_add(
                     CURLOPT_POSTFIELDS, conn->content);
             curl_easy_setopt(conn->easy,
                 CURLOPT_POSTFIELDSIZE, request->http.content_length);
-#if 1 /* Disable HTTP/1.1 100 Continue : Use "Expect:" in libcurl */
-            conn->header_list = curl_slist_append(
-                    conn->header_list, "Expect:");
-#else
-            curl_easy_setopt(conn->easy, CURLOPT_EXPECT_100_TIMEOUT_MS, 0L);
-#endif
             ogs_debug("SENDING...[%d]", (int)request->http.content_length);
             if (request->http.content_length)
                 ogs_debug("%s", request->http.content);
@@ -425,6 +557,9 @@ static connection_t *connection_add(
     curl_easy_setopt(conn->easy,
             CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE);
 #endif
+#if LIBCURL_VERSION_NUM >= 0x072B00 /* Multiplex rather than connect */
+    curl_easy_setopt(conn->easy, CURLOPT_PIPEWAIT, 1L);
+#endif
 
     ogs_list_add(&client->connection_list, conn);
 
@@ -437,6 +572,13 @@ static connection_t *connection_add(
     curl_easy_setopt(conn->easy, CURLOPT_HEADERDATA, conn);
     curl_easy_setopt(conn->easy, CURLOPT_ERRORBUFFER, conn->error);
 
+    conn->start = ogs_get_monotonic_time();
+
+    client->stats.request++;
+    client->stats.stream++;
+    if (client->stats.stream > client->stats.stream_hwm)
+        client->stats.stream_hwm = client->stats.stream;
+
     ogs_assert(client->multi);
     rc = curl_multi_add_handle(client->multi, conn->easy);
     mcode_or_die("connection_add: curl_multi_add_handle", rc);
@@ -453,17 +595,16 @@ static void connection_remove(connection_t *conn)
     ogs_assert(client);
 
     ogs_list_remove(&client->connection_list, conn);
+    client->stats.stream--;
 
     ogs_assert(client->multi);
     curl_multi_remove_handle(client->multi, conn->easy);
 
-    connection_free(conn);
+    connection_put(conn);
 }
 
 static void connection_free(connection_t *conn)
 {
-    int i;
-
     ogs_assert(conn);
 
     if (conn->content)
@@ -483,17 +624,8 @@ static void connection_free(connection_t *conn)
     if (conn->timer)
         ogs_timer_delete(conn->timer);
 
-    if (conn->num_of_header) {
-        for (i = 0; i < conn->num_of_header; i++)
-            if (conn->headers[i])
-                ogs_free(conn->headers[i]);
-        ogs_free(conn->headers);
-    }
     curl_slist_free_all(conn->header_list);
 
-    if (conn->method)
-        ogs_free(conn->method);
-
     ogs_pool_free(&connection_pool, conn);
 }
 
@@ -507,6 +639,76 @@ static void connection_remove_all(ogs_sbi_client_t *client)
         connection_remove(conn);
 }
 
+static void connection_free_idle(ogs_sbi_client_t *client)
+{
+    connection_t *conn = NULL, *next_conn = NULL;
+
+    ogs_assert(client);
+
+    ogs_list_for_each_safe(&client->idle_list, next_conn, conn) {
+        ogs_list_remove(&client->idle_list, conn);
+        connection_free(conn);
+    }
+    client->num_of_idle = 0;
+}
+
+/*
+ * e.g. "request:10 error:0 stream-hwm:2/100 latency(usec):[<512:8,<1024:2]"
+ *
+ * Each latency bucket is printed with its upper bound.
+ * Only the buckets with responses are printed.
+ */
+char *ogs_sbi_client_stats_print(
+        ogs_sbi_client_t *client, char *buf, char *last)
+{
+    char *p = buf;
+    int i, n = 0;
+
+    ogs_assert(client);
+    ogs_assert(buf);
+    ogs_assert(last);
+
+    p = ogs_slprintf(p, last, "request:%llu error:%llu stream-hwm:%d/%d "
+            "latency(usec):[",
+            (unsigned long long)client->stats.request,
+            (unsigned long long)client->stats.error,
+            client->stats.stream_hwm, client->max_stream);
+
+    for (i = 0; i < OGS_SBI_CLIENT_MAX_LATENCY; i++) {
+        if (!client->stats.latency[i])
+            continue;
+
+        if (i == OGS_SBI_CLIENT_MAX_LATENCY - 1)
+            p = ogs_slprintf(p, last, "%s+Inf:%llu", n++ ? "," : "",
+                    (unsigned long long)client->stats.latency[i]);
+        else
+            p = ogs_slprintf(p, last, "%s<%llu:%llu", n++ ? "," : "",
+                    1ULL << (i+1),
+                    (unsigned long long)client->stats.latency[i]);
+    }
+
+    ogs_slprintf(p, last, "]");
+
+    return buf;
+}
+
+static void connection_latency(connection_t *conn)
+{
+    ogs_sbi_client_t *client = NULL;
+    ogs_time_t usec;
+    int i;
+
+    ogs_assert(conn);
+    client = conn->client;
+    ogs_assert(client);
+
+    usec = ogs_get_monotonic_time() - conn->start;
+    for (i = 0; i < OGS_SBI_CLIENT_MAX_LATENCY - 1 && usec >= 2; i++)
+        usec >>= 1;
+
+    client->stats.latency[i]++;
+}
+
 static void connection_timer_expired(void *data)
 {
     connection_t *conn = NULL;
@@ -516,6 +718,9 @@ static void connection_timer_expired(void *data)
 
     ogs_error("Connection timer expired");
 
+    ogs_assert(conn->client);
+    conn->client->stats.error++;
+
     ogs_assert(conn->client_cb);
     conn->client_cb(OGS_TIMEUP, NULL, conn->data);
 
@@ -558,6 +763,8 @@ static void check_multi_info(ogs_sbi_client_t *client)
             if (res == CURLE_OK) {
                 ogs_log_level_e level = OGS_LOG_DEBUG;
 
+                connection_latency(conn);
+
                 response = ogs_sbi_response_new();
                 ogs_assert(response);
 
@@ -606,8 +813,10 @@ static void check_multi_info(ogs_sbi_client_t *client)
                     break;
                 }
 
-            } else
+            } else {
                 ogs_warn("[%d] %s", res, conn->error);
+                client->stats.error++;
+            }
 
             ogs_assert(conn->client_cb);
             if (res == CURLE_OK)
@@ -64,6 +64,21 @@ typedef struct ogs_sbi_client_s {
     void            *multi;             /* CURL multi handle */
     int             still_running;      /* number of running CURL handle */
 
+    ogs_list_t      idle_list;          /* Reusable CURL easy handles */
+    int             num_of_idle;
+    int             max_stream;         /* HTTP/2 concurrent streams */
+
+    struct {
+        uint64_t    request;
+        uint64_t    error;              /* Including timeout */
+        int         stream;             /* Streams in flight */
+        int         stream_hwm;
+
+#define OGS_SBI_CLIENT_MAX_LATENCY 24
+        /* latency[i] : Number of responses in [2^i, 2^(i+1)) usec */
+        uint64_t    latency[OGS_SBI_CLIENT_MAX_LATENCY];
+    } stats;
+
     unsigned int    reference_count;    /* reference count for memory free */
 } ogs_sbi_client_t;
 
@@ -82,6 +97,9 @@ ogs_sbi_client_t *ogs_sbi_client_find(
 void ogs_sbi_client_stop(ogs_sbi_client_t *client);
 void ogs_sbi_client_stop_all(void);
 
+char *ogs_sbi_client_stats_print(
+        ogs_sbi_client_t *client, char *buf, char *last);
+
 bool ogs_sbi_client_send_request(
         ogs_sbi_client_t *client, ogs_sbi_client_cb_f client_cb,
         ogs_sbi_request_t *request, void *data);
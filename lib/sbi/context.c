@@ -52,13 +52,13 @@ void ogs_sbi_context_init(OpenAPI_nf_type_e nf_type)
     ogs_pool_init(&nf_instance_pool, ogs_app()->pool.nf);
     ogs_pool_init(&nf_service_pool, ogs_app()->pool.nf_service);
 
-    ogs_pool_init(&xact_pool, ogs_app()->pool.xact);
+    ogs_pool_elastic_init(&xact_pool, ogs_app()->pool.xact);
 
     ogs_list_init(&self.subscription_spec_list);
     ogs_pool_init(&subscription_spec_pool, ogs_app()->pool.subscription);
 
     ogs_list_init(&self.subscription_data_list);
-    ogs_pool_init(&subscription_data_pool, ogs_app()->pool.subscription);
+    ogs_pool_elastic_init(&subscription_data_pool, ogs_app()->pool.subscription);
 
     ogs_pool_init(&smf_info_pool, ogs_app()->pool.nf);
 
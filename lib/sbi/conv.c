@@ -791,7 +791,7 @@ char *ogs_sbi_s_nssai_to_string(ogs_s_nssai_t *s_nssai)
     }
     if (sNSSAI.sd) ogs_free(sNSSAI.sd);
 
-    v = cJSON_Print(item);
+    v = cJSON_PrintUnformatted(item);
     ogs_expect(v);
     cJSON_Delete(item);
 
@@ -462,9 +462,9 @@ ogs_sbi_request_t *ogs_sbi_build_request(ogs_sbi_message_t *message)
             if (plmn_id.mnc) ogs_free(plmn_id.mnc);
             if (plmn_id.mcc) ogs_free(plmn_id.mcc);
 
-            v = cJSON_Print(item);
+            v = cJSON_PrintUnformatted(item);
             if (!v) {
-                ogs_error("cJSON_Print() failed");
+                ogs_error("cJSON_PrintUnformatted() failed");
                 ogs_sbi_request_free(request);
                 return NULL;
             }
@@ -531,9 +531,9 @@ ogs_sbi_request_t *ogs_sbi_build_request(ogs_sbi_message_t *message)
             return NULL;
         }
 
-        v = cJSON_Print(item);
+        v = cJSON_PrintUnformatted(item);
         if (!v) {
-            ogs_error("cJSON_Print() failed");
+            ogs_error("cJSON_PrintUnformatted() failed");
             ogs_sbi_request_free(request);
             return NULL;
         }
@@ -1203,7 +1203,7 @@ static char *build_json(ogs_sbi_message_t *message)
     }
 
     if (item) {
-        content = cJSON_Print(item);
+        content = cJSON_PrintUnformatted(item);
         ogs_assert(content);
         ogs_log_print(OGS_LOG_TRACE, "%s", content);
         cJSON_Delete(item);
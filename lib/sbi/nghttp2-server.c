@@ -21,10 +21,21 @@
 #include "yuarel.h"
 
 #include <netinet/tcp.h>
+#include <sys/uio.h>
 #include <nghttp2/nghttp2.h>
 
 #define USE_SEND_DATA_WITH_NO_COPY 1
 
+#define NUM_OF_IOV_PER_STREAM 4
+#define MAX_NUM_OF_IOV_IN_WRITEV 64
+#define MIN_SIZE_OF_WRITE_BUFFER 2048
+
+/*
+ * Content-Length comes from the peer, so the body is allocated
+ * up to this size at first and grows as the data arrives.
+ */
+#define MAX_SIZE_OF_CONTENT_PREALLOC (1024*1024)
+
 static void server_init(int num_of_session_pool, int num_of_stream_pool);
 static void server_final(void);
 
@@ -83,11 +94,34 @@ typedef struct ogs_sbi_stream_s {
 
     int32_t                 stream_id;
     ogs_sbi_request_t       *request;
+    size_t                  content_length; /* From Content-Length */
+    size_t                  content_size;   /* Allocated for the body */
     bool                    memory_overflow;
 
+    /*
+     * The response is owned by the stream until the last DATA frame
+     * referencing its body is queued. See on_send_data().
+     */
+    ogs_sbi_response_t      *response;
+    size_t                  sent;
+
     ogs_sbi_session_t       *session;
 } ogs_sbi_stream_t;
 
+/*
+ * Output queue entry of the session. DATA frames refer to the response body
+ * instead of copying it, and the whole queue is flushed with writev().
+ */
+typedef struct ogs_sbi_iov_s {
+    ogs_lnode_t             lnode;
+
+    struct iovec            iov;
+
+    ogs_pkbuf_t             *pkbuf;
+    ogs_sbi_response_t      *response;
+    bool                    free_response;
+} ogs_sbi_iov_t;
+
 static void session_remove(ogs_sbi_session_t *sbi_sess);
 static void session_remove_all(ogs_sbi_server_t *server);
 
@@ -100,19 +134,28 @@ static int session_set_callbacks(ogs_sbi_session_t *sbi_sess);
 static int session_send_preface(ogs_sbi_session_t *sbi_sess);
 static int session_send(ogs_sbi_session_t *sbi_sess);
 static void session_write_to_buffer(
-        ogs_sbi_session_t *sbi_sess, ogs_pkbuf_t *pkbuf);
+        ogs_sbi_session_t *sbi_sess, ogs_sbi_iov_t *iov);
+static void session_write_data(ogs_sbi_session_t *sbi_sess,
+        const uint8_t *data, size_t length);
+
+static ogs_sbi_iov_t *iov_new(void);
+static void iov_free(ogs_sbi_iov_t *iov);
 
 static OGS_POOL(session_pool, ogs_sbi_session_t);
 static OGS_POOL(stream_pool, ogs_sbi_stream_t);
+static OGS_POOL(iov_pool, ogs_sbi_iov_t);
 
 static void server_init(int num_of_session_pool, int num_of_stream_pool)
 {
     ogs_pool_init(&session_pool, num_of_session_pool);
-    ogs_pool_init(&stream_pool, num_of_stream_pool);
+    ogs_pool_elastic_init(&stream_pool, num_of_stream_pool);
+    ogs_pool_elastic_init(&iov_pool,
+            num_of_stream_pool * NUM_OF_IOV_PER_STREAM);
 }
 
 static void server_final(void)
 {
+    ogs_pool_final(&iov_pool);
     ogs_pool_final(&stream_pool);
     ogs_pool_final(&session_pool);
 }
@@ -343,6 +386,7 @@ static ssize_t response_read_callback(nghttp2_session *session,
 
     ogs_sbi_response_t *response = NULL;
     ogs_sbi_stream_t *stream = NULL;
+    size_t len;
 
     ogs_assert(session);
 
@@ -358,11 +402,28 @@ static ssize_t response_read_callback(nghttp2_session *session,
 
     ogs_assert(response->http.content);
     ogs_assert(response->http.content_length);
+    ogs_assert(stream->sent < response->http.content_length);
+
+    /* The body is split into frames of at most 'length' octets */
+    len = ogs_min(length, response->http.content_length - stream->sent);
 
 #if USE_SEND_DATA_WITH_NO_COPY
     *data_flags |= NGHTTP2_DATA_FLAG_NO_COPY;
+
+    /* stream->sent is updated in on_send_data() */
+    if (stream->sent + len < response->http.content_length)
+        return len;
 #else
-    memcpy(buf, response->http.content, response->http.content_length);
+    memcpy(buf, response->http.content + stream->sent, len);
+
+    stream->sent += len;
+    if (stream->sent < response->http.content_length)
+        return len;
+
+    if (stream->response == response) {
+        ogs_sbi_response_free(stream->response);
+        stream->response = NULL;
+    }
 #endif
 
     *data_flags |= NGHTTP2_DATA_FLAG_EOF;
@@ -378,11 +439,15 @@ static ssize_t response_read_callback(nghttp2_session *session,
     }
 #endif
 
-    return response->http.content_length;
+    return len;
 }
 
-static bool server_send_rspmem_persistent(
-        ogs_sbi_stream_t *stream, ogs_sbi_response_t *response)
+/*
+ * If 'owned' is true and this function returns true, the response is
+ * freed by this server once its body has been written to the socket.
+ */
+static bool send_response(ogs_sbi_stream_t *stream,
+        ogs_sbi_response_t *response, bool owned)
 {
     ogs_sbi_session_t *sbi_sess = NULL;
     ogs_sock_t *sock = NULL;
@@ -480,6 +545,20 @@ static bool server_send_rspmem_persistent(
                 sbi_sess->session, NGHTTP2_FLAG_NONE, stream->stream_id, rv);
     }
 
+    if (owned == true) {
+        if (rv == OGS_OK &&
+            response->http.content && response->http.content_length) {
+            /* The DATA frames will refer to the body */
+            if (stream->response)
+                ogs_sbi_response_free(stream->response);
+            stream->response = response;
+        } else {
+            ogs_sbi_response_free(response);
+        }
+    }
+
+    stream->sent = 0;
+
     if (session_send(sbi_sess) != OGS_OK) {
         ogs_error("session_send() failed");
         session_remove(sbi_sess);
@@ -490,18 +569,23 @@ static bool server_send_rspmem_persistent(
     return true;
 }
 
-static bool server_send_response(
+static bool server_send_rspmem_persistent(
         ogs_sbi_stream_t *stream, ogs_sbi_response_t *response)
 {
-    bool rc;
+    return send_response(stream, response, false);
+}
 
+static bool server_send_response(
+        ogs_sbi_stream_t *stream, ogs_sbi_response_t *response)
+{
     ogs_assert(response);
 
-    rc = server_send_rspmem_persistent(stream, response);
-
-    ogs_sbi_response_free(response);
+    if (send_response(stream, response, true) == false) {
+        ogs_sbi_response_free(response);
+        return false;
+    }
 
-    return rc;
+    return true;
 }
 
 static ogs_sbi_server_t *server_from_stream(ogs_sbi_stream_t *stream)
@@ -560,6 +644,25 @@ static void stream_remove(ogs_sbi_stream_t *stream)
     ogs_assert(stream->request);
     ogs_sbi_request_free(stream->request);
 
+    if (stream->response) {
+        ogs_sbi_iov_t *iov = NULL;
+
+        /*
+         * The stream has been closed before the whole body is queued.
+         * The last queued frame of the body frees the response.
+         */
+        ogs_list_reverse_for_each(&sbi_sess->write_queue, iov) {
+            if (iov->response == stream->response) {
+                iov->free_response = true;
+                stream->response = NULL;
+                break;
+            }
+        }
+
+        if (stream->response)
+            ogs_sbi_response_free(stream->response);
+    }
+
     ogs_pool_free(&stream_pool, stream);
 }
 
@@ -617,7 +720,7 @@ static ogs_sbi_session_t *session_add(
 static void session_remove(ogs_sbi_session_t *sbi_sess)
 {
     ogs_sbi_server_t *server = NULL;
-    ogs_pkbuf_t *pkbuf = NULL, *next_pkbuf = NULL;
+    ogs_sbi_iov_t *iov = NULL, *next_iov = NULL;
 
     ogs_assert(sbi_sess);
     server = sbi_sess->server;
@@ -637,9 +740,9 @@ static void session_remove(ogs_sbi_session_t *sbi_sess)
     if (sbi_sess->poll.write)
         ogs_pollset_remove(sbi_sess->poll.write);
 
-    ogs_list_for_each_safe(&sbi_sess->write_queue, next_pkbuf, pkbuf) {
-        ogs_list_remove(&sbi_sess->write_queue, pkbuf);
-        ogs_pkbuf_free(pkbuf);
+    ogs_list_for_each_safe(&sbi_sess->write_queue, next_iov, iov) {
+        ogs_list_remove(&sbi_sess->write_queue, iov);
+        iov_free(iov);
     }
 
     ogs_assert(sbi_sess->addr);
@@ -749,6 +852,10 @@ static void recv_handler(short when, ogs_socket_t fd, void *data)
             ogs_error("nghttp2_session_mem_recv() failed (%d:%s)",
                         (int)readlen, nghttp2_strerror((int)readlen));
             session_remove(sbi_sess);
+        } else if (nghttp2_session_want_write(sbi_sess->session)) {
+            /* WINDOW_UPDATE for the request body, SETTINGS/PING ACK */
+            if (session_send(sbi_sess) != OGS_OK)
+                ogs_error("session_send() failed");
         }
     } else {
         if (n < 0) {
@@ -1007,6 +1114,7 @@ static int on_header(nghttp2_session *session, const nghttp2_frame *frame,
 
     const char PATH[] = ":path";
     const char METHOD[] = ":method";
+    const char CONTENT_LENGTH[] = "content-length";
 
     nghttp2_vec namebuf, valuebuf;
     char *namestr = NULL, *valuestr = NULL;
@@ -1086,6 +1194,13 @@ static int on_header(nghttp2_session *session, const nghttp2_frame *frame,
         request->h.method = ogs_strdup(valuestr);
         ogs_assert(request->h.method);
 
+    } else if (namebuf.len == sizeof(CONTENT_LENGTH) - 1 &&
+            memcmp(CONTENT_LENGTH, namebuf.base, namebuf.len) == 0) {
+
+        /* The body is allocated at once in on_data_chunk_recv() */
+        stream->content_length = atoll(valuestr);
+        ogs_sbi_header_set(request->http.headers, namestr, valuestr);
+
     } else {
 
         ogs_sbi_header_set(request->http.headers, namestr, valuestr);
@@ -1105,7 +1220,7 @@ static int on_data_chunk_recv(nghttp2_session *session, uint8_t flags,
     ogs_sbi_stream_t *stream = NULL;
     ogs_sbi_request_t *request = NULL;
 
-    size_t offset = 0;
+    size_t offset = 0, size = 0;
 
     ogs_assert(session);
 
@@ -1125,12 +1240,18 @@ static int on_data_chunk_recv(nghttp2_session *session, uint8_t flags,
         ogs_assert(request->http.content_length == 0);
         ogs_assert(offset == 0);
 
-        request->http.content = (char*)ogs_malloc(len + 1);
-    } else {
+        size = ogs_max(len, ogs_min(
+                    stream->content_length, MAX_SIZE_OF_CONTENT_PREALLOC)) + 1;
+        request->http.content = (char*)ogs_malloc(size);
+        stream->content_size = size;
+    } else if (request->http.content_length + len + 1 > stream->content_size) {
         ogs_assert(request->http.content_length != 0);
 
+        size = ogs_max(request->http.content_length + len + 1,
+                    stream->content_size * 2);
         request->http.content = (char*)ogs_realloc(
-                request->http.content, request->http.content_length + len + 1);
+                request->http.content, size);
+        stream->content_size = size;
     }
 
     if (!request->http.content) {
@@ -1299,8 +1420,9 @@ static int on_send_data(nghttp2_session *session, nghttp2_frame *frame,
 
     ogs_sbi_response_t *response = NULL;
     ogs_sbi_stream_t *stream = NULL;
-    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_sbi_iov_t *iov = NULL;
     size_t padlen = 0;
+    uint8_t padding[256];
 
     ogs_assert(session);
     ogs_assert(frame);
@@ -1322,26 +1444,45 @@ static int on_send_data(nghttp2_session *session, nghttp2_frame *frame,
 
     ogs_assert(framehd);
     ogs_assert(length);
-
-    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
-    ogs_assert(pkbuf);
-    ogs_pkbuf_put_data(pkbuf, framehd, 9);
+    ogs_assert(stream->sent + length <= response->http.content_length);
 
     padlen = frame->data.padlen;
 
+    session_write_data(sbi_sess, framehd, 9);
+
     if (padlen > 0) {
-        ogs_pkbuf_put_u8(pkbuf, padlen-1);
+        padding[0] = padlen-1;
+        session_write_data(sbi_sess, padding, 1);
     }
 
-    ogs_pkbuf_put_data(pkbuf,
-            response->http.content, response->http.content_length);
+    if (stream->response == response) {
+        /* The body is not copied until it is written to the socket */
+        iov = iov_new();
+        ogs_assert(iov);
 
-    if (padlen > 0) {
-        memset(pkbuf->tail, 0, padlen-1);
-        ogs_pkbuf_put(pkbuf, padlen-1);
+        iov->iov.iov_base = response->http.content + stream->sent;
+        iov->iov.iov_len = length;
+        iov->response = response;
+
+        if (stream->sent + length == response->http.content_length) {
+            /* The last DATA frame frees the response */
+            iov->free_response = true;
+            stream->response = NULL;
+        }
+
+        session_write_to_buffer(sbi_sess, iov);
+    } else {
+        /* The persistent response is owned by the caller */
+        session_write_data(sbi_sess,
+                (uint8_t *)response->http.content + stream->sent, length);
     }
 
-    session_write_to_buffer(sbi_sess, pkbuf);
+    stream->sent += length;
+
+    if (padlen > 1) {
+        memset(padding, 0, padlen-1);
+        session_write_data(sbi_sess, padding, padlen-1);
+    }
 
     return 0;
 }
@@ -1350,25 +1491,13 @@ static ssize_t send_callback(nghttp2_session *session, const uint8_t *data,
                              size_t length, int flags, void *user_data)
 {
     ogs_sbi_session_t *sbi_sess = user_data;
-    ogs_sock_t *sock = NULL;
-    ogs_socket_t fd = INVALID_SOCKET;
-
-    ogs_pkbuf_t *pkbuf = NULL;
 
     ogs_assert(sbi_sess);
-    sock = sbi_sess->sock;
-    ogs_assert(sock);
-    fd = sock->fd;
-    ogs_assert(fd != INVALID_SOCKET);
 
     ogs_assert(data);
     ogs_assert(length);
 
-    pkbuf = ogs_pkbuf_alloc(NULL, length);
-    ogs_assert(pkbuf);
-    ogs_pkbuf_put_data(pkbuf, data, length);
-
-    session_write_to_buffer(sbi_sess, pkbuf);
+    session_write_data(sbi_sess, data, length);
 
     return length;
 }
@@ -1376,9 +1505,7 @@ static ssize_t send_callback(nghttp2_session *session, const uint8_t *data,
 
 static int session_send(ogs_sbi_session_t *sbi_sess)
 {
-#if USE_SEND_DATA_WITH_NO_COPY
-    ogs_pkbuf_t *pkbuf = NULL;
-#else
+#if !USE_SEND_DATA_WITH_NO_COPY
     int rv;
 #endif
 
@@ -1401,11 +1528,7 @@ static int session_send(ogs_sbi_session_t *sbi_sess)
             break;
         }
 
-        pkbuf = ogs_pkbuf_alloc(NULL, data_len);
-        ogs_assert(pkbuf);
-        ogs_pkbuf_put_data(pkbuf, data, data_len);
-
-        session_write_to_buffer(sbi_sess, pkbuf);
+        session_write_data(sbi_sess, data, data_len);
     }
 #else
     rv = nghttp2_session_send(sbi_sess->session);
@@ -1422,38 +1545,78 @@ static int session_send(ogs_sbi_session_t *sbi_sess)
 static void session_write_callback(short when, ogs_socket_t fd, void *data)
 {
     ogs_sbi_session_t *sbi_sess = data;
-    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_sbi_iov_t *iov = NULL, *next_iov = NULL;
+    struct iovec iovec[MAX_NUM_OF_IOV_IN_WRITEV];
+    ssize_t sent = 0;
+    int i = 0;
 
     ogs_assert(sbi_sess);
 
-    if (ogs_list_empty(&sbi_sess->write_queue) == true) {
-        ogs_assert(sbi_sess->poll.write);
-        ogs_pollset_remove(sbi_sess->poll.write);
-        sbi_sess->poll.write = NULL;
-        return;
+    if (sbi_sess->ssl) {
+        ogs_list_for_each(&sbi_sess->write_queue, iov) {
+            int rv;
+
+            if (i == MAX_NUM_OF_IOV_IN_WRITEV)
+                break;
+
+            rv = SSL_write(sbi_sess->ssl,
+                    iov->iov.iov_base, iov->iov.iov_len);
+            if (rv <= 0) {
+                ogs_error("SSL_write() failed [%d]",
+                        SSL_get_error(sbi_sess->ssl, rv));
+                break;
+            }
+
+            sent += rv;
+            i++;
+        }
+    } else {
+        ogs_list_for_each(&sbi_sess->write_queue, iov) {
+            if (i == MAX_NUM_OF_IOV_IN_WRITEV)
+                break;
+
+            iovec[i++] = iov->iov;
+        }
+
+        if (i) {
+            sent = writev(fd, iovec, i);
+            if (sent < 0) {
+                int err = ogs_socket_errno;
+                if (err != OGS_EAGAIN && err != EINTR)
+                    ogs_log_message(OGS_LOG_ERROR, err, "writev() failed");
+                return;
+            }
+        }
     }
 
-    pkbuf = ogs_list_first(&sbi_sess->write_queue);
-    ogs_assert(pkbuf);
-    ogs_list_remove(&sbi_sess->write_queue, pkbuf);
+    /* Release what has been written, and keep the rest for POLLOUT */
+    ogs_list_for_each_safe(&sbi_sess->write_queue, next_iov, iov) {
+        if (sent < (ssize_t)iov->iov.iov_len) {
+            iov->iov.iov_base = (uint8_t *)iov->iov.iov_base + sent;
+            iov->iov.iov_len -= sent;
+            break;
+        }
 
-    if (sbi_sess->ssl)
-        SSL_write(sbi_sess->ssl, pkbuf->data, pkbuf->len);
-    else
-        ogs_send(fd, pkbuf->data, pkbuf->len, 0);
+        sent -= iov->iov.iov_len;
 
-    ogs_log_hexdump(OGS_LOG_DEBUG, pkbuf->data, pkbuf->len);
+        ogs_list_remove(&sbi_sess->write_queue, iov);
+        iov_free(iov);
+    }
 
-    ogs_pkbuf_free(pkbuf);
+    if (ogs_list_empty(&sbi_sess->write_queue) == true) {
+        ogs_assert(sbi_sess->poll.write);
+        ogs_pollset_remove(sbi_sess->poll.write);
+        sbi_sess->poll.write = NULL;
+    }
 }
 
 static void session_write_to_buffer(
-        ogs_sbi_session_t *sbi_sess, ogs_pkbuf_t *pkbuf)
+        ogs_sbi_session_t *sbi_sess, ogs_sbi_iov_t *iov)
 {
     ogs_sock_t *sock = NULL;
     ogs_socket_t fd = INVALID_SOCKET;
 
-    ogs_assert(pkbuf);
+    ogs_assert(iov);
 
     ogs_assert(sbi_sess);
     sock = sbi_sess->sock;
@@ -1461,7 +1624,7 @@ static void session_write_to_buffer(
     fd = sock->fd;
     ogs_assert(fd != INVALID_SOCKET);
 
-    ogs_list_add(&sbi_sess->write_queue, pkbuf);
+    ogs_list_add(&sbi_sess->write_queue, iov);
 
     if (!sbi_sess->poll.write) {
         sbi_sess->poll.write = ogs_pollset_add(ogs_app()->pollset,
@@ -1469,3 +1632,66 @@ static void session_write_to_buffer(
         ogs_assert(sbi_sess->poll.write);
     }
 }
+
+/*
+ * The data is copied to the end of the queue
+ * if it fits in the buffer of the last entry.
+ */
+static void session_write_data(ogs_sbi_session_t *sbi_sess,
+        const uint8_t *data, size_t length)
+{
+    ogs_sbi_iov_t *iov = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+
+    ogs_assert(sbi_sess);
+    ogs_assert(data);
+    ogs_assert(length);
+
+    iov = ogs_list_last(&sbi_sess->write_queue);
+    if (iov && iov->pkbuf && ogs_pkbuf_tailroom(iov->pkbuf) >= length) {
+        ogs_pkbuf_put_data(iov->pkbuf, data, length);
+        iov->iov.iov_len += length;
+        return;
+    }
+
+    pkbuf = ogs_pkbuf_alloc(NULL, ogs_max(length, MIN_SIZE_OF_WRITE_BUFFER));
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put_data(pkbuf, data, length);
+
+    iov = iov_new();
+    ogs_assert(iov);
+
+    iov->pkbuf = pkbuf;
+    iov->iov.iov_base = pkbuf->data;
+    iov->iov.iov_len = pkbuf->len;
+
+    session_write_to_buffer(sbi_sess, iov);
+}
+
+static ogs_sbi_iov_t *iov_new(void)
+{
+    ogs_sbi_iov_t *iov = NULL;
+
+    ogs_pool_alloc(&iov_pool, &iov);
+    if (!iov) {
+        ogs_error("ogs_pool_alloc() failed");
+        return NULL;
+    }
+    memset(iov, 0, sizeof(*iov));
+
+    return iov;
+}
+
+static void iov_free(ogs_sbi_iov_t *iov)
+{
+    ogs_assert(iov);
+
+    if (iov->pkbuf)
+        ogs_pkbuf_free(iov->pkbuf);
+    if (iov->free_response == true) {
+        ogs_assert(iov->response);
+        ogs_sbi_response_free(iov->response);
+    }
+
+    ogs_pool_free(&iov_pool, iov);
+}
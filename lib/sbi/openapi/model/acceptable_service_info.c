@@ -150,7 +150,6 @@ end:
 OpenAPI_acceptable_service_info_t *OpenAPI_acceptable_service_info_copy(OpenAPI_acceptable_service_info_t *dst, OpenAPI_acceptable_service_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_acceptable_service_info_convertToJSON(src);
@@ -159,21 +158,6 @@ OpenAPI_acceptable_service_info_t *OpenAPI_acceptable_service_info_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_acceptable_service_info_free(dst);
     dst = OpenAPI_acceptable_service_info_parseFromJSON(item);
     cJSON_Delete(item);
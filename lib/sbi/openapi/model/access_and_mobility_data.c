@@ -560,7 +560,6 @@ end:
 OpenAPI_access_and_mobility_data_t *OpenAPI_access_and_mobility_data_copy(OpenAPI_access_and_mobility_data_t *dst, OpenAPI_access_and_mobility_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_and_mobility_data_convertToJSON(src);
@@ -569,21 +568,6 @@ OpenAPI_access_and_mobility_data_t *OpenAPI_access_and_mobility_data_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_and_mobility_data_free(dst);
     dst = OpenAPI_access_and_mobility_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -127,7 +127,6 @@ end:
 OpenAPI_access_net_charging_identifier_t *OpenAPI_access_net_charging_identifier_copy(OpenAPI_access_net_charging_identifier_t *dst, OpenAPI_access_net_charging_identifier_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_net_charging_identifier_convertToJSON(src);
@@ -136,21 +135,6 @@ OpenAPI_access_net_charging_identifier_t *OpenAPI_access_net_charging_identifier
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_net_charging_identifier_free(dst);
     dst = OpenAPI_access_net_charging_identifier_parseFromJSON(item);
     cJSON_Delete(item);
@@ -51,7 +51,6 @@ end:
 OpenAPI_access_right_status_t *OpenAPI_access_right_status_copy(OpenAPI_access_right_status_t *dst, OpenAPI_access_right_status_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_right_status_convertToJSON(src);
@@ -60,21 +59,6 @@ OpenAPI_access_right_status_t *OpenAPI_access_right_status_copy(OpenAPI_access_r
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_right_status_free(dst);
     dst = OpenAPI_access_right_status_parseFromJSON(item);
     cJSON_Delete(item);
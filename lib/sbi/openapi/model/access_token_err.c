@@ -135,7 +135,6 @@ end:
 OpenAPI_access_token_err_t *OpenAPI_access_token_err_copy(OpenAPI_access_token_err_t *dst, OpenAPI_access_token_err_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_token_err_convertToJSON(src);
@@ -144,21 +143,6 @@ OpenAPI_access_token_err_t *OpenAPI_access_token_err_copy(OpenAPI_access_token_e
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_token_err_free(dst);
     dst = OpenAPI_access_token_err_parseFromJSON(item);
     cJSON_Delete(item);
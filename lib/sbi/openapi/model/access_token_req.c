@@ -572,7 +572,6 @@ end:
 OpenAPI_access_token_req_t *OpenAPI_access_token_req_copy(OpenAPI_access_token_req_t *dst, OpenAPI_access_token_req_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_token_req_convertToJSON(src);
@@ -581,21 +580,6 @@ OpenAPI_access_token_req_t *OpenAPI_access_token_req_copy(OpenAPI_access_token_r
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_token_req_free(dst);
     dst = OpenAPI_access_token_req_parseFromJSON(item);
     cJSON_Delete(item);
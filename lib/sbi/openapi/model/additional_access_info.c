@@ -93,7 +93,6 @@ end:
 OpenAPI_additional_access_info_t *OpenAPI_additional_access_info_copy(OpenAPI_additional_access_info_t *dst, OpenAPI_additional_access_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_additional_access_info_convertToJSON(src);
@@ -102,21 +101,6 @@ OpenAPI_additional_access_info_t *OpenAPI_additional_access_info_copy(OpenAPI_ad
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_additional_access_info_free(dst);
     dst = OpenAPI_additional_access_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -73,7 +73,6 @@ end:
 OpenAPI_additional_snssai_data_t *OpenAPI_additional_snssai_data_copy(OpenAPI_additional_snssai_data_t *dst, OpenAPI_additional_snssai_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_additional_snssai_data_convertToJSON(src);
@@ -82,21 +81,6 @@ OpenAPI_additional_snssai_data_t *OpenAPI_additional_snssai_data_copy(OpenAPI_ad
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_additional_snssai_data_free(dst);
     dst = OpenAPI_additional_snssai_data_parseFromJSON(item);
     cJSON_Delete(item);
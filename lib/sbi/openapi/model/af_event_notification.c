@@ -128,7 +128,6 @@ end:
 OpenAPI_af_event_notification_t *OpenAPI_af_event_notification_copy(OpenAPI_af_event_notification_t *dst, OpenAPI_af_event_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_af_event_notification_convertToJSON(src);
@@ -137,21 +136,6 @@ OpenAPI_af_event_notification_t *OpenAPI_af_event_notification_copy(OpenAPI_af_e
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_af_event_notification_free(dst);
     dst = OpenAPI_af_event_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -137,7 +137,6 @@ end:
 OpenAPI_af_event_subscription_t *OpenAPI_af_event_subscription_copy(OpenAPI_af_event_subscription_t *dst, OpenAPI_af_event_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_af_event_subscription_convertToJSON(src);
@@ -146,21 +145,6 @@ OpenAPI_af_event_subscription_t *OpenAPI_af_event_subscription_copy(OpenAPI_af_e
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_af_event_subscription_free(dst);
     dst = OpenAPI_af_event_subscription_parseFromJSON(item);
     cJSON_Delete(item);
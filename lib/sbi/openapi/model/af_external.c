@@ -172,7 +172,6 @@ end:
 OpenAPI_af_external_t *OpenAPI_af_external_copy(OpenAPI_af_external_t *dst, OpenAPI_af_external_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_af_external_convertToJSON(src);
@@ -181,21 +180,6 @@ OpenAPI_af_external_t *OpenAPI_af_external_copy(OpenAPI_af_external_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_af_external_free(dst);
     dst = OpenAPI_af_external_parseFromJSON(item);
     cJSON_Delete(item);
@@ -255,7 +255,6 @@ end:
 OpenAPI_af_routing_requirement_rm_t *OpenAPI_af_routing_requirement_rm_copy(OpenAPI_af_routing_requirement_rm_t *dst, OpenAPI_af_routing_requirement_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_af_routing_requirement_rm_convertToJSON(src);
@@ -264,21 +263,6 @@ OpenAPI_af_routing_requirement_rm_t *OpenAPI_af_routing_requirement_rm_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_af_routing_requirement_rm_free(dst);
     dst = OpenAPI_af_routing_requirement_rm_parseFromJSON(item);
     cJSON_Delete(item);
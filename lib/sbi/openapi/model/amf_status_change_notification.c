@@ -107,7 +107,6 @@ end:
 OpenAPI_amf_status_change_notification_t *OpenAPI_amf_status_change_notification_copy(OpenAPI_amf_status_change_notification_t *dst, OpenAPI_amf_status_change_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_status_change_notification_convertToJSON(src);
@@ -116,21 +115,6 @@ OpenAPI_amf_status_change_notification_t *OpenAPI_amf_status_change_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_status_change_notification_free(dst);
     dst = OpenAPI_amf_status_change_notification_parseFromJSON(item);
     cJSON_Delete(item);
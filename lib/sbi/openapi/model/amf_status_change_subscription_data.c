@@ -127,7 +127,6 @@ end:
 OpenAPI_amf_status_change_subscription_data_t *OpenAPI_amf_status_change_subscription_data_copy(OpenAPI_amf_status_change_subscription_data_t *dst, OpenAPI_amf_status_change_subscription_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_status_change_subscription_data_convertToJSON(src);
@@ -136,21 +135,6 @@ OpenAPI_amf_status_change_subscription_data_t *OpenAPI_amf_status_change_subscri
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_status_change_subscription_data_free(dst);
     dst = OpenAPI_amf_status_change_subscription_data_parseFromJSON(item);
     cJSON_Delete(item);
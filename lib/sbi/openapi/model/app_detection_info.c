@@ -147,7 +147,6 @@ end:
 OpenAPI_app_detection_info_t *OpenAPI_app_detection_info_copy(OpenAPI_app_detection_info_t *dst, OpenAPI_app_detection_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_detection_info_convertToJSON(src);
@@ -156,21 +155,6 @@ OpenAPI_app_detection_info_t *OpenAPI_app_detection_info_copy(OpenAPI_app_detect
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_detection_info_free(dst);
     dst = OpenAPI_app_detection_info_parseFromJSON(item);
     cJSON_Delete(item);
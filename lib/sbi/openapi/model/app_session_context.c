@@ -123,7 +123,6 @@ end:
 OpenAPI_app_session_context_t *OpenAPI_app_session_context_copy(OpenAPI_app_session_context_t *dst, OpenAPI_app_session_context_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_session_context_convertToJSON(src);
@@ -132,21 +131,6 @@ OpenAPI_app_session_context_t *OpenAPI_app_session_context_copy(OpenAPI_app_sess
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_session_context_free(dst);
     dst = OpenAPI_app_session_context_parseFromJSON(item);
     cJSON_Delete(item);
@@ -771,7 +771,6 @@ end:
 OpenAPI_app_session_context_req_data_t *OpenAPI_app_session_context_req_data_copy(OpenAPI_app_session_context_req_data_t *dst, OpenAPI_app_session_context_req_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_session_context_req_data_convertToJSON(src);
@@ -780,21 +779,6 @@ OpenAPI_app_session_context_req_data_t *OpenAPI_app_session_context_req_data_cop
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_session_context_req_data_free(dst);
     dst = OpenAPI_app_session_context_req_data_parseFromJSON(item);
     cJSON_Delete(item);
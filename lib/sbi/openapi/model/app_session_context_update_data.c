@@ -530,7 +530,6 @@ end:
 OpenAPI_app_session_context_update_data_t *OpenAPI_app_session_context_update_data_copy(OpenAPI_app_session_context_update_data_t *dst, OpenAPI_app_session_context_update_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_session_context_update_data_convertToJSON(src);
@@ -539,21 +538,6 @@ OpenAPI_app_session_context_update_data_t *OpenAPI_app_session_context_update_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_session_context_update_data_free(dst);
     dst = OpenAPI_app_session_context_update_data_parseFromJSON(item);
     cJSON_Delete(item);
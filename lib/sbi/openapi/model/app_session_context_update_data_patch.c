@@ -75,7 +75,6 @@ end:
 OpenAPI_app_session_context_update_data_patch_t *OpenAPI_app_session_context_update_data_patch_copy(OpenAPI_app_session_context_update_data_patch_t *dst, OpenAPI_app_session_context_update_data_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_session_context_update_data_patch_convertToJSON(src);
@@ -84,21 +83,6 @@ OpenAPI_app_session_context_update_data_patch_t *OpenAPI_app_session_context_upd
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_session_context_update_data_patch_free(dst);
     dst = OpenAPI_app_session_context_update_data_patch_parseFromJSON(item);
     cJSON_Delete(item);
@@ -167,7 +167,6 @@ end:
 OpenAPI_application_data_change_notif_t *OpenAPI_application_data_change_notif_copy(OpenAPI_application_data_change_notif_t *dst, OpenAPI_application_data_change_notif_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_application_data_change_notif_convertToJSON(src);
@@ -176,21 +175,6 @@ OpenAPI_application_data_change_notif_t *OpenAPI_application_data_change_notif_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_application_data_change_notif_free(dst);
     dst = OpenAPI_application_data_change_notif_parseFromJSON(item);
     cJSON_Delete(item);
@@ -167,7 +167,6 @@ end:
 OpenAPI_application_data_subs_t *OpenAPI_application_data_subs_copy(OpenAPI_application_data_subs_t *dst, OpenAPI_application_data_subs_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_application_data_subs_convertToJSON(src);
@@ -176,21 +175,6 @@ OpenAPI_application_data_subs_t *OpenAPI_application_data_subs_copy(OpenAPI_appl
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_application_data_subs_free(dst);
     dst = OpenAPI_application_data_subs_parseFromJSON(item);
     cJSON_Delete(item);
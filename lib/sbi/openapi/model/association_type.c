@@ -51,7 +51,6 @@ end:
 OpenAPI_association_type_t *OpenAPI_association_type_copy(OpenAPI_association_type_t *dst, OpenAPI_association_type_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_association_type_convertToJSON(src);
@@ -60,21 +59,6 @@ OpenAPI_association_type_t *OpenAPI_association_type_copy(OpenAPI_association_ty
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_association_type_free(dst);
     dst = OpenAPI_association_type_parseFromJSON(item);
     cJSON_Delete(item);
@@ -284,7 +284,6 @@ end:
 OpenAPI_authentication_info_t *OpenAPI_authentication_info_copy(OpenAPI_authentication_info_t *dst, OpenAPI_authentication_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authentication_info_convertToJSON(src);
@@ -293,21 +292,6 @@ OpenAPI_authentication_info_t *OpenAPI_authentication_info_copy(OpenAPI_authenti
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authentication_info_free(dst);
     dst = OpenAPI_authentication_info_parseFromJSON(item);
     cJSON_Delete(item);
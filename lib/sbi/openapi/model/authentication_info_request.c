@@ -200,7 +200,6 @@ end:
 OpenAPI_authentication_info_request_t *OpenAPI_authentication_info_request_copy(OpenAPI_authentication_info_request_t *dst, OpenAPI_authentication_info_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authentication_info_request_convertToJSON(src);
@@ -209,21 +208,6 @@ OpenAPI_authentication_info_request_t *OpenAPI_authentication_info_request_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authentication_info_request_free(dst);
     dst = OpenAPI_authentication_info_request_parseFromJSON(item);
     cJSON_Delete(item);
@@ -301,7 +301,6 @@ end:
 OpenAPI_authentication_subscription_t *OpenAPI_authentication_subscription_copy(OpenAPI_authentication_subscription_t *dst, OpenAPI_authentication_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authentication_subscription_convertToJSON(src);
@@ -310,21 +309,6 @@ OpenAPI_authentication_subscription_t *OpenAPI_authentication_subscription_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authentication_subscription_free(dst);
     dst = OpenAPI_authentication_subscription_parseFromJSON(item);
     cJSON_Delete(item);
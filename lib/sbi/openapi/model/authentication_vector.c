@@ -212,7 +212,6 @@ end:
 OpenAPI_authentication_vector_t *OpenAPI_authentication_vector_copy(OpenAPI_authentication_vector_t *dst, OpenAPI_authentication_vector_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authentication_vector_convertToJSON(src);
@@ -221,21 +220,6 @@ OpenAPI_authentication_vector_t *OpenAPI_authentication_vector_copy(OpenAPI_auth
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authentication_vector_free(dst);
     dst = OpenAPI_authentication_vector_parseFromJSON(item);
     cJSON_Delete(item);
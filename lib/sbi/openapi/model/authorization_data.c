@@ -127,7 +127,6 @@ end:
 OpenAPI_authorization_data_t *OpenAPI_authorization_data_copy(OpenAPI_authorization_data_t *dst, OpenAPI_authorization_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authorization_data_convertToJSON(src);
@@ -136,21 +135,6 @@ OpenAPI_authorization_data_t *OpenAPI_authorization_data_copy(OpenAPI_authorizat
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authorization_data_free(dst);
     dst = OpenAPI_authorization_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -265,7 +265,6 @@ end:
 OpenAPI_authorized_default_qos_t *OpenAPI_authorized_default_qos_copy(OpenAPI_authorized_default_qos_t *dst, OpenAPI_authorized_default_qos_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authorized_default_qos_convertToJSON(src);
@@ -274,21 +273,6 @@ OpenAPI_authorized_default_qos_t *OpenAPI_authorized_default_qos_copy(OpenAPI_au
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authorized_default_qos_free(dst);
     dst = OpenAPI_authorized_default_qos_parseFromJSON(item);
     cJSON_Delete(item);
@@ -462,7 +462,6 @@ end:
 OpenAPI_authorized_network_slice_info_t *OpenAPI_authorized_network_slice_info_copy(OpenAPI_authorized_network_slice_info_t *dst, OpenAPI_authorized_network_slice_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authorized_network_slice_info_convertToJSON(src);
@@ -471,21 +470,6 @@ OpenAPI_authorized_network_slice_info_t *OpenAPI_authorized_network_slice_info_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authorized_network_slice_info_free(dst);
     dst = OpenAPI_authorized_network_slice_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -117,7 +117,6 @@ end:
 OpenAPI_battery_indication_t *OpenAPI_battery_indication_copy(OpenAPI_battery_indication_t *dst, OpenAPI_battery_indication_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_battery_indication_convertToJSON(src);
@@ -126,21 +125,6 @@ OpenAPI_battery_indication_t *OpenAPI_battery_indication_copy(OpenAPI_battery_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_battery_indication_free(dst);
     dst = OpenAPI_battery_indication_parseFromJSON(item);
     cJSON_Delete(item);
@@ -70,7 +70,6 @@ end:
 OpenAPI_bridge_management_container_t *OpenAPI_bridge_management_container_copy(OpenAPI_bridge_management_container_t *dst, OpenAPI_bridge_management_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_bridge_management_container_convertToJSON(src);
@@ -79,21 +78,6 @@ OpenAPI_bridge_management_container_t *OpenAPI_bridge_management_container_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_bridge_management_container_free(dst);
     dst = OpenAPI_bridge_management_container_parseFromJSON(item);
     cJSON_Delete(item);
@@ -118,7 +118,6 @@ end:
 OpenAPI_candidate_for_replacement_t *OpenAPI_candidate_for_replacement_copy(OpenAPI_candidate_for_replacement_t *dst, OpenAPI_candidate_for_replacement_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_candidate_for_replacement_convertToJSON(src);
@@ -127,21 +126,6 @@ OpenAPI_candidate_for_replacement_t *OpenAPI_candidate_for_replacement_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_candidate_for_replacement_free(dst);
     dst = OpenAPI_candidate_for_replacement_parseFromJSON(item);
     cJSON_Delete(item);
@@ -171,7 +171,6 @@ end:
 OpenAPI_charging_information_t *OpenAPI_charging_information_copy(OpenAPI_charging_information_t *dst, OpenAPI_charging_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_charging_information_convertToJSON(src);
@@ -180,21 +179,6 @@ OpenAPI_charging_information_t *OpenAPI_charging_information_copy(OpenAPI_chargi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_charging_information_free(dst);
     dst = OpenAPI_charging_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -193,7 +193,6 @@ end:
 OpenAPI_communication_characteristics_t *OpenAPI_communication_characteristics_copy(OpenAPI_communication_characteristics_t *dst, OpenAPI_communication_characteristics_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_communication_characteristics_convertToJSON(src);
@@ -202,21 +201,6 @@ OpenAPI_communication_characteristics_t *OpenAPI_communication_characteristics_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_communication_characteristics_free(dst);
     dst = OpenAPI_communication_characteristics_parseFromJSON(item);
     cJSON_Delete(item);
@@ -153,7 +153,6 @@ end:
 OpenAPI_condition_data_t *OpenAPI_condition_data_copy(OpenAPI_condition_data_t *dst, OpenAPI_condition_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_condition_data_convertToJSON(src);
@@ -162,21 +161,6 @@ OpenAPI_condition_data_t *OpenAPI_condition_data_copy(OpenAPI_condition_data_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_condition_data_free(dst);
     dst = OpenAPI_condition_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -99,7 +99,6 @@ end:
 OpenAPI_configured_snssai_t *OpenAPI_configured_snssai_copy(OpenAPI_configured_snssai_t *dst, OpenAPI_configured_snssai_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_configured_snssai_convertToJSON(src);
@@ -108,21 +107,6 @@ OpenAPI_configured_snssai_t *OpenAPI_configured_snssai_copy(OpenAPI_configured_s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_configured_snssai_free(dst);
     dst = OpenAPI_configured_snssai_parseFromJSON(item);
     cJSON_Delete(item);
@@ -91,7 +91,6 @@ end:
 OpenAPI_confirmation_data_t *OpenAPI_confirmation_data_copy(OpenAPI_confirmation_data_t *dst, OpenAPI_confirmation_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_confirmation_data_convertToJSON(src);
@@ -100,21 +99,6 @@ OpenAPI_confirmation_data_t *OpenAPI_confirmation_data_copy(OpenAPI_confirmation
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_confirmation_data_free(dst);
     dst = OpenAPI_confirmation_data_parseFromJSON(item);
     cJSON_Delete(item);
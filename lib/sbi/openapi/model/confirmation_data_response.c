@@ -112,7 +112,6 @@ end:
 OpenAPI_confirmation_data_response_t *OpenAPI_confirmation_data_response_copy(OpenAPI_confirmation_data_response_t *dst, OpenAPI_confirmation_data_response_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_confirmation_data_response_convertToJSON(src);
@@ -121,21 +120,6 @@ OpenAPI_confirmation_data_response_t *OpenAPI_confirmation_data_response_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_confirmation_data_response_free(dst);
     dst = OpenAPI_confirmation_data_response_parseFromJSON(item);
     cJSON_Delete(item);
@@ -94,7 +94,6 @@ end:
 OpenAPI_context_info_t *OpenAPI_context_info_copy(OpenAPI_context_info_t *dst, OpenAPI_context_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_context_info_convertToJSON(src);
@@ -103,21 +102,6 @@ OpenAPI_context_info_t *OpenAPI_context_info_copy(OpenAPI_context_info_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_context_info_free(dst);
     dst = OpenAPI_context_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -306,7 +306,6 @@ end:
 OpenAPI_data_change_notify_t *OpenAPI_data_change_notify_copy(OpenAPI_data_change_notify_t *dst, OpenAPI_data_change_notify_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_data_change_notify_convertToJSON(src);
@@ -315,21 +314,6 @@ OpenAPI_data_change_notify_t *OpenAPI_data_change_notify_copy(OpenAPI_data_chang
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_data_change_notify_free(dst);
     dst = OpenAPI_data_change_notify_parseFromJSON(item);
     cJSON_Delete(item);
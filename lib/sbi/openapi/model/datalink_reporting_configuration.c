@@ -192,7 +192,6 @@ end:
 OpenAPI_datalink_reporting_configuration_t *OpenAPI_datalink_reporting_configuration_copy(OpenAPI_datalink_reporting_configuration_t *dst, OpenAPI_datalink_reporting_configuration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_datalink_reporting_configuration_convertToJSON(src);
@@ -201,21 +200,6 @@ OpenAPI_datalink_reporting_configuration_t *OpenAPI_datalink_reporting_configura
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_datalink_reporting_configuration_free(dst);
     dst = OpenAPI_datalink_reporting_configuration_parseFromJSON(item);
     cJSON_Delete(item);
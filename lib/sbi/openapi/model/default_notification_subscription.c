@@ -197,7 +197,6 @@ end:
 OpenAPI_default_notification_subscription_t *OpenAPI_default_notification_subscription_copy(OpenAPI_default_notification_subscription_t *dst, OpenAPI_default_notification_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_default_notification_subscription_convertToJSON(src);
@@ -206,21 +205,6 @@ OpenAPI_default_notification_subscription_t *OpenAPI_default_notification_subscr
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_default_notification_subscription_free(dst);
     dst = OpenAPI_default_notification_subscription_parseFromJSON(item);
     cJSON_Delete(item);
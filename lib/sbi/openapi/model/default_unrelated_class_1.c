@@ -216,7 +216,6 @@ end:
 OpenAPI_default_unrelated_class_1_t *OpenAPI_default_unrelated_class_1_copy(OpenAPI_default_unrelated_class_1_t *dst, OpenAPI_default_unrelated_class_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_default_unrelated_class_1_convertToJSON(src);
@@ -225,21 +224,6 @@ OpenAPI_default_unrelated_class_1_t *OpenAPI_default_unrelated_class_1_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_default_unrelated_class_1_free(dst);
     dst = OpenAPI_default_unrelated_class_1_parseFromJSON(item);
     cJSON_Delete(item);
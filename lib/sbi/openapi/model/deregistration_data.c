@@ -135,7 +135,6 @@ end:
 OpenAPI_deregistration_data_t *OpenAPI_deregistration_data_copy(OpenAPI_deregistration_data_t *dst, OpenAPI_deregistration_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_deregistration_data_convertToJSON(src);
@@ -144,21 +143,6 @@ OpenAPI_deregistration_data_t *OpenAPI_deregistration_data_copy(OpenAPI_deregist
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_deregistration_data_free(dst);
     dst = OpenAPI_deregistration_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -115,7 +115,6 @@ end:
 OpenAPI_dnai_information_t *OpenAPI_dnai_information_copy(OpenAPI_dnai_information_t *dst, OpenAPI_dnai_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_dnai_information_convertToJSON(src);
@@ -124,21 +123,6 @@ OpenAPI_dnai_information_t *OpenAPI_dnai_information_copy(OpenAPI_dnai_informati
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_dnai_information_free(dst);
     dst = OpenAPI_dnai_information_parseFromJSON(item);
     cJSON_Delete(item);
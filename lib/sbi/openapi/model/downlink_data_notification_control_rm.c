@@ -133,7 +133,6 @@ end:
 OpenAPI_downlink_data_notification_control_rm_t *OpenAPI_downlink_data_notification_control_rm_copy(OpenAPI_downlink_data_notification_control_rm_t *dst, OpenAPI_downlink_data_notification_control_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_downlink_data_notification_control_rm_convertToJSON(src);
@@ -142,21 +141,6 @@ OpenAPI_downlink_data_notification_control_rm_t *OpenAPI_downlink_data_notificat
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_downlink_data_notification_control_rm_free(dst);
     dst = OpenAPI_downlink_data_notification_control_rm_parseFromJSON(item);
     cJSON_Delete(item);
@@ -248,7 +248,6 @@ end:
 OpenAPI_error_report_t *OpenAPI_error_report_copy(OpenAPI_error_report_t *dst, OpenAPI_error_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_error_report_convertToJSON(src);
@@ -257,21 +256,6 @@ OpenAPI_error_report_t *OpenAPI_error_report_copy(OpenAPI_error_report_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_error_report_free(dst);
     dst = OpenAPI_error_report_parseFromJSON(item);
     cJSON_Delete(item);
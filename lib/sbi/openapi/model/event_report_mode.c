@@ -51,7 +51,6 @@ end:
 OpenAPI_event_report_mode_t *OpenAPI_event_report_mode_copy(OpenAPI_event_report_mode_t *dst, OpenAPI_event_report_mode_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_event_report_mode_convertToJSON(src);
@@ -60,21 +59,6 @@ OpenAPI_event_report_mode_t *OpenAPI_event_report_mode_copy(OpenAPI_event_report
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_event_report_mode_free(dst);
     dst = OpenAPI_event_report_mode_parseFromJSON(item);
     cJSON_Delete(item);
@@ -874,7 +874,6 @@ end:
 OpenAPI_events_notification_t *OpenAPI_events_notification_copy(OpenAPI_events_notification_t *dst, OpenAPI_events_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_events_notification_convertToJSON(src);
@@ -883,21 +882,6 @@ OpenAPI_events_notification_t *OpenAPI_events_notification_copy(OpenAPI_events_n
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_events_notification_free(dst);
     dst = OpenAPI_events_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -194,7 +194,6 @@ end:
 OpenAPI_exposure_data_change_notification_t *OpenAPI_exposure_data_change_notification_copy(OpenAPI_exposure_data_change_notification_t *dst, OpenAPI_exposure_data_change_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_exposure_data_change_notification_convertToJSON(src);
@@ -203,21 +202,6 @@ OpenAPI_exposure_data_change_notification_t *OpenAPI_exposure_data_change_notifi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_exposure_data_change_notification_free(dst);
     dst = OpenAPI_exposure_data_change_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -418,7 +418,6 @@ end:
 OpenAPI_ext_amf_event_subscription_t *OpenAPI_ext_amf_event_subscription_copy(OpenAPI_ext_amf_event_subscription_t *dst, OpenAPI_ext_amf_event_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ext_amf_event_subscription_convertToJSON(src);
@@ -427,21 +426,6 @@ OpenAPI_ext_amf_event_subscription_t *OpenAPI_ext_amf_event_subscription_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ext_amf_event_subscription_free(dst);
     dst = OpenAPI_ext_amf_event_subscription_parseFromJSON(item);
     cJSON_Delete(item);
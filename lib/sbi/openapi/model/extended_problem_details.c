@@ -341,7 +341,6 @@ end:
 OpenAPI_extended_problem_details_t *OpenAPI_extended_problem_details_copy(OpenAPI_extended_problem_details_t *dst, OpenAPI_extended_problem_details_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_extended_problem_details_convertToJSON(src);
@@ -350,21 +349,6 @@ OpenAPI_extended_problem_details_t *OpenAPI_extended_problem_details_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_extended_problem_details_free(dst);
     dst = OpenAPI_extended_problem_details_parseFromJSON(item);
     cJSON_Delete(item);
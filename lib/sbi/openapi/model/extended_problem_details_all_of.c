@@ -75,7 +75,6 @@ end:
 OpenAPI_extended_problem_details_all_of_t *OpenAPI_extended_problem_details_all_of_copy(OpenAPI_extended_problem_details_all_of_t *dst, OpenAPI_extended_problem_details_all_of_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_extended_problem_details_all_of_convertToJSON(src);
@@ -84,21 +83,6 @@ OpenAPI_extended_problem_details_all_of_t *OpenAPI_extended_problem_details_all_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_extended_problem_details_all_of_free(dst);
     dst = OpenAPI_extended_problem_details_all_of_parseFromJSON(item);
     cJSON_Delete(item);
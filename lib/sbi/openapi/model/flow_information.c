@@ -218,7 +218,6 @@ end:
 OpenAPI_flow_information_t *OpenAPI_flow_information_copy(OpenAPI_flow_information_t *dst, OpenAPI_flow_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_flow_information_convertToJSON(src);
@@ -227,21 +226,6 @@ OpenAPI_flow_information_t *OpenAPI_flow_information_copy(OpenAPI_flow_informati
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_flow_information_free(dst);
     dst = OpenAPI_flow_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -339,7 +339,6 @@ end:
 OpenAPI_geographic_area_t *OpenAPI_geographic_area_copy(OpenAPI_geographic_area_t *dst, OpenAPI_geographic_area_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_geographic_area_convertToJSON(src);
@@ -348,21 +347,6 @@ OpenAPI_geographic_area_t *OpenAPI_geographic_area_copy(OpenAPI_geographic_area_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_geographic_area_free(dst);
     dst = OpenAPI_geographic_area_parseFromJSON(item);
     cJSON_Delete(item);
@@ -91,7 +91,6 @@ end:
 OpenAPI_geographical_coordinates_t *OpenAPI_geographical_coordinates_copy(OpenAPI_geographical_coordinates_t *dst, OpenAPI_geographical_coordinates_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_geographical_coordinates_convertToJSON(src);
@@ -100,21 +99,6 @@ OpenAPI_geographical_coordinates_t *OpenAPI_geographical_coordinates_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_geographical_coordinates_free(dst);
     dst = OpenAPI_geographical_coordinates_parseFromJSON(item);
     cJSON_Delete(item);
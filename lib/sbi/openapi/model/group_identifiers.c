@@ -147,7 +147,6 @@ end:
 OpenAPI_group_identifiers_t *OpenAPI_group_identifiers_copy(OpenAPI_group_identifiers_t *dst, OpenAPI_group_identifiers_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_group_identifiers_convertToJSON(src);
@@ -156,21 +155,6 @@ OpenAPI_group_identifiers_t *OpenAPI_group_identifiers_copy(OpenAPI_group_identi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_group_identifiers_free(dst);
     dst = OpenAPI_group_identifiers_parseFromJSON(item);
     cJSON_Delete(item);
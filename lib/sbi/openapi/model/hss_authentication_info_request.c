@@ -202,7 +202,6 @@ end:
 OpenAPI_hss_authentication_info_request_t *OpenAPI_hss_authentication_info_request_copy(OpenAPI_hss_authentication_info_request_t *dst, OpenAPI_hss_authentication_info_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hss_authentication_info_request_convertToJSON(src);
@@ -211,21 +210,6 @@ OpenAPI_hss_authentication_info_request_t *OpenAPI_hss_authentication_info_reque
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hss_authentication_info_request_free(dst);
     dst = OpenAPI_hss_authentication_info_request_parseFromJSON(item);
     cJSON_Delete(item);
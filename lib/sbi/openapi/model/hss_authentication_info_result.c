@@ -95,7 +95,6 @@ end:
 OpenAPI_hss_authentication_info_result_t *OpenAPI_hss_authentication_info_result_copy(OpenAPI_hss_authentication_info_result_t *dst, OpenAPI_hss_authentication_info_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hss_authentication_info_result_convertToJSON(src);
@@ -104,21 +103,6 @@ OpenAPI_hss_authentication_info_result_t *OpenAPI_hss_authentication_info_result
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hss_authentication_info_result_free(dst);
     dst = OpenAPI_hss_authentication_info_result_parseFromJSON(item);
     cJSON_Delete(item);
@@ -51,7 +51,6 @@ end:
 OpenAPI_hss_authentication_vectors_t *OpenAPI_hss_authentication_vectors_copy(OpenAPI_hss_authentication_vectors_t *dst, OpenAPI_hss_authentication_vectors_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hss_authentication_vectors_convertToJSON(src);
@@ -60,21 +59,6 @@ OpenAPI_hss_authentication_vectors_t *OpenAPI_hss_authentication_vectors_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hss_authentication_vectors_free(dst);
     dst = OpenAPI_hss_authentication_vectors_parseFromJSON(item);
     cJSON_Delete(item);
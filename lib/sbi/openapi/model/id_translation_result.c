@@ -111,7 +111,6 @@ end:
 OpenAPI_id_translation_result_t *OpenAPI_id_translation_result_copy(OpenAPI_id_translation_result_t *dst, OpenAPI_id_translation_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_id_translation_result_convertToJSON(src);
@@ -120,21 +119,6 @@ OpenAPI_id_translation_result_t *OpenAPI_id_translation_result_copy(OpenAPI_id_t
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_id_translation_result_free(dst);
     dst = OpenAPI_id_translation_result_parseFromJSON(item);
     cJSON_Delete(item);
@@ -111,7 +111,6 @@ end:
 OpenAPI_identity_range_t *OpenAPI_identity_range_copy(OpenAPI_identity_range_t *dst, OpenAPI_identity_range_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_identity_range_convertToJSON(src);
@@ -120,21 +119,6 @@ OpenAPI_identity_range_t *OpenAPI_identity_range_copy(OpenAPI_identity_range_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_identity_range_free(dst);
     dst = OpenAPI_identity_range_parseFromJSON(item);
     cJSON_Delete(item);
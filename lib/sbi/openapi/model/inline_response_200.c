@@ -110,7 +110,6 @@ end:
 OpenAPI_inline_response_200_t *OpenAPI_inline_response_200_copy(OpenAPI_inline_response_200_t *dst, OpenAPI_inline_response_200_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_inline_response_200_convertToJSON(src);
@@ -119,21 +118,6 @@ OpenAPI_inline_response_200_t *OpenAPI_inline_response_200_copy(OpenAPI_inline_r
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_inline_response_200_free(dst);
     dst = OpenAPI_inline_response_200_parseFromJSON(item);
     cJSON_Delete(item);
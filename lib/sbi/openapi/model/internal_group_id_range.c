@@ -111,7 +111,6 @@ end:
 OpenAPI_internal_group_id_range_t *OpenAPI_internal_group_id_range_copy(OpenAPI_internal_group_id_range_t *dst, OpenAPI_internal_group_id_range_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_internal_group_id_range_convertToJSON(src);
@@ -120,21 +119,6 @@ OpenAPI_internal_group_id_range_t *OpenAPI_internal_group_id_range_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_internal_group_id_range_free(dst);
     dst = OpenAPI_internal_group_id_range_parseFromJSON(item);
     cJSON_Delete(item);
@@ -131,7 +131,6 @@ end:
 OpenAPI_ip_multicast_address_info_t *OpenAPI_ip_multicast_address_info_copy(OpenAPI_ip_multicast_address_info_t *dst, OpenAPI_ip_multicast_address_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ip_multicast_address_info_convertToJSON(src);
@@ -140,21 +139,6 @@ OpenAPI_ip_multicast_address_info_t *OpenAPI_ip_multicast_address_info_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ip_multicast_address_info_free(dst);
     dst = OpenAPI_ip_multicast_address_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -172,7 +172,6 @@ end:
 OpenAPI_lcs_client_group_external_t *OpenAPI_lcs_client_group_external_copy(OpenAPI_lcs_client_group_external_t *dst, OpenAPI_lcs_client_group_external_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_lcs_client_group_external_convertToJSON(src);
@@ -181,21 +180,6 @@ OpenAPI_lcs_client_group_external_t *OpenAPI_lcs_client_group_external_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_lcs_client_group_external_free(dst);
     dst = OpenAPI_lcs_client_group_external_parseFromJSON(item);
     cJSON_Delete(item);
@@ -71,7 +71,6 @@ end:
 OpenAPI_links_value_schema_t *OpenAPI_links_value_schema_copy(OpenAPI_links_value_schema_t *dst, OpenAPI_links_value_schema_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_links_value_schema_convertToJSON(src);
@@ -80,21 +79,6 @@ OpenAPI_links_value_schema_t *OpenAPI_links_value_schema_copy(OpenAPI_links_valu
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_links_value_schema_free(dst);
     dst = OpenAPI_links_value_schema_parseFromJSON(item);
     cJSON_Delete(item);
@@ -51,7 +51,6 @@ end:
 OpenAPI_location_accuracy_t *OpenAPI_location_accuracy_copy(OpenAPI_location_accuracy_t *dst, OpenAPI_location_accuracy_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_location_accuracy_convertToJSON(src);
@@ -60,21 +59,6 @@ OpenAPI_location_accuracy_t *OpenAPI_location_accuracy_copy(OpenAPI_location_acc
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_location_accuracy_free(dst);
     dst = OpenAPI_location_accuracy_parseFromJSON(item);
     cJSON_Delete(item);
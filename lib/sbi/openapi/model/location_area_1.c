@@ -187,7 +187,6 @@ end:
 OpenAPI_location_area_1_t *OpenAPI_location_area_1_copy(OpenAPI_location_area_1_t *dst, OpenAPI_location_area_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_location_area_1_convertToJSON(src);
@@ -196,21 +195,6 @@ OpenAPI_location_area_1_t *OpenAPI_location_area_1_copy(OpenAPI_location_area_1_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_location_area_1_free(dst);
     dst = OpenAPI_location_area_1_parseFromJSON(item);
     cJSON_Delete(item);
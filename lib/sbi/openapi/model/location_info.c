@@ -167,7 +167,6 @@ end:
 OpenAPI_location_info_t *OpenAPI_location_info_copy(OpenAPI_location_info_t *dst, OpenAPI_location_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_location_info_convertToJSON(src);
@@ -176,21 +175,6 @@ OpenAPI_location_info_t *OpenAPI_location_info_copy(OpenAPI_location_info_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_location_info_free(dst);
     dst = OpenAPI_location_info_parseFromJSON(item);
     cJSON_Delete(item);
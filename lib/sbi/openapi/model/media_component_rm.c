@@ -880,7 +880,6 @@ end:
 OpenAPI_media_component_rm_t *OpenAPI_media_component_rm_copy(OpenAPI_media_component_rm_t *dst, OpenAPI_media_component_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_media_component_rm_convertToJSON(src);
@@ -889,21 +888,6 @@ OpenAPI_media_component_rm_t *OpenAPI_media_component_rm_copy(OpenAPI_media_comp
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_media_component_rm_free(dst);
     dst = OpenAPI_media_component_rm_parseFromJSON(item);
     cJSON_Delete(item);
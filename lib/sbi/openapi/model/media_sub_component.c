@@ -293,7 +293,6 @@ end:
 OpenAPI_media_sub_component_t *OpenAPI_media_sub_component_copy(OpenAPI_media_sub_component_t *dst, OpenAPI_media_sub_component_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_media_sub_component_convertToJSON(src);
@@ -302,21 +301,6 @@ OpenAPI_media_sub_component_t *OpenAPI_media_sub_component_copy(OpenAPI_media_su
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_media_sub_component_free(dst);
     dst = OpenAPI_media_sub_component_parseFromJSON(item);
     cJSON_Delete(item);
@@ -107,7 +107,6 @@ end:
 OpenAPI_message_waiting_data_t *OpenAPI_message_waiting_data_copy(OpenAPI_message_waiting_data_t *dst, OpenAPI_message_waiting_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_message_waiting_data_convertToJSON(src);
@@ -116,21 +115,6 @@ OpenAPI_message_waiting_data_t *OpenAPI_message_waiting_data_copy(OpenAPI_messag
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_message_waiting_data_free(dst);
     dst = OpenAPI_message_waiting_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -107,7 +107,6 @@ end:
 OpenAPI_modification_notification_t *OpenAPI_modification_notification_copy(OpenAPI_modification_notification_t *dst, OpenAPI_modification_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_modification_notification_convertToJSON(src);
@@ -116,21 +115,6 @@ OpenAPI_modification_notification_t *OpenAPI_modification_notification_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_modification_notification_free(dst);
     dst = OpenAPI_modification_notification_parseFromJSON(item);
     cJSON_Delete(item);
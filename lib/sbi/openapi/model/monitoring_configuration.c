@@ -347,7 +347,6 @@ end:
 OpenAPI_monitoring_configuration_t *OpenAPI_monitoring_configuration_copy(OpenAPI_monitoring_configuration_t *dst, OpenAPI_monitoring_configuration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_monitoring_configuration_convertToJSON(src);
@@ -356,21 +355,6 @@ OpenAPI_monitoring_configuration_t *OpenAPI_monitoring_configuration_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_monitoring_configuration_free(dst);
     dst = OpenAPI_monitoring_configuration_parseFromJSON(item);
     cJSON_Delete(item);
@@ -155,7 +155,6 @@ end:
 OpenAPI_multicast_access_control_t *OpenAPI_multicast_access_control_copy(OpenAPI_multicast_access_control_t *dst, OpenAPI_multicast_access_control_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_multicast_access_control_convertToJSON(src);
@@ -164,21 +163,6 @@ OpenAPI_multicast_access_control_t *OpenAPI_multicast_access_control_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_multicast_access_control_free(dst);
     dst = OpenAPI_multicast_access_control_parseFromJSON(item);
     cJSON_Delete(item);
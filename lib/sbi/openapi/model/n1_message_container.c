@@ -136,7 +136,6 @@ end:
 OpenAPI_n1_message_container_t *OpenAPI_n1_message_container_copy(OpenAPI_n1_message_container_t *dst, OpenAPI_n1_message_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n1_message_container_convertToJSON(src);
@@ -145,21 +144,6 @@ OpenAPI_n1_message_container_t *OpenAPI_n1_message_container_copy(OpenAPI_n1_mes
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n1_message_container_free(dst);
     dst = OpenAPI_n1_message_container_parseFromJSON(item);
     cJSON_Delete(item);
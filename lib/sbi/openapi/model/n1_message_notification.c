@@ -253,7 +253,6 @@ end:
 OpenAPI_n1_message_notification_t *OpenAPI_n1_message_notification_copy(OpenAPI_n1_message_notification_t *dst, OpenAPI_n1_message_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n1_message_notification_convertToJSON(src);
@@ -262,21 +261,6 @@ OpenAPI_n1_message_notification_t *OpenAPI_n1_message_notification_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n1_message_notification_free(dst);
     dst = OpenAPI_n1_message_notification_parseFromJSON(item);
     cJSON_Delete(item);
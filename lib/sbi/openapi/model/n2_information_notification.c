@@ -365,7 +365,6 @@ end:
 OpenAPI_n2_information_notification_t *OpenAPI_n2_information_notification_copy(OpenAPI_n2_information_notification_t *dst, OpenAPI_n2_information_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_information_notification_convertToJSON(src);
@@ -374,21 +373,6 @@ OpenAPI_n2_information_notification_t *OpenAPI_n2_information_notification_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_information_notification_free(dst);
     dst = OpenAPI_n2_information_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -99,7 +99,6 @@ end:
 OpenAPI_n2_information_transfer_error_t *OpenAPI_n2_information_transfer_error_copy(OpenAPI_n2_information_transfer_error_t *dst, OpenAPI_n2_information_transfer_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_information_transfer_error_convertToJSON(src);
@@ -108,21 +107,6 @@ OpenAPI_n2_information_transfer_error_t *OpenAPI_n2_information_transfer_error_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_information_transfer_error_free(dst);
     dst = OpenAPI_n2_information_transfer_error_parseFromJSON(item);
     cJSON_Delete(item);
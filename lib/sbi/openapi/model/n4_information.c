@@ -120,7 +120,6 @@ end:
 OpenAPI_n4_information_t *OpenAPI_n4_information_copy(OpenAPI_n4_information_t *dst, OpenAPI_n4_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n4_information_convertToJSON(src);
@@ -129,21 +128,6 @@ OpenAPI_n4_information_t *OpenAPI_n4_information_copy(OpenAPI_n4_information_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n4_information_free(dst);
     dst = OpenAPI_n4_information_parseFromJSON(item);
     cJSON_Delete(item);
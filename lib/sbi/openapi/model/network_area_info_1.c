@@ -275,7 +275,6 @@ end:
 OpenAPI_network_area_info_1_t *OpenAPI_network_area_info_1_copy(OpenAPI_network_area_info_1_t *dst, OpenAPI_network_area_info_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_network_area_info_1_convertToJSON(src);
@@ -284,21 +283,6 @@ OpenAPI_network_area_info_1_t *OpenAPI_network_area_info_1_copy(OpenAPI_network_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_network_area_info_1_free(dst);
     dst = OpenAPI_network_area_info_1_parseFromJSON(item);
     cJSON_Delete(item);
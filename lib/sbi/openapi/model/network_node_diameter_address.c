@@ -91,7 +91,6 @@ end:
 OpenAPI_network_node_diameter_address_t *OpenAPI_network_node_diameter_address_copy(OpenAPI_network_node_diameter_address_t *dst, OpenAPI_network_node_diameter_address_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_network_node_diameter_address_convertToJSON(src);
@@ -100,21 +99,6 @@ OpenAPI_network_node_diameter_address_t *OpenAPI_network_node_diameter_address_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_network_node_diameter_address_free(dst);
     dst = OpenAPI_network_node_diameter_address_parseFromJSON(item);
     cJSON_Delete(item);
@@ -150,7 +150,6 @@ end:
 OpenAPI_network_slice_cond_t *OpenAPI_network_slice_cond_copy(OpenAPI_network_slice_cond_t *dst, OpenAPI_network_slice_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_network_slice_cond_convertToJSON(src);
@@ -159,21 +158,6 @@ OpenAPI_network_slice_cond_t *OpenAPI_network_slice_cond_copy(OpenAPI_network_sl
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_network_slice_cond_free(dst);
     dst = OpenAPI_network_slice_cond_parseFromJSON(item);
     cJSON_Delete(item);
@@ -111,7 +111,6 @@ end:
 OpenAPI_nf_service_version_t *OpenAPI_nf_service_version_copy(OpenAPI_nf_service_version_t *dst, OpenAPI_nf_service_version_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nf_service_version_convertToJSON(src);
@@ -120,21 +119,6 @@ OpenAPI_nf_service_version_t *OpenAPI_nf_service_version_copy(OpenAPI_nf_service
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nf_service_version_free(dst);
     dst = OpenAPI_nf_service_version_parseFromJSON(item);
     cJSON_Delete(item);
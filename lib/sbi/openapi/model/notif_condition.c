@@ -137,7 +137,6 @@ end:
 OpenAPI_notif_condition_t *OpenAPI_notif_condition_copy(OpenAPI_notif_condition_t *dst, OpenAPI_notif_condition_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_notif_condition_convertToJSON(src);
@@ -146,21 +145,6 @@ OpenAPI_notif_condition_t *OpenAPI_notif_condition_copy(OpenAPI_notif_condition_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_notif_condition_free(dst);
     dst = OpenAPI_notif_condition_parseFromJSON(item);
     cJSON_Delete(item);
@@ -193,7 +193,6 @@ end:
 OpenAPI_notification_data_t *OpenAPI_notification_data_copy(OpenAPI_notification_data_t *dst, OpenAPI_notification_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_notification_data_convertToJSON(src);
@@ -202,21 +201,6 @@ OpenAPI_notification_data_t *OpenAPI_notification_data_copy(OpenAPI_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_notification_data_free(dst);
     dst = OpenAPI_notification_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -127,7 +127,6 @@ end:
 OpenAPI_notification_item_t *OpenAPI_notification_item_copy(OpenAPI_notification_item_t *dst, OpenAPI_notification_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_notification_item_convertToJSON(src);
@@ -136,21 +135,6 @@ OpenAPI_notification_item_t *OpenAPI_notification_item_copy(OpenAPI_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_notification_item_free(dst);
     dst = OpenAPI_notification_item_parseFromJSON(item);
     cJSON_Delete(item);
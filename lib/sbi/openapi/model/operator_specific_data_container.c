@@ -131,7 +131,6 @@ end:
 OpenAPI_operator_specific_data_container_t *OpenAPI_operator_specific_data_container_copy(OpenAPI_operator_specific_data_container_t *dst, OpenAPI_operator_specific_data_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_operator_specific_data_container_convertToJSON(src);
@@ -140,21 +139,6 @@ OpenAPI_operator_specific_data_container_t *OpenAPI_operator_specific_data_conta
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_operator_specific_data_container_free(dst);
     dst = OpenAPI_operator_specific_data_container_parseFromJSON(item);
     cJSON_Delete(item);
@@ -71,7 +71,6 @@ end:
 OpenAPI_options_response_t *OpenAPI_options_response_copy(OpenAPI_options_response_t *dst, OpenAPI_options_response_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_options_response_convertToJSON(src);
@@ -80,21 +79,6 @@ OpenAPI_options_response_t *OpenAPI_options_response_copy(OpenAPI_options_respon
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_options_response_free(dst);
     dst = OpenAPI_options_response_parseFromJSON(item);
     cJSON_Delete(item);
@@ -131,7 +131,6 @@ end:
 OpenAPI_out_of_credit_information_t *OpenAPI_out_of_credit_information_copy(OpenAPI_out_of_credit_information_t *dst, OpenAPI_out_of_credit_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_out_of_credit_information_convertToJSON(src);
@@ -140,21 +139,6 @@ OpenAPI_out_of_credit_information_t *OpenAPI_out_of_credit_information_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_out_of_credit_information_free(dst);
     dst = OpenAPI_out_of_credit_information_parseFromJSON(item);
     cJSON_Delete(item);
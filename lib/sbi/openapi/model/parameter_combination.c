@@ -115,7 +115,6 @@ end:
 OpenAPI_parameter_combination_t *OpenAPI_parameter_combination_copy(OpenAPI_parameter_combination_t *dst, OpenAPI_parameter_combination_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_parameter_combination_convertToJSON(src);
@@ -124,21 +123,6 @@ OpenAPI_parameter_combination_t *OpenAPI_parameter_combination_copy(OpenAPI_para
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_parameter_combination_free(dst);
     dst = OpenAPI_parameter_combination_parseFromJSON(item);
     cJSON_Delete(item);
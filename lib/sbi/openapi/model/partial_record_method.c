@@ -51,7 +51,6 @@ end:
 OpenAPI_partial_record_method_t *OpenAPI_partial_record_method_copy(OpenAPI_partial_record_method_t *dst, OpenAPI_partial_record_method_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_partial_record_method_convertToJSON(src);
@@ -60,21 +59,6 @@ OpenAPI_partial_record_method_t *OpenAPI_partial_record_method_copy(OpenAPI_part
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_partial_record_method_free(dst);
     dst = OpenAPI_partial_record_method_parseFromJSON(item);
     cJSON_Delete(item);
@@ -249,7 +249,6 @@ end:
 OpenAPI_partial_success_report_t *OpenAPI_partial_success_report_copy(OpenAPI_partial_success_report_t *dst, OpenAPI_partial_success_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_partial_success_report_convertToJSON(src);
@@ -258,21 +257,6 @@ OpenAPI_partial_success_report_t *OpenAPI_partial_success_report_copy(OpenAPI_pa
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_partial_success_report_free(dst);
     dst = OpenAPI_partial_success_report_parseFromJSON(item);
     cJSON_Delete(item);
@@ -71,7 +71,6 @@ end:
 OpenAPI_pcscf_restoration_notification_t *OpenAPI_pcscf_restoration_notification_copy(OpenAPI_pcscf_restoration_notification_t *dst, OpenAPI_pcscf_restoration_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pcscf_restoration_notification_convertToJSON(src);
@@ -80,21 +79,6 @@ OpenAPI_pcscf_restoration_notification_t *OpenAPI_pcscf_restoration_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pcscf_restoration_notification_free(dst);
     dst = OpenAPI_pcscf_restoration_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -161,7 +161,6 @@ end:
 OpenAPI_pdu_session_create_error_t *OpenAPI_pdu_session_create_error_copy(OpenAPI_pdu_session_create_error_t *dst, OpenAPI_pdu_session_create_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_create_error_convertToJSON(src);
@@ -170,21 +169,6 @@ OpenAPI_pdu_session_create_error_t *OpenAPI_pdu_session_create_error_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_create_error_free(dst);
     dst = OpenAPI_pdu_session_create_error_parseFromJSON(item);
     cJSON_Delete(item);
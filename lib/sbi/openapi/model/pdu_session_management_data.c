@@ -420,7 +420,6 @@ end:
 OpenAPI_pdu_session_management_data_t *OpenAPI_pdu_session_management_data_copy(OpenAPI_pdu_session_management_data_t *dst, OpenAPI_pdu_session_management_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_management_data_convertToJSON(src);
@@ -429,21 +428,6 @@ OpenAPI_pdu_session_management_data_t *OpenAPI_pdu_session_management_data_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_management_data_free(dst);
     dst = OpenAPI_pdu_session_management_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -183,7 +183,6 @@ end:
 OpenAPI_point_altitude_uncertainty_t *OpenAPI_point_altitude_uncertainty_copy(OpenAPI_point_altitude_uncertainty_t *dst, OpenAPI_point_altitude_uncertainty_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_point_altitude_uncertainty_convertToJSON(src);
@@ -192,21 +191,6 @@ OpenAPI_point_altitude_uncertainty_t *OpenAPI_point_altitude_uncertainty_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_point_altitude_uncertainty_free(dst);
     dst = OpenAPI_point_altitude_uncertainty_parseFromJSON(item);
     cJSON_Delete(item);
@@ -313,7 +313,6 @@ end:
 OpenAPI_policy_association_t *OpenAPI_policy_association_copy(OpenAPI_policy_association_t *dst, OpenAPI_policy_association_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_policy_association_convertToJSON(src);
@@ -322,21 +321,6 @@ OpenAPI_policy_association_t *OpenAPI_policy_association_copy(OpenAPI_policy_ass
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_policy_association_free(dst);
     dst = OpenAPI_policy_association_parseFromJSON(item);
     cJSON_Delete(item);
@@ -845,7 +845,6 @@ end:
 OpenAPI_policy_association_request_t *OpenAPI_policy_association_request_copy(OpenAPI_policy_association_request_t *dst, OpenAPI_policy_association_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_policy_association_request_convertToJSON(src);
@@ -854,21 +853,6 @@ OpenAPI_policy_association_request_t *OpenAPI_policy_association_request_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_policy_association_request_free(dst);
     dst = OpenAPI_policy_association_request_parseFromJSON(item);
     cJSON_Delete(item);
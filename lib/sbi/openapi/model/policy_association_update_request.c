@@ -740,7 +740,6 @@ end:
 OpenAPI_policy_association_update_request_t *OpenAPI_policy_association_update_request_copy(OpenAPI_policy_association_update_request_t *dst, OpenAPI_policy_association_update_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_policy_association_update_request_convertToJSON(src);
@@ -749,21 +748,6 @@ OpenAPI_policy_association_update_request_t *OpenAPI_policy_association_update_r
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_policy_association_update_request_free(dst);
     dst = OpenAPI_policy_association_update_request_parseFromJSON(item);
     cJSON_Delete(item);
@@ -230,7 +230,6 @@ end:
 OpenAPI_policy_data_subscription_t *OpenAPI_policy_data_subscription_copy(OpenAPI_policy_data_subscription_t *dst, OpenAPI_policy_data_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_policy_data_subscription_convertToJSON(src);
@@ -239,21 +238,6 @@ OpenAPI_policy_data_subscription_t *OpenAPI_policy_data_subscription_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_policy_data_subscription_free(dst);
     dst = OpenAPI_policy_data_subscription_parseFromJSON(item);
     cJSON_Delete(item);
@@ -90,7 +90,6 @@ end:
 OpenAPI_port_management_container_t *OpenAPI_port_management_container_copy(OpenAPI_port_management_container_t *dst, OpenAPI_port_management_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_port_management_container_convertToJSON(src);
@@ -99,21 +98,6 @@ OpenAPI_port_management_container_t *OpenAPI_port_management_container_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_port_management_container_free(dst);
     dst = OpenAPI_port_management_container_parseFromJSON(item);
     cJSON_Delete(item);
@@ -183,7 +183,6 @@ end:
 OpenAPI_preferred_search_t *OpenAPI_preferred_search_copy(OpenAPI_preferred_search_t *dst, OpenAPI_preferred_search_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_preferred_search_convertToJSON(src);
@@ -192,21 +191,6 @@ OpenAPI_preferred_search_t *OpenAPI_preferred_search_copy(OpenAPI_preferred_sear
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_preferred_search_free(dst);
     dst = OpenAPI_preferred_search_parseFromJSON(item);
     cJSON_Delete(item);
@@ -229,7 +229,6 @@ end:
 OpenAPI_problem_details_1_t *OpenAPI_problem_details_1_copy(OpenAPI_problem_details_1_t *dst, OpenAPI_problem_details_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_problem_details_1_convertToJSON(src);
@@ -238,21 +237,6 @@ OpenAPI_problem_details_1_t *OpenAPI_problem_details_1_copy(OpenAPI_problem_deta
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_problem_details_1_free(dst);
     dst = OpenAPI_problem_details_1_parseFromJSON(item);
     cJSON_Delete(item);
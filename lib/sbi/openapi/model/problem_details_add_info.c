@@ -73,7 +73,6 @@ end:
 OpenAPI_problem_details_add_info_t *OpenAPI_problem_details_add_info_copy(OpenAPI_problem_details_add_info_t *dst, OpenAPI_problem_details_add_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_problem_details_add_info_convertToJSON(src);
@@ -82,21 +81,6 @@ OpenAPI_problem_details_add_info_t *OpenAPI_problem_details_add_info_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_problem_details_add_info_free(dst);
     dst = OpenAPI_problem_details_add_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -155,7 +155,6 @@ end:
 OpenAPI_psa_information_t *OpenAPI_psa_information_copy(OpenAPI_psa_information_t *dst, OpenAPI_psa_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_psa_information_convertToJSON(src);
@@ -164,21 +163,6 @@ OpenAPI_psa_information_t *OpenAPI_psa_information_copy(OpenAPI_psa_information_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_psa_information_free(dst);
     dst = OpenAPI_psa_information_parseFromJSON(item);
     cJSON_Delete(item);
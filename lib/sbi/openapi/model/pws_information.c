@@ -213,7 +213,6 @@ end:
 OpenAPI_pws_information_t *OpenAPI_pws_information_copy(OpenAPI_pws_information_t *dst, OpenAPI_pws_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pws_information_convertToJSON(src);
@@ -222,21 +221,6 @@ OpenAPI_pws_information_t *OpenAPI_pws_information_copy(OpenAPI_pws_information_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pws_information_free(dst);
     dst = OpenAPI_pws_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -167,7 +167,6 @@ end:
 OpenAPI_pws_response_data_t *OpenAPI_pws_response_data_copy(OpenAPI_pws_response_data_t *dst, OpenAPI_pws_response_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pws_response_data_convertToJSON(src);
@@ -176,21 +175,6 @@ OpenAPI_pws_response_data_t *OpenAPI_pws_response_data_copy(OpenAPI_pws_response
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pws_response_data_free(dst);
     dst = OpenAPI_pws_response_data_parseFromJSON(item);
     cJSON_Delete(item);
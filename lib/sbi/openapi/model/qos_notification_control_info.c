@@ -148,7 +148,6 @@ end:
 OpenAPI_qos_notification_control_info_t *OpenAPI_qos_notification_control_info_copy(OpenAPI_qos_notification_control_info_t *dst, OpenAPI_qos_notification_control_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_notification_control_info_convertToJSON(src);
@@ -157,21 +156,6 @@ OpenAPI_qos_notification_control_info_t *OpenAPI_qos_notification_control_info_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_notification_control_info_free(dst);
     dst = OpenAPI_qos_notification_control_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -51,7 +51,6 @@ end:
 OpenAPI_reachability_filter_t *OpenAPI_reachability_filter_copy(OpenAPI_reachability_filter_t *dst, OpenAPI_reachability_filter_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_reachability_filter_convertToJSON(src);
@@ -60,21 +59,6 @@ OpenAPI_reachability_filter_t *OpenAPI_reachability_filter_copy(OpenAPI_reachabi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_reachability_filter_free(dst);
     dst = OpenAPI_reachability_filter_parseFromJSON(item);
     cJSON_Delete(item);
@@ -114,7 +114,6 @@ end:
 OpenAPI_redirect_information_t *OpenAPI_redirect_information_copy(OpenAPI_redirect_information_t *dst, OpenAPI_redirect_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_redirect_information_convertToJSON(src);
@@ -123,21 +122,6 @@ OpenAPI_redirect_information_t *OpenAPI_redirect_information_copy(OpenAPI_redire
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_redirect_information_free(dst);
     dst = OpenAPI_redirect_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -91,7 +91,6 @@ end:
 OpenAPI_redirect_response_t *OpenAPI_redirect_response_copy(OpenAPI_redirect_response_t *dst, OpenAPI_redirect_response_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_redirect_response_convertToJSON(src);
@@ -100,21 +99,6 @@ OpenAPI_redirect_response_t *OpenAPI_redirect_response_copy(OpenAPI_redirect_res
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_redirect_response_free(dst);
     dst = OpenAPI_redirect_response_parseFromJSON(item);
     cJSON_Delete(item);
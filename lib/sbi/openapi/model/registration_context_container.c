@@ -640,7 +640,6 @@ end:
 OpenAPI_registration_context_container_t *OpenAPI_registration_context_container_copy(OpenAPI_registration_context_container_t *dst, OpenAPI_registration_context_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_registration_context_container_convertToJSON(src);
@@ -649,21 +648,6 @@ OpenAPI_registration_context_container_t *OpenAPI_registration_context_container
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_registration_context_container_free(dst);
     dst = OpenAPI_registration_context_container_parseFromJSON(item);
     cJSON_Delete(item);
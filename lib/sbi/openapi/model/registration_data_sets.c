@@ -171,7 +171,6 @@ end:
 OpenAPI_registration_data_sets_t *OpenAPI_registration_data_sets_copy(OpenAPI_registration_data_sets_t *dst, OpenAPI_registration_data_sets_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_registration_data_sets_convertToJSON(src);
@@ -180,21 +179,6 @@ OpenAPI_registration_data_sets_t *OpenAPI_registration_data_sets_copy(OpenAPI_re
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_registration_data_sets_free(dst);
     dst = OpenAPI_registration_data_sets_parseFromJSON(item);
     cJSON_Delete(item);
@@ -160,7 +160,6 @@ end:
 OpenAPI_registration_location_info_t *OpenAPI_registration_location_info_copy(OpenAPI_registration_location_info_t *dst, OpenAPI_registration_location_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_registration_location_info_convertToJSON(src);
@@ -169,21 +168,6 @@ OpenAPI_registration_location_info_t *OpenAPI_registration_location_info_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_registration_location_info_free(dst);
     dst = OpenAPI_registration_location_info_parseFromJSON(item);
     cJSON_Delete(item);
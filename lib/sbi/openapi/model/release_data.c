@@ -370,7 +370,6 @@ end:
 OpenAPI_release_data_t *OpenAPI_release_data_copy(OpenAPI_release_data_t *dst, OpenAPI_release_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_release_data_convertToJSON(src);
@@ -379,21 +378,6 @@ OpenAPI_release_data_t *OpenAPI_release_data_copy(OpenAPI_release_data_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_release_data_free(dst);
     dst = OpenAPI_release_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -171,7 +171,6 @@ end:
 OpenAPI_released_data_t *OpenAPI_released_data_copy(OpenAPI_released_data_t *dst, OpenAPI_released_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_released_data_convertToJSON(src);
@@ -180,21 +179,6 @@ OpenAPI_released_data_t *OpenAPI_released_data_copy(OpenAPI_released_data_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_released_data_free(dst);
     dst = OpenAPI_released_data_parseFromJSON(item);
     cJSON_Delete(item);
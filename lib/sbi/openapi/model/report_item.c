@@ -71,7 +71,6 @@ end:
 OpenAPI_report_item_t *OpenAPI_report_item_copy(OpenAPI_report_item_t *dst, OpenAPI_report_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_report_item_convertToJSON(src);
@@ -80,21 +79,6 @@ OpenAPI_report_item_t *OpenAPI_report_item_copy(OpenAPI_report_item_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_report_item_free(dst);
     dst = OpenAPI_report_item_parseFromJSON(item);
     cJSON_Delete(item);
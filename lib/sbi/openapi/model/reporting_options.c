@@ -183,7 +183,6 @@ end:
 OpenAPI_reporting_options_t *OpenAPI_reporting_options_copy(OpenAPI_reporting_options_t *dst, OpenAPI_reporting_options_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_reporting_options_convertToJSON(src);
@@ -192,21 +191,6 @@ OpenAPI_reporting_options_t *OpenAPI_reporting_options_copy(OpenAPI_reporting_op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_reporting_options_free(dst);
     dst = OpenAPI_reporting_options_parseFromJSON(item);
     cJSON_Delete(item);
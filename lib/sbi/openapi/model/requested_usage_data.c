@@ -116,7 +116,6 @@ end:
 OpenAPI_requested_usage_data_t *OpenAPI_requested_usage_data_copy(OpenAPI_requested_usage_data_t *dst, OpenAPI_requested_usage_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_requested_usage_data_convertToJSON(src);
@@ -125,21 +124,6 @@ OpenAPI_requested_usage_data_t *OpenAPI_requested_usage_data_copy(OpenAPI_reques
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_requested_usage_data_free(dst);
     dst = OpenAPI_requested_usage_data_parseFromJSON(item);
     cJSON_Delete(item);
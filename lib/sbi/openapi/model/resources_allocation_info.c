@@ -148,7 +148,6 @@ end:
 OpenAPI_resources_allocation_info_t *OpenAPI_resources_allocation_info_copy(OpenAPI_resources_allocation_info_t *dst, OpenAPI_resources_allocation_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_resources_allocation_info_convertToJSON(src);
@@ -157,21 +156,6 @@ OpenAPI_resources_allocation_info_t *OpenAPI_resources_allocation_info_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_resources_allocation_info_free(dst);
     dst = OpenAPI_resources_allocation_info_parseFromJSON(item);
     cJSON_Delete(item);
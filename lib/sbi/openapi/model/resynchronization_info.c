@@ -91,7 +91,6 @@ end:
 OpenAPI_resynchronization_info_t *OpenAPI_resynchronization_info_copy(OpenAPI_resynchronization_info_t *dst, OpenAPI_resynchronization_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_resynchronization_info_convertToJSON(src);
@@ -100,21 +99,6 @@ OpenAPI_resynchronization_info_t *OpenAPI_resynchronization_info_copy(OpenAPI_re
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_resynchronization_info_free(dst);
     dst = OpenAPI_resynchronization_info_parseFromJSON(item);
     cJSON_Delete(item);
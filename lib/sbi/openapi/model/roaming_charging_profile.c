@@ -131,7 +131,6 @@ end:
 OpenAPI_roaming_charging_profile_t *OpenAPI_roaming_charging_profile_copy(OpenAPI_roaming_charging_profile_t *dst, OpenAPI_roaming_charging_profile_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_roaming_charging_profile_convertToJSON(src);
@@ -140,21 +139,6 @@ OpenAPI_roaming_charging_profile_t *OpenAPI_roaming_charging_profile_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_roaming_charging_profile_free(dst);
     dst = OpenAPI_roaming_charging_profile_parseFromJSON(item);
     cJSON_Delete(item);
@@ -115,7 +115,6 @@ end:
 OpenAPI_route_to_location_t *OpenAPI_route_to_location_copy(OpenAPI_route_to_location_t *dst, OpenAPI_route_to_location_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_route_to_location_convertToJSON(src);
@@ -124,21 +123,6 @@ OpenAPI_route_to_location_t *OpenAPI_route_to_location_copy(OpenAPI_route_to_loc
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_route_to_location_free(dst);
     dst = OpenAPI_route_to_location_parseFromJSON(item);
     cJSON_Delete(item);
@@ -134,7 +134,6 @@ end:
 OpenAPI_scheduled_communication_time_t *OpenAPI_scheduled_communication_time_copy(OpenAPI_scheduled_communication_time_t *dst, OpenAPI_scheduled_communication_time_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_scheduled_communication_time_convertToJSON(src);
@@ -143,21 +142,6 @@ OpenAPI_scheduled_communication_time_t *OpenAPI_scheduled_communication_time_cop
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_scheduled_communication_time_free(dst);
     dst = OpenAPI_scheduled_communication_time_parseFromJSON(item);
     cJSON_Delete(item);
@@ -51,7 +51,6 @@ end:
 OpenAPI_scheduled_communication_type_rm_t *OpenAPI_scheduled_communication_type_rm_copy(OpenAPI_scheduled_communication_type_rm_t *dst, OpenAPI_scheduled_communication_type_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_scheduled_communication_type_rm_convertToJSON(src);
@@ -60,21 +59,6 @@ OpenAPI_scheduled_communication_type_rm_t *OpenAPI_scheduled_communication_type_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_scheduled_communication_type_rm_free(dst);
     dst = OpenAPI_scheduled_communication_type_rm_parseFromJSON(item);
     cJSON_Delete(item);
@@ -215,7 +215,6 @@ end:
 OpenAPI_search_result_t *OpenAPI_search_result_copy(OpenAPI_search_result_t *dst, OpenAPI_search_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_search_result_convertToJSON(src);
@@ -224,21 +223,6 @@ OpenAPI_search_result_t *OpenAPI_search_result_copy(OpenAPI_search_result_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_search_result_free(dst);
     dst = OpenAPI_search_result_parseFromJSON(item);
     cJSON_Delete(item);
@@ -128,7 +128,6 @@ end:
 OpenAPI_secondary_rat_usage_report_t *OpenAPI_secondary_rat_usage_report_copy(OpenAPI_secondary_rat_usage_report_t *dst, OpenAPI_secondary_rat_usage_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_secondary_rat_usage_report_convertToJSON(src);
@@ -137,21 +136,6 @@ OpenAPI_secondary_rat_usage_report_t *OpenAPI_secondary_rat_usage_report_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_secondary_rat_usage_report_free(dst);
     dst = OpenAPI_secondary_rat_usage_report_parseFromJSON(item);
     cJSON_Delete(item);
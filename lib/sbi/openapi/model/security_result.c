@@ -93,7 +93,6 @@ end:
 OpenAPI_security_result_t *OpenAPI_security_result_copy(OpenAPI_security_result_t *dst, OpenAPI_security_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_security_result_convertToJSON(src);
@@ -102,21 +101,6 @@ OpenAPI_security_result_t *OpenAPI_security_result_copy(OpenAPI_security_result_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_security_result_free(dst);
     dst = OpenAPI_security_result_parseFromJSON(item);
     cJSON_Delete(item);
@@ -71,7 +71,6 @@ end:
 OpenAPI_service_name_cond_t *OpenAPI_service_name_cond_copy(OpenAPI_service_name_cond_t *dst, OpenAPI_service_name_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_service_name_cond_convertToJSON(src);
@@ -80,21 +79,6 @@ OpenAPI_service_name_cond_t *OpenAPI_service_name_cond_copy(OpenAPI_service_name
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_service_name_cond_free(dst);
     dst = OpenAPI_service_name_cond_parseFromJSON(item);
     cJSON_Delete(item);
@@ -317,7 +317,6 @@ end:
 OpenAPI_service_parameter_data_t *OpenAPI_service_parameter_data_copy(OpenAPI_service_parameter_data_t *dst, OpenAPI_service_parameter_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_service_parameter_data_convertToJSON(src);
@@ -326,21 +325,6 @@ OpenAPI_service_parameter_data_t *OpenAPI_service_parameter_data_copy(OpenAPI_se
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_service_parameter_data_free(dst);
     dst = OpenAPI_service_parameter_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -91,7 +91,6 @@ end:
 OpenAPI_service_parameter_data_patch_t *OpenAPI_service_parameter_data_patch_copy(OpenAPI_service_parameter_data_patch_t *dst, OpenAPI_service_parameter_data_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_service_parameter_data_patch_convertToJSON(src);
@@ -100,21 +99,6 @@ OpenAPI_service_parameter_data_patch_t *OpenAPI_service_parameter_data_patch_cop
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_service_parameter_data_patch_free(dst);
     dst = OpenAPI_service_parameter_data_patch_parseFromJSON(item);
     cJSON_Delete(item);
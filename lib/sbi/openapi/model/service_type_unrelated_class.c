@@ -236,7 +236,6 @@ end:
 OpenAPI_service_type_unrelated_class_t *OpenAPI_service_type_unrelated_class_copy(OpenAPI_service_type_unrelated_class_t *dst, OpenAPI_service_type_unrelated_class_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_service_type_unrelated_class_convertToJSON(src);
@@ -245,21 +244,6 @@ OpenAPI_service_type_unrelated_class_t *OpenAPI_service_type_unrelated_class_cop
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_service_type_unrelated_class_free(dst);
     dst = OpenAPI_service_type_unrelated_class_parseFromJSON(item);
     cJSON_Delete(item);
@@ -442,7 +442,6 @@ end:
 OpenAPI_session_management_subscription_data_1_t *OpenAPI_session_management_subscription_data_1_copy(OpenAPI_session_management_subscription_data_1_t *dst, OpenAPI_session_management_subscription_data_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_session_management_subscription_data_1_convertToJSON(src);
@@ -451,21 +450,6 @@ OpenAPI_session_management_subscription_data_1_t *OpenAPI_session_management_sub
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_session_management_subscription_data_1_free(dst);
     dst = OpenAPI_session_management_subscription_data_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -177,7 +177,6 @@ end:
 OpenAPI_session_rule_report_t *OpenAPI_session_rule_report_copy(OpenAPI_session_rule_report_t *dst, OpenAPI_session_rule_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_session_rule_report_convertToJSON(src);
@@ -186,21 +185,6 @@ OpenAPI_session_rule_report_t *OpenAPI_session_rule_report_copy(OpenAPI_session_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_session_rule_report_free(dst);
     dst = OpenAPI_session_rule_report_parseFromJSON(item);
     cJSON_Delete(item);
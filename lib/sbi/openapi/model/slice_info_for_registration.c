@@ -367,7 +367,6 @@ end:
 OpenAPI_slice_info_for_registration_t *OpenAPI_slice_info_for_registration_copy(OpenAPI_slice_info_for_registration_t *dst, OpenAPI_slice_info_for_registration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_slice_info_for_registration_convertToJSON(src);
@@ -376,21 +375,6 @@ OpenAPI_slice_info_for_registration_t *OpenAPI_slice_info_for_registration_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_slice_info_for_registration_free(dst);
     dst = OpenAPI_slice_info_for_registration_parseFromJSON(item);
     cJSON_Delete(item);
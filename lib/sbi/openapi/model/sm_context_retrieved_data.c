@@ -165,7 +165,6 @@ end:
 OpenAPI_sm_context_retrieved_data_t *OpenAPI_sm_context_retrieved_data_copy(OpenAPI_sm_context_retrieved_data_t *dst, OpenAPI_sm_context_retrieved_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_retrieved_data_convertToJSON(src);
@@ -174,21 +173,6 @@ OpenAPI_sm_context_retrieved_data_t *OpenAPI_sm_context_retrieved_data_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_retrieved_data_free(dst);
     dst = OpenAPI_sm_context_retrieved_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -308,7 +308,6 @@ end:
 OpenAPI_sm_context_status_notification_t *OpenAPI_sm_context_status_notification_copy(OpenAPI_sm_context_status_notification_t *dst, OpenAPI_sm_context_status_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_status_notification_convertToJSON(src);
@@ -317,21 +316,6 @@ OpenAPI_sm_context_status_notification_t *OpenAPI_sm_context_status_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_status_notification_free(dst);
     dst = OpenAPI_sm_context_status_notification_parseFromJSON(item);
     cJSON_Delete(item);
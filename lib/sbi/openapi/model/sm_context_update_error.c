@@ -185,7 +185,6 @@ end:
 OpenAPI_sm_context_update_error_t *OpenAPI_sm_context_update_error_copy(OpenAPI_sm_context_update_error_t *dst, OpenAPI_sm_context_update_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_update_error_convertToJSON(src);
@@ -194,21 +193,6 @@ OpenAPI_sm_context_update_error_t *OpenAPI_sm_context_update_error_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_update_error_free(dst);
     dst = OpenAPI_sm_context_update_error_parseFromJSON(item);
     cJSON_Delete(item);
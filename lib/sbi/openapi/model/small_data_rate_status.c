@@ -159,7 +159,6 @@ end:
 OpenAPI_small_data_rate_status_t *OpenAPI_small_data_rate_status_copy(OpenAPI_small_data_rate_status_t *dst, OpenAPI_small_data_rate_status_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_small_data_rate_status_convertToJSON(src);
@@ -168,21 +167,6 @@ OpenAPI_small_data_rate_status_t *OpenAPI_small_data_rate_status_copy(OpenAPI_sm
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_small_data_rate_status_free(dst);
     dst = OpenAPI_small_data_rate_status_parseFromJSON(item);
     cJSON_Delete(item);
@@ -368,7 +368,6 @@ end:
 OpenAPI_smf_registration_t *OpenAPI_smf_registration_copy(OpenAPI_smf_registration_t *dst, OpenAPI_smf_registration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smf_registration_convertToJSON(src);
@@ -377,21 +376,6 @@ OpenAPI_smf_registration_t *OpenAPI_smf_registration_copy(OpenAPI_smf_registrati
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smf_registration_free(dst);
     dst = OpenAPI_smf_registration_parseFromJSON(item);
     cJSON_Delete(item);
@@ -150,7 +150,6 @@ end:
 OpenAPI_smf_selection_subscription_data_t *OpenAPI_smf_selection_subscription_data_copy(OpenAPI_smf_selection_subscription_data_t *dst, OpenAPI_smf_selection_subscription_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smf_selection_subscription_data_convertToJSON(src);
@@ -159,21 +158,6 @@ OpenAPI_smf_selection_subscription_data_t *OpenAPI_smf_selection_subscription_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smf_selection_subscription_data_free(dst);
     dst = OpenAPI_smf_selection_subscription_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -94,7 +94,6 @@ end:
 OpenAPI_sponsor_connectivity_data_t *OpenAPI_sponsor_connectivity_data_copy(OpenAPI_sponsor_connectivity_data_t *dst, OpenAPI_sponsor_connectivity_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sponsor_connectivity_data_convertToJSON(src);
@@ -103,21 +102,6 @@ OpenAPI_sponsor_connectivity_data_t *OpenAPI_sponsor_connectivity_data_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sponsor_connectivity_data_free(dst);
     dst = OpenAPI_sponsor_connectivity_data_parseFromJSON(item);
     cJSON_Delete(item);
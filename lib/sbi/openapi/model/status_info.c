@@ -138,7 +138,6 @@ end:
 OpenAPI_status_info_t *OpenAPI_status_info_copy(OpenAPI_status_info_t *dst, OpenAPI_status_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_status_info_convertToJSON(src);
@@ -147,21 +146,6 @@ OpenAPI_status_info_t *OpenAPI_status_info_copy(OpenAPI_status_info_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_status_info_free(dst);
     dst = OpenAPI_status_info_parseFromJSON(item);
     cJSON_Delete(item);
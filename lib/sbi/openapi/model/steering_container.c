@@ -51,7 +51,6 @@ end:
 OpenAPI_steering_container_t *OpenAPI_steering_container_copy(OpenAPI_steering_container_t *dst, OpenAPI_steering_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_steering_container_convertToJSON(src);
@@ -60,21 +59,6 @@ OpenAPI_steering_container_t *OpenAPI_steering_container_copy(OpenAPI_steering_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_steering_container_free(dst);
     dst = OpenAPI_steering_container_parseFromJSON(item);
     cJSON_Delete(item);
@@ -107,7 +107,6 @@ end:
 OpenAPI_stored_search_result_t *OpenAPI_stored_search_result_copy(OpenAPI_stored_search_result_t *dst, OpenAPI_stored_search_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_stored_search_result_convertToJSON(src);
@@ -116,21 +115,6 @@ OpenAPI_stored_search_result_t *OpenAPI_stored_search_result_copy(OpenAPI_stored
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_stored_search_result_free(dst);
     dst = OpenAPI_stored_search_result_parseFromJSON(item);
     cJSON_Delete(item);
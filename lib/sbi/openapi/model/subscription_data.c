@@ -612,7 +612,6 @@ end:
 OpenAPI_subscription_data_t *OpenAPI_subscription_data_copy(OpenAPI_subscription_data_t *dst, OpenAPI_subscription_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_subscription_data_convertToJSON(src);
@@ -621,21 +620,6 @@ OpenAPI_subscription_data_t *OpenAPI_subscription_data_copy(OpenAPI_subscription
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_subscription_data_free(dst);
     dst = OpenAPI_subscription_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -395,7 +395,6 @@ end:
 OpenAPI_subscription_data_sets_t *OpenAPI_subscription_data_sets_copy(OpenAPI_subscription_data_sets_t *dst, OpenAPI_subscription_data_sets_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_subscription_data_sets_convertToJSON(src);
@@ -404,21 +403,6 @@ OpenAPI_subscription_data_sets_t *OpenAPI_subscription_data_sets_copy(OpenAPI_su
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_subscription_data_sets_free(dst);
     dst = OpenAPI_subscription_data_sets_parseFromJSON(item);
     cJSON_Delete(item);
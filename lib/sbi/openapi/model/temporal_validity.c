@@ -91,7 +91,6 @@ end:
 OpenAPI_temporal_validity_t *OpenAPI_temporal_validity_copy(OpenAPI_temporal_validity_t *dst, OpenAPI_temporal_validity_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_temporal_validity_convertToJSON(src);
@@ -100,21 +99,6 @@ OpenAPI_temporal_validity_t *OpenAPI_temporal_validity_copy(OpenAPI_temporal_val
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_temporal_validity_free(dst);
     dst = OpenAPI_temporal_validity_parseFromJSON(item);
     cJSON_Delete(item);
@@ -92,7 +92,6 @@ end:
 OpenAPI_termination_notification_t *OpenAPI_termination_notification_copy(OpenAPI_termination_notification_t *dst, OpenAPI_termination_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_termination_notification_convertToJSON(src);
@@ -101,21 +100,6 @@ OpenAPI_termination_notification_t *OpenAPI_termination_notification_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_termination_notification_free(dst);
     dst = OpenAPI_termination_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -97,7 +97,6 @@ end:
 OpenAPI_time_period_t *OpenAPI_time_period_copy(OpenAPI_time_period_t *dst, OpenAPI_time_period_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_time_period_convertToJSON(src);
@@ -106,21 +105,6 @@ OpenAPI_time_period_t *OpenAPI_time_period_copy(OpenAPI_time_period_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_time_period_free(dst);
     dst = OpenAPI_time_period_parseFromJSON(item);
     cJSON_Delete(item);
@@ -91,7 +91,6 @@ end:
 OpenAPI_time_window_t *OpenAPI_time_window_copy(OpenAPI_time_window_t *dst, OpenAPI_time_window_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_time_window_convertToJSON(src);
@@ -100,21 +99,6 @@ OpenAPI_time_window_t *OpenAPI_time_window_copy(OpenAPI_time_window_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_time_window_free(dst);
     dst = OpenAPI_time_window_parseFromJSON(item);
     cJSON_Delete(item);
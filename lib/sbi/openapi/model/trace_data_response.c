@@ -95,7 +95,6 @@ end:
 OpenAPI_trace_data_response_t *OpenAPI_trace_data_response_copy(OpenAPI_trace_data_response_t *dst, OpenAPI_trace_data_response_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_trace_data_response_convertToJSON(src);
@@ -104,21 +103,6 @@ OpenAPI_trace_data_response_t *OpenAPI_trace_data_response_copy(OpenAPI_trace_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_trace_data_response_free(dst);
     dst = OpenAPI_trace_data_response_parseFromJSON(item);
     cJSON_Delete(item);
@@ -429,7 +429,6 @@ end:
 OpenAPI_traffic_control_data_t *OpenAPI_traffic_control_data_copy(OpenAPI_traffic_control_data_t *dst, OpenAPI_traffic_control_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_traffic_control_data_convertToJSON(src);
@@ -438,21 +437,6 @@ OpenAPI_traffic_control_data_t *OpenAPI_traffic_control_data_copy(OpenAPI_traffi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_traffic_control_data_free(dst);
     dst = OpenAPI_traffic_control_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -51,7 +51,6 @@ end:
 OpenAPI_trigger_category_t *OpenAPI_trigger_category_copy(OpenAPI_trigger_category_t *dst, OpenAPI_trigger_category_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_trigger_category_convertToJSON(src);
@@ -60,21 +59,6 @@ OpenAPI_trigger_category_t *OpenAPI_trigger_category_copy(OpenAPI_trigger_catego
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_trigger_category_free(dst);
     dst = OpenAPI_trigger_category_parseFromJSON(item);
     cJSON_Delete(item);
@@ -71,7 +71,6 @@ end:
 OpenAPI_trigger_request_t *OpenAPI_trigger_request_copy(OpenAPI_trigger_request_t *dst, OpenAPI_trigger_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_trigger_request_convertToJSON(src);
@@ -80,21 +79,6 @@ OpenAPI_trigger_request_t *OpenAPI_trigger_request_copy(OpenAPI_trigger_request_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_trigger_request_free(dst);
     dst = OpenAPI_trigger_request_parseFromJSON(item);
     cJSON_Delete(item);
@@ -93,7 +93,6 @@ end:
 OpenAPI_tscai_input_container_t *OpenAPI_tscai_input_container_copy(OpenAPI_tscai_input_container_t *dst, OpenAPI_tscai_input_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_tscai_input_container_convertToJSON(src);
@@ -102,21 +101,6 @@ OpenAPI_tscai_input_container_t *OpenAPI_tscai_input_container_copy(OpenAPI_tsca
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_tscai_input_container_free(dst);
     dst = OpenAPI_tscai_input_container_parseFromJSON(item);
     cJSON_Delete(item);
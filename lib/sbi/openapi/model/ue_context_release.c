@@ -117,7 +117,6 @@ end:
 OpenAPI_ue_context_release_t *OpenAPI_ue_context_release_copy(OpenAPI_ue_context_release_t *dst, OpenAPI_ue_context_release_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_release_convertToJSON(src);
@@ -126,21 +125,6 @@ OpenAPI_ue_context_release_t *OpenAPI_ue_context_release_copy(OpenAPI_ue_context
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_release_free(dst);
     dst = OpenAPI_ue_context_release_parseFromJSON(item);
     cJSON_Delete(item);
@@ -75,7 +75,6 @@ end:
 OpenAPI_ue_context_relocated_data_t *OpenAPI_ue_context_relocated_data_copy(OpenAPI_ue_context_relocated_data_t *dst, OpenAPI_ue_context_relocated_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_relocated_data_convertToJSON(src);
@@ -84,21 +83,6 @@ OpenAPI_ue_context_relocated_data_t *OpenAPI_ue_context_relocated_data_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_relocated_data_free(dst);
     dst = OpenAPI_ue_context_relocated_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -93,7 +93,6 @@ end:
 OpenAPI_up_security_t *OpenAPI_up_security_copy(OpenAPI_up_security_t *dst, OpenAPI_up_security_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_up_security_convertToJSON(src);
@@ -102,21 +101,6 @@ OpenAPI_up_security_t *OpenAPI_up_security_copy(OpenAPI_up_security_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_up_security_free(dst);
     dst = OpenAPI_up_security_parseFromJSON(item);
     cJSON_Delete(item);
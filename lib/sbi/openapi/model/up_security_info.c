@@ -141,7 +141,6 @@ end:
 OpenAPI_up_security_info_t *OpenAPI_up_security_info_copy(OpenAPI_up_security_info_t *dst, OpenAPI_up_security_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_up_security_info_convertToJSON(src);
@@ -150,21 +149,6 @@ OpenAPI_up_security_info_t *OpenAPI_up_security_info_copy(OpenAPI_up_security_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_up_security_info_free(dst);
     dst = OpenAPI_up_security_info_parseFromJSON(item);
     cJSON_Delete(item);
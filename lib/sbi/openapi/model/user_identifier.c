@@ -111,7 +111,6 @@ end:
 OpenAPI_user_identifier_t *OpenAPI_user_identifier_copy(OpenAPI_user_identifier_t *dst, OpenAPI_user_identifier_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_user_identifier_convertToJSON(src);
@@ -120,21 +119,6 @@ OpenAPI_user_identifier_t *OpenAPI_user_identifier_copy(OpenAPI_user_identifier_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_user_identifier_free(dst);
     dst = OpenAPI_user_identifier_parseFromJSON(item);
     cJSON_Delete(item);
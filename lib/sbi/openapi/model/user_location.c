@@ -123,7 +123,6 @@ end:
 OpenAPI_user_location_t *OpenAPI_user_location_copy(OpenAPI_user_location_t *dst, OpenAPI_user_location_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_user_location_convertToJSON(src);
@@ -132,21 +131,6 @@ OpenAPI_user_location_t *OpenAPI_user_location_copy(OpenAPI_user_location_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_user_location_free(dst);
     dst = OpenAPI_user_location_parseFromJSON(item);
     cJSON_Delete(item);
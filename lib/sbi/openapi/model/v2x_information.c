@@ -75,7 +75,6 @@ end:
 OpenAPI_v2x_information_t *OpenAPI_v2x_information_copy(OpenAPI_v2x_information_t *dst, OpenAPI_v2x_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_v2x_information_convertToJSON(src);
@@ -84,21 +83,6 @@ OpenAPI_v2x_information_t *OpenAPI_v2x_information_copy(OpenAPI_v2x_information_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_v2x_information_free(dst);
     dst = OpenAPI_v2x_information_parseFromJSON(item);
     cJSON_Delete(item);
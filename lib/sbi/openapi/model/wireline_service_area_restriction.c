@@ -128,7 +128,6 @@ end:
 OpenAPI_wireline_service_area_restriction_t *OpenAPI_wireline_service_area_restriction_copy(OpenAPI_wireline_service_area_restriction_t *dst, OpenAPI_wireline_service_area_restriction_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_wireline_service_area_restriction_convertToJSON(src);
@@ -137,21 +136,6 @@ OpenAPI_wireline_service_area_restriction_t *OpenAPI_wireline_service_area_restr
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_wireline_service_area_restriction_free(dst);
     dst = OpenAPI_wireline_service_area_restriction_parseFromJSON(item);
     cJSON_Delete(item);
@@ -34,14 +34,13 @@
 #define IFNAMSIZ 32
 #endif
 
-ogs_socket_t ogs_tun_open(char *ifname, int len, int is_tap)
+static ogs_socket_t tun_open(char *ifname, int is_tap, int flags)
 {
     ogs_socket_t fd = INVALID_SOCKET;
 
     const char *dev = "/dev/net/tun";
     int rc;
     struct ifreq ifr;
-    int flags = IFF_NO_PI;
 
     ogs_assert(ifname);
 
@@ -71,6 +70,23 @@ cleanup:
     return INVALID_SOCKET;
 }
 
+ogs_socket_t ogs_tun_open(char *ifname, int len, int is_tap)
+{
+    return tun_open(ifname, is_tap, IFF_NO_PI);
+}
+
+ogs_socket_t ogs_tun_open_queue(char *ifname, int len, int is_tap)
+{
+    /*
+     * Every queue of the device, including the first one,
+     * must be attached with IFF_MULTI_QUEUE. A persistent device
+     * should be created with the `multi_queue` option as below.
+     *
+     * $ sudo ip tuntap add name ogstun mode tun multi_queue
+     */
+    return tun_open(ifname, is_tap, IFF_NO_PI | IFF_MULTI_QUEUE);
+}
+
 int ogs_tun_set_ip(char *ifname, ogs_ipsubnet_t *gw, ogs_ipsubnet_t *sub)
 {
     return OGS_OK;
@@ -57,9 +57,9 @@ void amf_context_init(void)
 
     /* Allocate TWICE the pool to check if maximum number of gNBs is reached */
     ogs_pool_init(&amf_gnb_pool, ogs_app()->max.peer*2);
-    ogs_pool_init(&amf_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&ran_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&amf_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_elastic_init(&amf_ue_pool, ogs_app()->max.ue);
+    ogs_pool_elastic_init(&ran_ue_pool, ogs_app()->max.ue);
+    ogs_pool_elastic_init(&amf_sess_pool, ogs_app()->pool.sess);
     ogs_pool_init(&self.m_tmsi, ogs_app()->max.ue*2);
 
     ogs_list_init(&self.gnb_list);
@@ -1020,6 +1020,8 @@ amf_gnb_t *amf_gnb_add(ogs_sock_t *sock, ogs_sockaddr_t *addr)
     gnb->ostream_id = 0;
 
     ogs_list_init(&gnb->ran_ue_list);
+    gnb->ran_ue_hash = ogs_ihash_make();
+    ogs_assert(gnb->ran_ue_hash);
 
     ogs_hash_set(self.gnb_addr_hash,
             gnb->sctp.addr, sizeof(ogs_sockaddr_t), gnb);
@@ -1054,6 +1056,9 @@ void amf_gnb_remove(amf_gnb_t *gnb)
             gnb->sctp.addr, sizeof(ogs_sockaddr_t), NULL);
     ogs_hash_set(self.gnb_id_hash, &gnb->gnb_id, sizeof(gnb->gnb_id), NULL);
 
+    ogs_ihash_destroy(gnb->ran_ue_hash);
+    gnb->ran_ue_hash = NULL;
+
     ogs_sctp_flush_and_destroy(&gnb->sctp);
 
     ogs_pool_free(&amf_gnb_pool, gnb);
@@ -1116,6 +1121,56 @@ amf_gnb_t *amf_gnb_cycle(amf_gnb_t *gnb)
     return ogs_pool_cycle(&amf_gnb_pool, gnb);
 }
 
+/*
+ * The gNB may use the same RAN_UE_NGAP_ID for more than one RAN-UE
+ * (e.g. INVALID_UE_NGAP_ID for the handover target). As with the list,
+ * the first one added is found. The others are only in the list.
+ */
+static void ran_ue_hash_add(amf_gnb_t *gnb, ran_ue_t *ran_ue)
+{
+    ogs_assert(gnb);
+    ogs_assert(ran_ue);
+
+    if (!gnb->ran_ue_hash)
+        return;
+
+    if (!ogs_ihash_get(gnb->ran_ue_hash, ran_ue->ran_ue_ngap_id))
+        ogs_ihash_set(gnb->ran_ue_hash, ran_ue->ran_ue_ngap_id, ran_ue);
+    else
+        gnb->num_of_ran_ue_dup++;
+}
+
+static void ran_ue_hash_remove(amf_gnb_t *gnb, ran_ue_t *ran_ue)
+{
+    ran_ue_t *iter = NULL;
+
+    ogs_assert(gnb);
+    ogs_assert(ran_ue);
+
+    if (!gnb->ran_ue_hash)
+        return;
+
+    if (ogs_ihash_get(gnb->ran_ue_hash, ran_ue->ran_ue_ngap_id) != ran_ue) {
+        if (gnb->num_of_ran_ue_dup > 0)
+            gnb->num_of_ran_ue_dup--;
+        return;
+    }
+
+    ogs_ihash_set(gnb->ran_ue_hash, ran_ue->ran_ue_ngap_id, NULL);
+
+    if (gnb->num_of_ran_ue_dup == 0)
+        return;
+
+    /* Index the next one with the same ID */
+    ogs_list_for_each(&gnb->ran_ue_list, iter) {
+        if (iter != ran_ue && iter->ran_ue_ngap_id == ran_ue->ran_ue_ngap_id) {
+            ogs_ihash_set(gnb->ran_ue_hash, iter->ran_ue_ngap_id, iter);
+            gnb->num_of_ran_ue_dup--;
+            break;
+        }
+    }
+}
+
 /** ran_ue_context handling function */
 ran_ue_t *ran_ue_add(amf_gnb_t *gnb, uint32_t ran_ue_ngap_id)
 {
@@ -1158,6 +1213,7 @@ ran_ue_t *ran_ue_add(amf_gnb_t *gnb, uint32_t ran_ue_ngap_id)
     ran_ue->gnb = gnb;
 
     ogs_list_add(&gnb->ran_ue_list, ran_ue);
+    ran_ue_hash_add(gnb, ran_ue);
 
     stats_add_ran_ue();
 
@@ -1170,6 +1226,7 @@ void ran_ue_remove(ran_ue_t *ran_ue)
     ogs_assert(ran_ue->gnb);
 
     ogs_list_remove(&ran_ue->gnb->ran_ue_list, ran_ue);
+    ran_ue_hash_remove(ran_ue->gnb, ran_ue);
 
     ogs_assert(ran_ue->t_ng_holding);
     ogs_timer_delete(ran_ue->t_ng_holding);
@@ -1187,25 +1244,33 @@ void ran_ue_switch_to_gnb(ran_ue_t *ran_ue, amf_gnb_t *new_gnb)
 
     /* Remove from the old gnb */
     ogs_list_remove(&ran_ue->gnb->ran_ue_list, ran_ue);
+    ran_ue_hash_remove(ran_ue->gnb, ran_ue);
 
     /* Add to the new gnb */
     ogs_list_add(&new_gnb->ran_ue_list, ran_ue);
+    ran_ue_hash_add(new_gnb, ran_ue);
 
     /* Switch to gnb */
     ran_ue->gnb = new_gnb;
 }
 
+void ran_ue_set_ran_ue_ngap_id(ran_ue_t *ran_ue, uint32_t ran_ue_ngap_id)
+{
+    ogs_assert(ran_ue);
+    ogs_assert(ran_ue->gnb);
+
+    ran_ue_hash_remove(ran_ue->gnb, ran_ue);
+    ran_ue->ran_ue_ngap_id = ran_ue_ngap_id;
+    ran_ue_hash_add(ran_ue->gnb, ran_ue);
+}
+
 ran_ue_t *ran_ue_find_by_ran_ue_ngap_id(
         amf_gnb_t *gnb, uint32_t ran_ue_ngap_id)
 {
-    ran_ue_t *ran_ue = NULL;
-
-    ogs_list_for_each(&gnb->ran_ue_list, ran_ue) {
-        if (ran_ue_ngap_id == ran_ue->ran_ue_ngap_id)
-            break;
-    }
+    ogs_assert(gnb);
+    ogs_assert(gnb->ran_ue_hash);
 
-    return ran_ue;
+    return ogs_ihash_get(gnb->ran_ue_hash, ran_ue_ngap_id);
 }
 
 ran_ue_t *ran_ue_find(uint32_t index)
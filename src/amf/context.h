@@ -148,6 +148,8 @@ typedef struct amf_gnb_s {
     ogs_pkbuf_t     *ng_reset_ack; /* Reset message */
 
     ogs_list_t      ran_ue_list;
+    ogs_ihash_t     *ran_ue_hash;   /* hash table (RAN_UE_NGAP_ID : RAN_UE) */
+    int             num_of_ran_ue_dup; /* Not indexed due to the same ID */
 
 } amf_gnb_t;
 
@@ -656,6 +658,7 @@ amf_gnb_t *amf_gnb_cycle(amf_gnb_t *gnb);
 ran_ue_t *ran_ue_add(amf_gnb_t *gnb, uint32_t ran_ue_ngap_id);
 void ran_ue_remove(ran_ue_t *ran_ue);
 void ran_ue_switch_to_gnb(ran_ue_t *ran_ue, amf_gnb_t *new_gnb);
+void ran_ue_set_ran_ue_ngap_id(ran_ue_t *ran_ue, uint32_t ran_ue_ngap_id);
 ran_ue_t *ran_ue_find_by_ran_ue_ngap_id(
         amf_gnb_t *gnb, uint32_t ran_ue_ngap_id);
 ran_ue_t *ran_ue_find(uint32_t index);
@@ -2703,12 +2703,12 @@ void ngap_handle_path_switch_request(
     ogs_info("    [OLD] TAC[%d] CellID[0x%llx]",
         amf_ue->nr_tai.tac.v, (long long)amf_ue->nr_cgi.cell_id);
 
-    /* Update RAN-UE-NGAP-ID */
-    ran_ue->ran_ue_ngap_id = *RAN_UE_NGAP_ID;
-
     /* Change ran_ue to the NEW gNB */
     ran_ue_switch_to_gnb(ran_ue, gnb);
 
+    /* Update RAN-UE-NGAP-ID */
+    ran_ue_set_ran_ue_ngap_id(ran_ue, *RAN_UE_NGAP_ID);
+
     if (!UserLocationInformation) {
         ogs_error("No UserLocationInformation");
         r = ngap_send_error_indication2(amf_ue,
@@ -3338,7 +3338,7 @@ void ngap_handle_handover_request_ack(
         return;
     }
 
-    target_ue->ran_ue_ngap_id = *RAN_UE_NGAP_ID;
+    ran_ue_set_ran_ue_ngap_id(target_ue, *RAN_UE_NGAP_ID);
 
     source_ue = target_ue->source_ue;
     if (!source_ue) {
@@ -36,7 +36,7 @@ void ausf_context_init(void)
 
     ogs_log_install_domain(&__ausf_log_domain, "ausf", ogs_core()->log.level);
 
-    ogs_pool_init(&ausf_ue_pool, ogs_app()->max.ue);
+    ogs_pool_elastic_init(&ausf_ue_pool, ogs_app()->max.ue);
 
     ogs_list_init(&self.ausf_ue_list);
     self.suci_hash = ogs_hash_make();
@@ -36,7 +36,7 @@ void bsf_context_init(void)
 
     ogs_log_install_domain(&__bsf_log_domain, "bsf", ogs_core()->log.level);
 
-    ogs_pool_init(&bsf_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_elastic_init(&bsf_sess_pool, ogs_app()->pool.sess);
 
     self.ipv4addr_hash = ogs_hash_make();
     ogs_assert(self.ipv4addr_hash);
@@ -99,9 +99,9 @@ void hss_context_init(void)
     ogs_log_install_domain(&__ogs_dbi_domain, "dbi", ogs_core()->log.level);
     ogs_log_install_domain(&__hss_log_domain, "hss", ogs_core()->log.level);
 
-    ogs_pool_init(&imsi_pool, ogs_app()->pool.impi);
-    ogs_pool_init(&impi_pool, ogs_app()->pool.impi);
-    ogs_pool_init(&impu_pool, ogs_app()->pool.impu);
+    ogs_pool_elastic_init(&imsi_pool, ogs_app()->pool.impi);
+    ogs_pool_elastic_init(&impi_pool, ogs_app()->pool.impi);
+    ogs_pool_elastic_init(&impu_pool, ogs_app()->pool.impu);
 
     self.imsi_hash = ogs_hash_make();
     ogs_assert(self.imsi_hash);
@@ -110,7 +110,6 @@ void hss_context_init(void)
     self.impu_hash = ogs_hash_make();
     ogs_assert(self.impu_hash);
 
-    ogs_thread_mutex_init(&self.db_lock);
     ogs_thread_mutex_init(&self.cx_lock);
 
     context_initialized = 1;
@@ -134,7 +133,6 @@ void hss_context_final(void)
     ogs_pool_final(&impi_pool);
     ogs_pool_final(&impu_pool);
 
-    ogs_thread_mutex_destroy(&self.db_lock);
     ogs_thread_mutex_destroy(&self.cx_lock);
 
     context_initialized = 0;
@@ -349,14 +347,31 @@ int hss_db_auth_info(char *imsi_bcd, ogs_dbi_auth_info_t *auth_info)
     ogs_assert(imsi_bcd);
     ogs_assert(auth_info);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
     rv = ogs_dbi_auth_info(supi, auth_info);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
+
+    return rv;
+}
+
+int hss_db_auth_info_increment_sqn(
+        char *imsi_bcd, ogs_dbi_auth_info_t *auth_info)
+{
+    int rv;
+    char *supi = NULL;
+
+    ogs_assert(imsi_bcd);
+    ogs_assert(auth_info);
+
+    supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
+    ogs_assert(supi);
+
+    rv = ogs_dbi_auth_info_increment_sqn(supi, auth_info);
+
+    ogs_free(supi);
 
     return rv;
 }
@@ -368,14 +383,12 @@ int hss_db_update_sqn(char *imsi_bcd, uint8_t *rand, uint64_t sqn)
 
     ogs_assert(imsi_bcd);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
     rv = ogs_dbi_update_sqn(supi, sqn);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
@@ -387,14 +400,12 @@ int hss_db_update_imeisv(char *imsi_bcd, char *imeisv)
 
     ogs_assert(imsi_bcd);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
     rv = ogs_dbi_update_imeisv(supi, imeisv);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
@@ -407,14 +418,12 @@ int hss_db_update_mme(char *imsi_bcd, char *mme_host, char *mme_realm,
 
     ogs_assert(imsi_bcd);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
     rv = ogs_dbi_update_mme(supi, mme_host, mme_realm, purge_flag);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
@@ -426,14 +435,12 @@ int hss_db_increment_sqn(char *imsi_bcd)
 
     ogs_assert(imsi_bcd);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
     rv = ogs_dbi_increment_sqn(supi);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
@@ -447,14 +454,12 @@ int hss_db_subscription_data(
     ogs_assert(imsi_bcd);
     ogs_assert(subscription_data);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
     rv = ogs_dbi_subscription_data(supi, subscription_data);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
@@ -466,11 +471,9 @@ int hss_db_msisdn_data(char *imsi_or_msisdn_bcd, ogs_msisdn_data_t *msisdn_data)
     ogs_assert(imsi_or_msisdn_bcd);
     ogs_assert(msisdn_data);
 
-    ogs_thread_mutex_lock(&self.db_lock);
 
     rv = ogs_dbi_msisdn_data(imsi_or_msisdn_bcd, msisdn_data);
 
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
@@ -483,14 +486,12 @@ int hss_db_ims_data(char *imsi_bcd, ogs_ims_data_t *ims_data)
     ogs_assert(imsi_bcd);
     ogs_assert(ims_data);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
     rv = ogs_dbi_ims_data(supi, ims_data);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
@@ -1179,12 +1180,8 @@ int hss_db_poll_change_stream(void)
 {
     int rv;
 
-    ogs_thread_mutex_lock(&self.db_lock);
-
     rv = ogs_dbi_poll_change_stream();
 
-    ogs_thread_mutex_unlock(&self.db_lock);
-
     return rv;
 }
 
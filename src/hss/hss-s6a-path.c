@@ -111,7 +111,8 @@ static int hss_ogs_diam_s6a_air_cb( struct msg **msg, struct avp *avp,
     ogs_cpystrn(imsi_bcd, (char*)hdr->avp_value->os.data,
         ogs_min(hdr->avp_value->os.len, OGS_MAX_IMSI_BCD_LEN)+1);
 
-    rv = hss_db_auth_info(imsi_bcd, &auth_info);
+    /* SQN is read and incremented by 32 in the DB at once */
+    rv = hss_db_auth_info_increment_sqn(imsi_bcd, &auth_info);
     if (rv != OGS_OK) {
         result_code = OGS_DIAM_S6A_ERROR_USER_UNKNOWN;
         goto out;
@@ -146,6 +147,15 @@ static int hss_ogs_diam_s6a_air_cb( struct msg **msg, struct avp *avp,
                 auth_info.sqn = ogs_buffer_to_uint64(sqn, OGS_SQN_LEN);
                 /* 33.102 C.3.4 Guide : IND + 1 */
                 auth_info.sqn = (auth_info.sqn + 32 + 1) & OGS_MAX_SQN;
+
+                rv = hss_db_update_sqn(imsi_bcd, auth_info.rand,
+                        (auth_info.sqn + 32) & OGS_MAX_SQN);
+                if (rv != OGS_OK) {
+                    ogs_error("Cannot update rand and sqn for IMSI:'%s'",
+                            imsi_bcd);
+                    result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
+                    goto out;
+                }
             } else {
                 ogs_error("Re-synch MAC failed for IMSI:`%s`", imsi_bcd);
                 ogs_log_print(OGS_LOG_ERROR, "MAC_S: ");
@@ -162,20 +172,6 @@ static int hss_ogs_diam_s6a_air_cb( struct msg **msg, struct avp *avp,
         }
     }
 
-    rv = hss_db_update_sqn(imsi_bcd, auth_info.rand, auth_info.sqn);
-    if (rv != OGS_OK) {
-        ogs_error("Cannot update rand and sqn for IMSI:'%s'", imsi_bcd);
-        result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
-        goto out;
-    }
-
-    rv = hss_db_increment_sqn(imsi_bcd);
-    if (rv != OGS_OK) {
-        ogs_error("Cannot increment sqn for IMSI:'%s'", imsi_bcd);
-        result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
-        goto out;
-    }
-
     ret = fd_msg_search_avp(qry, ogs_diam_visited_plmn_id, &avp);
     ogs_assert(ret == 0);
     ret = fd_msg_avp_hdr(avp, &hdr);
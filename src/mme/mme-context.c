@@ -99,11 +99,11 @@ void mme_context_init()
     /* Allocate TWICE the pool to check if maximum number of eNBs is reached */
     ogs_pool_init(&mme_enb_pool, ogs_app()->max.peer*2);
 
-    ogs_pool_init(&mme_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&enb_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&sgw_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&mme_sess_pool, ogs_app()->pool.sess);
-    ogs_pool_init(&mme_bearer_pool, ogs_app()->pool.bearer);
+    ogs_pool_elastic_init(&mme_ue_pool, ogs_app()->max.ue);
+    ogs_pool_elastic_init(&enb_ue_pool, ogs_app()->max.ue);
+    ogs_pool_elastic_init(&sgw_ue_pool, ogs_app()->max.ue);
+    ogs_pool_elastic_init(&mme_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_elastic_init(&mme_bearer_pool, ogs_app()->pool.bearer);
     ogs_pool_init(&self.m_tmsi, ogs_app()->max.ue*2);
 
     self.enb_addr_hash = ogs_hash_make();
@@ -1911,6 +1911,8 @@ mme_enb_t *mme_enb_add(ogs_sock_t *sock, ogs_sockaddr_t *addr)
     enb->ostream_id = 0;
 
     ogs_list_init(&enb->enb_ue_list);
+    enb->enb_ue_hash = ogs_ihash_make();
+    ogs_assert(enb->enb_ue_hash);
 
     ogs_hash_set(self.enb_addr_hash,
             enb->sctp.addr, sizeof(ogs_sockaddr_t), enb);
@@ -1952,6 +1954,9 @@ int mme_enb_remove(mme_enb_t *enb)
      * ogs_sctp_flush_and_destroy will clear this buffer
      */
 
+    ogs_ihash_destroy(enb->enb_ue_hash);
+    enb->enb_ue_hash = NULL;
+
     ogs_sctp_flush_and_destroy(&enb->sctp);
 
     ogs_pool_free(&mme_enb_pool, enb);
@@ -2018,6 +2023,56 @@ mme_enb_t *mme_enb_cycle(mme_enb_t *enb)
     return ogs_pool_cycle(&mme_enb_pool, enb);
 }
 
+/*
+ * The eNB may use the same ENB_UE_S1AP_ID for more than one eNB-UE
+ * (e.g. INVALID_UE_S1AP_ID for the handover target). As with the list,
+ * the first one added is found. The others are only in the list.
+ */
+static void enb_ue_hash_add(mme_enb_t *enb, enb_ue_t *enb_ue)
+{
+    ogs_assert(enb);
+    ogs_assert(enb_ue);
+
+    if (!enb->enb_ue_hash)
+        return;
+
+    if (!ogs_ihash_get(enb->enb_ue_hash, enb_ue->enb_ue_s1ap_id))
+        ogs_ihash_set(enb->enb_ue_hash, enb_ue->enb_ue_s1ap_id, enb_ue);
+    else
+        enb->num_of_enb_ue_dup++;
+}
+
+static void enb_ue_hash_remove(mme_enb_t *enb, enb_ue_t *enb_ue)
+{
+    enb_ue_t *iter = NULL;
+
+    ogs_assert(enb);
+    ogs_assert(enb_ue);
+
+    if (!enb->enb_ue_hash)
+        return;
+
+    if (ogs_ihash_get(enb->enb_ue_hash, enb_ue->enb_ue_s1ap_id) != enb_ue) {
+        if (enb->num_of_enb_ue_dup > 0)
+            enb->num_of_enb_ue_dup--;
+        return;
+    }
+
+    ogs_ihash_set(enb->enb_ue_hash, enb_ue->enb_ue_s1ap_id, NULL);
+
+    if (enb->num_of_enb_ue_dup == 0)
+        return;
+
+    /* Index the next one with the same ID */
+    ogs_list_for_each(&enb->enb_ue_list, iter) {
+        if (iter != enb_ue && iter->enb_ue_s1ap_id == enb_ue->enb_ue_s1ap_id) {
+            ogs_ihash_set(enb->enb_ue_hash, iter->enb_ue_s1ap_id, iter);
+            enb->num_of_enb_ue_dup--;
+            break;
+        }
+    }
+}
+
 /** enb_ue_context handling function */
 enb_ue_t *enb_ue_add(mme_enb_t *enb, uint32_t enb_ue_s1ap_id)
 {
@@ -2060,6 +2115,7 @@ enb_ue_t *enb_ue_add(mme_enb_t *enb, uint32_t enb_ue_s1ap_id)
     enb_ue->enb = enb;
 
     ogs_list_add(&enb->enb_ue_list, enb_ue);
+    enb_ue_hash_add(enb, enb_ue);
 
     stats_add_enb_ue();
 
@@ -2075,6 +2131,7 @@ void enb_ue_remove(enb_ue_t *enb_ue)
     ogs_assert(enb);
 
     ogs_list_remove(&enb->enb_ue_list, enb_ue);
+    enb_ue_hash_remove(enb, enb_ue);
 
     ogs_assert(enb_ue->t_s1_holding);
     ogs_timer_delete(enb_ue->t_s1_holding);
@@ -2092,25 +2149,33 @@ void enb_ue_switch_to_enb(enb_ue_t *enb_ue, mme_enb_t *new_enb)
 
     /* Remove from the old enb */
     ogs_list_remove(&enb_ue->enb->enb_ue_list, enb_ue);
+    enb_ue_hash_remove(enb_ue->enb, enb_ue);
 
     /* Add to the new enb */
     ogs_list_add(&new_enb->enb_ue_list, enb_ue);
+    enb_ue_hash_add(new_enb, enb_ue);
 
     /* Switch to enb */
     enb_ue->enb = new_enb;
 }
 
+void enb_ue_set_enb_ue_s1ap_id(enb_ue_t *enb_ue, uint32_t enb_ue_s1ap_id)
+{
+    ogs_assert(enb_ue);
+    ogs_assert(enb_ue->enb);
+
+    enb_ue_hash_remove(enb_ue->enb, enb_ue);
+    enb_ue->enb_ue_s1ap_id = enb_ue_s1ap_id;
+    enb_ue_hash_add(enb_ue->enb, enb_ue);
+}
+
 enb_ue_t *enb_ue_find_by_enb_ue_s1ap_id(
         mme_enb_t *enb, uint32_t enb_ue_s1ap_id)
 {
-    enb_ue_t *enb_ue = NULL;
-
-    ogs_list_for_each(&enb->enb_ue_list, enb_ue) {
-        if (enb_ue_s1ap_id == enb_ue->enb_ue_s1ap_id)
-            break;
-    }
+    ogs_assert(enb);
+    ogs_assert(enb->enb_ue_hash);
 
-    return enb_ue;
+    return ogs_ihash_get(enb->enb_ue_hash, enb_ue_s1ap_id);
 }
 
 enb_ue_t *enb_ue_find(uint32_t index)
@@ -225,6 +225,8 @@ typedef struct mme_enb_s {
     ogs_pkbuf_t     *s1_reset_ack; /* Reset message */
 
     ogs_list_t      enb_ue_list;
+    ogs_ihash_t     *enb_ue_hash;   /* hash table (ENB_UE_S1AP_ID : ENB_UE) */
+    int             num_of_enb_ue_dup; /* Not indexed due to the same ID */
 
 } mme_enb_t;
 
@@ -785,6 +787,7 @@ mme_enb_t *mme_enb_cycle(mme_enb_t *enb);
 enb_ue_t *enb_ue_add(mme_enb_t *enb, uint32_t enb_ue_s1ap_id);
 void enb_ue_remove(enb_ue_t *enb_ue);
 void enb_ue_switch_to_enb(enb_ue_t *enb_ue, mme_enb_t *new_enb);
+void enb_ue_set_enb_ue_s1ap_id(enb_ue_t *enb_ue, uint32_t enb_ue_s1ap_id);
 enb_ue_t *enb_ue_find_by_enb_ue_s1ap_id(
         mme_enb_t *enb, uint32_t enb_ue_s1ap_id);
 enb_ue_t *enb_ue_find(uint32_t index);
@@ -2002,12 +2002,12 @@ void s1ap_handle_path_switch_request(
             ogs_plmn_id_hexdump(&mme_ue->e_cgi.plmn_id),
             mme_ue->e_cgi.cell_id);
 
-    /* Update ENB-UE-S1AP-ID */
-    enb_ue->enb_ue_s1ap_id = *ENB_UE_S1AP_ID;
-
     /* Change enb_ue to the NEW eNB */
     enb_ue_switch_to_enb(enb_ue, enb);
 
+    /* Update ENB-UE-S1AP-ID */
+    enb_ue_set_enb_ue_s1ap_id(enb_ue, *ENB_UE_S1AP_ID);
+
     ogs_info("    NEW ENB_UE_S1AP_ID[%d] MME_UE_S1AP_ID[%d]",
             enb_ue->enb_ue_s1ap_id, enb_ue->mme_ue_s1ap_id);
 
@@ -2542,7 +2542,7 @@ void s1ap_handle_handover_request_ack(
     ogs_debug("    Target : ENB_UE_S1AP_ID[%d] MME_UE_S1AP_ID[%d]",
             target_ue->enb_ue_s1ap_id, target_ue->mme_ue_s1ap_id);
 
-    target_ue->enb_ue_s1ap_id = *ENB_UE_S1AP_ID;
+    enb_ue_set_enb_ue_s1ap_id(target_ue, *ENB_UE_S1AP_ID);
 
     for (i = 0; i < E_RABAdmittedList->list.count; i++) {
         S1AP_E_RABAdmittedItemIEs_t *item = NULL;
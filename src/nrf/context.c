@@ -23,6 +23,8 @@ static nrf_context_t self;
 
 int __nrf_log_domain;
 
+static OGS_POOL(nrf_nf_index_pool, nrf_nf_index_t);
+
 static int context_initialized = 0;
 
 void nrf_context_init(void)
@@ -34,6 +36,11 @@ void nrf_context_init(void)
 
     ogs_log_install_domain(&__nrf_log_domain, "nrf", ogs_core()->log.level);
 
+    ogs_pool_init(&nrf_nf_index_pool, ogs_app()->pool.nf);
+
+    self.nf_index_hash = ogs_hash_make();
+    ogs_assert(self.nf_index_hash);
+
     context_initialized = 1;
 }
 
@@ -51,6 +58,13 @@ void nrf_context_final(void)
             nrf_nf_fsm_fini(nf_instance);
     }
 
+    nrf_nf_index_remove_all();
+
+    ogs_assert(self.nf_index_hash);
+    ogs_hash_destroy(self.nf_index_hash);
+
+    ogs_pool_final(&nrf_nf_index_pool);
+
     context_initialized = 0;
 }
 
@@ -121,3 +135,238 @@ int nrf_context_parse_config(void)
 
     return OGS_OK;
 }
+
+static void nf_index_profile_clear(nrf_nf_index_t *index)
+{
+    ogs_hash_index_t *hi = NULL;
+
+    ogs_assert(index);
+    ogs_assert(index->profile_hash);
+
+    for (hi = ogs_hash_first(index->profile_hash);
+            hi; hi = ogs_hash_next(hi)) {
+        char *key = (char *)ogs_hash_this_key(hi);
+        char *profile = ogs_hash_this_val(hi);
+
+        ogs_hash_set(index->profile_hash, key, strlen(key), NULL);
+
+        ogs_free(key);
+        cJSON_free(profile);
+    }
+
+    index->num_of_profile = 0;
+}
+
+/*
+ * Called whenever the NF Profile is changed by NFRegister or NFUpdate.
+ */
+nrf_nf_index_t *nrf_nf_index_update(ogs_sbi_nf_instance_t *nf_instance)
+{
+    nrf_nf_index_t *index = NULL;
+    ogs_sbi_nf_service_t *nf_service = NULL;
+    ogs_sbi_service_type_e service_type = OGS_SBI_SERVICE_TYPE_NULL;
+
+    ogs_assert(nf_instance);
+
+    index = nrf_nf_index_find(nf_instance);
+    if (!index) {
+        ogs_pool_alloc(&nrf_nf_index_pool, &index);
+        if (!index) {
+            ogs_error("Maximum number of NF index[%d] reached",
+                    (int)ogs_app()->pool.nf);
+            return NULL;
+        }
+        memset(index, 0, sizeof *index);
+
+        index->nf_instance = nf_instance;
+
+        index->profile_hash = ogs_hash_make();
+        ogs_assert(index->profile_hash);
+
+        ogs_hash_set(self.nf_index_hash,
+                &index->nf_instance, sizeof(index->nf_instance), index);
+    } else {
+        nf_index_profile_clear(index);
+    }
+
+    if (index->nf_type != nf_instance->nf_type) {
+        if (index->nf_type) {
+            ogs_list_remove(&self.nf_type_list[index->nf_type], index);
+            self.num_of_nf_type[index->nf_type]--;
+        }
+
+        index->nf_type = nf_instance->nf_type;
+        ogs_assert(index->nf_type < OGS_SBI_MAX_NUM_OF_NF_TYPE);
+
+        if (index->nf_type) {
+            ogs_list_add(&self.nf_type_list[index->nf_type], index);
+            self.num_of_nf_type[index->nf_type]++;
+        }
+    }
+
+    memset(index->service_type, 0, sizeof(index->service_type));
+    ogs_list_for_each(&nf_instance->nf_service_list, nf_service) {
+        if (!nf_service->name)
+            continue;
+
+        service_type = ogs_sbi_service_type_from_name(nf_service->name);
+        if (service_type)
+            index->service_type[service_type] = true;
+    }
+
+    return index;
+}
+
+void nrf_nf_index_remove(ogs_sbi_nf_instance_t *nf_instance)
+{
+    nrf_nf_index_t *index = NULL;
+
+    ogs_assert(nf_instance);
+
+    index = nrf_nf_index_find(nf_instance);
+    if (!index)
+        return;
+
+    if (index->nf_type) {
+        ogs_list_remove(&self.nf_type_list[index->nf_type], index);
+        self.num_of_nf_type[index->nf_type]--;
+    }
+
+    ogs_hash_set(self.nf_index_hash,
+            &index->nf_instance, sizeof(index->nf_instance), NULL);
+
+    nf_index_profile_clear(index);
+    ogs_hash_destroy(index->profile_hash);
+
+    ogs_pool_free(&nrf_nf_index_pool, index);
+}
+
+void nrf_nf_index_remove_all(void)
+{
+    ogs_hash_index_t *hi = NULL;
+
+    for (hi = ogs_hash_first(self.nf_index_hash);
+            hi; hi = ogs_hash_next(hi)) {
+        nrf_nf_index_t *index = ogs_hash_this_val(hi);
+        ogs_assert(index);
+
+        nrf_nf_index_remove(index->nf_instance);
+    }
+}
+
+nrf_nf_index_t *nrf_nf_index_find(ogs_sbi_nf_instance_t *nf_instance)
+{
+    ogs_assert(nf_instance);
+    return ogs_hash_get(self.nf_index_hash,
+            &nf_instance, sizeof(nf_instance));
+}
+
+/*
+ * Quick check before ogs_sbi_discovery_option_is_matched().
+ * It only tells if the NF Instance provides any of the service-names.
+ */
+bool nrf_nf_index_has_service(nrf_nf_index_t *index,
+        ogs_sbi_discovery_option_t *discovery_option)
+{
+    ogs_sbi_service_type_e service_type = OGS_SBI_SERVICE_TYPE_NULL;
+    int i;
+
+    ogs_assert(index);
+
+    if (!discovery_option || !discovery_option->num_of_service_names)
+        return true;
+
+    for (i = 0; i < discovery_option->num_of_service_names; i++) {
+        if (!discovery_option->service_names[i])
+            continue;
+
+        service_type = ogs_sbi_service_type_from_name(
+                discovery_option->service_names[i]);
+        if (!service_type)
+            return true; /* Unknown service. Leave it to the full match */
+
+        if (index->service_type[service_type] == true)
+            return true;
+    }
+
+    return false;
+}
+
+static int profile_service_name_compare(const void *a, const void *b)
+{
+    return strcmp(*(const char **)a, *(const char **)b);
+}
+
+/*
+ * Returns the NFProfile JSON of the NF Instance.
+ * It is rendered only once until the NF Profile is changed.
+ */
+const char *nrf_nf_index_profile(nrf_nf_index_t *index,
+        ogs_sbi_discovery_option_t *discovery_option, bool service_map)
+{
+#define MAX_NUM_OF_NF_INDEX_PROFILE 16
+    OpenAPI_nf_profile_t *NFProfile = NULL;
+    cJSON *item = NULL;
+    char *key = NULL, *profile = NULL;
+    const char *service_names[OGS_SBI_MAX_NUM_OF_SERVICE_TYPE];
+    int i, num_of_service_names = 0;
+
+    ogs_assert(index);
+    ogs_assert(index->nf_instance);
+
+    if (discovery_option) {
+        for (i = 0; i < discovery_option->num_of_service_names; i++) {
+            if (discovery_option->service_names[i])
+                service_names[num_of_service_names++] =
+                    discovery_option->service_names[i];
+        }
+    }
+    if (num_of_service_names > 1)
+        qsort(service_names, num_of_service_names,
+                sizeof(service_names[0]), profile_service_name_compare);
+
+    key = ogs_strdup(service_map == true ? "M:" : "L:");
+    ogs_assert(key);
+    for (i = 0; i < num_of_service_names; i++)
+        key = ogs_mstrcatf(key, "%s%s", i ? "," : "", service_names[i]);
+    ogs_assert(key);
+
+    profile = ogs_hash_get(index->profile_hash, key, strlen(key));
+    if (profile) {
+        ogs_free(key);
+        return profile;
+    }
+
+    NFProfile = ogs_nnrf_nfm_build_nf_profile(
+            index->nf_instance, NULL, discovery_option, service_map);
+    if (!NFProfile) {
+        ogs_error("ogs_nnrf_nfm_build_nf_profile() failed");
+        ogs_free(key);
+        return NULL;
+    }
+
+    item = OpenAPI_nf_profile_convertToJSON(NFProfile);
+    ogs_nnrf_nfm_free_nf_profile(NFProfile);
+    if (!item) {
+        ogs_error("OpenAPI_nf_profile_convertToJSON() failed");
+        ogs_free(key);
+        return NULL;
+    }
+
+    profile = cJSON_PrintUnformatted(item);
+    cJSON_Delete(item);
+    if (!profile) {
+        ogs_error("cJSON_PrintUnformatted() failed");
+        ogs_free(key);
+        return NULL;
+    }
+
+    /* Too many kinds of service-names. Start over */
+    if (index->num_of_profile >= MAX_NUM_OF_NF_INDEX_PROFILE)
+        nf_index_profile_clear(index);
+
+    ogs_hash_set(index->profile_hash, key, strlen(key), profile);
+    index->num_of_profile++;
+
+    return profile;
+}
@@ -36,15 +36,49 @@ extern int __nrf_log_domain;
 #define OGS_LOG_DOMAIN __nrf_log_domain
 
 typedef struct nrf_context_s {
-    int dummy;
+    /* NF Instances by NF type for NF-Discover */
+    ogs_list_t nf_type_list[OGS_SBI_MAX_NUM_OF_NF_TYPE];
+    int num_of_nf_type[OGS_SBI_MAX_NUM_OF_NF_TYPE];
+
+    ogs_hash_t *nf_index_hash;      /* hash table (NF Instance) */
 } nrf_context_t;
 
+typedef struct nrf_nf_index_s {
+    ogs_lnode_t lnode;
+
+    ogs_sbi_nf_instance_t *nf_instance;
+    OpenAPI_nf_type_e nf_type;
+
+    /* Services provided by the NF Instance */
+    bool service_type[OGS_SBI_MAX_NUM_OF_SERVICE_TYPE];
+
+    /*
+     * NFProfile JSON as sent in the SearchResult.
+     *
+     * The services in the NFProfile depend on the service-names
+     * and the service-map feature of the NF-Discover,
+     * so the key is made from them (e.g. "M:nsmf-pdusession").
+     */
+    ogs_hash_t *profile_hash;
+    int num_of_profile;
+} nrf_nf_index_t;
+
 void nrf_context_init(void);
 void nrf_context_final(void);
 nrf_context_t *nrf_self(void);
 
 int nrf_context_parse_config(void);
 
+nrf_nf_index_t *nrf_nf_index_update(ogs_sbi_nf_instance_t *nf_instance);
+void nrf_nf_index_remove(ogs_sbi_nf_instance_t *nf_instance);
+void nrf_nf_index_remove_all(void);
+
+nrf_nf_index_t *nrf_nf_index_find(ogs_sbi_nf_instance_t *nf_instance);
+bool nrf_nf_index_has_service(nrf_nf_index_t *index,
+        ogs_sbi_discovery_option_t *discovery_option);
+const char *nrf_nf_index_profile(nrf_nf_index_t *index,
+        ogs_sbi_discovery_option_t *discovery_option, bool service_map);
+
 #ifdef __cplusplus
 }
 #endif
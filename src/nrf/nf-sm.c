@@ -77,6 +77,8 @@ void nrf_nf_state_final(ogs_fsm_t *s, nrf_event_t *e)
     ogs_assert(nf_instance);
 
     ogs_timer_delete(nf_instance->t_no_heartbeat);
+
+    nrf_nf_index_remove(nf_instance);
 }
 
 void nrf_nf_state_will_register(ogs_fsm_t *s, nrf_event_t *e)
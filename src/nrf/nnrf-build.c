@@ -99,3 +99,120 @@ end:
 
     return request;
 }
+
+/*
+ * SearchResult of NF-Discover.
+ *
+ * Only the NF Instances of the target-nf-type are visited,
+ * and the SearchResult is made of the NFProfile JSON
+ * cached in each of them.
+ */
+char *nrf_nnrf_disc_build_search_result(ogs_sbi_message_t *recvmsg,
+        int validity_period, size_t *content_length)
+{
+    ogs_sbi_nf_instance_t *nf_instance = NULL;
+    ogs_sbi_discovery_option_t *discovery_option = NULL;
+    nrf_nf_index_t *index = NULL;
+    bool service_map = false;
+
+    const char **profile = NULL;
+    size_t *profile_length = NULL;
+    char *content = NULL, *p = NULL, *last = NULL;
+    size_t length;
+    int i, j;
+
+    ogs_assert(recvmsg);
+    ogs_assert(recvmsg->param.target_nf_type);
+    ogs_assert(recvmsg->param.requester_nf_type);
+    ogs_assert(content_length);
+
+    discovery_option = recvmsg->param.discovery_option;
+    if (discovery_option)
+        service_map = OGS_SBI_FEATURES_IS_SET(
+                discovery_option->requester_features,
+                OGS_SBI_NNRF_DISC_SERVICE_MAP) ? true : false;
+
+    ogs_assert(recvmsg->param.target_nf_type < OGS_SBI_MAX_NUM_OF_NF_TYPE);
+    i = nrf_self()->num_of_nf_type[recvmsg->param.target_nf_type];
+    if (i) {
+        profile = ogs_calloc(i, sizeof(*profile));
+        ogs_assert(profile);
+        profile_length = ogs_calloc(i, sizeof(*profile_length));
+        ogs_assert(profile_length);
+    }
+
+    i = 0;
+    ogs_list_for_each(
+            &nrf_self()->nf_type_list[recvmsg->param.target_nf_type], index) {
+        nf_instance = index->nf_instance;
+        ogs_assert(nf_instance);
+
+        if (NF_INSTANCE_EXCLUDED_FROM_DISCOVERY(nf_instance))
+            continue;
+
+        ogs_assert(nf_instance->nf_type == recvmsg->param.target_nf_type);
+
+        if (ogs_sbi_nf_instance_is_allowed_nf_type(
+                nf_instance, recvmsg->param.requester_nf_type) == false)
+            continue;
+
+        if (discovery_option &&
+            (nrf_nf_index_has_service(index, discovery_option) == false ||
+             ogs_sbi_discovery_option_is_matched(
+                nf_instance,
+                recvmsg->param.requester_nf_type,
+                discovery_option) == false))
+            continue;
+
+        if (recvmsg->param.limit && i >= recvmsg->param.limit)
+            break;
+
+        ogs_debug("[%s:%d] NF-Discovered [NF-Type:%s,NF-Status:%s,"
+                "IPv4:%d,IPv6:%d]", nf_instance->id, i,
+                OpenAPI_nf_type_ToString(nf_instance->nf_type),
+                OpenAPI_nf_status_ToString(nf_instance->nf_status),
+                nf_instance->num_of_ipv4, nf_instance->num_of_ipv6);
+
+        profile[i] = nrf_nf_index_profile(
+                index, discovery_option, service_map);
+        if (!profile[i]) {
+            ogs_error("[%s] nrf_nf_index_profile() failed", nf_instance->id);
+            continue;
+        }
+        profile_length[i] = strlen(profile[i]);
+
+        i++;
+    }
+
+#define SEARCH_RESULT_HEAD "{\"validityPeriod\":%d,\"nfInstances\":["
+#define SEARCH_RESULT_TAIL "]}"
+#define SEARCH_RESULT_TAIL_COMPLETE "],\"numNfInstComplete\":%d}"
+    length = sizeof(SEARCH_RESULT_HEAD) + 11 /* INT_MIN */ +
+        sizeof(SEARCH_RESULT_TAIL_COMPLETE) + 11 /* INT_MIN */;
+    for (j = 0; j < i; j++)
+        length += profile_length[j] + 1;
+
+    content = ogs_malloc(length);
+    ogs_assert(content);
+
+    p = content;
+    last = content + length;
+
+    p = ogs_slprintf(p, last, SEARCH_RESULT_HEAD, validity_period);
+    for (j = 0; j < i; j++) {
+        if (j) *p++ = ',';
+        memcpy(p, profile[j], profile_length[j]);
+        p += profile_length[j];
+    }
+    if (recvmsg->param.limit)
+        p = ogs_slprintf(p, last, SEARCH_RESULT_TAIL_COMPLETE, i);
+    else
+        p = ogs_slprintf(p, last, SEARCH_RESULT_TAIL);
+    ogs_assert(p < last);
+
+    if (profile) ogs_free(profile);
+    if (profile_length) ogs_free(profile_length);
+
+    *content_length = p - content;
+    return content;
+}
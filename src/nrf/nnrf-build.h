@@ -32,6 +32,9 @@ ogs_sbi_request_t *nrf_nnrf_nfm_build_nf_status_notify(
         OpenAPI_notification_event_type_e event,
         ogs_sbi_nf_instance_t *nf_instance);
 
+char *nrf_nnrf_disc_build_search_result(ogs_sbi_message_t *recvmsg,
+        int validity_period, size_t *content_length);
+
 #ifdef __cplusplus
 }
 #endif
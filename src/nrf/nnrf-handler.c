@@ -17,6 +17,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include "nnrf-build.h"
 #include "nnrf-handler.h"
 
 bool nrf_nnrf_handle_nf_register(ogs_sbi_nf_instance_t *nf_instance,
@@ -41,6 +42,7 @@ bool nrf_nnrf_handle_nf_register(ogs_sbi_nf_instance_t *nf_instance,
     }
 
     ogs_nnrf_nfm_handle_nf_profile(nf_instance, NFProfile);
+    nrf_nf_index_update(nf_instance);
 
     if (OGS_FSM_CHECK(&nf_instance->sm, nrf_nf_state_will_register)) {
         recvmsg->http.location = recvmsg->h.uri;
@@ -143,6 +145,11 @@ bool nrf_nnrf_handle_nf_update(ogs_sbi_nf_instance_t *nf_instance,
             }
         }
 
+        /*
+         * The patch items are not applied to the NF Instance,
+         * so the cached NF Profile is still valid.
+         */
+
         response = ogs_sbi_build_response(
                 recvmsg, OGS_SBI_HTTP_STATUS_NO_CONTENT);
         ogs_assert(response);
@@ -435,12 +442,11 @@ bool nrf_nnrf_handle_nf_discover(
 {
     ogs_sbi_message_t sendmsg;
     ogs_sbi_response_t *response = NULL;
-    ogs_sbi_nf_instance_t *nf_instance = NULL;
     ogs_sbi_discovery_option_t *discovery_option = NULL;
 
-    OpenAPI_search_result_t *SearchResult = NULL;
-    OpenAPI_nf_profile_t *NFProfile = NULL;
-    OpenAPI_lnode_t *node = NULL;
+    char *content = NULL;
+    size_t content_length;
+    int validity_period;
     int i;
 
     ogs_assert(stream);
@@ -465,16 +471,8 @@ bool nrf_nnrf_handle_nf_discover(
             OpenAPI_nf_type_ToString(recvmsg->param.requester_nf_type),
             OpenAPI_nf_type_ToString(recvmsg->param.target_nf_type));
 
-    SearchResult = ogs_calloc(1, sizeof(*SearchResult));
-    ogs_assert(SearchResult);
-
-    SearchResult->is_validity_period = true;
-    SearchResult->validity_period =
-        ogs_app()->time.nf_instance.validity_duration;
-    ogs_assert(SearchResult->validity_period);
-
-    SearchResult->nf_instances = OpenAPI_list_create();
-    ogs_assert(SearchResult->nf_instances);
+    validity_period = ogs_app()->time.nf_instance.validity_duration;
+    ogs_assert(validity_period);
 
     if (recvmsg->param.discovery_option)
         discovery_option = recvmsg->param.discovery_option;
@@ -499,66 +497,25 @@ bool nrf_nnrf_handle_nf_discover(
         }
     }
 
-    i = 0;
-    ogs_list_for_each(&ogs_sbi_self()->nf_instance_list, nf_instance) {
-        if (NF_INSTANCE_EXCLUDED_FROM_DISCOVERY(nf_instance))
-            continue;
-
-        if (nf_instance->nf_type != recvmsg->param.target_nf_type)
-            continue;
-
-        if (ogs_sbi_nf_instance_is_allowed_nf_type(
-                nf_instance, recvmsg->param.requester_nf_type) == false)
-            continue;
-
-        if (discovery_option &&
-            ogs_sbi_discovery_option_is_matched(
-                nf_instance,
-                recvmsg->param.requester_nf_type,
-                discovery_option) == false)
-            continue;
-
-        if (recvmsg->param.limit && i >= recvmsg->param.limit)
-            break;
-
-        ogs_debug("[%s:%d] NF-Discovered [NF-Type:%s,NF-Status:%s,"
-                "IPv4:%d,IPv6:%d]", nf_instance->id, i,
-                OpenAPI_nf_type_ToString(nf_instance->nf_type),
-                OpenAPI_nf_status_ToString(nf_instance->nf_status),
-                nf_instance->num_of_ipv4, nf_instance->num_of_ipv6);
-
-        NFProfile = ogs_nnrf_nfm_build_nf_profile(
-                nf_instance, NULL, discovery_option,
-                discovery_option &&
-                OGS_SBI_FEATURES_IS_SET(
-                    discovery_option->requester_features,
-                    OGS_SBI_NNRF_DISC_SERVICE_MAP) ? true : false);
-        OpenAPI_list_add(SearchResult->nf_instances, NFProfile);
-
-        i++;
-    }
-
-    if (recvmsg->param.limit) SearchResult->num_nf_inst_complete = i;
+    content = nrf_nnrf_disc_build_search_result(
+            recvmsg, validity_period, &content_length);
+    ogs_assert(content);
 
     memset(&sendmsg, 0, sizeof(sendmsg));
-    sendmsg.SearchResult = SearchResult;
-    sendmsg.http.cache_control =
-        ogs_msprintf("max-age=%d", SearchResult->validity_period);
+    sendmsg.http.cache_control = ogs_msprintf("max-age=%d", validity_period);
     ogs_assert(sendmsg.http.cache_control);
 
     response = ogs_sbi_build_response(&sendmsg, OGS_SBI_HTTP_STATUS_OK);
     ogs_assert(response);
-    ogs_assert(true == ogs_sbi_server_send_response(stream, response));
 
-    OpenAPI_list_for_each(SearchResult->nf_instances, node) {
-        NFProfile = node->data;
-        if (NFProfile) ogs_nnrf_nfm_free_nf_profile(NFProfile);
-    }
-    OpenAPI_list_free(SearchResult->nf_instances);
+    response->http.content = content;
+    response->http.content_length = content_length;
+    ogs_sbi_header_set(response->http.headers,
+            OGS_SBI_CONTENT_TYPE, OGS_SBI_CONTENT_JSON_TYPE);
+
+    ogs_assert(true == ogs_sbi_server_send_response(stream, response));
 
-    if (sendmsg.http.cache_control)
-        ogs_free(sendmsg.http.cache_control);
-    ogs_free(SearchResult);
+    ogs_free(sendmsg.http.cache_control);
 
     return true;
 }
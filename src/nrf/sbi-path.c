@@ -61,6 +61,9 @@ int nrf_sbi_open(void)
     /* Build NF instance information. */
     ogs_sbi_nf_instance_build_default(nf_instance);
 
+    /* NRF itself can be discovered */
+    nrf_nf_index_update(nf_instance);
+
     if (ogs_sbi_server_start_all(ogs_sbi_server_handler) != OGS_OK)
         return OGS_ERROR;
 
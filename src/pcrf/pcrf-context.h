@@ -41,8 +41,6 @@ typedef struct pcrf_context_s {
     const char          *diam_conf_path;  /* PCRF Diameter conf path */
     ogs_diam_config_t   *diam_config;     /* PCRF Diameter config */
 
-    ogs_thread_mutex_t  db_lock;
-
     ogs_hash_t          *ip_hash; /* hash table for Gx Frame IPv4/IPv6 */
     ogs_thread_mutex_t  hash_lock;
 } pcrf_context_t;
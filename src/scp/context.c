@@ -18,16 +18,19 @@
  */
 
 #include "context.h"
+#include "metrics.h"
 
 static scp_context_t self;
 
 int __scp_log_domain;
 
 static OGS_POOL(scp_assoc_pool, scp_assoc_t);
+static OGS_POOL(scp_discovery_pool, scp_discovery_t);
 
 static int context_initialized = 0;
 
 static int max_num_of_scp_assoc = 0;
+static int max_num_of_scp_discovery = 0;
 
 void scp_context_init(void)
 {
@@ -42,6 +45,11 @@ void scp_context_init(void)
     max_num_of_scp_assoc = ogs_app()->max.ue * MAX_NUM_OF_SCP_ASSOC;
 
     ogs_pool_init(&scp_assoc_pool, max_num_of_scp_assoc);
+    max_num_of_scp_discovery = ogs_app()->max.ue;
+    ogs_pool_init(&scp_discovery_pool, max_num_of_scp_discovery);
+
+    self.discovery_hash = ogs_hash_make();
+    ogs_assert(self.discovery_hash);
 
     context_initialized = 1;
 }
@@ -51,8 +59,13 @@ void scp_context_final(void)
     ogs_assert(context_initialized == 1);
 
     scp_assoc_remove_all();
+    scp_discovery_remove_all();
+
+    ogs_assert(self.discovery_hash);
+    ogs_hash_destroy(self.discovery_hash);
 
     ogs_pool_final(&scp_assoc_pool);
+    ogs_pool_final(&scp_discovery_pool);
 
     context_initialized = 0;
 }
@@ -100,6 +113,8 @@ int scp_context_parse_config(void)
                     /* handle config in sbi library */
                 } else if (!strcmp(scp_key, "discovery")) {
                     /* handle config in sbi library */
+                } else if (!strcmp(scp_key, "metrics")) {
+                    /* handle config in metrics library */
                 } else
                     ogs_warn("unknown key `%s`", scp_key);
             }
@@ -127,6 +142,7 @@ scp_assoc_t *scp_assoc_add(ogs_sbi_stream_t *stream)
     memset(assoc, 0, sizeof *assoc);
 
     assoc->stream = stream;
+    assoc->created = ogs_get_monotonic_time();
 
     ogs_list_add(&self.assoc_list, assoc);
 
@@ -159,3 +175,152 @@ scp_assoc_t *scp_assoc_find(uint32_t index)
 {
     return ogs_pool_find(&scp_assoc_pool, index);
 }
+
+static int discovery_service_name_compare(const void *a, const void *b)
+{
+    return strcmp(*(const char **)a, *(const char **)b);
+}
+
+char *scp_discovery_key(
+        OpenAPI_nf_type_e target_nf_type,
+        OpenAPI_nf_type_e requester_nf_type,
+        ogs_sbi_discovery_option_t *discovery_option)
+{
+    char *key = NULL;
+    const char *service_names[OGS_SBI_MAX_NUM_OF_SERVICE_TYPE];
+    int i, num_of_service_names = 0;
+
+    ogs_assert(target_nf_type);
+    ogs_assert(requester_nf_type);
+    ogs_assert(discovery_option);
+
+    key = ogs_msprintf("%s:%s:%s:%s:",
+            OpenAPI_nf_type_ToString(target_nf_type),
+            OpenAPI_nf_type_ToString(requester_nf_type),
+            discovery_option->target_nf_instance_id ?
+                discovery_option->target_nf_instance_id : "",
+            discovery_option->requester_nf_instance_id ?
+                discovery_option->requester_nf_instance_id : "");
+    ogs_assert(key);
+
+    /*
+     * The first service name is the one of the request,
+     * so only the rest of them are sorted.
+     */
+    for (i = 0; i < discovery_option->num_of_service_names; i++)
+        service_names[num_of_service_names++] =
+            discovery_option->service_names[i];
+    if (num_of_service_names > 2)
+        qsort(service_names + 1, num_of_service_names - 1,
+                sizeof(service_names[0]), discovery_service_name_compare);
+
+    for (i = 0; i < num_of_service_names; i++)
+        key = ogs_mstrcatf(key, "%s%s", i ? "," : "", service_names[i]);
+
+    key = ogs_mstrcatf(key, ":%llx",
+            (unsigned long long)discovery_option->requester_features);
+    ogs_assert(key);
+
+    return key;
+}
+
+scp_discovery_t *scp_discovery_add(char *key)
+{
+    scp_discovery_t *discovery = NULL, *iter = NULL;
+
+    ogs_assert(key);
+
+    ogs_pool_alloc(&scp_discovery_pool, &discovery);
+    if (!discovery) {
+        /* Evict the oldest one which is not in flight */
+        ogs_list_for_each(&self.discovery_list, iter) {
+            if (iter->in_flight == false) {
+                scp_discovery_remove(iter);
+                break;
+            }
+        }
+        ogs_pool_alloc(&scp_discovery_pool, &discovery);
+        if (!discovery) {
+            ogs_error("Maximum number of discovery[%d] reached",
+                        max_num_of_scp_discovery);
+            return NULL;
+        }
+    }
+    memset(discovery, 0, sizeof *discovery);
+
+    discovery->key = ogs_strdup(key);
+    ogs_assert(discovery->key);
+
+    ogs_hash_set(self.discovery_hash, discovery->key,
+            strlen(discovery->key), discovery);
+
+    ogs_list_add(&self.discovery_list, discovery);
+
+    scp_metrics_inst_global_inc(SCP_METR_GLOB_GAUGE_DISCOVERY_CACHE_ENTRY);
+
+    return discovery;
+}
+
+void scp_discovery_remove(scp_discovery_t *discovery)
+{
+    ogs_assert(discovery);
+    ogs_assert(discovery->key);
+
+    ogs_list_remove(&self.discovery_list, discovery);
+
+    if (discovery->stale == false)
+        ogs_hash_set(self.discovery_hash,
+                discovery->key, strlen(discovery->key), NULL);
+    ogs_free(discovery->key);
+
+    ogs_pool_free(&scp_discovery_pool, discovery);
+
+    scp_metrics_inst_global_dec(SCP_METR_GLOB_GAUGE_DISCOVERY_CACHE_ENTRY);
+}
+
+void scp_discovery_remove_all(void)
+{
+    scp_discovery_t *discovery = NULL, *next_discovery = NULL;
+
+    ogs_list_for_each_safe(&self.discovery_list, next_discovery, discovery)
+        scp_discovery_remove(discovery);
+}
+
+/*
+ * Called whenever the NRF notifies a change of an NF profile.
+ * A new NF-Discover for the same key is sent even if
+ * a stale one is still in flight.
+ */
+void scp_discovery_flush(void)
+{
+    scp_discovery_t *discovery = NULL, *next_discovery = NULL;
+
+    ogs_list_for_each_safe(&self.discovery_list, next_discovery, discovery) {
+        if (discovery->stale == true)
+            continue;
+
+        if (discovery->in_flight == true) {
+            ogs_hash_set(self.discovery_hash,
+                    discovery->key, strlen(discovery->key), NULL);
+            discovery->stale = true;
+        } else {
+            scp_discovery_remove(discovery);
+        }
+    }
+}
+
+scp_discovery_t *scp_discovery_find(const char *key)
+{
+    ogs_assert(key);
+    return ogs_hash_get(self.discovery_hash, key, strlen(key));
+}
+
+bool scp_discovery_valid(scp_discovery_t *discovery)
+{
+    ogs_assert(discovery);
+
+    if (discovery->in_flight == true || discovery->stale == true)
+        return false;
+
+    return ogs_get_monotonic_time() < discovery->expires;
+}
@@ -36,8 +36,33 @@ extern int __scp_log_domain;
 
 typedef struct scp_context_s {
     ogs_list_t          assoc_list;
+
+    ogs_list_t          discovery_list;
+    ogs_hash_t          *discovery_hash;    /* hash table (Discovery Key) */
 } scp_context_t;
 
+typedef struct scp_discovery_s {
+    ogs_lnode_t lnode;
+
+    /*
+     * Target NF type, Requester NF type and the Discovery Option
+     * with the service names normalized
+     * (e.g. "SMF:AMF::<requester-nf-instance-id>:nsmf-pdusession:0")
+     */
+    char *key;
+
+    /*
+     * While the NF-Discover is in flight, the associations
+     * with the same key wait for it instead of sending another one.
+     * If the cache is flushed in the meantime, the entry is only
+     * marked stale and is removed when the NRF answers.
+     */
+    bool in_flight;
+    bool stale;
+
+    ogs_time_t expires;     /* SearchResult's validityPeriod */
+} scp_discovery_t;
+
 typedef struct scp_assoc_s scp_assoc_t;
 
 typedef struct scp_assoc_s {
@@ -53,6 +78,9 @@ typedef struct scp_assoc_s {
     OpenAPI_nf_type_e requester_nf_type;
 
     ogs_sbi_nf_instance_t *nf_service_producer;
+
+    scp_discovery_t *discovery;     /* Waiting for the NF-Discover */
+    ogs_time_t created;             /* To measure the proxy latency */
 } scp_assoc_t;
 
 void scp_context_init(void);
@@ -67,6 +95,18 @@ void scp_assoc_remove_all(void);
 
 scp_assoc_t *scp_assoc_find(uint32_t index);
 
+char *scp_discovery_key(
+        OpenAPI_nf_type_e target_nf_type,
+        OpenAPI_nf_type_e requester_nf_type,
+        ogs_sbi_discovery_option_t *discovery_option);
+scp_discovery_t *scp_discovery_add(char *key);
+void scp_discovery_remove(scp_discovery_t *discovery);
+void scp_discovery_remove_all(void);
+void scp_discovery_flush(void);
+
+scp_discovery_t *scp_discovery_find(const char *key);
+bool scp_discovery_valid(scp_discovery_t *discovery);
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,6 +19,7 @@
 
 #include "context.h"
 #include "sbi-path.h"
+#include "metrics.h"
 
 static ogs_thread_t *thread;
 static void scp_main(void *data);
@@ -29,12 +30,17 @@ int scp_initialize()
 {
     int rv;
 
+    scp_metrics_init();
+
     ogs_sbi_context_init(OpenAPI_nf_type_SCP);
     scp_context_init();
 
     rv = ogs_sbi_context_parse_config("scp", "nrf", "next_scp");
     if (rv != OGS_OK) return rv;
 
+    rv = ogs_metrics_context_parse_config("scp");
+    if (rv != OGS_OK) return rv;
+
     rv = scp_context_parse_config();
     if (rv != OGS_OK) return rv;
 
@@ -42,6 +48,8 @@ int scp_initialize()
             ogs_app()->logger.domain, ogs_app()->logger.level);
     if (rv != OGS_OK) return rv;
 
+    ogs_metrics_context_open(ogs_metrics_self());
+
     rv = scp_sbi_open();
     if (rv != 0) return OGS_ERROR;
 
@@ -85,8 +93,12 @@ void scp_terminate(void)
 
     scp_sbi_close();
 
+    ogs_metrics_context_close(ogs_metrics_self());
+
     scp_context_final();
     ogs_sbi_context_final();
+
+    scp_metrics_final();
 }
 
 static void scp_main(void *data)
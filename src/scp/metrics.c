@@ -0,0 +1,161 @@
+#include "ogs-app.h"
+#include "context.h"
+
+#include "metrics.h"
+
+typedef struct scp_metrics_spec_def_s {
+    unsigned int type;
+    const char *name;
+    const char *description;
+    int initial_val;
+    unsigned int num_labels;
+    const char **labels;
+} scp_metrics_spec_def_t;
+
+/* Helper generic functions: */
+static int scp_metrics_init_inst(ogs_metrics_inst_t **inst,
+        ogs_metrics_spec_t **specs, unsigned int len,
+        unsigned int num_labels, const char **labels)
+{
+    unsigned int i;
+    for (i = 0; i < len; i++)
+        inst[i] = ogs_metrics_inst_new(specs[i], num_labels, labels);
+    return OGS_OK;
+}
+
+static int scp_metrics_free_inst(ogs_metrics_inst_t **inst,
+        unsigned int len)
+{
+    unsigned int i;
+    for (i = 0; i < len; i++)
+        ogs_metrics_inst_free(inst[i]);
+    memset(inst, 0, sizeof(inst[0]) * len);
+    return OGS_OK;
+}
+
+static int scp_metrics_init_spec(ogs_metrics_context_t *ctx,
+        ogs_metrics_spec_t **dst, scp_metrics_spec_def_t *src, unsigned int len)
+{
+    unsigned int i;
+    for (i = 0; i < len; i++) {
+        dst[i] = ogs_metrics_spec_new(ctx, src[i].type,
+                src[i].name, src[i].description,
+                src[i].initial_val, src[i].num_labels, src[i].labels);
+    }
+    return OGS_OK;
+}
+
+/* GLOBAL */
+ogs_metrics_spec_t *scp_metrics_spec_global[_SCP_METR_GLOB_MAX];
+ogs_metrics_inst_t *scp_metrics_inst_global[_SCP_METR_GLOB_MAX];
+scp_metrics_spec_def_t scp_metrics_spec_def_global[_SCP_METR_GLOB_MAX] = {
+/* Global Counters: */
+[SCP_METR_GLOB_CTR_DISCOVERY_CACHE_HIT] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "scp_discovery_cache_hit",
+    .description = "Delegated discoveries served from the cache",
+},
+[SCP_METR_GLOB_CTR_DISCOVERY_CACHE_MISS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "scp_discovery_cache_miss",
+    .description = "Delegated discoveries sent to the NRF",
+},
+[SCP_METR_GLOB_CTR_DISCOVERY_CACHE_WAIT] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "scp_discovery_cache_wait",
+    .description = "Delegated discoveries waiting for the same NRF query",
+},
+[SCP_METR_GLOB_CTR_PROXY_LATENCY_COUNT] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "scp_proxy_latency_seconds_count",
+    .description = "Proxied requests answered by the producer",
+},
+/* Global Gauges: */
+[SCP_METR_GLOB_GAUGE_DISCOVERY_CACHE_ENTRY] = {
+    .type = OGS_METRICS_METRIC_TYPE_GAUGE,
+    .name = "scp_discovery_cache_entry",
+    .description = "Entries in the discovery cache",
+},
+};
+int scp_metrics_init_inst_global(void)
+{
+    return scp_metrics_init_inst(scp_metrics_inst_global,
+            scp_metrics_spec_global, _SCP_METR_GLOB_MAX, 0, NULL);
+}
+int scp_metrics_free_inst_global(void)
+{
+    return scp_metrics_free_inst(scp_metrics_inst_global, _SCP_METR_GLOB_MAX);
+}
+
+/* PROXY LATENCY */
+static const char *labels_le[] = {
+    "le"
+};
+static const struct {
+    ogs_time_t usec;
+    const char *le;
+} proxy_latency_bucket[] = {
+    { 1000, "0.001" },
+    { 2500, "0.0025" },
+    { 5000, "0.005" },
+    { 10000, "0.01" },
+    { 25000, "0.025" },
+    { 50000, "0.05" },
+    { 100000, "0.1" },
+    { 250000, "0.25" },
+    { 500000, "0.5" },
+    { 1000000, "1" },
+    { 0, "+Inf" },
+};
+#define NUM_OF_PROXY_LATENCY_BUCKET OGS_ARRAY_SIZE(proxy_latency_bucket)
+
+static ogs_metrics_spec_t *scp_metrics_spec_proxy_latency;
+static ogs_metrics_inst_t *scp_metrics_inst_proxy_latency[
+    NUM_OF_PROXY_LATENCY_BUCKET];
+
+static void scp_metrics_init_proxy_latency(ogs_metrics_context_t *ctx)
+{
+    unsigned int i;
+
+    scp_metrics_spec_proxy_latency = ogs_metrics_spec_new(ctx,
+            OGS_METRICS_METRIC_TYPE_COUNTER,
+            "scp_proxy_latency_seconds_bucket",
+            "Time from the consumer request to the producer response",
+            0, OGS_ARRAY_SIZE(labels_le), labels_le);
+
+    for (i = 0; i < NUM_OF_PROXY_LATENCY_BUCKET; i++)
+        scp_metrics_inst_proxy_latency[i] = ogs_metrics_inst_new(
+                scp_metrics_spec_proxy_latency,
+                OGS_ARRAY_SIZE(labels_le),
+                (const char *[]){ proxy_latency_bucket[i].le });
+}
+
+void scp_metrics_proxy_latency_observe(ogs_time_t latency)
+{
+    unsigned int i;
+
+    for (i = 0; i < NUM_OF_PROXY_LATENCY_BUCKET; i++) {
+        if (proxy_latency_bucket[i].usec == 0 ||
+            latency <= proxy_latency_bucket[i].usec)
+            ogs_metrics_inst_inc(scp_metrics_inst_proxy_latency[i]);
+    }
+
+    scp_metrics_inst_global_inc(SCP_METR_GLOB_CTR_PROXY_LATENCY_COUNT);
+}
+
+void scp_metrics_init(void)
+{
+    ogs_metrics_context_t *ctx = ogs_metrics_self();
+    ogs_metrics_context_init();
+
+    scp_metrics_init_spec(ctx, scp_metrics_spec_global,
+            scp_metrics_spec_def_global, _SCP_METR_GLOB_MAX);
+
+    scp_metrics_init_inst_global();
+    scp_metrics_init_proxy_latency(ctx);
+}
+
+void scp_metrics_final(void)
+{
+    ogs_metrics_context_final();
+}
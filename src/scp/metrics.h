@@ -0,0 +1,43 @@
+#ifndef SCP_METRICS_H
+#define SCP_METRICS_H
+
+#include "ogs-metrics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* GLOBAL */
+typedef enum scp_metric_type_global_s {
+    SCP_METR_GLOB_CTR_DISCOVERY_CACHE_HIT = 0,
+    SCP_METR_GLOB_CTR_DISCOVERY_CACHE_MISS,
+    SCP_METR_GLOB_CTR_DISCOVERY_CACHE_WAIT,
+    SCP_METR_GLOB_CTR_PROXY_LATENCY_COUNT,
+    SCP_METR_GLOB_GAUGE_DISCOVERY_CACHE_ENTRY,
+    _SCP_METR_GLOB_MAX,
+} scp_metric_type_global_t;
+extern ogs_metrics_inst_t *scp_metrics_inst_global[_SCP_METR_GLOB_MAX];
+
+int scp_metrics_init_inst_global(void);
+int scp_metrics_free_inst_global(void);
+
+static inline void scp_metrics_inst_global_set(scp_metric_type_global_t t, int val)
+{ ogs_metrics_inst_set(scp_metrics_inst_global[t], val); }
+static inline void scp_metrics_inst_global_add(scp_metric_type_global_t t, int val)
+{ ogs_metrics_inst_add(scp_metrics_inst_global[t], val); }
+static inline void scp_metrics_inst_global_inc(scp_metric_type_global_t t)
+{ ogs_metrics_inst_inc(scp_metrics_inst_global[t]); }
+static inline void scp_metrics_inst_global_dec(scp_metric_type_global_t t)
+{ ogs_metrics_inst_dec(scp_metrics_inst_global[t]); }
+
+/* PROXY LATENCY : Cumulative buckets labeled by upper bound ("le") */
+void scp_metrics_proxy_latency_observe(ogs_time_t latency);
+
+void scp_metrics_init(void);
+void scp_metrics_final(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCP_METRICS_H */
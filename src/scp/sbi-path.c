@@ -18,6 +18,7 @@
  */
 
 #include "sbi-path.h"
+#include "metrics.h"
 
 static int request_handler(ogs_sbi_request_t *request, void *data);
 static int response_handler(
@@ -25,6 +26,7 @@ static int response_handler(
 static int discover_handler(
         int status, ogs_sbi_response_t *response, void *data);
 
+static char *send_discovered_request(scp_assoc_t *assoc);
 static void copy_request(
         ogs_sbi_request_t *target, ogs_sbi_request_t *source,
         bool include_discovery);
@@ -361,6 +363,8 @@ static int request_handler(ogs_sbi_request_t *request, void *data)
      *******************************/
     if (discovery_presence == true) {
         ogs_sbi_request_t *nrf_request = NULL;
+        scp_discovery_t *discovery = NULL;
+        char *discovery_key = NULL, *strerror = NULL;
 
         assoc = scp_assoc_add(stream);
         if (!assoc) {
@@ -369,6 +373,50 @@ static int request_handler(ogs_sbi_request_t *request, void *data)
             return OGS_ERROR;
         }
 
+        /* Store request and service-type in association context */
+        assoc->request = request;
+        ogs_assert(assoc->request);
+        assoc->service_type = service_type;
+        ogs_assert(assoc->service_type);
+        assoc->requester_nf_type = requester_nf_type;
+        ogs_assert(assoc->requester_nf_type);
+
+        ogs_assert(target_nf_type);
+        ogs_assert(discovery_option);
+
+        discovery_key = scp_discovery_key(
+                target_nf_type, requester_nf_type, discovery_option);
+        ogs_assert(discovery_key);
+
+        discovery = scp_discovery_find(discovery_key);
+        if (discovery && discovery->in_flight == true) {
+            /* Wait for the same NF-Discover already sent to the NRF */
+            assoc->discovery = discovery;
+            scp_metrics_inst_global_inc(SCP_METR_GLOB_CTR_DISCOVERY_CACHE_WAIT);
+
+            ogs_free(discovery_key);
+            ogs_sbi_discovery_option_free(discovery_option);
+
+            return OGS_OK;
+        }
+
+        if (discovery && scp_discovery_valid(discovery) == true) {
+            strerror = send_discovered_request(assoc);
+            if (!strerror) {
+                scp_metrics_inst_global_inc(
+                        SCP_METR_GLOB_CTR_DISCOVERY_CACHE_HIT);
+
+                ogs_free(discovery_key);
+                ogs_sbi_discovery_option_free(discovery_option);
+
+                return OGS_OK;
+            }
+
+            /* NF Instance has gone. Discover it again */
+            ogs_debug("[%s] %s", discovery_key, strerror);
+            ogs_free(strerror);
+        }
+
         if (headers.nrf_uri) {
             char *key = NULL;
             char *nnrf_disc = NULL;
@@ -427,6 +475,7 @@ static int request_handler(ogs_sbi_request_t *request, void *data)
                 if (rc == false || scheme == OpenAPI_uri_scheme_NULL) {
                     ogs_error("Invalid nnrf-disc [%s]", nnrf_disc);
 
+                    ogs_free(discovery_key);
                     ogs_sbi_discovery_option_free(discovery_option);
                     scp_assoc_remove(assoc);
 
@@ -452,6 +501,7 @@ static int request_handler(ogs_sbi_request_t *request, void *data)
             if (!nrf_client) {
                 ogs_error("No NRF");
 
+                ogs_free(discovery_key);
                 ogs_sbi_discovery_option_free(discovery_option);
                 scp_assoc_remove(assoc);
 
@@ -459,32 +509,41 @@ static int request_handler(ogs_sbi_request_t *request, void *data)
             }
         }
 
-        /* Store request and service-type in association context */
-        assoc->request = request;
-        ogs_assert(assoc->request);
-        assoc->service_type = service_type;
-        ogs_assert(assoc->service_type);
-        assoc->requester_nf_type = requester_nf_type;
-        ogs_assert(assoc->requester_nf_type);
+        if (!discovery) {
+            discovery = scp_discovery_add(discovery_key);
+            if (!discovery) {
+                ogs_error("scp_discovery_add() failed");
 
-        ogs_assert(target_nf_type);
-        ogs_assert(discovery_option);
+                ogs_free(discovery_key);
+                ogs_sbi_discovery_option_free(discovery_option);
+                scp_assoc_remove(assoc);
+
+                return OGS_ERROR;
+            }
+        }
+        ogs_free(discovery_key);
 
         nrf_request = ogs_nnrf_disc_build_discover(
                     target_nf_type, requester_nf_type, discovery_option);
         if (!nrf_request) {
             ogs_error("ogs_nnrf_disc_build_discover() failed");
 
+            scp_discovery_remove(discovery);
             ogs_sbi_discovery_option_free(discovery_option);
             scp_assoc_remove(assoc);
 
             return OGS_ERROR;
         }
 
+        discovery->in_flight = true;
+        discovery->expires = 0;
+        assoc->discovery = discovery;
+
         if (false == ogs_sbi_client_send_request(
-                    nrf_client, discover_handler, nrf_request, assoc)) {
+                    nrf_client, discover_handler, nrf_request, discovery)) {
             ogs_error("ogs_sbi_client_send_request() failed");
 
+            scp_discovery_remove(discovery);
             scp_assoc_remove(assoc);
 
             ogs_sbi_request_free(nrf_request);
@@ -493,6 +552,8 @@ static int request_handler(ogs_sbi_request_t *request, void *data)
             return OGS_ERROR;
         }
 
+        scp_metrics_inst_global_inc(SCP_METR_GLOB_CTR_DISCOVERY_CACHE_MISS);
+
         ogs_sbi_request_free(nrf_request);
         ogs_sbi_discovery_option_free(discovery_option);
 
@@ -552,6 +613,9 @@ static int response_handler(
 
     ogs_assert(response);
 
+    scp_metrics_proxy_latency_observe(
+            ogs_get_monotonic_time() - assoc->created);
+
     if (assoc->nf_service_producer) {
         if (assoc->nf_service_producer->id)
             ogs_sbi_header_set(response->http.headers,
@@ -573,27 +637,12 @@ static int discover_handler(
     char *strerror = NULL;
     ogs_sbi_message_t message;
 
-    scp_assoc_t *assoc = data;
-    ogs_sbi_stream_t *stream = NULL;
-    ogs_sbi_request_t *request = NULL;
-    ogs_sbi_service_type_e service_type = OGS_SBI_SERVICE_TYPE_NULL;
-    OpenAPI_nf_type_e requester_nf_type = OpenAPI_nf_type_NULL;
-
-    ogs_sbi_request_t scp_request;
-    char *apiroot = NULL;
+    scp_discovery_t *discovery = data;
+    scp_assoc_t *assoc = NULL, *next_assoc = NULL;
 
-    ogs_sbi_nf_instance_t *nf_instance = NULL;
-    ogs_sbi_client_t *client = NULL, *next_scp = NULL;
-
-    ogs_assert(assoc);
-    stream = assoc->stream;
-    ogs_assert(stream);
-    request = assoc->request;
-    ogs_assert(request);
-    service_type = assoc->service_type;
-    ogs_assert(service_type);
-    requester_nf_type = assoc->requester_nf_type;
-    ogs_assert(requester_nf_type);
+    ogs_assert(discovery);
+    ogs_assert(discovery->in_flight == true);
+    discovery->in_flight = false;
 
     if (status != OGS_OK) {
 
@@ -601,12 +650,20 @@ static int discover_handler(
                 status == OGS_DONE ? OGS_LOG_DEBUG : OGS_LOG_WARN, 0,
                 "response_handler() failed [%d]", status);
 
-        ogs_assert(true ==
-            ogs_sbi_server_send_error(stream,
-                OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR, NULL,
-                "response_handler() failed", NULL));
+        ogs_list_for_each_safe(&scp_self()->assoc_list, next_assoc, assoc) {
+            if (assoc->discovery != discovery)
+                continue;
 
-        scp_assoc_remove(assoc);
+            ogs_assert(assoc->stream);
+            ogs_assert(true ==
+                ogs_sbi_server_send_error(assoc->stream,
+                    OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR, NULL,
+                    "response_handler() failed", NULL));
+
+            scp_assoc_remove(assoc);
+        }
+
+        scp_discovery_remove(discovery);
 
         return OGS_ERROR;
     }
@@ -631,25 +688,112 @@ static int discover_handler(
 
     ogs_nnrf_disc_handle_nf_discover_search_result(message.SearchResult);
 
+    /*
+     * The NRF sends the same value in 'Cache-Control: max-age',
+     * which is not kept in the response of the SBI client.
+     */
+    if (message.SearchResult->is_validity_period &&
+        message.SearchResult->validity_period)
+        discovery->expires = ogs_get_monotonic_time() +
+            ogs_time_from_sec(message.SearchResult->validity_period);
+
+    /* Forward all the requests waiting for this NF-Discover */
+    ogs_list_for_each_safe(&scp_self()->assoc_list, next_assoc, assoc) {
+        char *cause = NULL;
+
+        if (assoc->discovery != discovery)
+            continue;
+
+        assoc->discovery = NULL;
+
+        cause = send_discovered_request(assoc);
+        if (cause) {
+            ogs_error("%s", cause);
+
+            ogs_assert(assoc->stream);
+            ogs_assert(true ==
+                ogs_sbi_server_send_error(assoc->stream,
+                    OGS_SBI_HTTP_STATUS_BAD_REQUEST, NULL, cause, NULL));
+
+            ogs_free(cause);
+
+            scp_assoc_remove(assoc);
+        }
+    }
+
+    if (discovery->stale == true || !discovery->expires)
+        scp_discovery_remove(discovery);
+
+    ogs_sbi_response_free(response);
+    ogs_sbi_message_free(&message);
+
+    return OGS_OK;
+
+cleanup:
+    ogs_assert(strerror);
+    ogs_error("%s", strerror);
+
+    ogs_list_for_each_safe(&scp_self()->assoc_list, next_assoc, assoc) {
+        if (assoc->discovery != discovery)
+            continue;
+
+        ogs_assert(assoc->stream);
+        ogs_assert(true ==
+            ogs_sbi_server_send_error(assoc->stream,
+                OGS_SBI_HTTP_STATUS_BAD_REQUEST, NULL, strerror, NULL));
+
+        scp_assoc_remove(assoc);
+    }
+
+    ogs_free(strerror);
+
+    scp_discovery_remove(discovery);
+
+    ogs_sbi_response_free(response);
+    ogs_sbi_message_free(&message);
+
+    return OGS_ERROR;
+}
+
+/*
+ * Forward the request of the association to the NF Instance
+ * selected among the NF Profiles discovered so far.
+ *
+ * If it fails, nothing is sent and the cause is returned.
+ */
+static char *send_discovered_request(scp_assoc_t *assoc)
+{
+    ogs_sbi_request_t *request = NULL;
+    ogs_sbi_service_type_e service_type = OGS_SBI_SERVICE_TYPE_NULL;
+    OpenAPI_nf_type_e requester_nf_type = OpenAPI_nf_type_NULL;
+
+    ogs_sbi_request_t scp_request;
+    char *apiroot = NULL;
+
+    ogs_sbi_nf_instance_t *nf_instance = NULL;
+    ogs_sbi_client_t *client = NULL, *next_scp = NULL;
+
+    ogs_assert(assoc);
+    request = assoc->request;
+    ogs_assert(request);
+    service_type = assoc->service_type;
+    ogs_assert(service_type);
+    requester_nf_type = assoc->requester_nf_type;
+    ogs_assert(requester_nf_type);
+
     nf_instance = ogs_sbi_nf_instance_find_by_service_type(
                     service_type, requester_nf_type);
-    if (!nf_instance) {
-        strerror = ogs_msprintf("(NF discover) No NF-Instance [%s:%s]",
+    if (!nf_instance)
+        return ogs_msprintf("(NF discover) No NF-Instance [%s:%s]",
                     ogs_sbi_service_type_to_name(service_type),
                     OpenAPI_nf_type_ToString(requester_nf_type));
 
-        goto cleanup;
-    }
-
     client = ogs_sbi_client_find_by_service_type(nf_instance, service_type);
-    if (!client) {
-        strerror = ogs_msprintf("(NF discover) No client [%s:%s]",
+    if (!client)
+        return ogs_msprintf("(NF discover) No client [%s:%s]",
                     ogs_sbi_service_type_to_name(service_type),
                     OpenAPI_nf_type_ToString(requester_nf_type));
 
-        goto cleanup;
-    }
-
     /* Copy Request for sending SCP */
     copy_request(&scp_request, request, false);
     ogs_assert(scp_request.http.headers);
@@ -687,38 +831,17 @@ static int discover_handler(
     if (ogs_sbi_client_send_request(
                 client, response_handler, &scp_request, assoc) != true) {
         ogs_error("ogs_sbi_client_send_request() failed");
-        strerror = ogs_msprintf("ogs_sbi_client_send_request() failed");
 
         ogs_sbi_http_hash_free(scp_request.http.headers);
         ogs_free(scp_request.h.uri);
 
-        goto cleanup;
+        return ogs_msprintf("ogs_sbi_client_send_request() failed");
     }
 
     ogs_sbi_http_hash_free(scp_request.http.headers);
     ogs_free(scp_request.h.uri);
 
-    ogs_sbi_response_free(response);
-    ogs_sbi_message_free(&message);
-
-    return OGS_OK;
-
-cleanup:
-    ogs_assert(strerror);
-    ogs_error("%s", strerror);
-
-    ogs_assert(true ==
-        ogs_sbi_server_send_error(
-            stream, OGS_SBI_HTTP_STATUS_BAD_REQUEST, NULL, strerror, NULL));
-
-    ogs_free(strerror);
-
-    scp_assoc_remove(assoc);
-
-    ogs_sbi_response_free(response);
-    ogs_sbi_message_free(&message);
-
-    return OGS_ERROR;
+    return NULL;
 }
 
 static void copy_request(
@@ -94,6 +94,9 @@ void scp_state_operational(ogs_fsm_t *s, scp_event_t *e)
                 SWITCH(message.h.method)
                 CASE(OGS_SBI_HTTP_METHOD_POST)
                     ogs_nnrf_nfm_handle_nf_status_notify(stream, &message);
+
+                    /* Discover again with the new NF Profiles */
+                    scp_discovery_flush();
                     break;
 
                 DEFAULT
@@ -45,10 +45,10 @@ void sgwc_context_init(void)
 
     ogs_log_install_domain(&__sgwc_log_domain, "sgwc", ogs_core()->log.level);
 
-    ogs_pool_init(&sgwc_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&sgwc_sess_pool, ogs_app()->pool.sess);
-    ogs_pool_init(&sgwc_bearer_pool, ogs_app()->pool.bearer);
-    ogs_pool_init(&sgwc_tunnel_pool, ogs_app()->pool.tunnel);
+    ogs_pool_elastic_init(&sgwc_ue_pool, ogs_app()->max.ue);
+    ogs_pool_elastic_init(&sgwc_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_elastic_init(&sgwc_bearer_pool, ogs_app()->pool.bearer);
+    ogs_pool_elastic_init(&sgwc_tunnel_pool, ogs_app()->pool.tunnel);
 
     self.imsi_ue_hash = ogs_hash_make();
     ogs_assert(self.imsi_ue_hash);
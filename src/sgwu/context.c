@@ -42,9 +42,9 @@ void sgwu_context_init(void)
     ogs_pfcp_self()->up_function_features_len = 2;
 
     ogs_list_init(&self.sess_list);
-    ogs_pool_init(&sgwu_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_elastic_init(&sgwu_sess_pool, ogs_app()->pool.sess);
 
-    self.seid_hash = ogs_hash_make();
+    self.seid_hash = ogs_ihash_make();
     ogs_assert(self.seid_hash);
     self.f_seid_hash = ogs_hash_make();
     ogs_assert(self.f_seid_hash);
@@ -59,7 +59,7 @@ void sgwu_context_final(void)
     sgwu_sess_remove_all();
 
     ogs_assert(self.seid_hash);
-    ogs_hash_destroy(self.seid_hash);
+    ogs_ihash_destroy(self.seid_hash);
     ogs_assert(self.f_seid_hash);
     ogs_hash_destroy(self.f_seid_hash);
 
@@ -151,8 +151,7 @@ sgwu_sess_t *sgwu_sess_add(ogs_pfcp_f_seid_t *cp_f_seid)
 
     ogs_hash_set(self.f_seid_hash, &sess->sgwc_sxa_f_seid,
             sizeof(sess->sgwc_sxa_f_seid), sess);
-    ogs_hash_set(self.seid_hash, &sess->sgwc_sxa_f_seid.seid,
-            sizeof(sess->sgwc_sxa_f_seid.seid), sess);
+    ogs_ihash_set(self.seid_hash, sess->sgwc_sxa_f_seid.seid, sess);
 
     ogs_info("UE F-SEID[UP:0x%lx CP:0x%lx]",
         (long)sess->sgwu_sxa_seid, (long)sess->sgwc_sxa_f_seid.seid);
@@ -172,8 +171,7 @@ int sgwu_sess_remove(sgwu_sess_t *sess)
     ogs_list_remove(&self.sess_list, sess);
     ogs_pfcp_sess_clear(&sess->pfcp);
 
-    ogs_hash_set(self.seid_hash, &sess->sgwc_sxa_f_seid.seid,
-            sizeof(sess->sgwc_sxa_f_seid.seid), NULL);
+    ogs_ihash_set(self.seid_hash, sess->sgwc_sxa_f_seid.seid, NULL);
     ogs_hash_set(self.f_seid_hash, &sess->sgwc_sxa_f_seid,
             sizeof(sess->sgwc_sxa_f_seid), NULL);
 
@@ -203,7 +201,7 @@ sgwu_sess_t *sgwu_sess_find(uint32_t index)
 
 sgwu_sess_t *sgwu_sess_find_by_sgwc_sxa_seid(uint64_t seid)
 {
-    return (sgwu_sess_t *)ogs_hash_get(self.seid_hash, &seid, sizeof(seid));
+    return (sgwu_sess_t *)ogs_ihash_get(self.seid_hash, seid);
 }
 
 sgwu_sess_t *sgwu_sess_find_by_sgwc_sxa_f_seid(ogs_pfcp_f_seid_t *f_seid)
@@ -37,7 +37,7 @@ extern int __sgwu_log_domain;
 #define OGS_LOG_DOMAIN __sgwu_log_domain
 
 typedef struct sgwu_context_s {
-    ogs_hash_t      *seid_hash;     /* hash table (SEID) */
+    ogs_ihash_t     *seid_hash;     /* hash table (SEID) */
     ogs_hash_t      *f_seid_hash;   /* hash table (F-SEID) */
 
     ogs_list_t      sess_list;
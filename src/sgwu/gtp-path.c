@@ -237,6 +237,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
         ogs_assert(pdr);
         ogs_assert(true == ogs_pfcp_up_handle_pdr(
                                 pdr, gtp_h->type, pkbuf, &report));
+        pkbuf = NULL;
 
         if (report.type.downlink_data_report) {
             ogs_assert(pdr->sess);
@@ -256,7 +257,8 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     }
 
 cleanup:
-    ogs_pkbuf_free(pkbuf);
+    if (pkbuf)
+        ogs_pkbuf_free(pkbuf);
 }
 
 int sgwu_gtp_init(void)
@@ -265,6 +267,7 @@ int sgwu_gtp_init(void)
     memset(&config, 0, sizeof config);
 
     config.cluster_2048_pool = ogs_app()->pool.packet;
+    config.hugepage = ogs_app()->pool.defconfig.hugepage;
 
 #if OGS_USE_TALLOC
     /* allocate a talloc pool for GTP to ensure it doesn't have to go back
@@ -81,11 +81,11 @@ void smf_context_init(void)
     ogs_log_install_domain(&__gsm_log_domain, "gsm", ogs_core()->log.level);
 
     ogs_pool_init(&smf_gtp_node_pool, ogs_app()->pool.nf);
-    ogs_pool_init(&smf_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&smf_sess_pool, ogs_app()->pool.sess);
-    ogs_pool_init(&smf_bearer_pool, ogs_app()->pool.bearer);
+    ogs_pool_elastic_init(&smf_ue_pool, ogs_app()->max.ue);
+    ogs_pool_elastic_init(&smf_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_elastic_init(&smf_bearer_pool, ogs_app()->pool.bearer);
 
-    ogs_pool_init(&smf_pf_pool,
+    ogs_pool_elastic_init(&smf_pf_pool,
             ogs_app()->pool.bearer * OGS_MAX_NUM_OF_FLOW_IN_BEARER);
 
     self.supi_hash = ogs_hash_make();
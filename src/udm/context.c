@@ -36,7 +36,7 @@ void udm_context_init(void)
 
     ogs_log_install_domain(&__udm_log_domain, "udm", ogs_core()->log.level);
 
-    ogs_pool_init(&udm_ue_pool, ogs_app()->max.ue);
+    ogs_pool_elastic_init(&udm_ue_pool, ogs_app()->max.ue);
 
     ogs_list_init(&self.udm_ue_list);
     self.suci_hash = ogs_hash_make();
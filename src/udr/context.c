@@ -57,6 +57,12 @@ static int udr_context_prepare(void)
 
 static int udr_context_validation(void)
 {
+    if (self.db_thread < 0 || self.db_thread > UDR_MAX_NUM_OF_DB_THREAD) {
+        ogs_error("Invalid udr.db_thread [%d:0-%d] in '%s'",
+                self.db_thread, UDR_MAX_NUM_OF_DB_THREAD, ogs_app()->file);
+        return OGS_ERROR;
+    }
+
     return OGS_OK;
 }
 
@@ -88,6 +94,9 @@ int udr_context_parse_config(void)
                     /* handle config in sbi library */
                 } else if (!strcmp(udr_key, "discovery")) {
                     /* handle config in sbi library */
+                } else if (!strcmp(udr_key, "db_thread")) {
+                    const char *v = ogs_yaml_iter_value(&udr_iter);
+                    if (v) self.db_thread = atoi(v);
                 } else
                     ogs_warn("unknown key `%s`", udr_key);
             }
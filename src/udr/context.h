@@ -35,7 +35,10 @@ extern int __udr_log_domain;
 #undef OGS_LOG_DOMAIN
 #define OGS_LOG_DOMAIN __udr_log_domain
 
+#define UDR_MAX_NUM_OF_DB_THREAD 64
+
 typedef struct udr_context_s {
+    int db_thread;  /* DB threads(0: DB is accessed in the main thread) */
 } udr_context_t;
 
 void udr_context_init(void);
@@ -43,6 +43,9 @@ int udr_initialize()
     rv = ogs_dbi_init(ogs_app()->db_uri);
     if (rv != OGS_OK) return rv;
 
+    rv = ogs_dbi_async_init(ogs_app()->pollset, udr_self()->db_thread);
+    if (rv != OGS_OK) return rv;
+
     rv = udr_sbi_open();
     if (rv != OGS_OK) return rv;
 
@@ -84,6 +87,8 @@ void udr_terminate(void)
     ogs_thread_destroy(thread);
     ogs_timer_delete(t_termination_holding);
 
+    ogs_dbi_async_final();
+
     udr_sbi_close();
 
     ogs_dbi_final();
@@ -20,25 +20,183 @@
 #include "sbi-path.h"
 #include "nudr-handler.h"
 
-bool udr_nudr_dr_handle_subscription_authentication(
-        ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg)
+/*
+ * The DB part of the authentication request runs in a DB thread
+ * if 'udr.db_thread' is configured. Since the received message is freed
+ * when the handler returns, everything needed is copied here.
+ */
+typedef enum {
+    UDR_AUTH_GET_SUBSCRIPTION,
+    UDR_AUTH_UPDATE_SQN,
+    UDR_AUTH_UPDATE_STATUS,
+} udr_auth_op_e;
+
+typedef struct udr_auth_request_s {
+    ogs_dbi_request_t dbi;
+
+    ogs_sbi_stream_t *stream;
+    udr_auth_op_e op;
+    char *supi;
+    uint64_t sqn;
+
+    ogs_dbi_auth_info_t auth_info;
+    int status;
+    const char *title;
+} udr_auth_request_t;
+
+static int auth_request_exec(ogs_dbi_request_t *dbi)
 {
+    udr_auth_request_t *request = NULL;
     int rv;
 
+    ogs_assert(dbi);
+    request = dbi->data;
+    ogs_assert(request);
+
+    rv = ogs_dbi_auth_info(request->supi, &request->auth_info);
+    if (rv != OGS_OK) {
+        ogs_warn("[%s] Cannot find SUPI in DB", request->supi);
+        request->status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
+        request->title = "Cannot find SUPI Type";
+        return OGS_ERROR;
+    }
+
+    switch (request->op) {
+    case UDR_AUTH_GET_SUBSCRIPTION:
+        break;
+
+    case UDR_AUTH_UPDATE_SQN:
+        /* The next SQN is stored with one update */
+        rv = ogs_dbi_update_sqn(request->supi,
+                (request->sqn + 32) & OGS_MAX_SQN);
+        if (rv != OGS_OK) {
+            ogs_fatal("[%s] Cannot update SQN", request->supi);
+            request->status = OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR;
+            request->title = "Cannot update SQN";
+            return OGS_ERROR;
+        }
+        break;
+
+    case UDR_AUTH_UPDATE_STATUS:
+        rv = ogs_dbi_increment_sqn(request->supi);
+        if (rv != OGS_OK) {
+            ogs_fatal("[%s] Cannot increment SQN", request->supi);
+            request->status = OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR;
+            request->title = "Cannot increment SQN";
+            return OGS_ERROR;
+        }
+        break;
+
+    default:
+        ogs_fatal("Unknown operation [%d]", request->op);
+        ogs_assert_if_reached();
+    }
+
+    return OGS_OK;
+}
+
+static void auth_request_done(ogs_dbi_request_t *dbi)
+{
+    udr_auth_request_t *request = NULL;
+    ogs_dbi_auth_info_t *auth_info = NULL;
+
+    ogs_sbi_message_t message;
     ogs_sbi_message_t sendmsg;
     ogs_sbi_response_t *response = NULL;
-    ogs_dbi_auth_info_t auth_info;
 
     char k_string[OGS_KEYSTRLEN(OGS_KEY_LEN)];
     char opc_string[OGS_KEYSTRLEN(OGS_KEY_LEN)];
     char amf_string[OGS_KEYSTRLEN(OGS_AMF_LEN)];
     char sqn_string[OGS_KEYSTRLEN(OGS_SQN_LEN)];
-
-    char sqn[OGS_SQN_LEN];
-    char *supi = NULL;
+    uint8_t sqn[OGS_SQN_LEN];
 
     OpenAPI_authentication_subscription_t AuthenticationSubscription;
     OpenAPI_sequence_number_t SequenceNumber;
+
+    ogs_assert(dbi);
+    request = dbi->data;
+    ogs_assert(request);
+    ogs_assert(request->stream);
+
+    if (dbi->rv != OGS_OK) {
+        /* The problem is built from the request URI */
+        memset(&message, 0, sizeof(message));
+        message.h.service.name = (char *)OGS_SBI_SERVICE_NAME_NUDR_DR;
+        message.h.api.version = (char *)OGS_SBI_API_V1;
+        message.h.resource.component[0] =
+            (char *)OGS_SBI_RESOURCE_NAME_SUBSCRIPTION_DATA;
+        message.h.resource.component[1] = request->supi;
+
+        ogs_expect(true ==
+            ogs_sbi_server_send_error(request->stream, request->status,
+                &message, request->title, request->supi));
+        goto out;
+    }
+
+    memset(&sendmsg, 0, sizeof(sendmsg));
+
+    if (request->op == UDR_AUTH_GET_SUBSCRIPTION) {
+        auth_info = &request->auth_info;
+
+        memset(&AuthenticationSubscription, 0,
+                sizeof(AuthenticationSubscription));
+
+        AuthenticationSubscription.authentication_method =
+            OpenAPI_auth_method_5G_AKA;
+
+        ogs_hex_to_ascii(auth_info->k, sizeof(auth_info->k),
+                k_string, sizeof(k_string));
+        AuthenticationSubscription.enc_permanent_key = k_string;
+
+        ogs_hex_to_ascii(auth_info->amf, sizeof(auth_info->amf),
+                amf_string, sizeof(amf_string));
+        AuthenticationSubscription.authentication_management_field =
+                amf_string;
+
+        if (!auth_info->use_opc)
+            milenage_opc(auth_info->k, auth_info->op, auth_info->opc);
+
+        ogs_hex_to_ascii(auth_info->opc, sizeof(auth_info->opc),
+                opc_string, sizeof(opc_string));
+        AuthenticationSubscription.enc_opc_key = opc_string;
+
+        ogs_uint64_to_buffer(auth_info->sqn, OGS_SQN_LEN, sqn);
+        ogs_hex_to_ascii(sqn, sizeof(sqn), sqn_string, sizeof(sqn_string));
+
+        memset(&SequenceNumber, 0, sizeof(SequenceNumber));
+        SequenceNumber.sqn = sqn_string;
+        AuthenticationSubscription.sequence_number = &SequenceNumber;
+
+        ogs_assert(AuthenticationSubscription.authentication_method);
+        sendmsg.AuthenticationSubscription = &AuthenticationSubscription;
+
+        response = ogs_sbi_build_response(&sendmsg, OGS_SBI_HTTP_STATUS_OK);
+    } else {
+        response = ogs_sbi_build_response(
+                &sendmsg, OGS_SBI_HTTP_STATUS_NO_CONTENT);
+    }
+    ogs_assert(response);
+
+    /* The stream could be removed while the DB thread is running */
+    ogs_expect(true ==
+            ogs_sbi_server_send_response(request->stream, response));
+
+out:
+    ogs_free(request->supi);
+    ogs_free(request);
+}
+
+bool udr_nudr_dr_handle_subscription_authentication(
+        ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg)
+{
+    int rv;
+
+    udr_auth_request_t *request = NULL;
+    udr_auth_op_e op = UDR_AUTH_GET_SUBSCRIPTION;
+    uint64_t sqn = 0;
+
+    char *supi = NULL;
+
     OpenAPI_list_t *PatchItemList = NULL;
     OpenAPI_lnode_t *node = NULL;
 
@@ -63,65 +221,16 @@ bool udr_nudr_dr_handle_subscription_authentication(
         return false;
     }
 
-    rv = ogs_dbi_auth_info(supi, &auth_info);
-    if (rv != OGS_OK) {
-        ogs_warn("[%s] Cannot find SUPI in DB", supi);
-        ogs_assert(true ==
-            ogs_sbi_server_send_error(stream, OGS_SBI_HTTP_STATUS_NOT_FOUND,
-                recvmsg, "Cannot find SUPI Type", supi));
-        return false;
-    }
-
     SWITCH(recvmsg->h.resource.component[3])
     CASE(OGS_SBI_RESOURCE_NAME_AUTHENTICATION_SUBSCRIPTION)
         SWITCH(recvmsg->h.method)
         CASE(OGS_SBI_HTTP_METHOD_GET)
-            memset(&AuthenticationSubscription, 0,
-                    sizeof(AuthenticationSubscription));
-
-            AuthenticationSubscription.authentication_method =
-                OpenAPI_auth_method_5G_AKA;
-
-            ogs_hex_to_ascii(auth_info.k, sizeof(auth_info.k),
-                    k_string, sizeof(k_string));
-            AuthenticationSubscription.enc_permanent_key = k_string;
-
-            ogs_hex_to_ascii(auth_info.amf, sizeof(auth_info.amf),
-                    amf_string, sizeof(amf_string));
-            AuthenticationSubscription.authentication_management_field =
-                    amf_string;
-
-            if (!auth_info.use_opc)
-                milenage_opc(auth_info.k, auth_info.op, auth_info.opc);
-
-            ogs_hex_to_ascii(auth_info.opc, sizeof(auth_info.opc),
-                    opc_string, sizeof(opc_string));
-            AuthenticationSubscription.enc_opc_key = opc_string;
-
-            ogs_uint64_to_buffer(auth_info.sqn, OGS_SQN_LEN, sqn);
-            ogs_hex_to_ascii(sqn, sizeof(sqn), sqn_string, sizeof(sqn_string));
-
-            memset(&SequenceNumber, 0, sizeof(SequenceNumber));
-            SequenceNumber.sqn = sqn_string;
-            AuthenticationSubscription.sequence_number = &SequenceNumber;
-
-            memset(&sendmsg, 0, sizeof(sendmsg));
-
-            ogs_assert(AuthenticationSubscription.authentication_method);
-            sendmsg.AuthenticationSubscription =
-                &AuthenticationSubscription;
-
-            response = ogs_sbi_build_response(
-                    &sendmsg, OGS_SBI_HTTP_STATUS_OK);
-            ogs_assert(response);
-            ogs_assert(true == ogs_sbi_server_send_response(stream, response));
-
-            return true;
+            op = UDR_AUTH_GET_SUBSCRIPTION;
+            break;
 
         CASE(OGS_SBI_HTTP_METHOD_PATCH)
             char *sqn_string = NULL;
             uint8_t sqn_ms[OGS_SQN_LEN];
-            uint64_t sqn = 0;
 
             PatchItemList = recvmsg->PatchItemList;
             if (!PatchItemList) {
@@ -154,34 +263,8 @@ bool udr_nudr_dr_handle_subscription_authentication(
                     sqn_ms, sizeof(sqn_ms));
             sqn = ogs_buffer_to_uint64(sqn_ms, OGS_SQN_LEN);
 
-            rv = ogs_dbi_update_sqn(supi, sqn);
-            if (rv != OGS_OK) {
-                ogs_fatal("[%s] Cannot update SQN", supi);
-                ogs_assert(true ==
-                    ogs_sbi_server_send_error(stream,
-                        OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR,
-                        recvmsg, "Cannot update SQN", supi));
-                return false;
-            }
-
-            rv = ogs_dbi_increment_sqn(supi);
-            if (rv != OGS_OK) {
-                ogs_fatal("[%s] Cannot increment SQN", supi);
-                ogs_assert(true ==
-                    ogs_sbi_server_send_error(stream,
-                        OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR,
-                        recvmsg, "Cannot increment SQN", supi));
-                return false;
-            }
-
-            memset(&sendmsg, 0, sizeof(sendmsg));
-
-            response = ogs_sbi_build_response(
-                    &sendmsg, OGS_SBI_HTTP_STATUS_NO_CONTENT);
-            ogs_assert(response);
-            ogs_assert(true == ogs_sbi_server_send_response(stream, response));
-
-            return true;
+            op = UDR_AUTH_UPDATE_SQN;
+            break;
 
         DEFAULT
             ogs_error("Invalid HTTP method [%s]", recvmsg->h.method);
@@ -189,6 +272,7 @@ bool udr_nudr_dr_handle_subscription_authentication(
                 ogs_sbi_server_send_error(stream,
                     OGS_SBI_HTTP_STATUS_MEHTOD_NOT_ALLOWED,
                     recvmsg, "Invalid HTTP method", recvmsg->h.method));
+            return false;
         END
         break;
 
@@ -209,23 +293,8 @@ bool udr_nudr_dr_handle_subscription_authentication(
                 return false;
             }
 
-            memset(&sendmsg, 0, sizeof(sendmsg));
-            rv = ogs_dbi_increment_sqn(supi);
-            if (rv != OGS_OK) {
-                ogs_fatal("[%s] Cannot increment SQN", supi);
-                ogs_assert(true ==
-                    ogs_sbi_server_send_error(stream,
-                        OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR,
-                        recvmsg, "Cannot increment SQN", supi));
-                return false;
-            }
-
-            response = ogs_sbi_build_response(
-                    &sendmsg, OGS_SBI_HTTP_STATUS_NO_CONTENT);
-            ogs_assert(response);
-            ogs_assert(true == ogs_sbi_server_send_response(stream, response));
-
-            return true;
+            op = UDR_AUTH_UPDATE_STATUS;
+            break;
 
         DEFAULT
             ogs_error("Invalid HTTP method [%s]", recvmsg->h.method);
@@ -233,6 +302,7 @@ bool udr_nudr_dr_handle_subscription_authentication(
                 ogs_sbi_server_send_error(stream,
                     OGS_SBI_HTTP_STATUS_MEHTOD_NOT_ALLOWED,
                     recvmsg, "Invalid HTTP method", recvmsg->h.method));
+            return false;
         END
         break;
 
@@ -244,9 +314,34 @@ bool udr_nudr_dr_handle_subscription_authentication(
                 OGS_SBI_HTTP_STATUS_MEHTOD_NOT_ALLOWED,
                 recvmsg, "Unknown resource name",
                 recvmsg->h.resource.component[3]));
+        return false;
     END
 
-    return false;
+    request = ogs_calloc(1, sizeof(*request));
+    ogs_assert(request);
+
+    request->dbi.exec = auth_request_exec;
+    request->dbi.done = auth_request_done;
+    request->dbi.data = request;
+
+    request->stream = stream;
+    request->op = op;
+    request->supi = ogs_strdup(supi);
+    ogs_assert(request->supi);
+    request->sqn = sqn;
+
+    if (ogs_dbi_async_enabled()) {
+        rv = ogs_dbi_async_submit(&request->dbi);
+        if (rv == OGS_OK)
+            return true;
+
+        ogs_warn("[%s] DB request queue is full", supi);
+    }
+
+    request->dbi.rv = request->dbi.exec(&request->dbi);
+    request->dbi.done(&request->dbi);
+
+    return true;
 }
 
 bool udr_nudr_dr_handle_subscription_context(
@@ -19,6 +19,7 @@
 
 #include "context.h"
 #include "pfcp-path.h"
+#include "fwd.h"
 
 static upf_context_t self;
 
@@ -30,6 +31,20 @@ static int context_initialized = 0;
 
 static void upf_sess_urr_acc_remove_all(upf_sess_t *sess);
 
+/* ipv4_hash is keyed by the address, ipv6_hash by the /64 prefix */
+static uint64_t ipv4_hash_key(const uint32_t *addr)
+{
+    return addr[0];
+}
+
+static uint64_t ipv6_hash_key(const uint32_t *addr6)
+{
+    uint64_t key;
+
+    memcpy(&key, addr6, OGS_IPV6_DEFAULT_PREFIX_LEN >> 3);
+    return key;
+}
+
 void upf_context_init(void)
 {
     ogs_assert(context_initialized == 0);
@@ -48,17 +63,24 @@ void upf_context_init(void)
     ogs_pfcp_self()->up_function_features_len = 4;
 
     ogs_list_init(&self.sess_list);
-    ogs_pool_init(&upf_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_elastic_init(&upf_sess_pool, ogs_app()->pool.sess);
 
-    self.seid_hash = ogs_hash_make();
+    /* Default : one packet per wakeup (batching disabled) */
+    self.datapath.batch = 1;
+    /* Default : datapath runs in the control thread */
+    self.datapath.workers = 0;
+
+    self.seid_hash = ogs_ihash_make();
     ogs_assert(self.seid_hash);
     self.f_seid_hash = ogs_hash_make();
     ogs_assert(self.f_seid_hash);
-    self.ipv4_hash = ogs_hash_make();
+    self.ipv4_hash = ogs_ihash_make();
     ogs_assert(self.ipv4_hash);
-    self.ipv6_hash = ogs_hash_make();
+    self.ipv6_hash = ogs_ihash_make();
     ogs_assert(self.ipv6_hash);
 
+    upf_fwd_init();
+
     context_initialized = 1;
 }
 
@@ -78,17 +100,19 @@ void upf_context_final(void)
     upf_sess_remove_all();
 
     ogs_assert(self.seid_hash);
-    ogs_hash_destroy(self.seid_hash);
+    ogs_ihash_destroy(self.seid_hash);
     ogs_assert(self.f_seid_hash);
     ogs_hash_destroy(self.f_seid_hash);
     ogs_assert(self.ipv4_hash);
-    ogs_hash_destroy(self.ipv4_hash);
+    ogs_ihash_destroy(self.ipv4_hash);
     ogs_assert(self.ipv6_hash);
-    ogs_hash_destroy(self.ipv6_hash);
+    ogs_ihash_destroy(self.ipv6_hash);
 
     free_upf_route_trie_node(self.ipv4_framed_routes);
     free_upf_route_trie_node(self.ipv6_framed_routes);
 
+    upf_fwd_final();
+
     ogs_pool_final(&upf_sess_pool);
 
     context_initialized = 0;
@@ -114,6 +138,19 @@ static int upf_context_validation(void)
         ogs_error("No upf.subnet: in '%s'", ogs_app()->file);
         return OGS_ERROR;
     }
+    if (self.datapath.batch < 1 ||
+        self.datapath.batch > OGS_MAX_NUM_OF_MMSG) {
+        ogs_error("Invalid upf.datapath.batch [%d:1-%d] in '%s'",
+                self.datapath.batch, OGS_MAX_NUM_OF_MMSG, ogs_app()->file);
+        return OGS_ERROR;
+    }
+    if (self.datapath.workers < 0 ||
+        self.datapath.workers > UPF_MAX_NUM_OF_WORKER) {
+        ogs_error("Invalid upf.datapath.workers [%d:0-%d] in '%s'",
+                self.datapath.workers, UPF_MAX_NUM_OF_WORKER,
+                ogs_app()->file);
+        return OGS_ERROR;
+    }
     return OGS_OK;
 }
 
@@ -147,6 +184,22 @@ int upf_context_parse_config(void)
                     /* handle config in pfcp library */
                 } else if (!strcmp(upf_key, "metrics")) {
                     /* handle config in metrics library */
+                } else if (!strcmp(upf_key, "datapath")) {
+                    ogs_yaml_iter_t datapath_iter;
+                    ogs_yaml_iter_recurse(&upf_iter, &datapath_iter);
+                    while (ogs_yaml_iter_next(&datapath_iter)) {
+                        const char *datapath_key =
+                            ogs_yaml_iter_key(&datapath_iter);
+                        ogs_assert(datapath_key);
+                        if (!strcmp(datapath_key, "batch")) {
+                            const char *v = ogs_yaml_iter_value(&datapath_iter);
+                            if (v) self.datapath.batch = atoi(v);
+                        } else if (!strcmp(datapath_key, "workers")) {
+                            const char *v = ogs_yaml_iter_value(&datapath_iter);
+                            if (v) self.datapath.workers = atoi(v);
+                        } else
+                            ogs_warn("unknown key `%s`", datapath_key);
+                    }
                 } else
                     ogs_warn("unknown key `%s`", upf_key);
             }
@@ -175,6 +228,14 @@ upf_sess_t *upf_sess_add(ogs_pfcp_f_seid_t *cp_f_seid)
     ogs_assert(sess->index > 0 && sess->index <= ogs_app()->pool.sess);
 
     sess->upf_n4_seid = sess->index;
+    sess->generation = ++self.sess_generation;
+
+    if (self.datapath.workers) {
+        sess->urr_acc_worker = ogs_calloc(
+                self.datapath.workers * OGS_MAX_NUM_OF_URR,
+                sizeof(upf_sess_urr_acc_worker_t));
+        ogs_assert(sess->urr_acc_worker);
+    }
 
     /* Since F-SEID is composed of ogs_ip_t and uint64-seid,
      * all these values must be put into the structure-smf_n4_f_seid
@@ -185,8 +246,7 @@ upf_sess_t *upf_sess_add(ogs_pfcp_f_seid_t *cp_f_seid)
 
     ogs_hash_set(self.f_seid_hash, &sess->smf_n4_f_seid,
             sizeof(sess->smf_n4_f_seid), sess);
-    ogs_hash_set(self.seid_hash, &sess->smf_n4_f_seid.seid,
-            sizeof(sess->smf_n4_f_seid.seid), sess);
+    ogs_ihash_set(self.seid_hash, sess->smf_n4_f_seid.seid, sess);
 
     ogs_list_add(&self.sess_list, sess);
     upf_metrics_inst_global_inc(UPF_METR_GLOB_GAUGE_UPF_SESSIONNBR);
@@ -202,22 +262,21 @@ int upf_sess_remove(upf_sess_t *sess)
     ogs_assert(sess);
 
     upf_sess_urr_acc_remove_all(sess);
+    upf_fwd_remove(sess);
 
     ogs_list_remove(&self.sess_list, sess);
     ogs_pfcp_sess_clear(&sess->pfcp);
 
-    ogs_hash_set(self.seid_hash, &sess->smf_n4_f_seid.seid,
-            sizeof(sess->smf_n4_f_seid.seid), NULL);
+    ogs_ihash_set(self.seid_hash, sess->smf_n4_f_seid.seid, NULL);
     ogs_hash_set(self.f_seid_hash, &sess->smf_n4_f_seid,
             sizeof(sess->smf_n4_f_seid), NULL);
 
     if (sess->ipv4) {
-        ogs_hash_set(self.ipv4_hash, sess->ipv4->addr, OGS_IPV4_LEN, NULL);
+        ogs_ihash_set(self.ipv4_hash, ipv4_hash_key(sess->ipv4->addr), NULL);
         ogs_pfcp_ue_ip_free(sess->ipv4);
     }
     if (sess->ipv6) {
-        ogs_hash_set(self.ipv6_hash,
-                sess->ipv6->addr, OGS_IPV6_DEFAULT_PREFIX_LEN >> 3, NULL);
+        ogs_ihash_set(self.ipv6_hash, ipv6_hash_key(sess->ipv6->addr), NULL);
         ogs_pfcp_ue_ip_free(sess->ipv6);
     }
 
@@ -226,6 +285,9 @@ int upf_sess_remove(upf_sess_t *sess)
 
     ogs_pfcp_pool_final(&sess->pfcp);
 
+    if (sess->urr_acc_worker)
+        ogs_free(sess->urr_acc_worker);
+
     ogs_pool_free(&upf_sess_pool, sess);
     upf_metrics_inst_global_dec(UPF_METR_GLOB_GAUGE_UPF_SESSIONNBR);
 
@@ -249,9 +311,23 @@ upf_sess_t *upf_sess_find(uint32_t index)
     return ogs_pool_find(&upf_sess_pool, index);
 }
 
+/*
+ * The index of a removed session is reused by the next one,
+ * so an event posted by a datapath worker also checks the generation.
+ */
+upf_sess_t *upf_sess_find_by_generation(uint32_t index, uint32_t generation)
+{
+    upf_sess_t *sess = upf_sess_find(index);
+
+    if (sess && sess->generation != generation)
+        return NULL;
+
+    return sess;
+}
+
 upf_sess_t *upf_sess_find_by_smf_n4_seid(uint64_t seid)
 {
-    return (upf_sess_t *)ogs_hash_get(self.seid_hash, &seid, sizeof(seid));
+    return (upf_sess_t *)ogs_ihash_get(self.seid_hash, seid);
 }
 
 upf_sess_t *upf_sess_find_by_smf_n4_f_seid(ogs_pfcp_f_seid_t *f_seid)
@@ -282,7 +358,7 @@ upf_sess_t *upf_sess_find_by_ipv4(uint32_t addr)
 
     ogs_assert(self.ipv4_hash);
 
-    ret = ogs_hash_get(self.ipv4_hash, &addr, OGS_IPV4_LEN);
+    ret = ogs_ihash_get(self.ipv4_hash, addr);
     if (ret)
         return ret;
 
@@ -313,8 +389,7 @@ upf_sess_t *upf_sess_find_by_ipv6(uint32_t *addr6)
 
     ogs_assert(self.ipv6_hash);
     ogs_assert(addr6);
-    ret = ogs_hash_get(
-            self.ipv6_hash, addr6, OGS_IPV6_DEFAULT_PREFIX_LEN >> 3);
+    ret = ogs_ihash_get(self.ipv6_hash, ipv6_hash_key(addr6));
     if (ret)
         return ret;
 
@@ -379,13 +454,11 @@ uint8_t upf_sess_set_ue_ip(upf_sess_t *sess,
     ogs_assert(ue_ip);
 
     if (sess->ipv4) {
-        ogs_hash_set(self.ipv4_hash,
-                sess->ipv4->addr, OGS_IPV4_LEN, NULL);
+        ogs_ihash_set(self.ipv4_hash, ipv4_hash_key(sess->ipv4->addr), NULL);
         ogs_pfcp_ue_ip_free(sess->ipv4);
     }
     if (sess->ipv6) {
-        ogs_hash_set(self.ipv6_hash,
-                sess->ipv6->addr, OGS_IPV6_DEFAULT_PREFIX_LEN >> 3, NULL);
+        ogs_ihash_set(self.ipv6_hash, ipv6_hash_key(sess->ipv6->addr), NULL);
         ogs_pfcp_ue_ip_free(sess->ipv6);
     }
 
@@ -399,7 +472,8 @@ uint8_t upf_sess_set_ue_ip(upf_sess_t *sess,
                 ogs_assert(cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED);
                 return cause_value;
             }
-            ogs_hash_set(self.ipv4_hash, sess->ipv4->addr, OGS_IPV4_LEN, sess);
+            ogs_ihash_set(self.ipv4_hash,
+                    ipv4_hash_key(sess->ipv4->addr), sess);
         } else {
             ogs_warn("Cannot support PDN-Type[%d], [IPv4:%d IPv6:%d DNN:%s]",
                 session_type, ue_ip->ipv4, ue_ip->ipv6,
@@ -414,8 +488,8 @@ uint8_t upf_sess_set_ue_ip(upf_sess_t *sess,
                 ogs_assert(cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED);
                 return cause_value;
             }
-            ogs_hash_set(self.ipv6_hash, sess->ipv6->addr,
-                    OGS_IPV6_DEFAULT_PREFIX_LEN >> 3, sess);
+            ogs_ihash_set(self.ipv6_hash,
+                    ipv6_hash_key(sess->ipv6->addr), sess);
         } else {
             ogs_warn("Cannot support PDN-Type[%d], [IPv4:%d IPv6:%d DNN:%s]",
                 session_type, ue_ip->ipv4, ue_ip->ipv6,
@@ -430,7 +504,8 @@ uint8_t upf_sess_set_ue_ip(upf_sess_t *sess,
                 ogs_assert(cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED);
                 return cause_value;
             }
-            ogs_hash_set(self.ipv4_hash, sess->ipv4->addr, OGS_IPV4_LEN, sess);
+            ogs_ihash_set(self.ipv4_hash,
+                    ipv4_hash_key(sess->ipv4->addr), sess);
         } else {
             ogs_warn("Cannot support PDN-Type[%d], [IPv4:%d IPv6:%d DNN:%s]",
                 session_type, ue_ip->ipv4, ue_ip->ipv6,
@@ -444,15 +519,15 @@ uint8_t upf_sess_set_ue_ip(upf_sess_t *sess,
                 ogs_error("ogs_pfcp_ue_ip_alloc() failed[%d]", cause_value);
                 ogs_assert(cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED);
                 if (sess->ipv4) {
-                    ogs_hash_set(self.ipv4_hash,
-                            sess->ipv4->addr, OGS_IPV4_LEN, NULL);
+                    ogs_ihash_set(self.ipv4_hash,
+                            ipv4_hash_key(sess->ipv4->addr), NULL);
                     ogs_pfcp_ue_ip_free(sess->ipv4);
                     sess->ipv4 = NULL;
                 }
                 return cause_value;
             }
-            ogs_hash_set(self.ipv6_hash, sess->ipv6->addr,
-                    OGS_IPV6_DEFAULT_PREFIX_LEN >> 3, sess);
+            ogs_ihash_set(self.ipv6_hash,
+                    ipv6_hash_key(sess->ipv6->addr), sess);
         } else {
             ogs_warn("Cannot support PDN-Type[%d], [IPv4:%d IPv6:%d DNN:%s]",
                 session_type, ue_ip->ipv4, ue_ip->ipv6,
@@ -655,7 +730,6 @@ uint8_t upf_sess_set_ue_ipv6_framed_routes(upf_sess_t *sess,
 void upf_sess_urr_acc_add(upf_sess_t *sess, ogs_pfcp_urr_t *urr, size_t size, bool is_uplink)
 {
     upf_sess_urr_acc_t *urr_acc = &sess->urr_acc[urr->id];
-    uint64_t vol;
 
     /* Increment total & ul octets + pkts */
     urr_acc->total_octets += size;
@@ -672,6 +746,130 @@ void upf_sess_urr_acc_add(upf_sess_t *sess, ogs_pfcp_urr_t *urr, size_t size, bo
     if (urr_acc->time_of_first_packet == 0)
         urr_acc->time_of_first_packet = urr_acc->time_of_last_packet;
 
+    upf_sess_urr_acc_check(sess, urr);
+}
+
+#define URR_ACC_WORKER_ADD(__cOUNTER, __vAL) \
+    __atomic_store_n(&(__cOUNTER), \
+            __atomic_load_n(&(__cOUNTER), __ATOMIC_RELAXED) + (__vAL), \
+            __ATOMIC_RELAXED)
+
+/*
+ * Datapath worker variant of upf_sess_urr_acc_add().
+ *
+ * The worker only updates its own counters while holding the datapath
+ * read lock. It returns true once the volume threshold/quota may have been
+ * reached; the caller must then ask the control thread to run
+ * upf_sess_urr_acc_check().
+ */
+bool upf_sess_urr_acc_add_by_worker(upf_sess_t *sess, ogs_pfcp_urr_t *urr,
+        int worker_id, size_t size, bool is_uplink)
+{
+    upf_sess_urr_acc_t *urr_acc = &sess->urr_acc[urr->id];
+    upf_sess_urr_acc_worker_t *acc = NULL;
+    uint64_t vol;
+    int i;
+
+    ogs_assert(sess->urr_acc_worker);
+    ogs_assert(worker_id >= 0 && worker_id < self.datapath.workers);
+
+    acc = &sess->urr_acc_worker[worker_id * OGS_MAX_NUM_OF_URR + urr->id];
+
+    /*
+     * Only this worker writes to its own counters. The stores are atomic,
+     * so that the control thread and the peers never read a torn value.
+     */
+    if (is_uplink) {
+        URR_ACC_WORKER_ADD(acc->ul_octets, size);
+        URR_ACC_WORKER_ADD(acc->ul_pkts, 1);
+    } else {
+        URR_ACC_WORKER_ADD(acc->dl_octets, size);
+        URR_ACC_WORKER_ADD(acc->dl_pkts, 1);
+    }
+
+    __atomic_store_n(&acc->time_of_last_packet,
+            ogs_time_now(), __ATOMIC_RELAXED);
+    if (acc->time_of_first_packet == 0)
+        __atomic_store_n(&acc->time_of_first_packet,
+                acc->time_of_last_packet, __ATOMIC_RELAXED);
+
+    if (__atomic_load_n(&urr_acc->check_pending, __ATOMIC_ACQUIRE) == true)
+        return false;
+
+    if (!(urr->rep_triggers.volume_quota && urr->vol_quota.tovol) &&
+        !(urr->rep_triggers.volume_threshold && urr->vol_threshold.tovol))
+        return false;
+
+    /* Other workers' counters may be slightly behind, which is fine here */
+    vol = 0;
+    for (i = 0; i < self.datapath.workers; i++) {
+        upf_sess_urr_acc_worker_t *peer =
+            &sess->urr_acc_worker[i * OGS_MAX_NUM_OF_URR + urr->id];
+        vol += __atomic_load_n(&peer->ul_octets, __ATOMIC_RELAXED) +
+            __atomic_load_n(&peer->dl_octets, __ATOMIC_RELAXED);
+    }
+    vol -= __atomic_load_n(
+            &urr_acc->last_report.total_octets, __ATOMIC_RELAXED);
+
+    if ((urr->rep_triggers.volume_quota && urr->vol_quota.tovol && vol >= urr->vol_quota.total_volume) ||
+        (urr->rep_triggers.volume_threshold && urr->vol_threshold.tovol && vol >= urr->vol_threshold.total_volume)) {
+        /* Only one of the workers asks for the check */
+        return __atomic_exchange_n(
+                &urr_acc->check_pending, true, __ATOMIC_ACQ_REL) == false;
+    }
+
+    return false;
+}
+
+/* Fold the per-worker counters into urr_acc. Control thread only */
+static void upf_sess_urr_acc_merge(upf_sess_t *sess, const ogs_pfcp_urr_t *urr)
+{
+    upf_sess_urr_acc_t *urr_acc = &sess->urr_acc[urr->id];
+    int i;
+
+    if (!sess->urr_acc_worker)
+        return;
+
+    urr_acc->ul_octets = 0;
+    urr_acc->dl_octets = 0;
+    urr_acc->ul_pkts = 0;
+    urr_acc->dl_pkts = 0;
+
+    /* Workers keep counting while the counters are folded */
+    for (i = 0; i < self.datapath.workers; i++) {
+        upf_sess_urr_acc_worker_t *acc =
+            &sess->urr_acc_worker[i * OGS_MAX_NUM_OF_URR + urr->id];
+        ogs_time_t first, last;
+
+        urr_acc->ul_octets +=
+            __atomic_load_n(&acc->ul_octets, __ATOMIC_RELAXED);
+        urr_acc->dl_octets +=
+            __atomic_load_n(&acc->dl_octets, __ATOMIC_RELAXED);
+        urr_acc->ul_pkts += __atomic_load_n(&acc->ul_pkts, __ATOMIC_RELAXED);
+        urr_acc->dl_pkts += __atomic_load_n(&acc->dl_pkts, __ATOMIC_RELAXED);
+
+        first = __atomic_load_n(&acc->time_of_first_packet, __ATOMIC_RELAXED);
+        last = __atomic_load_n(&acc->time_of_last_packet, __ATOMIC_RELAXED);
+        if (first &&
+            (urr_acc->time_of_first_packet == 0 ||
+             first < urr_acc->time_of_first_packet))
+            urr_acc->time_of_first_packet = first;
+        if (last > urr_acc->time_of_last_packet)
+            urr_acc->time_of_last_packet = last;
+    }
+
+    urr_acc->total_octets = urr_acc->ul_octets + urr_acc->dl_octets;
+    urr_acc->total_pkts = urr_acc->ul_pkts + urr_acc->dl_pkts;
+}
+
+void upf_sess_urr_acc_check(upf_sess_t *sess, ogs_pfcp_urr_t *urr)
+{
+    upf_sess_urr_acc_t *urr_acc = &sess->urr_acc[urr->id];
+    uint64_t vol;
+
+    __atomic_store_n(&urr_acc->check_pending, false, __ATOMIC_RELEASE);
+    upf_sess_urr_acc_merge(sess, urr);
+
     /* generate report if volume threshold/quota is reached */
     vol = urr_acc->total_octets - urr_acc->last_report.total_octets;
     if ((urr->rep_triggers.volume_quota && urr->vol_quota.tovol && vol >= urr->vol_quota.total_volume) ||
@@ -698,6 +896,8 @@ void upf_sess_urr_acc_fill_usage_report(upf_sess_t *sess, const ogs_pfcp_urr_t *
     ogs_time_t last_report_timestamp;
     ogs_time_t now;
 
+    upf_sess_urr_acc_merge(sess, urr);
+
     now = ogs_time_now(); /* we need UTC for start_time and end_time */
 
     if (urr_acc->last_report.timestamp)
@@ -753,7 +953,9 @@ void upf_sess_urr_acc_fill_usage_report(upf_sess_t *sess, const ogs_pfcp_urr_t *
 void upf_sess_urr_acc_snapshot(upf_sess_t *sess, ogs_pfcp_urr_t *urr)
 {
     upf_sess_urr_acc_t *urr_acc = &sess->urr_acc[urr->id];
-    urr_acc->last_report.total_octets = urr_acc->total_octets;
+    /* Read by the datapath workers without the lock */
+    __atomic_store_n(&urr_acc->last_report.total_octets,
+            urr_acc->total_octets, __ATOMIC_RELAXED);
     urr_acc->last_report.dl_octets = urr_acc->dl_octets;
     urr_acc->last_report.ul_octets = urr_acc->ul_octets;
     urr_acc->last_report.total_pkts = urr_acc->total_pkts;
@@ -45,17 +45,26 @@ extern int __upf_log_domain;
 #undef OGS_LOG_DOMAIN
 #define OGS_LOG_DOMAIN __upf_log_domain
 
+#define UPF_MAX_NUM_OF_WORKER   32
+
 struct upf_route_trie_node;
 
 typedef struct upf_context_s {
-    ogs_hash_t                 *seid_hash;     /* hash table (SEID) */
+    ogs_ihash_t                *seid_hash;     /* hash table (SEID) */
     ogs_hash_t                 *f_seid_hash;   /* hash table (F-SEID) */
-    ogs_hash_t                 *ipv4_hash;     /* hash table (IPv4 Address) */
-    ogs_hash_t                 *ipv6_hash;     /* hash table (IPv6 Address) */
+    ogs_ihash_t                *ipv4_hash;     /* hash table (IPv4 Address) */
+    ogs_ihash_t                *ipv6_hash;     /* hash table (IPv6 Address) */
     struct upf_route_trie_node *ipv4_framed_routes; /* IPv4 framed routes trie */
     struct upf_route_trie_node *ipv6_framed_routes; /* IPv6 framed routes trie */
 
     ogs_list_t                  sess_list;
+
+    struct {
+        int                     batch;  /* Max packets per wakeup */
+        int                     workers; /* Number of datapath threads */
+    } datapath;
+
+    uint32_t                    sess_generation;
 } upf_context_t;
 
 /* trie mapping from IP framed routes to session. */
@@ -66,8 +75,18 @@ struct upf_route_trie_node {
 };
 
 /* Accounting: */
+typedef struct upf_sess_urr_acc_worker_s {
+    uint64_t ul_octets;
+    uint64_t dl_octets;
+    uint64_t ul_pkts;
+    uint64_t dl_pkts;
+    ogs_time_t time_of_first_packet;
+    ogs_time_t time_of_last_packet;
+} upf_sess_urr_acc_worker_t;
+
 typedef struct upf_sess_urr_acc_s {
     bool reporting_enabled;
+    bool check_pending; /* A datapath worker asked for a volume check */
     ogs_timer_t *t_validity_time; /* Quota Validity Time expiration handler */
     ogs_timer_t *t_time_quota; /* Time Quota expiration handler */
     ogs_timer_t *t_time_threshold; /* Time Threshold expiration handler */
@@ -93,10 +112,21 @@ typedef struct upf_sess_urr_acc_s {
     } last_report;
 } upf_sess_urr_acc_t;
 
+/* Forwarding cache entry, see fwd.h */
+#define UPF_MAX_NUM_OF_FWD  (OGS_MAX_NUM_OF_PDR * 2 + 2)
+typedef struct upf_fwd_s {
+    uint64_t        key;
+    uint8_t         table;
+
+    struct upf_sess_s *sess;
+    ogs_pfcp_pdr_t  *pdr;
+} upf_fwd_t;
+
 #define UPF_SESS(pfcp_sess) ogs_container_of(pfcp_sess, upf_sess_t, pfcp)
 typedef struct upf_sess_s {
     ogs_lnode_t     lnode;
     uint32_t        index;              /**< An index of this node */
+    uint32_t        generation;         /* Tells a reused index apart */
 
     ogs_pfcp_sess_t pfcp;
 
@@ -118,6 +148,15 @@ typedef struct upf_sess_s {
 
     /* Accounting: */
     upf_sess_urr_acc_t urr_acc[OGS_MAX_NUM_OF_URR]; /* FIXME: This probably needs to be mved to a hashtable or alike */
+    /*
+     * Counters updated by datapath workers [workers][OGS_MAX_NUM_OF_URR],
+     * merged into urr_acc[] by the control thread
+     */
+    upf_sess_urr_acc_worker_t *urr_acc_worker;
+
+    /* Keys of this session in the forwarding cache */
+    upf_fwd_t       fwd[UPF_MAX_NUM_OF_FWD];
+    int             num_of_fwd;
 } upf_sess_t;
 
 void upf_context_init(void);
@@ -132,6 +171,7 @@ upf_sess_t *upf_sess_add(ogs_pfcp_f_seid_t *f_seid);
 int upf_sess_remove(upf_sess_t *sess);
 void upf_sess_remove_all(void);
 upf_sess_t *upf_sess_find(uint32_t index);
+upf_sess_t *upf_sess_find_by_generation(uint32_t index, uint32_t generation);
 upf_sess_t *upf_sess_find_by_smf_n4_seid(uint64_t seid);
 upf_sess_t *upf_sess_find_by_smf_n4_f_seid(ogs_pfcp_f_seid_t *f_seid);
 upf_sess_t *upf_sess_find_by_upf_n4_seid(uint64_t seid);
@@ -146,6 +186,9 @@ uint8_t upf_sess_set_ue_ipv6_framed_routes(upf_sess_t *sess,
         char *framed_routes[]);
 
 void upf_sess_urr_acc_add(upf_sess_t *sess, ogs_pfcp_urr_t *urr, size_t size, bool is_uplink);
+bool upf_sess_urr_acc_add_by_worker(upf_sess_t *sess, ogs_pfcp_urr_t *urr,
+        int worker_id, size_t size, bool is_uplink);
+void upf_sess_urr_acc_check(upf_sess_t *sess, ogs_pfcp_urr_t *urr);
 void upf_sess_urr_acc_fill_usage_report(upf_sess_t *sess, const ogs_pfcp_urr_t *urr,
                                         ogs_pfcp_user_plane_report_t *report, unsigned int idx);
 void upf_sess_urr_acc_snapshot(upf_sess_t *sess, ogs_pfcp_urr_t *urr);
@@ -38,10 +38,13 @@ static void pollset_action_setup(void)
 #endif
 
 static OGS_POOL(pool, upf_event_t);
+/* Datapath workers also allocate events */
+static ogs_thread_mutex_t pool_mutex;
 
 void upf_event_init(void)
 {
     ogs_pool_init(&pool, ogs_app()->pool.event);
+    ogs_thread_mutex_init(&pool_mutex);
 
 #if defined(HAVE_KQUEUE)
     ogs_assert(ogs_app()->pollset);
@@ -62,6 +65,7 @@ void upf_event_term(void)
 
 void upf_event_final(void)
 {
+    ogs_thread_mutex_destroy(&pool_mutex);
     ogs_pool_final(&pool);
 }
 
@@ -69,7 +73,9 @@ upf_event_t *upf_event_new(upf_event_e id)
 {
     upf_event_t *e = NULL;
 
+    ogs_thread_mutex_lock(&pool_mutex);
     ogs_pool_alloc(&pool, &e);
+    ogs_thread_mutex_unlock(&pool_mutex);
     ogs_assert(e);
     memset(e, 0, sizeof(*e));
 
@@ -81,7 +87,9 @@ upf_event_t *upf_event_new(upf_event_e id)
 void upf_event_free(upf_event_t *e)
 {
     ogs_assert(e);
+    ogs_thread_mutex_lock(&pool_mutex);
     ogs_pool_free(&pool, e);
+    ogs_thread_mutex_unlock(&pool_mutex);
 }
 
 const char *upf_event_get_name(upf_event_t *e)
@@ -101,6 +109,10 @@ const char *upf_event_get_name(upf_event_t *e)
         return "UPF_EVT_N4_TIMER";
     case UPF_EVT_N4_NO_HEARTBEAT:
         return "UPF_EVT_N4_NO_HEARTBEAT";
+    case UPF_EVT_SESS_REPORT:
+        return "UPF_EVT_SESS_REPORT";
+    case UPF_EVT_SESS_URR_CHECK:
+        return "UPF_EVT_SESS_URR_CHECK";
 
     default: 
        break;
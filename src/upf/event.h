@@ -29,6 +29,7 @@ extern "C" {
 typedef struct ogs_pfcp_node_s ogs_pfcp_node_t;
 typedef struct ogs_pfcp_xact_s ogs_pfcp_xact_t;
 typedef struct ogs_pfcp_message_s ogs_pfcp_message_t;
+typedef struct ogs_pfcp_user_plane_report_s ogs_pfcp_user_plane_report_t;
 typedef struct upf_sess_s upf_sess_t;
 
 typedef enum {
@@ -38,6 +39,9 @@ typedef enum {
     UPF_EVT_N4_TIMER,
     UPF_EVT_N4_NO_HEARTBEAT,
 
+    UPF_EVT_SESS_REPORT,
+    UPF_EVT_SESS_URR_CHECK,
+
     UPF_EVT_TOP,
 
 } upf_event_e;
@@ -51,6 +55,12 @@ typedef struct upf_event_s {
     ogs_pfcp_node_t *pfcp_node;
     ogs_pfcp_xact_t *pfcp_xact;
     ogs_pfcp_message_t *pfcp_message;
+
+    /* Posted by datapath workers */
+    uint32_t sess_id;
+    uint32_t sess_generation;
+    uint32_t urr_id;
+    ogs_pfcp_user_plane_report_t *report;
 } upf_event_t;
 
 OGS_STATIC_ASSERT(OGS_EVENT_SIZE >= sizeof(upf_event_t));
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "fwd.h"
+
+#if HAVE_NETINET_IP_H
+#include <netinet/ip.h>
+#endif
+
+#if HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+
+#define UPF_FWD_QFI_ANY         0xff
+#define UPF_FWD_TEID_KEY(teid, qfi) (((uint64_t)(teid) << 8) | (qfi))
+
+typedef enum {
+    UPF_FWD_TEID = 0,
+    UPF_FWD_IPV4,
+    UPF_FWD_IPV6,
+    UPF_FWD_MAX_TABLE,
+} upf_fwd_table_e;
+
+static ogs_ihash_t *fwd_table[UPF_FWD_MAX_TABLE];
+
+void upf_fwd_init(void)
+{
+    int i;
+
+    for (i = 0; i < UPF_FWD_MAX_TABLE; i++) {
+        fwd_table[i] = ogs_ihash_make();
+        ogs_assert(fwd_table[i]);
+    }
+}
+
+void upf_fwd_final(void)
+{
+    int i;
+
+    for (i = 0; i < UPF_FWD_MAX_TABLE; i++) {
+        ogs_assert(ogs_ihash_count(fwd_table[i]) == 0);
+        ogs_ihash_destroy(fwd_table[i]);
+        fwd_table[i] = NULL;
+    }
+}
+
+static void fwd_add(upf_sess_t *sess,
+        uint8_t table, uint64_t key, ogs_pfcp_pdr_t *pdr)
+{
+    upf_fwd_t *fwd = NULL;
+    int i;
+
+    ogs_assert(sess);
+    ogs_assert(pdr);
+
+    for (i = 0; i < sess->num_of_fwd; i++) {
+        fwd = &sess->fwd[i];
+        if (fwd->table == table && fwd->key == key)
+            return;
+    }
+
+    ogs_assert(sess->num_of_fwd < UPF_MAX_NUM_OF_FWD);
+    fwd = &sess->fwd[sess->num_of_fwd++];
+
+    fwd->key = key;
+    fwd->table = table;
+    fwd->sess = sess;
+    fwd->pdr = pdr;
+
+    /* The last setter owns the key, as with ogs_hash_set() */
+    ogs_ihash_set(fwd_table[table], key, fwd);
+}
+
+static void fwd_add_uplink(upf_sess_t *sess, uint32_t teid, uint8_t qfi)
+{
+    ogs_pfcp_pdr_t *pdr = NULL;
+
+    /* Same selection as upf_gtp_handle_gtpu() */
+    ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
+        if (pdr->src_if != OGS_PFCP_INTERFACE_ACCESS &&
+            pdr->src_if != OGS_PFCP_INTERFACE_CP_FUNCTION)
+            continue;
+
+        if (teid != pdr->f_teid.teid)
+            continue;
+
+        if (qfi && pdr->qfi != qfi)
+            continue;
+
+        break;
+    }
+
+    /* Depends on the SDF Filter */
+    if (!pdr || ogs_list_first(&pdr->rule_list))
+        return;
+
+    fwd_add(sess, UPF_FWD_TEID, UPF_FWD_TEID_KEY(teid, qfi), pdr);
+}
+
+static void fwd_add_downlink(upf_sess_t *sess)
+{
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_pdr_t *fallback_pdr = NULL;
+    ogs_pfcp_far_t *far = NULL;
+    uint64_t key;
+
+    /* Same selection as upf_gtp_handle_downlink() */
+    ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
+        far = pdr->far;
+        ogs_assert(far);
+
+        if (pdr->src_if != OGS_PFCP_INTERFACE_CORE)
+            continue;
+
+        fallback_pdr = pdr;
+
+        if (far->dst_if != OGS_PFCP_INTERFACE_ACCESS)
+            continue;
+
+        if (far->outer_header_creation.ip4 == 0 &&
+            far->outer_header_creation.ip6 == 0 &&
+            far->outer_header_creation.udp4 == 0 &&
+            far->outer_header_creation.udp6 == 0 &&
+            far->outer_header_creation.gtpu4 == 0 &&
+            far->outer_header_creation.gtpu6 == 0)
+            continue;
+
+        break;
+    }
+
+    if (!pdr)
+        pdr = fallback_pdr;
+    else if (ogs_list_first(&pdr->rule_list))
+        pdr = NULL; /* Depends on the SDF Filter */
+
+    if (!pdr)
+        return;
+
+    if (sess->ipv4 && upf_sess_find_by_ipv4(sess->ipv4->addr[0]) == sess)
+        fwd_add(sess, UPF_FWD_IPV4, sess->ipv4->addr[0], pdr);
+
+    if (sess->ipv6 && upf_sess_find_by_ipv6(sess->ipv6->addr) == sess) {
+        memcpy(&key, sess->ipv6->addr, sizeof(key));
+        fwd_add(sess, UPF_FWD_IPV6, key, pdr);
+    }
+}
+
+void upf_fwd_update(upf_sess_t *sess)
+{
+    ogs_pfcp_object_t *obj = NULL;
+    ogs_pfcp_pdr_t *pdr = NULL;
+
+    ogs_assert(sess);
+
+    upf_fwd_remove(sess);
+
+    ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
+        if (pdr->src_if != OGS_PFCP_INTERFACE_ACCESS &&
+            pdr->src_if != OGS_PFCP_INTERFACE_CP_FUNCTION)
+            continue;
+
+        if (!pdr->f_teid_len)
+            continue;
+
+        obj = ogs_pfcp_object_find_by_teid(pdr->f_teid.teid);
+        if (!obj)
+            continue;
+
+        if (obj->type == OGS_PFCP_OBJ_PDR_TYPE) {
+            /* The TEID selects this PDR regardless of QFI */
+            if (obj == &pdr->obj)
+                fwd_add(sess, UPF_FWD_TEID, UPF_FWD_TEID_KEY(
+                            pdr->f_teid.teid, UPF_FWD_QFI_ANY), pdr);
+        } else if (obj == &sess->pfcp.obj) {
+            /* G-PDU without QFI and with the QFI of this PDR */
+            fwd_add_uplink(sess, pdr->f_teid.teid, 0);
+            if (pdr->qfi)
+                fwd_add_uplink(sess, pdr->f_teid.teid, pdr->qfi);
+        }
+    }
+
+    fwd_add_downlink(sess);
+}
+
+void upf_fwd_remove(upf_sess_t *sess)
+{
+    upf_fwd_t *fwd = NULL;
+    int i;
+
+    ogs_assert(sess);
+
+    for (i = 0; i < sess->num_of_fwd; i++) {
+        fwd = &sess->fwd[i];
+
+        /* Remove the key only if it still belongs to this entry */
+        if (ogs_ihash_get(fwd_table[fwd->table], fwd->key) == fwd)
+            ogs_ihash_set(fwd_table[fwd->table], fwd->key, NULL);
+    }
+
+    sess->num_of_fwd = 0;
+}
+
+upf_fwd_t *upf_fwd_find_by_teid(uint32_t teid, uint8_t qfi)
+{
+    upf_fwd_t *fwd = NULL;
+
+    fwd = ogs_ihash_get(fwd_table[UPF_FWD_TEID], UPF_FWD_TEID_KEY(teid, qfi));
+    if (!fwd)
+        fwd = ogs_ihash_get(fwd_table[UPF_FWD_TEID],
+                UPF_FWD_TEID_KEY(teid, UPF_FWD_QFI_ANY));
+
+    return fwd;
+}
+
+upf_fwd_t *upf_fwd_find_by_ue_ip(ogs_pkbuf_t *pkbuf)
+{
+    struct ip *ip_h = NULL;
+    struct ip6_hdr *ip6_h = NULL;
+    uint64_t key;
+
+    ogs_assert(pkbuf);
+    ogs_assert(pkbuf->data);
+
+    ip_h = (struct ip *)pkbuf->data;
+    if (ip_h->ip_v == 4) {
+        return ogs_ihash_get(fwd_table[UPF_FWD_IPV4], ip_h->ip_dst.s_addr);
+    } else if (ip_h->ip_v == 6) {
+        ip6_h = (struct ip6_hdr *)pkbuf->data;
+        memcpy(&key, ip6_h->ip6_dst.s6_addr, sizeof(key));
+        return ogs_ihash_get(fwd_table[UPF_FWD_IPV6], key);
+    }
+
+    return NULL;
+}
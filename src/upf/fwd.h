@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef UPF_FWD_H
+#define UPF_FWD_H
+
+#include "context.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Forwarding Cache
+ *
+ * Maps (TEID, QFI) and UE IP address directly to the session and PDR
+ * that the datapath would select, so that most packets skip the
+ * TEID/IP hash lookups and the PDR list walk.
+ *
+ * - Entries are rebuilt by upf_fwd_update() whenever N4 changes the
+ *   session, and removed by upf_fwd_remove().
+ * - No entry is made if the PDR selection depends on the SDF Filter.
+ *   Such packets, and packets for framed routes, miss the cache and
+ *   take the normal path.
+ * - Tables are only modified by the control thread under the worker
+ *   write lock.
+ */
+
+void upf_fwd_init(void);
+void upf_fwd_final(void);
+
+void upf_fwd_update(upf_sess_t *sess);
+void upf_fwd_remove(upf_sess_t *sess);
+
+upf_fwd_t *upf_fwd_find_by_teid(uint32_t teid, uint8_t qfi);
+upf_fwd_t *upf_fwd_find_by_ue_ip(ogs_pkbuf_t *pkbuf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UPF_FWD_H */
@@ -47,11 +47,17 @@
 #include <ifaddrs.h>
 #endif
 
+#if HAVE_LINUX_FILTER_H
+#include <linux/filter.h>
+#endif
+
 #include "arp-nd.h"
 #include "event.h"
 #include "gtp-path.h"
 #include "pfcp-path.h"
 #include "rule-match.h"
+#include "worker.h"
+#include "fwd.h"
 
 #define UPF_GTP_HANDLED     1
 
@@ -99,71 +105,128 @@ static uint16_t _get_eth_type(uint8_t *data, uint len) {
     return 0;
 }
 
-static void _gtpv1_tun_recv_common_cb(
-        short when, ogs_socket_t fd, bool has_eth, void *data)
+static void upf_gtp_send_session_report(upf_worker_t *worker,
+        upf_sess_t *sess, ogs_pfcp_user_plane_report_t *report)
 {
-    ogs_pkbuf_t *recvbuf = NULL;
+    upf_event_t *e = NULL;
 
-    upf_sess_t *sess = NULL;
-    ogs_pfcp_pdr_t *pdr = NULL;
-    ogs_pfcp_pdr_t *fallback_pdr = NULL;
-    ogs_pfcp_far_t *far = NULL;
-    ogs_pfcp_user_plane_report_t report;
-    int i;
+    ogs_assert(sess);
+    ogs_assert(report);
 
-    recvbuf = ogs_tun_read(fd, packet_pool);
-    if (!recvbuf) {
-        ogs_warn("ogs_tun_read() failed");
+    if (!worker) {
+        ogs_assert(OGS_OK ==
+            upf_pfcp_send_session_report_request(sess, report));
         return;
     }
 
-    if (has_eth) {
-        ogs_pkbuf_t *replybuf = NULL;
-        uint16_t eth_type = _get_eth_type(recvbuf->data, recvbuf->len);
-        uint8_t size;
+    e = upf_event_new(UPF_EVT_SESS_REPORT);
+    ogs_assert(e);
+    e->sess_id = sess->index;
+    e->sess_generation = sess->generation;
+    e->report = ogs_memdup(report, sizeof(*report));
+    ogs_assert(e->report);
 
-        if (eth_type == ETHERTYPE_ARP) {
-            if (is_arp_req(recvbuf->data, recvbuf->len)) {
-                replybuf = ogs_pkbuf_alloc(packet_pool, OGS_MAX_PKT_LEN);
-                ogs_assert(replybuf);
-                ogs_pkbuf_reserve(replybuf, OGS_TUN_MAX_HEADROOM);
-                ogs_pkbuf_put(replybuf, OGS_MAX_PKT_LEN-OGS_TUN_MAX_HEADROOM);
-                size = arp_reply(replybuf->data, recvbuf->data, recvbuf->len,
-                    proxy_mac_addr);
-                ogs_pkbuf_trim(replybuf, size);
-                ogs_info("[SEND] reply to ARP request: %u", size);
-            } else {
-                goto cleanup;
-            }
-        } else if (eth_type == ETHERTYPE_IPV6 &&
-                    is_nd_req(recvbuf->data, recvbuf->len)) {
-            replybuf = ogs_pkbuf_alloc(packet_pool, OGS_MAX_PKT_LEN);
-            ogs_assert(replybuf);
-            ogs_pkbuf_reserve(replybuf, OGS_TUN_MAX_HEADROOM);
-            ogs_pkbuf_put(replybuf, OGS_MAX_PKT_LEN-OGS_TUN_MAX_HEADROOM);
-            size = nd_reply(replybuf->data, recvbuf->data, recvbuf->len,
-                proxy_mac_addr);
-            ogs_pkbuf_trim(replybuf, size);
-            ogs_info("[SEND] reply to ND solicit: %u", size);
-        }
-        if (replybuf) {
-            if (ogs_tun_write(fd, replybuf) != OGS_OK)
-                ogs_warn("ogs_tun_write() for reply failed");
-            
-            ogs_pkbuf_free(replybuf);
-            goto cleanup;
+    if (upf_worker_post(e) != OGS_OK) {
+        ogs_free(e->report);
+        upf_event_free(e);
+    }
+}
+
+/* Check Gate Status and MBR of the QER before forwarding */
+bool upf_gtp_qer_police(
+        ogs_pfcp_pdr_t *pdr, unsigned int len, bool is_uplink)
+{
+    ogs_assert(pdr);
+
+    if (!pdr->qer)
+        return true;
+
+    switch (ogs_pfcp_qer_police(pdr->qer, is_uplink, len)) {
+    case OGS_PFCP_QER_PASS:
+        return true;
+    case OGS_PFCP_QER_GATE_CLOSED:
+        upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_QER_GATEDROPPKT);
+        return false;
+    case OGS_PFCP_QER_MBR_EXCEEDED:
+        upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_QER_MBRDROPPKT);
+        return false;
+    default:
+        ogs_assert_if_reached();
+    }
+
+    return false;
+}
+
+static void upf_gtp_urr_acc_add(upf_worker_t *worker,
+        upf_sess_t *sess, ogs_pfcp_pdr_t *pdr, size_t size, bool is_uplink)
+{
+    ogs_pfcp_urr_t *urr = NULL;
+    upf_event_t *e = NULL;
+    int i;
+
+    for (i = 0; i < pdr->num_of_urr; i++) {
+        urr = pdr->urr[i];
+
+        if (!worker) {
+            upf_sess_urr_acc_add(sess, urr, size, is_uplink);
+            continue;
         }
-        if (eth_type != ETHERTYPE_IP && eth_type != ETHERTYPE_IPV6) {
-            ogs_error("[DROP] Invalid eth_type [%x]]", eth_type);
-            ogs_log_hexdump(OGS_LOG_ERROR, recvbuf->data, recvbuf->len);
-            goto cleanup;
+
+        if (upf_sess_urr_acc_add_by_worker(
+                    sess, urr, worker->id, size, is_uplink) == false)
+            continue;
+
+        e = upf_event_new(UPF_EVT_SESS_URR_CHECK);
+        ogs_assert(e);
+        e->sess_id = sess->index;
+        e->sess_generation = sess->generation;
+        e->urr_id = urr->id;
+
+        if (upf_worker_post(e) != OGS_OK) {
+            __atomic_store_n(&sess->urr_acc[urr->id].check_pending,
+                    false, __ATOMIC_RELEASE);
+            upf_event_free(e);
         }
-        ogs_pkbuf_pull(recvbuf, ETHER_HDR_LEN);
     }
+}
 
-    sess = upf_sess_find_by_ue_ip_address(recvbuf);
-    if (!sess)
-        goto cleanup;
+/*
+ * Downlink is sharded by UE IP address.
+ * IPv6 UE is identified by its /64 prefix.
+ */
+static upf_worker_t *upf_gtp_worker_by_ue_ip(ogs_pkbuf_t *pkbuf)
+{
+    struct ip *ip_h = NULL;
+    struct ip6_hdr *ip6_h = NULL;
+    uint32_t *addr = NULL;
+    uint32_t hash;
+
+    ip_h = (struct ip *)pkbuf->data;
+    if (ip_h->ip_v == 4 && pkbuf->len >= sizeof(struct ip)) {
+        hash = be32toh(ip_h->ip_dst.s_addr);
+    } else if (ip_h->ip_v == 6 && pkbuf->len >= sizeof(struct ip6_hdr)) {
+        ip6_h = (struct ip6_hdr *)pkbuf->data;
+        addr = (uint32_t *)ip6_h->ip6_dst.s6_addr;
+        hash = be32toh(addr[0] ^ addr[1]);
+    } else {
+        return NULL;
+    }
+
+    return upf_worker_find(hash % upf_worker_count());
+}
+
+static ogs_pfcp_pdr_t *upf_gtp_find_downlink_pdr(
+        upf_sess_t *sess, ogs_pkbuf_t *recvbuf)
+{
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_pdr_t *fallback_pdr = NULL;
+    ogs_pfcp_far_t *far = NULL;
+    ogs_pfcp_classifier_t *classifier = NULL;
+    uint32_t matched = 0;
+
+    classifier = sess->pfcp.classifier;
+    if (classifier)
+        matched = ogs_pfcp_classifier_match(classifier, recvbuf);
 
     ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
         far = pdr->far;
@@ -190,7 +253,10 @@ static void _gtpv1_tun_recv_common_cb(
             continue;
 
         /* Check if Rule List in PDR */
-        if (ogs_list_first(&pdr->rule_list) &&
+        if (classifier) {
+            if ((matched & OGS_PFCP_PDR_MASK(pdr)) == 0)
+                continue;
+        } else if (ogs_list_first(&pdr->rule_list) &&
             ogs_pfcp_pdr_rule_find_by_packet(pdr, recvbuf) == NULL)
             continue;
 
@@ -200,6 +266,30 @@ static void _gtpv1_tun_recv_common_cb(
     if (!pdr)
         pdr = fallback_pdr;
 
+    return pdr;
+}
+
+static void upf_gtp_handle_downlink(
+        upf_worker_t *worker, ogs_pkbuf_t *recvbuf)
+{
+    upf_sess_t *sess = NULL;
+    ogs_pfcp_pdr_t *pdr = NULL;
+    upf_fwd_t *fwd = NULL;
+    unsigned int len;
+    ogs_pfcp_user_plane_report_t report;
+
+    fwd = upf_fwd_find_by_ue_ip(recvbuf);
+    if (fwd) {
+        sess = fwd->sess;
+        pdr = fwd->pdr;
+    } else {
+        sess = upf_sess_find_by_ue_ip_address(recvbuf);
+        if (!sess)
+            goto cleanup;
+
+        pdr = upf_gtp_find_downlink_pdr(sess, recvbuf);
+    }
+
     if (!pdr) {
         if (ogs_app()->parameter.multicast) {
             upf_gtp_handle_multicast(recvbuf);
@@ -207,16 +297,22 @@ static void _gtpv1_tun_recv_common_cb(
         goto cleanup;
     }
 
+    len = recvbuf->len;
+
+    if (upf_gtp_qer_police(pdr, len, false) == false)
+        goto cleanup;
+
     /* Increment total & dl octets + pkts */
-    for (i = 0; i < pdr->num_of_urr; i++)
-        upf_sess_urr_acc_add(sess, pdr->urr[i], recvbuf->len, false);
+    upf_gtp_urr_acc_add(worker, sess, pdr, len, false);
 
+    /* recvbuf is consumed by ogs_pfcp_up_handle_pdr() */
     ogs_assert(true == ogs_pfcp_up_handle_pdr(
                 pdr, OGS_GTPU_MSGTYPE_GPDU, recvbuf, &report));
+    recvbuf = NULL;
 
     upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_GTP_OUTDATAPKTN3UPF);
     upf_metrics_inst_by_qfi_add(pdr->qer->qfi,
-        UPF_METR_CTR_GTP_OUTDATAVOLUMEQOSLEVELN3UPF, recvbuf->len);
+        UPF_METR_CTR_GTP_OUTDATAVOLUMEQOSLEVELN3UPF, len);
 
     if (report.type.downlink_data_report) {
         ogs_assert(pdr->sess);
@@ -227,14 +323,169 @@ static void _gtpv1_tun_recv_common_cb(
         if (pdr->qer && pdr->qer->qfi)
             report.downlink_data.qfi = pdr->qer->qfi; /* for 5GC */
 
-        ogs_assert(OGS_OK ==
-            upf_pfcp_send_session_report_request(sess, &report));
+        upf_gtp_send_session_report(worker, sess, &report);
     }
 
+cleanup:
+    if (recvbuf)
+        ogs_pkbuf_free(recvbuf);
+}
+
+static void upf_gtp_handle_tun(upf_worker_t *worker,
+        ogs_socket_t fd, bool has_eth, ogs_pkbuf_t *recvbuf,
+        uint32_t *handoff)
+{
+    upf_worker_t *owner = NULL;
+
+    if (has_eth) {
+        ogs_pkbuf_t *replybuf = NULL;
+        uint16_t eth_type = _get_eth_type(recvbuf->data, recvbuf->len);
+        uint8_t size;
+
+        if (eth_type == ETHERTYPE_ARP) {
+            if (is_arp_req(recvbuf->data, recvbuf->len)) {
+                replybuf = ogs_pkbuf_alloc(packet_pool, OGS_MAX_PKT_LEN);
+                ogs_assert(replybuf);
+                ogs_pkbuf_reserve(replybuf, OGS_TUN_MAX_HEADROOM);
+                ogs_pkbuf_put(replybuf, OGS_MAX_PKT_LEN-OGS_TUN_MAX_HEADROOM);
+                size = arp_reply(replybuf->data, recvbuf->data, recvbuf->len,
+                    proxy_mac_addr);
+                ogs_pkbuf_trim(replybuf, size);
+                ogs_info("[SEND] reply to ARP request: %u", size);
+            } else {
+                goto cleanup;
+            }
+        } else if (eth_type == ETHERTYPE_IPV6 &&
+                    is_nd_req(recvbuf->data, recvbuf->len)) {
+            replybuf = ogs_pkbuf_alloc(packet_pool, OGS_MAX_PKT_LEN);
+            ogs_assert(replybuf);
+            ogs_pkbuf_reserve(replybuf, OGS_TUN_MAX_HEADROOM);
+            ogs_pkbuf_put(replybuf, OGS_MAX_PKT_LEN-OGS_TUN_MAX_HEADROOM);
+            size = nd_reply(replybuf->data, recvbuf->data, recvbuf->len,
+                proxy_mac_addr);
+            ogs_pkbuf_trim(replybuf, size);
+            ogs_info("[SEND] reply to ND solicit: %u", size);
+        }
+        if (replybuf) {
+            if (ogs_tun_write(fd, replybuf) != OGS_OK)
+                ogs_warn("ogs_tun_write() for reply failed");
+            
+            ogs_pkbuf_free(replybuf);
+            goto cleanup;
+        }
+        if (eth_type != ETHERTYPE_IP && eth_type != ETHERTYPE_IPV6) {
+            ogs_error("[DROP] Invalid eth_type [%x]]", eth_type);
+            ogs_log_hexdump(OGS_LOG_ERROR, recvbuf->data, recvbuf->len);
+            goto cleanup;
+        }
+        ogs_pkbuf_pull(recvbuf, ETHER_HDR_LEN);
+    }
+
+    if (worker) {
+        owner = upf_gtp_worker_by_ue_ip(recvbuf);
+        if (owner && owner != worker) {
+            ogs_assert(handoff);
+            if (upf_worker_handoff(owner, recvbuf) == OGS_OK)
+                *handoff |= (1U << owner->id);
+            return;
+        }
+    }
+
+    upf_gtp_handle_downlink(worker, recvbuf);
+    return;
+
 cleanup:
     ogs_pkbuf_free(recvbuf);
 }
 
+/* One bit per worker in the handoff mask */
+OGS_STATIC_ASSERT(UPF_MAX_NUM_OF_WORKER <= sizeof(uint32_t) * 8);
+
+static void upf_gtp_wakeup_handoff(uint32_t handoff)
+{
+    int i;
+
+    for (i = 0; handoff; i++, handoff >>= 1) {
+        if (handoff & 1)
+            upf_worker_wakeup(upf_worker_find(i));
+    }
+}
+
+int upf_gtp_handle_handoff(upf_worker_t *worker)
+{
+    void *pkbuf[64];
+    unsigned int i, num;
+    int rv;
+
+    ogs_assert(worker);
+
+    rv = ogs_queue_trypop_bulk(worker->queue,
+            pkbuf, OGS_ARRAY_SIZE(pkbuf), &num);
+    if (rv != OGS_OK)
+        return rv;
+
+    upf_worker_rdlock();
+    ogs_gtp_tx_batch_start();
+
+    do {
+        for (i = 0; i < num; i++)
+            upf_gtp_handle_downlink(worker, pkbuf[i]);
+    } while (ogs_queue_trypop_bulk(worker->queue,
+                pkbuf, OGS_ARRAY_SIZE(pkbuf), &num) == OGS_OK);
+
+    ogs_gtp_tx_batch_flush();
+    upf_worker_rdunlock();
+
+    return OGS_OK;
+}
+
+static void _gtpv1_tun_recv_common_cb(
+        short when, ogs_socket_t fd, bool has_eth, void *data)
+{
+    upf_worker_t *worker = data;
+    ogs_pkbuf_t *recvbuf = NULL;
+    uint32_t handoff = 0;
+    int i;
+
+    if (upf_self()->datapath.batch == 1 && !worker) {
+        recvbuf = ogs_tun_read(fd, packet_pool);
+        if (!recvbuf) {
+            ogs_warn("ogs_tun_read() failed");
+            return;
+        }
+
+        upf_gtp_handle_tun(NULL, fd, has_eth, recvbuf, NULL);
+        return;
+    }
+
+    /*
+     * Batch Mode
+     *
+     * The TUN device is non-blocking, so drain up to datapath.batch packets
+     * and send the resulting G-PDUs with sendmmsg() at the end.
+     *
+     * A datapath worker always runs here. Packets for a UE owned by
+     * another worker are handed off, and the owner is woken up once.
+     */
+    if (worker)
+        upf_worker_rdlock();
+    ogs_gtp_tx_batch_start();
+
+    for (i = 0; i < upf_self()->datapath.batch; i++) {
+        recvbuf = ogs_tun_read(fd, packet_pool);
+        if (!recvbuf)
+            break;
+
+        upf_gtp_handle_tun(worker, fd, has_eth, recvbuf, &handoff);
+    }
+
+    ogs_gtp_tx_batch_flush();
+    if (worker)
+        upf_worker_rdunlock();
+
+    upf_gtp_wakeup_handoff(handoff);
+}
+
 static void _gtpv1_tun_recv_cb(short when, ogs_socket_t fd, void *data)
 {
     _gtpv1_tun_recv_common_cb(when, fd, false, data);
@@ -245,41 +496,84 @@ static void _gtpv1_tun_recv_eth_cb(short when, ogs_socket_t fd, void *data)
     _gtpv1_tun_recv_common_cb(when, fd, true, data);
 }
 
-static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
+static ogs_pfcp_pdr_t *upf_gtp_find_uplink_pdr(
+        uint32_t teid, uint8_t qfi, ogs_pkbuf_t *pkbuf)
+{
+    ogs_pfcp_object_t *pfcp_object = NULL;
+    ogs_pfcp_sess_t *pfcp_sess = NULL;
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_classifier_t *classifier = NULL;
+    uint32_t matched = 0;
+
+    pfcp_object = ogs_pfcp_object_find_by_teid(teid);
+    if (!pfcp_object)
+        return NULL;
+
+    switch(pfcp_object->type) {
+    case OGS_PFCP_OBJ_PDR_TYPE:
+        pdr = (ogs_pfcp_pdr_t *)pfcp_object;
+        ogs_assert(pdr);
+        break;
+    case OGS_PFCP_OBJ_SESS_TYPE:
+        pfcp_sess = (ogs_pfcp_sess_t *)pfcp_object;
+        ogs_assert(pfcp_sess);
+
+        classifier = pfcp_sess->classifier;
+        if (classifier)
+            matched = ogs_pfcp_classifier_match(classifier, pkbuf);
+
+        ogs_list_for_each(&pfcp_sess->pdr_list, pdr) {
+
+            /* Check if Source Interface */
+            if (pdr->src_if != OGS_PFCP_INTERFACE_ACCESS &&
+                pdr->src_if != OGS_PFCP_INTERFACE_CP_FUNCTION)
+                continue;
+
+            /* Check if TEID */
+            if (teid != pdr->f_teid.teid)
+                continue;
+
+            /* Check if QFI */
+            if (qfi && pdr->qfi != qfi)
+                continue;
+
+            /* Check if Rule List in PDR */
+            if (classifier) {
+                if ((matched & OGS_PFCP_PDR_MASK(pdr)) == 0)
+                    continue;
+            } else if (ogs_list_first(&pdr->rule_list) &&
+                ogs_pfcp_pdr_rule_find_by_packet(pdr, pkbuf) == NULL)
+                continue;
+
+            break;
+        }
+
+        break;
+    default:
+        ogs_fatal("Unknown type [%d]", pfcp_object->type);
+        ogs_assert_if_reached();
+    }
+
+    return pdr;
+}
+
+static void upf_gtp_handle_gtpu(upf_worker_t *worker,
+        ogs_socket_t fd, ogs_pkbuf_t *pkbuf, ogs_sockaddr_t *from)
 {
     int len;
-    ssize_t size;
     char buf[OGS_ADDRSTRLEN];
 
     upf_sess_t *sess = NULL;
 
-    ogs_pkbuf_t *pkbuf = NULL;
-    ogs_sockaddr_t from;
-
     ogs_gtp2_header_t *gtp_h = NULL;
     ogs_pfcp_user_plane_report_t report;
 
     uint32_t teid;
     uint8_t qfi;
 
-    ogs_assert(fd != INVALID_SOCKET);
-
-    pkbuf = ogs_pkbuf_alloc(packet_pool, OGS_MAX_PKT_LEN);
-    ogs_assert(pkbuf);
-    ogs_pkbuf_reserve(pkbuf, OGS_TUN_MAX_HEADROOM);
-    ogs_pkbuf_put(pkbuf, OGS_MAX_PKT_LEN-OGS_TUN_MAX_HEADROOM);
-
-    size = ogs_recvfrom(fd, pkbuf->data, pkbuf->len, 0, &from);
-    if (size <= 0) {
-        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
-                "ogs_recv() failed");
-        goto cleanup;
-    }
-
-    ogs_pkbuf_trim(pkbuf, size);
-
     ogs_assert(pkbuf);
     ogs_assert(pkbuf->len);
+    ogs_assert(from);
 
     gtp_h = (ogs_gtp2_header_t *)pkbuf->data;
     if (gtp_h->version != OGS_GTP2_VERSION_1) {
@@ -291,16 +585,16 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     if (gtp_h->type == OGS_GTPU_MSGTYPE_ECHO_REQ) {
         ogs_pkbuf_t *echo_rsp;
 
-        ogs_debug("[RECV] Echo Request from [%s]", OGS_ADDR(&from, buf));
+        ogs_debug("[RECV] Echo Request from [%s]", OGS_ADDR(from, buf));
         echo_rsp = ogs_gtp2_handle_echo_req(pkbuf);
         ogs_expect(echo_rsp);
         if (echo_rsp) {
             ssize_t sent;
 
             /* Echo reply */
-            ogs_debug("[SEND] Echo Response to [%s]", OGS_ADDR(&from, buf));
+            ogs_debug("[SEND] Echo Response to [%s]", OGS_ADDR(from, buf));
 
-            sent = ogs_sendto(fd, echo_rsp->data, echo_rsp->len, 0, &from);
+            sent = ogs_sendto(fd, echo_rsp->data, echo_rsp->len, 0, from);
             if (sent < 0 || sent != echo_rsp->len) {
                 ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
                         "ogs_sendto() failed");
@@ -313,7 +607,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     teid = be32toh(gtp_h->teid);
 
     ogs_debug("[RECV] GPU-U Type [%d] from [%s] : TEID[0x%x]",
-            gtp_h->type, OGS_ADDR(&from, buf), teid);
+            gtp_h->type, OGS_ADDR(from, buf), teid);
 
     qfi = 0;
     if (gtp_h->flags & OGS_GTPU_FLAGS_E) {
@@ -370,8 +664,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
                 sess = UPF_SESS(far->sess);
                 ogs_assert(sess);
 
-                ogs_assert(OGS_OK ==
-                    upf_pfcp_send_session_report_request(sess, &report));
+                upf_gtp_send_session_report(worker, sess, &report);
             }
 
         } else {
@@ -383,14 +676,12 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
         uint16_t eth_type = 0;
         struct ip *ip_h = NULL;
         uint32_t *src_addr = NULL;
-        ogs_pfcp_object_t *pfcp_object = NULL;
-        ogs_pfcp_sess_t *pfcp_sess = NULL;
         ogs_pfcp_pdr_t *pdr = NULL;
         ogs_pfcp_far_t *far = NULL;
+        upf_fwd_t *fwd = NULL;
 
         ogs_pfcp_subnet_t *subnet = NULL;
         ogs_pfcp_dev_t *dev = NULL;
-        int i;
 
         ip_h = (struct ip *)pkbuf->data;
         ogs_assert(ip_h);
@@ -399,55 +690,17 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
         upf_metrics_inst_by_qfi_add(qfi,
                 UPF_METR_CTR_GTP_INDATAVOLUMEQOSLEVELN3UPF, pkbuf->len);
 
-        pfcp_object = ogs_pfcp_object_find_by_teid(teid);
-        if (!pfcp_object) {
+        fwd = upf_fwd_find_by_teid(teid, qfi);
+        if (fwd)
+            pdr = fwd->pdr;
+        else
+            pdr = upf_gtp_find_uplink_pdr(teid, qfi, pkbuf);
+
+        if (!pdr) {
             /* TODO : Send Error Indication */
             goto cleanup;
         }
 
-        switch(pfcp_object->type) {
-        case OGS_PFCP_OBJ_PDR_TYPE:
-            pdr = (ogs_pfcp_pdr_t *)pfcp_object;
-            ogs_assert(pdr);
-            break;
-        case OGS_PFCP_OBJ_SESS_TYPE:
-            pfcp_sess = (ogs_pfcp_sess_t *)pfcp_object;
-            ogs_assert(pfcp_sess);
-
-            ogs_list_for_each(&pfcp_sess->pdr_list, pdr) {
-
-                /* Check if Source Interface */
-                if (pdr->src_if != OGS_PFCP_INTERFACE_ACCESS &&
-                    pdr->src_if != OGS_PFCP_INTERFACE_CP_FUNCTION)
-                    continue;
-
-                /* Check if TEID */
-                if (teid != pdr->f_teid.teid)
-                    continue;
-
-                /* Check if QFI */
-                if (qfi && pdr->qfi != qfi)
-                    continue;
-
-                /* Check if Rule List in PDR */
-                if (ogs_list_first(&pdr->rule_list) &&
-                    ogs_pfcp_pdr_rule_find_by_packet(pdr, pkbuf) == NULL)
-                    continue;
-
-                break;
-            }
-
-            if (!pdr) {
-                /* TODO : Send Error Indication */
-                goto cleanup;
-            }
-
-            break;
-        default:
-            ogs_fatal("Unknown type [%d]", pfcp_object->type);
-            ogs_assert_if_reached();
-        }
-
         ogs_assert(pdr);
         ogs_assert(pdr->sess);
         ogs_assert(pdr->sess->obj.type == OGS_PFCP_OBJ_SESS_TYPE);
@@ -594,9 +847,11 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
             dev = subnet->dev;
             ogs_assert(dev);
 
+            if (upf_gtp_qer_police(pdr, pkbuf->len, true) == false)
+                goto cleanup;
+
             /* Increment total & ul octets + pkts */
-            for (i = 0; i < pdr->num_of_urr; i++)
-                upf_sess_urr_acc_add(sess, pdr->urr[i], pkbuf->len, true);
+            upf_gtp_urr_acc_add(worker, sess, pdr, pkbuf->len, true);
 
             if (dev->is_tap) {
                 ogs_assert(eth_type);
@@ -616,6 +871,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
         } else if (far->dst_if == OGS_PFCP_INTERFACE_ACCESS) {
             ogs_assert(true == ogs_pfcp_up_handle_pdr(
                         pdr, gtp_h->type, pkbuf, &report));
+            pkbuf = NULL;
 
             if (report.type.downlink_data_report) {
                 ogs_error("Indirect Data Fowarding Buffered");
@@ -624,8 +880,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
                 if (pdr->qer && pdr->qer->qfi)
                     report.downlink_data.qfi = pdr->qer->qfi; /* for 5GC */
 
-                ogs_assert(OGS_OK ==
-                    upf_pfcp_send_session_report_request(sess, &report));
+                upf_gtp_send_session_report(worker, sess, &report);
             }
 
         } else if (far->dst_if == OGS_PFCP_INTERFACE_CP_FUNCTION) {
@@ -643,6 +898,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
 
             ogs_assert(true == ogs_pfcp_up_handle_pdr(
                         pdr, gtp_h->type, pkbuf, &report));
+            pkbuf = NULL;
 
             ogs_assert(report.type.downlink_data_report == 0);
 
@@ -656,7 +912,85 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     }
 
 cleanup:
-    ogs_pkbuf_free(pkbuf);
+    if (pkbuf)
+        ogs_pkbuf_free(pkbuf);
+}
+
+static ogs_pkbuf_t *gtpu_pkbuf_alloc(void)
+{
+    ogs_pkbuf_t *pkbuf = NULL;
+
+    pkbuf = ogs_pkbuf_alloc(packet_pool, OGS_MAX_PKT_LEN);
+    ogs_assert(pkbuf);
+    ogs_pkbuf_reserve(pkbuf, OGS_TUN_MAX_HEADROOM);
+    ogs_pkbuf_put(pkbuf, OGS_MAX_PKT_LEN-OGS_TUN_MAX_HEADROOM);
+
+    return pkbuf;
+}
+
+static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
+{
+    upf_worker_t *worker = data;
+    ssize_t size;
+    int i, n, batch;
+
+    ogs_pkbuf_t *pkbuf[OGS_MAX_NUM_OF_MMSG];
+    ogs_sockaddr_t from[OGS_MAX_NUM_OF_MMSG];
+
+    ogs_assert(fd != INVALID_SOCKET);
+
+    batch = upf_self()->datapath.batch;
+
+    if (batch == 1) {
+        pkbuf[0] = gtpu_pkbuf_alloc();
+
+        size = ogs_recvfrom(fd, pkbuf[0]->data, pkbuf[0]->len, 0, &from[0]);
+        if (size <= 0) {
+            ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                    "ogs_recv() failed");
+            ogs_pkbuf_free(pkbuf[0]);
+            return;
+        }
+
+        ogs_pkbuf_trim(pkbuf[0], size);
+
+        if (worker)
+            upf_worker_rdlock();
+        upf_gtp_handle_gtpu(worker, fd, pkbuf[0], &from[0]);
+        if (worker)
+            upf_worker_rdunlock();
+        return;
+    }
+
+    /*
+     * Batch Mode
+     *
+     * Drain up to datapath.batch datagrams with one recvmmsg(),
+     * and send the resulting G-PDUs with sendmmsg() at the end.
+     */
+    for (i = 0; i < batch; i++)
+        pkbuf[i] = gtpu_pkbuf_alloc();
+
+    n = ogs_recvmmsg(fd, pkbuf, from, batch, 0);
+    if (n <= 0) {
+        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                "ogs_recvmmsg() failed");
+        n = 0;
+    }
+
+    if (worker)
+        upf_worker_rdlock();
+    ogs_gtp_tx_batch_start();
+
+    for (i = 0; i < n; i++)
+        upf_gtp_handle_gtpu(worker, fd, pkbuf[i], &from[i]);
+
+    ogs_gtp_tx_batch_flush();
+    if (worker)
+        upf_worker_rdunlock();
+
+    for (i = n; i < batch; i++)
+        ogs_pkbuf_free(pkbuf[i]);
 }
 
 int upf_gtp_init(void)
@@ -665,6 +999,7 @@ int upf_gtp_init(void)
     memset(&config, 0, sizeof config);
 
     config.cluster_2048_pool = ogs_app()->pool.packet;
+    config.hugepage = ogs_app()->pool.defconfig.hugepage;
 
 #if OGS_USE_TALLOC
     /* allocate a talloc pool for GTP to ensure it doesn't have to go back
@@ -709,6 +1044,118 @@ static void _get_dev_mac_addr(char *ifname, uint8_t *mac_addr)
 #endif
 }
 
+/*
+ * Uplink is sharded by TEID.
+ *
+ * The reuseport group is indexed in bind order, so the socket
+ * of worker N is at index N. Without this program, the kernel falls back
+ * to its 4-tuple hash, so a TEID still lands on one worker per peer.
+ */
+static void upf_gtp_steer_by_teid(ogs_sock_t *sock)
+{
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && HAVE_LINUX_FILTER_H
+    /* UDP payload starts at offset 0, and TEID is at offset 4 */
+    struct sock_filter code[] = {
+        { BPF_LD | BPF_W | BPF_ABS, 0, 0, 4 },
+        { BPF_ALU | BPF_MOD | BPF_K, 0, 0, 0 },
+        { BPF_RET | BPF_A, 0, 0, 0 },
+    };
+    struct sock_fprog prog;
+
+    code[1].k = upf_worker_count();
+
+    memset(&prog, 0, sizeof(prog));
+    prog.len = OGS_ARRAY_SIZE(code);
+    prog.filter = code;
+
+    if (setsockopt(sock->fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+                &prog, sizeof(prog)) != 0) {
+        ogs_log_message(OGS_LOG_WARN, ogs_socket_errno,
+                "setsockopt(SO_ATTACH_REUSEPORT_CBPF) failed");
+    }
+#else
+    ogs_warn("GTP-U cannot be steered by TEID on this platform");
+#endif
+}
+
+static int upf_gtp_open_worker_gtpu(ogs_socknode_t *node)
+{
+    upf_worker_t *worker = NULL;
+    ogs_socknode_t *wnode = NULL;
+    int i;
+
+    ogs_assert(node);
+    ogs_assert(node->sock);
+
+    for (i = 0; i < upf_worker_count(); i++) {
+        worker = upf_worker_find(i);
+
+        if (i == 0) {
+            /* The first worker takes over the server socket */
+            node->poll = ogs_pollset_add(worker->pollset,
+                    OGS_POLLIN, node->sock->fd, _gtpv1_u_recv_cb, worker);
+            ogs_assert(node->poll);
+            continue;
+        }
+
+        wnode = ogs_socknode_add(
+                &worker->gtpu_list, AF_UNSPEC, node->addr, node->option);
+        ogs_assert(wnode);
+
+        wnode->sock = ogs_udp_server(wnode->addr, wnode->option);
+        if (!wnode->sock) {
+            ogs_error("Worker[%d] cannot open GTP-U socket", worker->id);
+            return OGS_ERROR;
+        }
+
+        wnode->poll = ogs_pollset_add(worker->pollset,
+                OGS_POLLIN, wnode->sock->fd, _gtpv1_u_recv_cb, worker);
+        ogs_assert(wnode->poll);
+    }
+
+    upf_gtp_steer_by_teid(node->sock);
+
+    return OGS_OK;
+}
+
+static int upf_gtp_open_worker_tun(ogs_pfcp_dev_t *dev)
+{
+    upf_worker_t *worker = NULL;
+    ogs_socket_t fd;
+    int i;
+
+    ogs_assert(dev);
+
+    for (i = 0; i < upf_worker_count(); i++) {
+        worker = upf_worker_find(i);
+        ogs_assert(worker->num_of_tun < OGS_MAX_NUM_OF_DEV);
+
+        if (i == 0) {
+            fd = dev->fd;
+        } else {
+            fd = ogs_tun_open_queue(
+                    dev->ifname, OGS_MAX_IFNAME_LEN, dev->is_tap);
+            if (fd == INVALID_SOCKET) {
+                ogs_error("Worker[%d] cannot open queue(dev:%s)",
+                        worker->id, dev->ifname);
+                return OGS_ERROR;
+            }
+        }
+
+        worker->tun[worker->num_of_tun].dev = dev;
+        worker->tun[worker->num_of_tun].fd = fd;
+        worker->tun[worker->num_of_tun].poll = ogs_pollset_add(
+                worker->pollset, OGS_POLLIN, fd,
+                dev->is_tap ? _gtpv1_tun_recv_eth_cb : _gtpv1_tun_recv_cb,
+                worker);
+        ogs_assert(worker->tun[worker->num_of_tun].poll);
+
+        worker->num_of_tun++;
+    }
+
+    return OGS_OK;
+}
+
 int upf_gtp_open(void)
 {
     ogs_pfcp_dev_t *dev = NULL;
@@ -718,6 +1165,16 @@ int upf_gtp_open(void)
     int rc;
 
     ogs_list_for_each(&ogs_gtp_self()->gtpu_list, node) {
+        if (upf_worker_count()) {
+            /* Every worker binds its own socket to the same address */
+            if (!node->option) {
+                node->option = ogs_calloc(1, sizeof(*node->option));
+                ogs_assert(node->option);
+                ogs_sockopt_init(node->option);
+            }
+            node->option->so_reuseport = true;
+        }
+
         sock = ogs_gtp_server(node);
         if (!sock) return OGS_ERROR;
 
@@ -726,9 +1183,14 @@ int upf_gtp_open(void)
         else if (sock->family == AF_INET6)
             ogs_gtp_self()->gtpu_sock6 = sock;
 
-        node->poll = ogs_pollset_add(ogs_app()->pollset,
-                OGS_POLLIN, sock->fd, _gtpv1_u_recv_cb, sock);
-        ogs_assert(node->poll);
+        if (upf_worker_count()) {
+            rc = upf_gtp_open_worker_gtpu(node);
+            if (rc != OGS_OK) return rc;
+        } else {
+            node->poll = ogs_pollset_add(ogs_app()->pollset,
+                    OGS_POLLIN, sock->fd, _gtpv1_u_recv_cb, NULL);
+            ogs_assert(node->poll);
+        }
     }
 
     OGS_SETUP_GTPU_SERVER;
@@ -747,12 +1209,27 @@ int upf_gtp_open(void)
     /* Open Tun interface */
     ogs_list_for_each(&ogs_pfcp_self()->dev_list, dev) {
         dev->is_tap = strstr(dev->ifname, "tap");
-        dev->fd = ogs_tun_open(dev->ifname, OGS_MAX_IFNAME_LEN, dev->is_tap);
+        if (upf_worker_count())
+            dev->fd = ogs_tun_open_queue(
+                    dev->ifname, OGS_MAX_IFNAME_LEN, dev->is_tap);
+        else
+            dev->fd = ogs_tun_open(
+                    dev->ifname, OGS_MAX_IFNAME_LEN, dev->is_tap);
         if (dev->fd == INVALID_SOCKET) {
             ogs_error("tun_open(dev:%s) failed", dev->ifname);
             return OGS_ERROR;
         }
 
+        if (upf_worker_count()) {
+            if (dev->is_tap)
+                _get_dev_mac_addr(dev->ifname, dev->mac_addr);
+
+            rc = upf_gtp_open_worker_tun(dev);
+            if (rc != OGS_OK) return rc;
+
+            continue;
+        }
+
         if (dev->is_tap) {
             _get_dev_mac_addr(dev->ifname, dev->mac_addr);
             dev->poll = ogs_pollset_add(ogs_app()->pollset,
@@ -793,9 +1270,26 @@ int upf_gtp_open(void)
 void upf_gtp_close(void)
 {
     ogs_pfcp_dev_t *dev = NULL;
+    upf_worker_t *worker = NULL;
+    int i, j;
 
     ogs_socknode_remove_all(&ogs_gtp_self()->gtpu_list);
 
+    for (i = 0; i < upf_worker_count(); i++) {
+        worker = upf_worker_find(i);
+
+        ogs_socknode_remove_all(&worker->gtpu_list);
+
+        for (j = 0; j < worker->num_of_tun; j++) {
+            if (worker->tun[j].poll)
+                ogs_pollset_remove(worker->tun[j].poll);
+            /* The first queue is closed below as dev->fd */
+            if (worker->tun[j].fd != worker->tun[j].dev->fd)
+                ogs_closesocket(worker->tun[j].fd);
+        }
+        worker->num_of_tun = 0;
+    }
+
     ogs_list_for_each(&ogs_pfcp_self()->dev_list, dev) {
         if (dev->poll)
             ogs_pollset_remove(dev->poll);
@@ -831,9 +1325,18 @@ static void upf_gtp_handle_multicast(ogs_pkbuf_t *recvbuf)
 
                     ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
                         if (pdr->src_if == OGS_PFCP_INTERFACE_CORE) {
+                            ogs_pkbuf_t *sendbuf = NULL;
+
+                            /* The caller still owns recvbuf */
+                            sendbuf = ogs_pkbuf_copy(recvbuf);
+                            if (!sendbuf) {
+                                ogs_error("ogs_pkbuf_copy() failed");
+                                return;
+                            }
+
                             ogs_assert(true ==
                                 ogs_pfcp_up_handle_pdr(pdr,
-                                    OGS_GTPU_MSGTYPE_GPDU, recvbuf, &report));
+                                    OGS_GTPU_MSGTYPE_GPDU, sendbuf, &report));
                             break;
                         }
                     }
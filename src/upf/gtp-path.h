@@ -22,6 +22,7 @@
 
 #include "ogs-tun.h"
 #include "ogs-gtp.h"
+#include "ogs-pfcp.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,6 +34,12 @@ void upf_gtp_final(void);
 int upf_gtp_open(void);
 void upf_gtp_close(void);
 
+typedef struct upf_worker_s upf_worker_t;
+int upf_gtp_handle_handoff(upf_worker_t *worker);
+
+bool upf_gtp_qer_police(
+        ogs_pfcp_pdr_t *pdr, unsigned int len, bool is_uplink);
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,6 +21,7 @@
 #include "gtp-path.h"
 #include "pfcp-path.h"
 #include "metrics.h"
+#include "worker.h"
 
 static ogs_thread_t *thread;
 static void upf_main(void *data);
@@ -55,6 +56,9 @@ int upf_initialize()
     rv = upf_context_parse_config();
     if (rv != OGS_OK) return rv;
 
+    rv = upf_worker_init();
+    if (rv != OGS_OK) return rv;
+
     rv = ogs_log_config_domain(
             ogs_app()->logger.domain, ogs_app()->logger.level);
     if (rv != OGS_OK) return rv;
@@ -70,6 +74,9 @@ int upf_initialize()
     rv = upf_gtp_open();
     if (rv != OGS_OK) return rv;
 
+    rv = upf_worker_start();
+    if (rv != OGS_OK) return rv;
+
     thread = ogs_thread_create(upf_main, NULL);
     if (!thread) return OGS_ERROR;
 
@@ -86,9 +93,13 @@ void upf_terminate(void)
 
     ogs_thread_destroy(thread);
 
+    upf_worker_stop();
+
     upf_pfcp_close();
     upf_gtp_close();
 
+    upf_worker_final();
+
     ogs_metrics_context_close(ogs_metrics_self());
 
     upf_context_final();
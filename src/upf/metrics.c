@@ -10,19 +10,10 @@ typedef struct upf_metrics_spec_def_s {
     int initial_val;
     unsigned int num_labels;
     const char **labels;
+    bool fast;
 } upf_metrics_spec_def_t;
 
 /* Helper generic functions: */
-static int upf_metrics_init_inst(ogs_metrics_inst_t **inst,
-        ogs_metrics_spec_t **specs, unsigned int len,
-        unsigned int num_labels, const char **labels)
-{
-    unsigned int i;
-    for (i = 0; i < len; i++)
-        inst[i] = ogs_metrics_inst_new(specs[i], num_labels, labels);
-    return OGS_OK;
-}
-
 static int upf_metrics_free_inst(ogs_metrics_inst_t **inst,
         unsigned int len)
 {
@@ -48,17 +39,20 @@ static int upf_metrics_init_spec(ogs_metrics_context_t *ctx,
 /* GLOBAL */
 ogs_metrics_spec_t *upf_metrics_spec_global[_UPF_METR_GLOB_MAX];
 ogs_metrics_inst_t *upf_metrics_inst_global[_UPF_METR_GLOB_MAX];
+ogs_metrics_fast_t *upf_metrics_fast_global[_UPF_METR_GLOB_MAX];
 upf_metrics_spec_def_t upf_metrics_spec_def_global[_UPF_METR_GLOB_MAX] = {
 /* Global Counters: */
 [UPF_METR_GLOB_CTR_GTP_INDATAPKTN3UPF] = {
     .type = OGS_METRICS_METRIC_TYPE_COUNTER,
     .name = "fivegs_ep_n3_gtp_indatapktn3upf",
     .description = "Number of incoming GTP data packets on the N3 interface",
+    .fast = true,
 },
 [UPF_METR_GLOB_CTR_GTP_OUTDATAPKTN3UPF] = {
     .type = OGS_METRICS_METRIC_TYPE_COUNTER,
     .name = "fivegs_ep_n3_gtp_outdatapktn3upf",
     .description = "Number of outgoing GTP data packets on the N3 interface",
+    .fast = true,
 },
 [UPF_METR_GLOB_CTR_SM_N4SESSIONESTABREQ] = {
     .type = OGS_METRICS_METRIC_TYPE_COUNTER,
@@ -75,6 +69,18 @@ upf_metrics_spec_def_t upf_metrics_spec_def_global[_UPF_METR_GLOB_MAX] = {
     .name = "fivegs_upffunction_sm_n4sessionreportsucc",
     .description = "Number of successful N4 session reports",
 },
+[UPF_METR_GLOB_CTR_QER_GATEDROPPKT] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "fivegs_upffunction_upf_qergatedroppkt",
+    .description = "Number of packets dropped by closed QER gate",
+    .fast = true,
+},
+[UPF_METR_GLOB_CTR_QER_MBRDROPPKT] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "fivegs_upffunction_upf_qermbrdroppkt",
+    .description = "Number of packets dropped by exceeding QER MBR",
+    .fast = true,
+},
 /* Global Gauges: */
 [UPF_METR_GLOB_GAUGE_UPF_SESSIONNBR] = {
     .type = OGS_METRICS_METRIC_TYPE_GAUGE,
@@ -84,12 +90,29 @@ upf_metrics_spec_def_t upf_metrics_spec_def_global[_UPF_METR_GLOB_MAX] = {
 };
 int upf_metrics_init_inst_global(void)
 {
-    return upf_metrics_init_inst(upf_metrics_inst_global, upf_metrics_spec_global,
-                _UPF_METR_GLOB_MAX, 0, NULL);
+    unsigned int i;
+    for (i = 0; i < _UPF_METR_GLOB_MAX; i++) {
+        if (upf_metrics_spec_def_global[i].fast)
+            upf_metrics_fast_global[i] =
+                ogs_metrics_fast_new(upf_metrics_spec_global[i], 1);
+        else
+            upf_metrics_inst_global[i] =
+                ogs_metrics_inst_new(upf_metrics_spec_global[i], 0, NULL);
+    }
+    return OGS_OK;
 }
 int upf_metrics_free_inst_global(void)
 {
-    return upf_metrics_free_inst(upf_metrics_inst_global, _UPF_METR_GLOB_MAX);
+    unsigned int i;
+    for (i = 0; i < _UPF_METR_GLOB_MAX; i++) {
+        if (upf_metrics_fast_global[i])
+            ogs_metrics_fast_free(upf_metrics_fast_global[i]);
+        else if (upf_metrics_inst_global[i])
+            ogs_metrics_inst_free(upf_metrics_inst_global[i]);
+    }
+    memset(upf_metrics_fast_global, 0, sizeof(upf_metrics_fast_global));
+    memset(upf_metrics_inst_global, 0, sizeof(upf_metrics_inst_global));
+    return OGS_OK;
 }
 
 /* BY_QFI */
@@ -105,7 +128,8 @@ const char *labels_qfi[] = {
         .labels = labels_qfi, \
     },
 ogs_metrics_spec_t *upf_metrics_spec_by_qfi[_UPF_METR_BY_QFI_MAX];
-ogs_hash_t *metrics_hash_by_qfi = NULL;   /* hash table for QFI label */
+/* QFI is used as the id of the fast counter */
+ogs_metrics_fast_t *upf_metrics_fast_by_qfi[_UPF_METR_BY_QFI_MAX];
 upf_metrics_spec_def_t upf_metrics_spec_def_by_qfi[_UPF_METR_BY_QFI_MAX] = {
 /* Counters: */
 UPF_METR_BY_QFI_CTR_ENTRY(
@@ -118,53 +142,29 @@ UPF_METR_BY_QFI_CTR_ENTRY(
     "Data volume of outgoing GTP data packets per QoS level on the N3 interface")
 };
 void upf_metrics_init_by_qfi(void);
-int upf_metrics_free_inst_by_qfi(ogs_metrics_inst_t **inst);
-typedef struct upf_metric_key_by_qfi_s {
-    uint8_t                     qfi;
-    upf_metric_type_by_qfi_t    t;
-} upf_metric_key_by_qfi_t;
+void upf_metrics_final_by_qfi(void);
 
 void upf_metrics_init_by_qfi(void)
 {
-    metrics_hash_by_qfi = ogs_hash_make();
-    ogs_assert(metrics_hash_by_qfi);
+    unsigned int i;
+    for (i = 0; i < _UPF_METR_BY_QFI_MAX; i++)
+        upf_metrics_fast_by_qfi[i] = ogs_metrics_fast_new(
+                upf_metrics_spec_by_qfi[i], OGS_MAX_QOS_FLOW_ID+1);
 }
-void upf_metrics_inst_by_qfi_add(uint8_t qfi,
-        upf_metric_type_by_qfi_t t, int val)
+void upf_metrics_final_by_qfi(void)
 {
-    ogs_metrics_inst_t *metrics = NULL;
-    upf_metric_key_by_qfi_t *qfi_key;
-
-    qfi_key = ogs_calloc(1, sizeof(*qfi_key));
-    ogs_assert(qfi_key);
-
-    qfi_key->qfi = qfi;
-    qfi_key->t = t;
-
-    metrics = ogs_hash_get(metrics_hash_by_qfi,
-            qfi_key, sizeof(*qfi_key));
-
-    if (!metrics) {
-        char qfi_str[4];
-        ogs_snprintf(qfi_str, sizeof(qfi_str), "%d", qfi);
-
-        metrics = ogs_metrics_inst_new(upf_metrics_spec_by_qfi[t],
-                upf_metrics_spec_def_by_qfi->num_labels,
-                (const char *[]){ qfi_str });
-
-        ogs_assert(metrics);
-        ogs_hash_set(metrics_hash_by_qfi,
-                qfi_key, sizeof(*qfi_key), metrics);
-    } else {
-        ogs_free(qfi_key);
+    unsigned int i;
+    for (i = 0; i < _UPF_METR_BY_QFI_MAX; i++) {
+        if (upf_metrics_fast_by_qfi[i])
+            ogs_metrics_fast_free(upf_metrics_fast_by_qfi[i]);
+        upf_metrics_fast_by_qfi[i] = NULL;
     }
-
-    ogs_metrics_inst_add(metrics, val);
 }
-
-int upf_metrics_free_inst_by_qfi(ogs_metrics_inst_t **inst)
+void upf_metrics_inst_by_qfi_add(uint8_t qfi,
+        upf_metric_type_by_qfi_t t, int val)
 {
-    return upf_metrics_free_inst(inst, _UPF_METR_BY_QFI_MAX);
+    ogs_assert(val >= 0);
+    ogs_metrics_fast_add(upf_metrics_fast_by_qfi[t], qfi, val);
 }
 
 /* BY_CAUSE */
@@ -339,21 +339,9 @@ void upf_metrics_final(void)
 {
     ogs_hash_index_t *hi;
 
-    if (metrics_hash_by_qfi) {
-        for (hi = ogs_hash_first(metrics_hash_by_qfi); hi; hi = ogs_hash_next(hi)) {
-            upf_metric_key_by_qfi_t *key =
-                (upf_metric_key_by_qfi_t *)ogs_hash_this_key(hi);
-            //void *val = ogs_hash_this_val(hi);
+    upf_metrics_free_inst_global();
+    upf_metrics_final_by_qfi();
 
-            ogs_hash_set(metrics_hash_by_qfi, key, sizeof(*key), NULL);
-
-            ogs_free(key);
-            /* don't free val (metric itself) -
-             * it will be free'd by ogs_metrics_context_final() */
-            //ogs_free(val);
-        }
-        ogs_hash_destroy(metrics_hash_by_qfi);
-    }
     if (metrics_hash_by_cause) {
         for (hi = ogs_hash_first(metrics_hash_by_cause); hi; hi = ogs_hash_next(hi)) {
             upf_metric_key_by_cause_t *key =
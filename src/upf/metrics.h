@@ -14,20 +14,35 @@ typedef enum upf_metric_type_global_s {
     UPF_METR_GLOB_CTR_SM_N4SESSIONESTABREQ,
     UPF_METR_GLOB_CTR_SM_N4SESSIONREPORT,
     UPF_METR_GLOB_CTR_SM_N4SESSIONREPORTSUCC,
+    UPF_METR_GLOB_CTR_QER_GATEDROPPKT,
+    UPF_METR_GLOB_CTR_QER_MBRDROPPKT,
     UPF_METR_GLOB_GAUGE_UPF_SESSIONNBR,
     _UPF_METR_GLOB_MAX,
 } upf_metric_type_global_t;
 extern ogs_metrics_inst_t *upf_metrics_inst_global[_UPF_METR_GLOB_MAX];
+extern ogs_metrics_fast_t *upf_metrics_fast_global[_UPF_METR_GLOB_MAX];
 
 int upf_metrics_init_inst_global(void);
 int upf_metrics_free_inst_global(void);
 
+/* Per-packet counters go to the fast counter without locking */
 static inline void upf_metrics_inst_global_set(upf_metric_type_global_t t, int val)
 { ogs_metrics_inst_set(upf_metrics_inst_global[t], val); }
 static inline void upf_metrics_inst_global_add(upf_metric_type_global_t t, int val)
-{ ogs_metrics_inst_add(upf_metrics_inst_global[t], val); }
+{
+    if (upf_metrics_fast_global[t]) {
+        ogs_assert(val >= 0);
+        ogs_metrics_fast_add(upf_metrics_fast_global[t], 0, val);
+    } else
+        ogs_metrics_inst_add(upf_metrics_inst_global[t], val);
+}
 static inline void upf_metrics_inst_global_inc(upf_metric_type_global_t t)
-{ ogs_metrics_inst_inc(upf_metrics_inst_global[t]); }
+{
+    if (upf_metrics_fast_global[t])
+        ogs_metrics_fast_inc(upf_metrics_fast_global[t], 0);
+    else
+        ogs_metrics_inst_inc(upf_metrics_inst_global[t]);
+}
 static inline void upf_metrics_inst_global_dec(upf_metric_type_global_t t)
 { ogs_metrics_inst_dec(upf_metrics_inst_global[t]); }
 
@@ -21,6 +21,7 @@
 #include "pfcp-path.h"
 #include "gtp-path.h"
 #include "n4-handler.h"
+#include "fwd.h"
 
 static void upf_n4_handle_create_urr(upf_sess_t *sess, ogs_pfcp_tlv_create_urr_t *create_urr_arr,
                               uint8_t *cause_value, uint8_t *offending_ie_value)
@@ -216,6 +217,13 @@ void upf_n4_handle_session_establishment_request(
         }
     }
 
+    /* Compile SDF Filters of all PDRs */
+    if (ogs_pfcp_classifier_compile(&sess->pfcp) != OGS_OK)
+        ogs_warn("Fall back to linear SDF filter matching");
+
+    /* Precompute the forwarding entries of this session */
+    upf_fwd_update(sess);
+
     /* Send Buffered Packet to gNB/SGW */
     ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
         if (pdr->src_if == OGS_PFCP_INTERFACE_CORE) { /* Downlink */
@@ -231,6 +239,7 @@ void upf_n4_handle_session_establishment_request(
 cleanup:
     upf_metrics_inst_by_cause_add(cause_value,
             UPF_METR_CTR_SM_N4SESSIONESTABFAIL, 1);
+    upf_fwd_remove(sess);
     ogs_pfcp_sess_clear(&sess->pfcp);
     ogs_pfcp_send_error_message(xact, sess ? sess->smf_n4_f_seid.seid : 0,
             OGS_PFCP_SESSION_ESTABLISHMENT_RESPONSE_TYPE,
@@ -465,6 +474,13 @@ void upf_n4_handle_session_modification_request(
         }
     }
 
+    /* Compile SDF Filters of all PDRs */
+    if (ogs_pfcp_classifier_compile(&sess->pfcp) != OGS_OK)
+        ogs_warn("Fall back to linear SDF filter matching");
+
+    /* Precompute the forwarding entries of this session */
+    upf_fwd_update(sess);
+
     /* Send Buffered Packet to gNB/SGW */
     ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
         if (pdr->src_if == OGS_PFCP_INTERFACE_CORE) { /* Downlink */
@@ -478,6 +494,7 @@ void upf_n4_handle_session_modification_request(
     return;
 
 cleanup:
+    upf_fwd_remove(sess);
     ogs_pfcp_sess_clear(&sess->pfcp);
     ogs_pfcp_send_error_message(xact, sess ? sess->smf_n4_f_seid.seid : 0,
             OGS_PFCP_SESSION_MODIFICATION_RESPONSE_TYPE,
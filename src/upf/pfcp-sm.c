@@ -24,6 +24,7 @@
 
 #include "pfcp-path.h"
 #include "n4-handler.h"
+#include "worker.h"
 
 static void node_timeout(ogs_pfcp_xact_t *xact, void *data);
 
@@ -216,7 +217,12 @@ void upf_pfcp_state_associated(ogs_fsm_t *s, upf_event_t *e)
             ogs_pfcp_up_handle_association_setup_response(node, xact,
                     &message->pfcp_association_setup_response);
             break;
+        /*
+         * Datapath workers must not see a session while it is changing.
+         * They are held off only while N4 session messages are handled.
+         */
         case OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE:
+            upf_worker_wrlock();
             if (message->h.seid_presence && message->h.seid == 0) {
                 ogs_expect(!sess);
                 sess = upf_sess_add_by_message(message);
@@ -225,18 +231,25 @@ void upf_pfcp_state_associated(ogs_fsm_t *s, upf_event_t *e)
             }
             upf_n4_handle_session_establishment_request(
                 sess, xact, &message->pfcp_session_establishment_request);
+            upf_worker_wrunlock();
             break;
         case OGS_PFCP_SESSION_MODIFICATION_REQUEST_TYPE:
+            upf_worker_wrlock();
             upf_n4_handle_session_modification_request(
                 sess, xact, &message->pfcp_session_modification_request);
+            upf_worker_wrunlock();
             break;
         case OGS_PFCP_SESSION_DELETION_REQUEST_TYPE:
+            upf_worker_wrlock();
             upf_n4_handle_session_deletion_request(
                 sess, xact, &message->pfcp_session_deletion_request);
+            upf_worker_wrunlock();
             break;
         case OGS_PFCP_SESSION_REPORT_RESPONSE_TYPE:
+            upf_worker_wrlock();
             upf_n4_handle_session_report_response(
                 sess, xact, &message->pfcp_session_report_response);
+            upf_worker_wrunlock();
             break;
         default:
             ogs_error("Not implemented PFCP message type[%d]",
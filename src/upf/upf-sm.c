@@ -48,6 +48,9 @@ void upf_state_operational(ogs_fsm_t *s, upf_event_t *e)
     ogs_pfcp_node_t *node = NULL;
     ogs_pfcp_xact_t *xact = NULL;
 
+    upf_sess_t *sess = NULL;
+    ogs_pfcp_urr_t *urr = NULL;
+
     upf_sm_debug(e);
 
     ogs_assert(s);
@@ -104,6 +107,30 @@ void upf_state_operational(ogs_fsm_t *s, upf_event_t *e)
 
         ogs_fsm_dispatch(&node->sm, e);
         break;
+
+    case UPF_EVT_SESS_REPORT:
+        ogs_assert(e->report);
+
+        /* The session may have been removed after the worker posted it */
+        sess = upf_sess_find_by_generation(e->sess_id, e->sess_generation);
+        if (sess) {
+            ogs_assert(OGS_OK ==
+                upf_pfcp_send_session_report_request(sess, e->report));
+        }
+
+        ogs_free(e->report);
+        break;
+
+    case UPF_EVT_SESS_URR_CHECK:
+        sess = upf_sess_find_by_generation(e->sess_id, e->sess_generation);
+        if (!sess)
+            break;
+
+        urr = ogs_pfcp_urr_find(&sess->pfcp, e->urr_id);
+        if (urr)
+            upf_sess_urr_acc_check(sess, urr);
+        break;
+
     default:
         ogs_error("No handler for event %s", upf_event_get_name(e));
         break;
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "worker.h"
+#include "gtp-path.h"
+
+/* GTP-U sockets, TUN queues and the notify descriptor */
+#define UPF_WORKER_POLLSET_SIZE     (OGS_MAX_NUM_OF_DEV + 32)
+#define UPF_WORKER_QUEUE_SIZE       4096
+
+static upf_worker_t worker_array[UPF_MAX_NUM_OF_WORKER];
+static int num_of_worker = 0;
+
+static ogs_thread_rwlock_t rwlock;
+
+static void upf_worker_main(void *data);
+
+int upf_worker_init(void)
+{
+    int i;
+
+    num_of_worker = upf_self()->datapath.workers;
+    if (num_of_worker == 0)
+        return OGS_OK;
+
+    ogs_assert(num_of_worker <= UPF_MAX_NUM_OF_WORKER);
+
+    ogs_thread_rwlock_init(&rwlock);
+
+    memset(worker_array, 0, sizeof(worker_array));
+    for (i = 0; i < num_of_worker; i++) {
+        upf_worker_t *worker = &worker_array[i];
+
+        worker->id = i;
+
+        worker->pollset = ogs_pollset_create(UPF_WORKER_POLLSET_SIZE);
+        if (!worker->pollset) {
+            ogs_error("ogs_pollset_create() failed");
+            goto cleanup;
+        }
+
+        worker->queue = ogs_queue_create(UPF_WORKER_QUEUE_SIZE);
+        if (!worker->queue) {
+            ogs_error("ogs_queue_create() failed");
+            goto cleanup;
+        }
+
+        ogs_list_init(&worker->gtpu_list);
+    }
+
+    return OGS_OK;
+
+cleanup:
+    /* Destroy the pollsets and queues created before the failure */
+    upf_worker_final();
+
+    return OGS_ERROR;
+}
+
+void upf_worker_final(void)
+{
+    int i;
+
+    if (num_of_worker == 0)
+        return;
+
+    for (i = 0; i < num_of_worker; i++) {
+        upf_worker_t *worker = &worker_array[i];
+
+        /* Packets left in the queue go away with the packet pool */
+        if (worker->queue)
+            ogs_queue_destroy(worker->queue);
+        worker->queue = NULL;
+
+        if (worker->pollset)
+            ogs_pollset_destroy(worker->pollset);
+        worker->pollset = NULL;
+    }
+
+    ogs_thread_rwlock_destroy(&rwlock);
+
+    num_of_worker = 0;
+}
+
+int upf_worker_start(void)
+{
+    int i;
+
+    for (i = 0; i < num_of_worker; i++) {
+        upf_worker_t *worker = &worker_array[i];
+
+        worker->thread = ogs_thread_create(upf_worker_main, worker);
+        if (!worker->thread) {
+            ogs_error("ogs_thread_create() failed");
+            /* Join the workers started before the failure */
+            upf_worker_stop();
+            return OGS_ERROR;
+        }
+    }
+
+    ogs_info("%d datapath worker(s) started", num_of_worker);
+
+    return OGS_OK;
+}
+
+void upf_worker_stop(void)
+{
+    int i;
+
+    for (i = 0; i < num_of_worker; i++) {
+        upf_worker_t *worker = &worker_array[i];
+
+        if (!worker->thread)
+            continue;
+
+        ogs_queue_term(worker->queue);
+        ogs_pollset_notify(worker->pollset);
+
+        ogs_thread_destroy(worker->thread);
+        worker->thread = NULL;
+    }
+}
+
+int upf_worker_count(void)
+{
+    return num_of_worker;
+}
+
+upf_worker_t *upf_worker_find(int id)
+{
+    ogs_assert(id >= 0 && id < num_of_worker);
+    return &worker_array[id];
+}
+
+void upf_worker_rdlock(void)
+{
+    ogs_thread_rwlock_rdlock(&rwlock);
+}
+
+void upf_worker_rdunlock(void)
+{
+    ogs_thread_rwlock_rdunlock(&rwlock);
+}
+
+void upf_worker_wrlock(void)
+{
+    if (num_of_worker)
+        ogs_thread_rwlock_wrlock(&rwlock);
+}
+
+void upf_worker_wrunlock(void)
+{
+    if (num_of_worker)
+        ogs_thread_rwlock_wrunlock(&rwlock);
+}
+
+/*
+ * Queue the packet to its owner worker.
+ * The caller should call upf_worker_wakeup() once after the batch.
+ */
+int upf_worker_handoff(upf_worker_t *worker, ogs_pkbuf_t *pkbuf)
+{
+    int rv;
+
+    ogs_assert(worker);
+    ogs_assert(pkbuf);
+
+    rv = ogs_queue_trypush(worker->queue, pkbuf);
+    if (rv != OGS_OK) {
+        ogs_warn("[DROP] Worker[%d] queue is full", worker->id);
+        ogs_pkbuf_free(pkbuf);
+        return OGS_ERROR;
+    }
+
+    return OGS_OK;
+}
+
+void upf_worker_wakeup(upf_worker_t *worker)
+{
+    ogs_assert(worker);
+    ogs_pollset_notify(worker->pollset);
+}
+
+/*
+ * Post an event to the control thread.
+ *
+ * Workers hold the read lock here, and the control thread needs the
+ * write lock to drain its queue. So never block on a full queue.
+ */
+int upf_worker_post(upf_event_t *e)
+{
+    int rv;
+
+    ogs_assert(e);
+
+    rv = ogs_queue_trypush(ogs_app()->queue, e);
+    if (rv != OGS_OK) {
+        ogs_error("ogs_queue_trypush() failed:%d", (int)rv);
+        return OGS_ERROR;
+    }
+
+    ogs_pollset_notify(ogs_app()->pollset);
+
+    return OGS_OK;
+}
+
+static void upf_worker_main(void *data)
+{
+    upf_worker_t *worker = data;
+
+    ogs_assert(worker);
+
+    for ( ;; ) {
+        ogs_pollset_poll(worker->pollset, OGS_INFINITE_TIME);
+
+        /* Downlink packets handed off by other workers */
+        if (upf_gtp_handle_handoff(worker) == OGS_DONE)
+            break;
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef UPF_WORKER_H
+#define UPF_WORKER_H
+
+#include "context.h"
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Datapath Worker
+ *
+ * With upf.datapath.workers > 0, GTP-U and TUN packets are handled by
+ * worker threads instead of the control thread.
+ *
+ * - Each worker owns one GTP-U socket per upf.gtpu (SO_REUSEPORT) and
+ *   one queue per TUN device (IFF_MULTI_QUEUE).
+ * - Uplink is sharded by TEID, downlink by UE IP address.
+ * - Sessions, PDR/FAR/QER/URR and the forwarding cache are changed only
+ *   by N4 session messages. The control thread holds the write lock while
+ *   it handles them, and workers hold the read lock while handling
+ *   a batch. URR counters shared with workers are accessed atomically.
+ * - Workers never call the PFCP path directly. Reports are posted to the
+ *   control thread as events.
+ */
+
+typedef struct upf_worker_s {
+    int             id;
+
+    ogs_thread_t    *thread;
+    ogs_pollset_t   *pollset;
+    ogs_queue_t     *queue;     /* Downlink packets handed off by peers */
+
+    ogs_list_t      gtpu_list;  /* GTP-U Server List */
+
+    struct {
+        ogs_pfcp_dev_t  *dev;
+        ogs_socket_t    fd;
+        ogs_poll_t      *poll;
+    } tun[OGS_MAX_NUM_OF_DEV];
+    int             num_of_tun;
+} upf_worker_t;
+
+int upf_worker_init(void);
+void upf_worker_final(void);
+
+int upf_worker_start(void);
+void upf_worker_stop(void);
+
+int upf_worker_count(void);
+upf_worker_t *upf_worker_find(int id);
+
+void upf_worker_rdlock(void);
+void upf_worker_rdunlock(void);
+void upf_worker_wrlock(void);
+void upf_worker_wrunlock(void);
+
+int upf_worker_handoff(upf_worker_t *worker, ogs_pkbuf_t *pkbuf);
+void upf_worker_wakeup(upf_worker_t *worker);
+
+int upf_worker_post(upf_event_t *e);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UPF_WORKER_H */
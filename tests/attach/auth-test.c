@@ -420,11 +420,123 @@ static void test1_func(abts_case *tc, void *data)
     test_ue_remove(test_ue);
 }
 
+#define NUM_OF_TEST_AIR 1000
+#define NUM_OF_TEST_AIR_THREAD 4
+
+static void air_main(void *data)
+{
+    test_ue_t *test_ue = data;
+    ogs_dbi_auth_info_t auth_info;
+    int rv, i;
+
+    for (i = 0; i < NUM_OF_TEST_AIR; i++) {
+        rv = ogs_dbi_auth_info_increment_sqn(test_ue->supi, &auth_info);
+        ogs_assert(rv == OGS_OK);
+    }
+}
+
+static void test2_func(abts_case *tc, void *data)
+{
+    int rv, i;
+    ogs_nas_5gs_mobile_identity_suci_t mobile_identity_suci;
+    test_ue_t *test_ue = NULL;
+    ogs_thread_t *thread[NUM_OF_TEST_AIR_THREAD];
+    ogs_dbi_auth_info_t auth_info;
+    uint64_t sqn;
+    ogs_time_t start, elapsed;
+
+    bson_t *doc = NULL;
+
+    /* Setup Test UE */
+    memset(&mobile_identity_suci, 0, sizeof(mobile_identity_suci));
+
+    mobile_identity_suci.h.supi_format = OGS_NAS_5GS_SUPI_FORMAT_IMSI;
+    mobile_identity_suci.h.type = OGS_NAS_5GS_MOBILE_IDENTITY_SUCI;
+    mobile_identity_suci.routing_indicator1 = 0;
+    mobile_identity_suci.routing_indicator2 = 0xf;
+    mobile_identity_suci.routing_indicator3 = 0xf;
+    mobile_identity_suci.routing_indicator4 = 0xf;
+    mobile_identity_suci.protection_scheme_id = OGS_PROTECTION_SCHEME_NULL;
+    mobile_identity_suci.home_network_pki_value = 0;
+
+    test_ue = test_ue_add_by_suci(&mobile_identity_suci, "3746000006");
+    ogs_assert(test_ue);
+
+    test_ue->k_string = "465b5ce8b199b49faa5f0a2ee238a6bc";
+    test_ue->opc_string = "e8ed289deba952e4283b54e88e6183ca";
+
+    /********** Insert Subscriber in Database */
+    doc = test_db_new_simple(test_ue);
+    ABTS_PTR_NOTNULL(tc, doc);
+    ABTS_INT_EQUAL(tc, OGS_OK, test_db_insert_ue(test_ue, doc));
+
+    rv = ogs_dbi_auth_info(test_ue->supi, &auth_info);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    sqn = auth_info.sqn;
+
+    /* Previous AIR sequence : read, update and increment the SQN */
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_TEST_AIR; i++) {
+        rv = ogs_dbi_auth_info(test_ue->supi, &auth_info);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        rv = ogs_dbi_update_sqn(test_ue->supi, auth_info.sqn);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        rv = ogs_dbi_increment_sqn(test_ue->supi);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    }
+    elapsed = ogs_get_monotonic_time() - start;
+
+    /* Benchmark : run with '-e info' to see the result */
+    ogs_info("AIR(read/update/increment) : %lld AIR/s",
+            (long long)NUM_OF_TEST_AIR * OGS_USEC_PER_SEC / (elapsed+1));
+
+    rv = ogs_dbi_auth_info(test_ue->supi, &auth_info);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_TRUE(tc, auth_info.sqn ==
+            ((sqn + 32 * NUM_OF_TEST_AIR) & OGS_MAX_SQN));
+    sqn = auth_info.sqn;
+
+    /* Current AIR : the SQN is read and incremented at once */
+    start = ogs_get_monotonic_time();
+    air_main(test_ue);
+    elapsed = ogs_get_monotonic_time() - start;
+
+    ogs_info("AIR(find-and-modify) : %lld AIR/s",
+            (long long)NUM_OF_TEST_AIR * OGS_USEC_PER_SEC / (elapsed+1));
+
+    /* The client pool is shared by the concurrent AIRs */
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_TEST_AIR_THREAD; i++) {
+        thread[i] = ogs_thread_create(air_main, test_ue);
+        ABTS_PTR_NOTNULL(tc, thread[i]);
+    }
+    for (i = 0; i < NUM_OF_TEST_AIR_THREAD; i++)
+        ogs_thread_destroy(thread[i]);
+    elapsed = ogs_get_monotonic_time() - start;
+
+    ogs_info("AIR(find-and-modify, %d threads) : %lld AIR/s",
+            NUM_OF_TEST_AIR_THREAD,
+            (long long)NUM_OF_TEST_AIR * NUM_OF_TEST_AIR_THREAD *
+                OGS_USEC_PER_SEC / (elapsed+1));
+
+    /* No SQN is lost or reused by the concurrent AIRs */
+    rv = ogs_dbi_auth_info(test_ue->supi, &auth_info);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_TRUE(tc, auth_info.sqn == ((sqn +
+            32 * NUM_OF_TEST_AIR * (NUM_OF_TEST_AIR_THREAD+1)) & OGS_MAX_SQN));
+
+    /********** Remove Subscriber in Database */
+    ABTS_INT_EQUAL(tc, OGS_OK, test_db_remove_ue(test_ue));
+
+    test_ue_remove(test_ue);
+}
+
 abts_suite *test_auth(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, test1_func, NULL);
+    abts_run_test(suite, test2_func, NULL);
 
     return suite;
 }
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "amf/context.h"
+#include "amf/metrics.h"
+#include "core/abts.h"
+
+#define NUM_OF_TEST_RAN_UE 50000
+
+static void test_amf_init(void)
+{
+    ogs_app()->timer_mgr = ogs_timer_mgr_create(NUM_OF_TEST_RAN_UE);
+    ogs_assert(ogs_app()->timer_mgr);
+
+    amf_context_init();
+}
+
+static void test_amf_final(void)
+{
+    amf_context_final();
+
+    ogs_timer_mgr_destroy(ogs_app()->timer_mgr);
+    ogs_app()->timer_mgr = NULL;
+}
+
+/* Only the RAN-UE context of the gNB is used */
+static void test_gnb_init(amf_gnb_t *gnb)
+{
+    memset(gnb, 0, sizeof(*gnb));
+    gnb->max_num_of_ostreams = OGS_DEFAULT_SCTP_MAX_NUM_OF_OSTREAMS;
+    ogs_list_init(&gnb->ran_ue_list);
+    gnb->ran_ue_hash = ogs_ihash_make();
+    ogs_assert(gnb->ran_ue_hash);
+}
+
+static void test_gnb_final(amf_gnb_t *gnb)
+{
+    ogs_ihash_destroy(gnb->ran_ue_hash);
+}
+
+static void amf_context_test1(abts_case *tc, void *data)
+{
+    amf_gnb_t gnb;
+    ran_ue_t **ran_ue = NULL;
+    ogs_log_level_e level;
+    ogs_time_t start, elapsed;
+    int i, found = 0;
+
+    test_amf_init();
+    test_gnb_init(&gnb);
+
+    /* Do not log each RAN-UE */
+    level = ogs_log_get_domain_level(__amf_log_domain);
+    ogs_log_set_domain_level(__amf_log_domain, OGS_LOG_ERROR);
+
+    ran_ue = ogs_calloc(NUM_OF_TEST_RAN_UE, sizeof(*ran_ue));
+    ogs_assert(ran_ue);
+
+    for (i = 0; i < NUM_OF_TEST_RAN_UE; i++) {
+        ran_ue[i] = ran_ue_add(&gnb, i);
+        ABTS_PTR_NOTNULL(tc, ran_ue[i]);
+    }
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_RAN_UE, ogs_list_count(&gnb.ran_ue_list));
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_RAN_UE, ogs_ihash_count(gnb.ran_ue_hash));
+    ABTS_INT_EQUAL(tc, 0, gnb.num_of_ran_ue_dup);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_TEST_RAN_UE; i++) {
+        if (ran_ue_find_by_ran_ue_ngap_id(&gnb, i) == ran_ue[i])
+            found++;
+    }
+    elapsed = ogs_get_monotonic_time() - start;
+
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_RAN_UE, found);
+    ABTS_PTR_EQUAL(tc, NULL,
+            ran_ue_find_by_ran_ue_ngap_id(&gnb, NUM_OF_TEST_RAN_UE));
+
+    /* RAN_UE_NGAP_ID is updated by the gNB */
+    for (i = 0; i < NUM_OF_TEST_RAN_UE; i++)
+        ran_ue_set_ran_ue_ngap_id(ran_ue[i], NUM_OF_TEST_RAN_UE + i);
+
+    for (i = 0; i < NUM_OF_TEST_RAN_UE; i++) {
+        ABTS_PTR_EQUAL(tc, NULL, ran_ue_find_by_ran_ue_ngap_id(&gnb, i));
+        ABTS_PTR_EQUAL(tc, ran_ue[i],
+                ran_ue_find_by_ran_ue_ngap_id(&gnb, NUM_OF_TEST_RAN_UE + i));
+    }
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_RAN_UE, ogs_ihash_count(gnb.ran_ue_hash));
+
+    for (i = 0; i < NUM_OF_TEST_RAN_UE; i++)
+        ran_ue_remove(ran_ue[i]);
+
+    ABTS_INT_EQUAL(tc, 0, ogs_list_count(&gnb.ran_ue_list));
+    ABTS_INT_EQUAL(tc, 0, ogs_ihash_count(gnb.ran_ue_hash));
+
+    ogs_free(ran_ue);
+
+    ogs_log_set_domain_level(__amf_log_domain, level);
+
+    /* Benchmark : run with '-e info' to see the result */
+    ogs_info("%d RAN-UEs : %d lookups in %lld usecs, %lld ns/lookup",
+            NUM_OF_TEST_RAN_UE, NUM_OF_TEST_RAN_UE, (long long)elapsed,
+            (long long)elapsed * 1000 / NUM_OF_TEST_RAN_UE);
+
+    test_gnb_final(&gnb);
+    test_amf_final();
+}
+
+static void amf_context_test2(abts_case *tc, void *data)
+{
+    amf_gnb_t gnb, target;
+    ran_ue_t *a = NULL, *b = NULL, *c = NULL;
+
+    test_amf_init();
+    test_gnb_init(&gnb);
+    test_gnb_init(&target);
+
+    /* Handover targets share INVALID_UE_NGAP_ID */
+    a = ran_ue_add(&gnb, INVALID_UE_NGAP_ID);
+    ABTS_PTR_NOTNULL(tc, a);
+    b = ran_ue_add(&gnb, INVALID_UE_NGAP_ID);
+    ABTS_PTR_NOTNULL(tc, b);
+    c = ran_ue_add(&gnb, INVALID_UE_NGAP_ID);
+    ABTS_PTR_NOTNULL(tc, c);
+
+    /* The first one added is found */
+    ABTS_PTR_EQUAL(tc, a,
+            ran_ue_find_by_ran_ue_ngap_id(&gnb, INVALID_UE_NGAP_ID));
+    ABTS_INT_EQUAL(tc, 2, gnb.num_of_ran_ue_dup);
+
+    /* A duplicate which is not indexed */
+    ran_ue_remove(b);
+    ABTS_PTR_EQUAL(tc, a,
+            ran_ue_find_by_ran_ue_ngap_id(&gnb, INVALID_UE_NGAP_ID));
+    ABTS_INT_EQUAL(tc, 1, gnb.num_of_ran_ue_dup);
+
+    b = ran_ue_add(&gnb, INVALID_UE_NGAP_ID);
+    ABTS_PTR_NOTNULL(tc, b);
+    ABTS_INT_EQUAL(tc, 2, gnb.num_of_ran_ue_dup);
+
+    /* The next one in the list is indexed */
+    ran_ue_remove(a);
+    ABTS_PTR_EQUAL(tc, c,
+            ran_ue_find_by_ran_ue_ngap_id(&gnb, INVALID_UE_NGAP_ID));
+    ABTS_INT_EQUAL(tc, 1, gnb.num_of_ran_ue_dup);
+
+    ran_ue_set_ran_ue_ngap_id(c, 1);
+    ABTS_PTR_EQUAL(tc, b,
+            ran_ue_find_by_ran_ue_ngap_id(&gnb, INVALID_UE_NGAP_ID));
+    ABTS_PTR_EQUAL(tc, c, ran_ue_find_by_ran_ue_ngap_id(&gnb, 1));
+    ABTS_INT_EQUAL(tc, 0, gnb.num_of_ran_ue_dup);
+
+    ran_ue_set_ran_ue_ngap_id(c, INVALID_UE_NGAP_ID);
+    ABTS_PTR_EQUAL(tc, b,
+            ran_ue_find_by_ran_ue_ngap_id(&gnb, INVALID_UE_NGAP_ID));
+    ABTS_PTR_EQUAL(tc, NULL, ran_ue_find_by_ran_ue_ngap_id(&gnb, 1));
+    ABTS_INT_EQUAL(tc, 1, gnb.num_of_ran_ue_dup);
+
+    /* The indexed one is moved to another gNB */
+    ran_ue_switch_to_gnb(b, &target);
+    ABTS_PTR_EQUAL(tc, c,
+            ran_ue_find_by_ran_ue_ngap_id(&gnb, INVALID_UE_NGAP_ID));
+    ABTS_INT_EQUAL(tc, 0, gnb.num_of_ran_ue_dup);
+    ABTS_PTR_EQUAL(tc, b,
+            ran_ue_find_by_ran_ue_ngap_id(&target, INVALID_UE_NGAP_ID));
+    ABTS_INT_EQUAL(tc, 0, target.num_of_ran_ue_dup);
+
+    ran_ue_remove(b);
+    ran_ue_remove(c);
+
+    ABTS_PTR_EQUAL(tc, NULL,
+            ran_ue_find_by_ran_ue_ngap_id(&gnb, INVALID_UE_NGAP_ID));
+    ABTS_PTR_EQUAL(tc, NULL,
+            ran_ue_find_by_ran_ue_ngap_id(&target, INVALID_UE_NGAP_ID));
+    ABTS_INT_EQUAL(tc, 0, ogs_ihash_count(gnb.ran_ue_hash));
+    ABTS_INT_EQUAL(tc, 0, ogs_ihash_count(target.ran_ue_hash));
+
+    test_gnb_final(&target);
+    test_gnb_final(&gnb);
+    test_amf_final();
+}
+
+abts_suite *test_context(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    /* The metrics are not initialized again in the same process */
+    ogs_app_context_init();
+    ogs_app()->max.ue = NUM_OF_TEST_RAN_UE;
+    amf_metrics_init();
+
+    abts_run_test(suite, amf_context_test1, NULL);
+    abts_run_test(suite, amf_context_test2, NULL);
+
+    amf_metrics_final();
+    ogs_app_context_final();
+
+    return suite;
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mme/mme-context.h"
+#include "mme/metrics.h"
+#include "core/abts.h"
+
+#define NUM_OF_TEST_ENB_UE 50000
+
+static void test_mme_init(void)
+{
+    ogs_app()->timer_mgr = ogs_timer_mgr_create(NUM_OF_TEST_ENB_UE);
+    ogs_assert(ogs_app()->timer_mgr);
+
+    mme_context_init();
+}
+
+static void test_mme_final(void)
+{
+    mme_context_final();
+
+    ogs_timer_mgr_destroy(ogs_app()->timer_mgr);
+    ogs_app()->timer_mgr = NULL;
+}
+
+/* Only the eNB-UE context of the eNB is used */
+static void test_enb_init(mme_enb_t *enb)
+{
+    memset(enb, 0, sizeof(*enb));
+    enb->max_num_of_ostreams = OGS_DEFAULT_SCTP_MAX_NUM_OF_OSTREAMS;
+    ogs_list_init(&enb->enb_ue_list);
+    enb->enb_ue_hash = ogs_ihash_make();
+    ogs_assert(enb->enb_ue_hash);
+}
+
+static void test_enb_final(mme_enb_t *enb)
+{
+    ogs_ihash_destroy(enb->enb_ue_hash);
+}
+
+static void mme_context_test1(abts_case *tc, void *data)
+{
+    mme_enb_t enb;
+    enb_ue_t **enb_ue = NULL;
+    ogs_log_level_e level;
+    ogs_time_t start, elapsed;
+    int i, found = 0;
+
+    test_mme_init();
+    test_enb_init(&enb);
+
+    /* Do not log each eNB-UE */
+    level = ogs_log_get_domain_level(__mme_log_domain);
+    ogs_log_set_domain_level(__mme_log_domain, OGS_LOG_ERROR);
+
+    enb_ue = ogs_calloc(NUM_OF_TEST_ENB_UE, sizeof(*enb_ue));
+    ogs_assert(enb_ue);
+
+    for (i = 0; i < NUM_OF_TEST_ENB_UE; i++) {
+        enb_ue[i] = enb_ue_add(&enb, i);
+        ABTS_PTR_NOTNULL(tc, enb_ue[i]);
+    }
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_ENB_UE, ogs_list_count(&enb.enb_ue_list));
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_ENB_UE, ogs_ihash_count(enb.enb_ue_hash));
+    ABTS_INT_EQUAL(tc, 0, enb.num_of_enb_ue_dup);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_TEST_ENB_UE; i++) {
+        if (enb_ue_find_by_enb_ue_s1ap_id(&enb, i) == enb_ue[i])
+            found++;
+    }
+    elapsed = ogs_get_monotonic_time() - start;
+
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_ENB_UE, found);
+    ABTS_PTR_EQUAL(tc, NULL,
+            enb_ue_find_by_enb_ue_s1ap_id(&enb, NUM_OF_TEST_ENB_UE));
+
+    /* ENB_UE_S1AP_ID is updated by the eNB */
+    for (i = 0; i < NUM_OF_TEST_ENB_UE; i++)
+        enb_ue_set_enb_ue_s1ap_id(enb_ue[i], NUM_OF_TEST_ENB_UE + i);
+
+    for (i = 0; i < NUM_OF_TEST_ENB_UE; i++) {
+        ABTS_PTR_EQUAL(tc, NULL, enb_ue_find_by_enb_ue_s1ap_id(&enb, i));
+        ABTS_PTR_EQUAL(tc, enb_ue[i],
+                enb_ue_find_by_enb_ue_s1ap_id(&enb, NUM_OF_TEST_ENB_UE + i));
+    }
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_ENB_UE, ogs_ihash_count(enb.enb_ue_hash));
+
+    for (i = 0; i < NUM_OF_TEST_ENB_UE; i++)
+        enb_ue_remove(enb_ue[i]);
+
+    ABTS_INT_EQUAL(tc, 0, ogs_list_count(&enb.enb_ue_list));
+    ABTS_INT_EQUAL(tc, 0, ogs_ihash_count(enb.enb_ue_hash));
+
+    ogs_free(enb_ue);
+
+    ogs_log_set_domain_level(__mme_log_domain, level);
+
+    /* Benchmark : run with '-e info' to see the result */
+    ogs_info("%d eNB-UEs : %d lookups in %lld usecs, %lld ns/lookup",
+            NUM_OF_TEST_ENB_UE, NUM_OF_TEST_ENB_UE, (long long)elapsed,
+            (long long)elapsed * 1000 / NUM_OF_TEST_ENB_UE);
+
+    test_enb_final(&enb);
+    test_mme_final();
+}
+
+static void mme_context_test2(abts_case *tc, void *data)
+{
+    mme_enb_t enb, target;
+    enb_ue_t *a = NULL, *b = NULL, *c = NULL;
+
+    test_mme_init();
+    test_enb_init(&enb);
+    test_enb_init(&target);
+
+    /* Handover targets share INVALID_UE_S1AP_ID */
+    a = enb_ue_add(&enb, INVALID_UE_S1AP_ID);
+    ABTS_PTR_NOTNULL(tc, a);
+    b = enb_ue_add(&enb, INVALID_UE_S1AP_ID);
+    ABTS_PTR_NOTNULL(tc, b);
+    c = enb_ue_add(&enb, INVALID_UE_S1AP_ID);
+    ABTS_PTR_NOTNULL(tc, c);
+
+    /* The first one added is found */
+    ABTS_PTR_EQUAL(tc, a,
+            enb_ue_find_by_enb_ue_s1ap_id(&enb, INVALID_UE_S1AP_ID));
+    ABTS_INT_EQUAL(tc, 2, enb.num_of_enb_ue_dup);
+
+    /* A duplicate which is not indexed */
+    enb_ue_remove(b);
+    ABTS_PTR_EQUAL(tc, a,
+            enb_ue_find_by_enb_ue_s1ap_id(&enb, INVALID_UE_S1AP_ID));
+    ABTS_INT_EQUAL(tc, 1, enb.num_of_enb_ue_dup);
+
+    b = enb_ue_add(&enb, INVALID_UE_S1AP_ID);
+    ABTS_PTR_NOTNULL(tc, b);
+    ABTS_INT_EQUAL(tc, 2, enb.num_of_enb_ue_dup);
+
+    /* The next one in the list is indexed */
+    enb_ue_remove(a);
+    ABTS_PTR_EQUAL(tc, c,
+            enb_ue_find_by_enb_ue_s1ap_id(&enb, INVALID_UE_S1AP_ID));
+    ABTS_INT_EQUAL(tc, 1, enb.num_of_enb_ue_dup);
+
+    enb_ue_set_enb_ue_s1ap_id(c, 1);
+    ABTS_PTR_EQUAL(tc, b,
+            enb_ue_find_by_enb_ue_s1ap_id(&enb, INVALID_UE_S1AP_ID));
+    ABTS_PTR_EQUAL(tc, c, enb_ue_find_by_enb_ue_s1ap_id(&enb, 1));
+    ABTS_INT_EQUAL(tc, 0, enb.num_of_enb_ue_dup);
+
+    enb_ue_set_enb_ue_s1ap_id(c, INVALID_UE_S1AP_ID);
+    ABTS_PTR_EQUAL(tc, b,
+            enb_ue_find_by_enb_ue_s1ap_id(&enb, INVALID_UE_S1AP_ID));
+    ABTS_PTR_EQUAL(tc, NULL, enb_ue_find_by_enb_ue_s1ap_id(&enb, 1));
+    ABTS_INT_EQUAL(tc, 1, enb.num_of_enb_ue_dup);
+
+    /* The indexed one is moved to another eNB */
+    enb_ue_switch_to_enb(b, &target);
+    ABTS_PTR_EQUAL(tc, c,
+            enb_ue_find_by_enb_ue_s1ap_id(&enb, INVALID_UE_S1AP_ID));
+    ABTS_INT_EQUAL(tc, 0, enb.num_of_enb_ue_dup);
+    ABTS_PTR_EQUAL(tc, b,
+            enb_ue_find_by_enb_ue_s1ap_id(&target, INVALID_UE_S1AP_ID));
+    ABTS_INT_EQUAL(tc, 0, target.num_of_enb_ue_dup);
+
+    enb_ue_remove(b);
+    enb_ue_remove(c);
+
+    ABTS_PTR_EQUAL(tc, NULL,
+            enb_ue_find_by_enb_ue_s1ap_id(&enb, INVALID_UE_S1AP_ID));
+    ABTS_PTR_EQUAL(tc, NULL,
+            enb_ue_find_by_enb_ue_s1ap_id(&target, INVALID_UE_S1AP_ID));
+    ABTS_INT_EQUAL(tc, 0, ogs_ihash_count(enb.enb_ue_hash));
+    ABTS_INT_EQUAL(tc, 0, ogs_ihash_count(target.enb_ue_hash));
+
+    test_enb_final(&target);
+    test_enb_final(&enb);
+    test_mme_final();
+}
+
+abts_suite *test_context(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    /* The metrics are not initialized again in the same process */
+    ogs_app_context_init();
+    ogs_app()->max.ue = NUM_OF_TEST_ENB_UE;
+    mme_metrics_init();
+
+    abts_run_test(suite, mme_context_test1, NULL);
+    abts_run_test(suite, mme_context_test2, NULL);
+
+    mme_metrics_final();
+    ogs_app_context_final();
+
+    return suite;
+}
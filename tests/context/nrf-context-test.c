@@ -0,0 +1,435 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "nrf/context.h"
+#include "nrf/nnrf-build.h"
+#include "core/abts.h"
+
+#define NUM_OF_TEST_NF_INSTANCE     1000
+#define NUM_OF_TEST_REQUEST         10
+#define TEST_VALIDITY_PERIOD        3600
+
+static void test_nrf_init(void)
+{
+    ogs_app()->timer_mgr = ogs_timer_mgr_create(ogs_app()->pool.nf);
+    ogs_assert(ogs_app()->timer_mgr);
+
+    ogs_sbi_context_init(OpenAPI_nf_type_NRF);
+    nrf_context_init();
+}
+
+static void test_nrf_final(void)
+{
+    nrf_context_final();
+    ogs_sbi_context_final();
+
+    ogs_timer_mgr_destroy(ogs_app()->timer_mgr);
+    ogs_app()->timer_mgr = NULL;
+}
+
+static OpenAPI_nf_profile_t *test_nf_profile(
+        int id, const char *nf_type, int addr,
+        const char *service_name1, const char *service_name2)
+{
+    OpenAPI_nf_profile_t *NFProfile = NULL;
+    const char *service_name[2];
+    char buf[OGS_HUGE_LEN];
+    char *p, *last;
+    cJSON *item = NULL;
+    int i;
+
+    service_name[0] = service_name1;
+    service_name[1] = service_name2;
+
+    p = buf;
+    last = buf + sizeof(buf);
+
+    p = ogs_slprintf(p, last,
+        "{\"nfInstanceId\":\"%08x-4b1e-11ed-8e4f-0b6f0f0f0001\","
+        "\"nfType\":\"%s\",\"nfStatus\":\"REGISTERED\","
+        "\"heartBeatTimer\":10,\"ipv4Addresses\":[\"127.0.%d.%d\"],"
+        "\"allowedNfTypes\":[\"AMF\",\"SCP\"],"
+        "\"priority\":0,\"capacity\":100,\"load\":0,"
+        "\"nfServices\":[",
+        id, nf_type, addr / 250, addr % 250);
+    for (i = 0; i < 2; i++) {
+        if (!service_name[i])
+            continue;
+        p = ogs_slprintf(p, last,
+            "%s{\"serviceInstanceId\":\"%08x-%d\","
+            "\"serviceName\":\"%s\","
+            "\"versions\":[{\"apiVersionInUri\":\"v1\","
+            "\"apiFullVersion\":\"1.0.0\"}],"
+            "\"scheme\":\"http\",\"nfServiceStatus\":\"REGISTERED\","
+            "\"ipEndPoints\":[{\"ipv4Address\":\"127.0.%d.%d\","
+            "\"port\":7777}],"
+            "\"allowedNfTypes\":[\"AMF\"],"
+            "\"priority\":0,\"capacity\":100,\"load\":0}",
+            i ? "," : "", id, i, service_name[i], addr / 250, addr % 250);
+    }
+    p = ogs_slprintf(p, last, "],\"nfProfileChangesSupportInd\":true}");
+    ogs_assert(p < last);
+
+    item = cJSON_Parse(buf);
+    ogs_assert(item);
+    NFProfile = OpenAPI_nf_profile_parseFromJSON(item);
+    ogs_assert(NFProfile);
+    cJSON_Delete(item);
+
+    return NFProfile;
+}
+
+/* As in nrf_nnrf_handle_nf_register() */
+static void test_nf_register(ogs_sbi_nf_instance_t *nf_instance,
+        OpenAPI_nf_profile_t *NFProfile)
+{
+    ogs_nnrf_nfm_handle_nf_profile(nf_instance, NFProfile);
+    ogs_assert(nrf_nf_index_update(nf_instance));
+
+    OpenAPI_nf_profile_free(NFProfile);
+}
+
+/* As in nrf_state_operational() for a new NF instance */
+static ogs_sbi_nf_instance_t *test_nf_instance_add(int id)
+{
+    ogs_sbi_nf_instance_t *nf_instance = NULL;
+    char nf_instance_id[OGS_UUID_FORMATTED_LENGTH + 1];
+
+    ogs_snprintf(nf_instance_id, sizeof(nf_instance_id),
+            "%08x-4b1e-11ed-8e4f-0b6f0f0f0001", id);
+
+    nf_instance = ogs_sbi_nf_instance_add();
+    ogs_assert(nf_instance);
+    ogs_sbi_nf_instance_set_id(nf_instance, nf_instance_id);
+
+    nrf_nf_fsm_init(nf_instance);
+
+    return nf_instance;
+}
+
+/* As in nrf_state_operational() after NFDeregister */
+static void test_nf_deregister(ogs_sbi_nf_instance_t *nf_instance)
+{
+    nrf_nf_fsm_fini(nf_instance);
+    ogs_sbi_nf_instance_remove(nf_instance);
+}
+
+static char *test_nf_discover(abts_case *tc,
+        OpenAPI_nf_type_e target_nf_type,
+        ogs_sbi_discovery_option_t *discovery_option, int limit)
+{
+    ogs_sbi_message_t recvmsg;
+    char *content = NULL;
+    size_t content_length;
+
+    memset(&recvmsg, 0, sizeof(recvmsg));
+    recvmsg.param.target_nf_type = target_nf_type;
+    recvmsg.param.requester_nf_type = OpenAPI_nf_type_AMF;
+    recvmsg.param.discovery_option = discovery_option;
+    recvmsg.param.limit = limit;
+
+    content = nrf_nnrf_disc_build_search_result(
+            &recvmsg, TEST_VALIDITY_PERIOD, &content_length);
+    ABTS_PTR_NOTNULL(tc, content);
+    ABTS_INT_EQUAL(tc, strlen(content), content_length);
+
+    return content;
+}
+
+/* Number of NF instances in the SearchResult, -1 if not parsed */
+static int test_search_result_count(const char *content)
+{
+    OpenAPI_search_result_t *SearchResult = NULL;
+    cJSON *item = NULL;
+    int count = -1;
+
+    item = cJSON_Parse(content);
+    if (!item)
+        return -1;
+
+    SearchResult = OpenAPI_search_result_parseFromJSON(item);
+    if (SearchResult) {
+        count = SearchResult->nf_instances ?
+            SearchResult->nf_instances->count : 0;
+        OpenAPI_search_result_free(SearchResult);
+    }
+    cJSON_Delete(item);
+
+    return count;
+}
+
+static void nrf_context_test1(abts_case *tc, void *data)
+{
+    ogs_sbi_nf_instance_t *smf1 = NULL, *smf2 = NULL, *ausf = NULL;
+    ogs_sbi_discovery_option_t *discovery_option = NULL;
+    nrf_nf_index_t *index = NULL;
+    char *content = NULL;
+    const char *key = NULL;
+
+    test_nrf_init();
+
+    /* NFRegister */
+    smf1 = test_nf_instance_add(1);
+    test_nf_register(smf1, test_nf_profile(1, "SMF", 1,
+                "nsmf-pdusession", "nsmf-event-exposure"));
+    smf2 = test_nf_instance_add(2);
+    test_nf_register(smf2, test_nf_profile(2, "SMF", 2,
+                "nsmf-event-exposure", NULL));
+    ausf = test_nf_instance_add(3);
+    test_nf_register(ausf, test_nf_profile(3, "AUSF", 3,
+                "nausf-auth", NULL));
+
+    ABTS_INT_EQUAL(tc, 2, nrf_self()->num_of_nf_type[OpenAPI_nf_type_SMF]);
+    ABTS_INT_EQUAL(tc, 1, nrf_self()->num_of_nf_type[OpenAPI_nf_type_AUSF]);
+
+    index = nrf_nf_index_find(smf1);
+    ABTS_PTR_NOTNULL(tc, index);
+    ABTS_INT_EQUAL(tc, OpenAPI_nf_type_SMF, index->nf_type);
+    ABTS_INT_EQUAL(tc, 0, index->num_of_profile);
+
+    /* NF-Discover without options */
+    content = test_nf_discover(tc, OpenAPI_nf_type_SMF, NULL, 0);
+    ABTS_INT_EQUAL(tc, 2, test_search_result_count(content));
+    ABTS_PTR_NOTNULL(tc, strstr(content, "\"validityPeriod\":3600"));
+    ABTS_PTR_EQUAL(tc, NULL, strstr(content, "numNfInstComplete"));
+    ABTS_PTR_EQUAL(tc, NULL, strstr(content, "nausf-auth"));
+    ogs_free(content);
+
+    ABTS_INT_EQUAL(tc, 1, index->num_of_profile);
+    ABTS_PTR_NOTNULL(tc, ogs_hash_get(index->profile_hash, "L:", 2));
+
+    /* The limit adds numNfInstComplete */
+    content = test_nf_discover(tc, OpenAPI_nf_type_SMF, NULL, 1);
+    ABTS_INT_EQUAL(tc, 1, test_search_result_count(content));
+    ABTS_PTR_NOTNULL(tc, strstr(content, "\"numNfInstComplete\":1}"));
+    ogs_free(content);
+
+    /* The service-names are sorted in the key of the cache */
+    discovery_option = ogs_sbi_discovery_option_new();
+    ogs_assert(discovery_option);
+    ogs_sbi_discovery_option_add_service_names(
+            discovery_option, (char *)"nsmf-pdusession");
+    ogs_sbi_discovery_option_add_service_names(
+            discovery_option, (char *)"nsmf-event-exposure");
+
+    content = test_nf_discover(tc, OpenAPI_nf_type_SMF, discovery_option, 0);
+    ABTS_INT_EQUAL(tc, 2, test_search_result_count(content));
+    ogs_free(content);
+
+    key = "L:nsmf-event-exposure,nsmf-pdusession";
+    ABTS_INT_EQUAL(tc, 2, index->num_of_profile);
+    ABTS_PTR_NOTNULL(tc, ogs_hash_get(index->profile_hash, key, strlen(key)));
+
+    ogs_sbi_discovery_option_free(discovery_option);
+
+    /* Only the service in service-names is in the NFProfile */
+    discovery_option = ogs_sbi_discovery_option_new();
+    ogs_assert(discovery_option);
+    ogs_sbi_discovery_option_add_service_names(
+            discovery_option, (char *)"nsmf-pdusession");
+
+    content = test_nf_discover(tc, OpenAPI_nf_type_SMF, discovery_option, 0);
+    ABTS_INT_EQUAL(tc, 1, test_search_result_count(content));
+    ABTS_PTR_NOTNULL(tc, strstr(content, "\"nfServices\":["));
+    ABTS_PTR_EQUAL(tc, NULL, strstr(content, "nsmf-event-exposure"));
+    ogs_free(content);
+
+    /* The service-map feature is another variant */
+    OGS_SBI_FEATURES_SET(discovery_option->requester_features,
+            OGS_SBI_NNRF_DISC_SERVICE_MAP);
+
+    content = test_nf_discover(tc, OpenAPI_nf_type_SMF, discovery_option, 0);
+    ABTS_INT_EQUAL(tc, 1, test_search_result_count(content));
+    ABTS_PTR_NOTNULL(tc, strstr(content, "\"nfServiceList\":{"));
+    ogs_free(content);
+
+    key = "M:nsmf-pdusession";
+    ABTS_INT_EQUAL(tc, 4, index->num_of_profile);
+    ABTS_PTR_NOTNULL(tc, ogs_hash_get(index->profile_hash, key, strlen(key)));
+
+    /* The same request is served from the cache */
+    content = test_nf_discover(tc, OpenAPI_nf_type_SMF, discovery_option, 0);
+    ABTS_INT_EQUAL(tc, 1, test_search_result_count(content));
+    ogs_free(content);
+    ABTS_INT_EQUAL(tc, 4, index->num_of_profile);
+
+    ogs_sbi_discovery_option_free(discovery_option);
+
+    /* The service type rejects the NF instance before the full match */
+    discovery_option = ogs_sbi_discovery_option_new();
+    ogs_assert(discovery_option);
+    ogs_sbi_discovery_option_add_service_names(
+            discovery_option, (char *)"namf-comm");
+
+    ABTS_TRUE(tc, nrf_nf_index_has_service(index, discovery_option) == false);
+    content = test_nf_discover(tc, OpenAPI_nf_type_SMF, discovery_option, 0);
+    ABTS_INT_EQUAL(tc, 0, test_search_result_count(content));
+    ogs_free(content);
+
+    ogs_sbi_discovery_option_free(discovery_option);
+
+    /* NFRegister again with another address drops the cache */
+    test_nf_register(smf1, test_nf_profile(1, "SMF", 101,
+                "nsmf-pdusession", "nsmf-event-exposure"));
+    ABTS_PTR_EQUAL(tc, index, nrf_nf_index_find(smf1));
+    ABTS_INT_EQUAL(tc, 0, index->num_of_profile);
+    ABTS_INT_EQUAL(tc, 2, nrf_self()->num_of_nf_type[OpenAPI_nf_type_SMF]);
+
+    content = test_nf_discover(tc, OpenAPI_nf_type_SMF, NULL, 0);
+    ABTS_INT_EQUAL(tc, 2, test_search_result_count(content));
+    ABTS_PTR_NOTNULL(tc, strstr(content, "127.0.0.101"));
+    ABTS_PTR_EQUAL(tc, NULL, strstr(content, "\"127.0.0.1\""));
+    ogs_free(content);
+
+    /* NFDeregister */
+    test_nf_deregister(smf1);
+    ABTS_INT_EQUAL(tc, 1, nrf_self()->num_of_nf_type[OpenAPI_nf_type_SMF]);
+
+    content = test_nf_discover(tc, OpenAPI_nf_type_SMF, NULL, 0);
+    ABTS_INT_EQUAL(tc, 1, test_search_result_count(content));
+    ABTS_PTR_EQUAL(tc, NULL, strstr(content, "127.0.0.101"));
+    ABTS_PTR_NOTNULL(tc, strstr(content, "127.0.0.2"));
+    ogs_free(content);
+
+    test_nf_deregister(smf2);
+    ABTS_INT_EQUAL(tc, 0, nrf_self()->num_of_nf_type[OpenAPI_nf_type_SMF]);
+
+    content = test_nf_discover(tc, OpenAPI_nf_type_SMF, NULL, 0);
+    ABTS_INT_EQUAL(tc, 0, test_search_result_count(content));
+    ogs_free(content);
+
+    content = test_nf_discover(tc, OpenAPI_nf_type_AUSF, NULL, 0);
+    ABTS_INT_EQUAL(tc, 1, test_search_result_count(content));
+    ogs_free(content);
+
+    test_nf_deregister(ausf);
+
+    test_nrf_final();
+}
+
+/*
+ * The SearchResult made of the cached NFProfile JSON
+ * must be the same as the one printed by cJSON.
+ */
+static void nrf_context_test2(abts_case *tc, void *data)
+{
+    ogs_sbi_nf_instance_t **nf_instance = NULL;
+    OpenAPI_nf_profile_t **NFProfile = NULL;
+    OpenAPI_search_result_t *SearchResult = NULL;
+    OpenAPI_list_t *NFProfileList = NULL;
+    char *content = NULL, *content2 = NULL;
+    cJSON *item = NULL;
+    ogs_time_t start, cjson_usecs, cached_usecs;
+    int i, j;
+
+    test_nrf_init();
+
+    nf_instance = ogs_calloc(NUM_OF_TEST_NF_INSTANCE, sizeof(*nf_instance));
+    ogs_assert(nf_instance);
+    NFProfile = ogs_calloc(NUM_OF_TEST_NF_INSTANCE, sizeof(*NFProfile));
+    ogs_assert(NFProfile);
+
+    for (i = 0; i < NUM_OF_TEST_NF_INSTANCE; i++) {
+        nf_instance[i] = test_nf_instance_add(i);
+        test_nf_register(nf_instance[i],
+                test_nf_profile(i, "SMF", i, "nsmf-pdusession", NULL));
+    }
+
+    /* NRF lists the NF instances in the order of NFRegister */
+    for (i = 0; i < NUM_OF_TEST_NF_INSTANCE; i++) {
+        NFProfile[i] = ogs_nnrf_nfm_build_nf_profile(
+                nf_instance[i], NULL, NULL, false);
+        ABTS_PTR_NOTNULL(tc, NFProfile[i]);
+    }
+
+    /* Benchmark : run with '-e info' to see the result */
+    start = ogs_get_monotonic_time();
+    for (j = 0; j < NUM_OF_TEST_REQUEST; j++) {
+        NFProfileList = OpenAPI_list_create();
+        ogs_assert(NFProfileList);
+        for (i = 0; i < NUM_OF_TEST_NF_INSTANCE; i++)
+            OpenAPI_list_add(NFProfileList, NFProfile[i]);
+
+        SearchResult = OpenAPI_search_result_create(
+                true, TEST_VALIDITY_PERIOD, NFProfileList, NULL,
+                true, NUM_OF_TEST_NF_INSTANCE, NULL, NULL);
+        ogs_assert(SearchResult);
+
+        item = OpenAPI_search_result_convertToJSON(SearchResult);
+        ogs_assert(item);
+        if (content)
+            cJSON_free(content);
+        content = cJSON_PrintUnformatted(item);
+        ogs_assert(content);
+        cJSON_Delete(item);
+
+        OpenAPI_list_free(NFProfileList);
+        SearchResult->nf_instances = NULL;
+        OpenAPI_search_result_free(SearchResult);
+    }
+    cjson_usecs = ogs_get_monotonic_time() - start;
+
+    start = ogs_get_monotonic_time();
+    for (j = 0; j < NUM_OF_TEST_REQUEST; j++) {
+        if (content2)
+            ogs_free(content2);
+        content2 = test_nf_discover(tc, OpenAPI_nf_type_SMF,
+                NULL, NUM_OF_TEST_NF_INSTANCE);
+    }
+    cached_usecs = ogs_get_monotonic_time() - start;
+
+    ABTS_STR_EQUAL(tc, content, content2);
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_NF_INSTANCE,
+            test_search_result_count(content2));
+
+    ogs_info("%d NF instances : cJSON %lld usecs/request, "
+            "cached %lld usecs/request",
+            NUM_OF_TEST_NF_INSTANCE,
+            (long long)cjson_usecs / NUM_OF_TEST_REQUEST,
+            (long long)cached_usecs / NUM_OF_TEST_REQUEST);
+
+    cJSON_free(content);
+    ogs_free(content2);
+
+    for (i = 0; i < NUM_OF_TEST_NF_INSTANCE; i++) {
+        ogs_nnrf_nfm_free_nf_profile(NFProfile[i]);
+        test_nf_deregister(nf_instance[i]);
+    }
+    ogs_free(NFProfile);
+    ogs_free(nf_instance);
+
+    test_nrf_final();
+}
+
+abts_suite *test_context(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    ogs_app_context_init();
+    /* The NRF and the SCP are also NF instances */
+    ogs_app()->pool.nf = NUM_OF_TEST_NF_INSTANCE + 2;
+    ogs_app()->pool.nf_service = ogs_app()->pool.nf * 2;
+
+    abts_run_test(suite, nrf_context_test1, NULL);
+    abts_run_test(suite, nrf_context_test2, NULL);
+
+    ogs_app_context_final();
+
+    return suite;
+}
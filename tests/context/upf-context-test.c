@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "upf/context.h"
+#include "upf/fwd.h"
+#include "upf/gtp-path.h"
+#include "upf/metrics.h"
+#include "core/abts.h"
+
+#include <netinet/ip.h>
+#include <netinet/ip6.h>
+
+static uint64_t test_counter(upf_metric_type_global_t t)
+{
+    ogs_assert(upf_metrics_fast_global[t]);
+    return ogs_metrics_fast_get(upf_metrics_fast_global[t], 0);
+}
+
+static void upf_context_test1(abts_case *tc, void *data)
+{
+    ogs_pfcp_pdr_t pdr;
+    ogs_pfcp_qer_t qer;
+    uint64_t gate, mbr;
+
+    memset(&pdr, 0, sizeof(pdr));
+    memset(&qer, 0, sizeof(qer));
+    ogs_thread_mutex_init(&qer.policer.mutex);
+
+    gate = test_counter(UPF_METR_GLOB_CTR_QER_GATEDROPPKT);
+    mbr = test_counter(UPF_METR_GLOB_CTR_QER_MBRDROPPKT);
+
+    /* No QER */
+    ABTS_TRUE(tc, upf_gtp_qer_police(&pdr, OGS_MAX_PKT_LEN, true) == true);
+
+    /* 800bps : The bucket is one packet of the maximum size */
+    pdr.qer = &qer;
+    qer.mbr.uplink = 800;
+    qer.mbr.downlink = 800;
+    ogs_pfcp_qer_update_policer(&qer);
+
+    ABTS_TRUE(tc, upf_gtp_qer_police(&pdr, OGS_MAX_PKT_LEN, true) == true);
+    ABTS_TRUE(tc, upf_gtp_qer_police(&pdr, 1, true) == false);
+    ABTS_TRUE(tc, upf_gtp_qer_police(&pdr, 1, true) == false);
+    ABTS_TRUE(tc, upf_gtp_qer_police(&pdr, OGS_MAX_PKT_LEN, false) == true);
+    ABTS_TRUE(tc, upf_gtp_qer_police(&pdr, 1, false) == false);
+
+    ABTS_TRUE(tc, test_counter(UPF_METR_GLOB_CTR_QER_GATEDROPPKT) == gate);
+    ABTS_TRUE(tc, test_counter(UPF_METR_GLOB_CTR_QER_MBRDROPPKT) == mbr + 3);
+
+    /* Gate drops are counted separately from MBR drops */
+    qer.gate_status.uplink = OGS_PFCP_GATE_CLOSE;
+    ABTS_TRUE(tc, upf_gtp_qer_police(&pdr, 1, true) == false);
+    qer.gate_status.downlink = OGS_PFCP_GATE_CLOSE;
+    ABTS_TRUE(tc, upf_gtp_qer_police(&pdr, 1, false) == false);
+
+    ABTS_TRUE(tc, test_counter(UPF_METR_GLOB_CTR_QER_GATEDROPPKT) == gate + 2);
+    ABTS_TRUE(tc, test_counter(UPF_METR_GLOB_CTR_QER_MBRDROPPKT) == mbr + 3);
+
+    ogs_thread_mutex_destroy(&qer.policer.mutex);
+}
+
+static upf_sess_t *test_sess_add(uint64_t seid)
+{
+    ogs_pfcp_f_seid_t f_seid;
+
+    memset(&f_seid, 0, sizeof(f_seid));
+    f_seid.ipv4 = 1;
+    f_seid.addr = htobe32(0x7f000001);
+    f_seid.seid = seid;
+
+    return upf_sess_add(&f_seid);
+}
+
+static ogs_pfcp_pdr_t *test_pdr_add(upf_sess_t *sess,
+        ogs_pfcp_interface_t src_if, uint32_t teid, uint8_t qfi)
+{
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_far_t *far = NULL;
+
+    pdr = ogs_pfcp_pdr_add(&sess->pfcp);
+    ogs_assert(pdr);
+    far = ogs_pfcp_far_add(&sess->pfcp);
+    ogs_assert(far);
+    ogs_pfcp_pdr_associate_far(pdr, far);
+
+    pdr->src_if = src_if;
+    pdr->qfi = qfi;
+
+    if (src_if == OGS_PFCP_INTERFACE_ACCESS) {
+        far->dst_if = OGS_PFCP_INTERFACE_CORE;
+
+        pdr->f_teid.ipv4 = 1;
+        pdr->f_teid.teid = teid;
+        pdr->f_teid_len = 5;
+    } else {
+        far->dst_if = OGS_PFCP_INTERFACE_ACCESS;
+        far->outer_header_creation.gtpu4 = 1;
+    }
+
+    return pdr;
+}
+
+static upf_fwd_t *test_find_by_ue_ip(int family, const void *addr)
+{
+    ogs_pkbuf_t *pkbuf = NULL;
+    struct ip *ip_h = NULL;
+    struct ip6_hdr *ip6_h = NULL;
+    upf_fwd_t *fwd = NULL;
+
+    pkbuf = ogs_pkbuf_alloc(NULL, sizeof(*ip6_h));
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put(pkbuf, sizeof(*ip6_h));
+    memset(pkbuf->data, 0, pkbuf->len);
+
+    if (family == AF_INET) {
+        ip_h = (struct ip *)pkbuf->data;
+        ip_h->ip_v = 4;
+        memcpy(&ip_h->ip_dst.s_addr, addr, OGS_IPV4_LEN);
+    } else {
+        ip6_h = (struct ip6_hdr *)pkbuf->data;
+        ip6_h->ip6_vfc = 0x60;
+        memcpy(ip6_h->ip6_dst.s6_addr, addr, OGS_IPV6_LEN);
+    }
+
+    fwd = upf_fwd_find_by_ue_ip(pkbuf);
+    ogs_pkbuf_free(pkbuf);
+
+    return fwd;
+}
+
+static void upf_context_test2(abts_case *tc, void *data)
+{
+    upf_sess_t *sess = NULL, *other = NULL;
+    ogs_pfcp_pdr_t *ul1 = NULL, *ul2 = NULL, *ul3 = NULL;
+    ogs_pfcp_pdr_t *dl = NULL, *pdr = NULL;
+    upf_fwd_t *fwd = NULL;
+    uint32_t addr, unknown;
+    uint8_t addr6[OGS_IPV6_LEN];
+    int rv;
+
+    ogs_pfcp_context_init();
+    upf_context_init();
+
+    ABTS_PTR_NOTNULL(tc, ogs_pfcp_subnet_add(
+                "10.45.0.1", "16", NULL, "ogstun"));
+    ABTS_PTR_NOTNULL(tc, ogs_pfcp_subnet_add(
+                "2001:db8:cafe::1", "48", NULL, "ogstun"));
+
+    sess = test_sess_add(1);
+    ABTS_PTR_NOTNULL(tc, sess);
+
+    /* PDR with its own TEID, and two PDRs sharing a TEID by QFI */
+    ul1 = test_pdr_add(sess, OGS_PFCP_INTERFACE_ACCESS, 0x100, 1);
+    ogs_pfcp_object_teid_hash_set(OGS_PFCP_OBJ_PDR_TYPE, ul1);
+    ul2 = test_pdr_add(sess, OGS_PFCP_INTERFACE_ACCESS, 0x200, 1);
+    ogs_pfcp_object_teid_hash_set(OGS_PFCP_OBJ_SESS_TYPE, ul2);
+    ul3 = test_pdr_add(sess, OGS_PFCP_INTERFACE_ACCESS, 0x200, 2);
+    ogs_pfcp_object_teid_hash_set(OGS_PFCP_OBJ_SESS_TYPE, ul3);
+
+    /* UE IPv4 and IPv6 address */
+    dl = test_pdr_add(sess, OGS_PFCP_INTERFACE_CORE, 0, 0);
+    addr = htobe32(0x0a2d0002);
+    ogs_assert(OGS_OK == ogs_inet_pton(AF_INET6, "2001:db8:cafe::2", addr6));
+    dl->ue_ip_addr.ipv4 = 1;
+    dl->ue_ip_addr.ipv6 = 1;
+    dl->ue_ip_addr.both.addr = addr;
+    memcpy(dl->ue_ip_addr.both.addr6, addr6, OGS_IPV6_LEN);
+    dl->ue_ip_addr_len = sizeof(dl->ue_ip_addr);
+    ABTS_INT_EQUAL(tc, OGS_PFCP_CAUSE_REQUEST_ACCEPTED,
+        upf_sess_set_ue_ip(sess, OGS_PDU_SESSION_TYPE_IPV4V6, dl));
+
+    /* N4 Establishment */
+    upf_fwd_update(sess);
+
+    /* The TEID selects the PDR regardless of QFI */
+    fwd = upf_fwd_find_by_teid(0x100, 0);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, sess, fwd->sess);
+    ABTS_PTR_EQUAL(tc, ul1, fwd->pdr);
+    fwd = upf_fwd_find_by_teid(0x100, 9);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, ul1, fwd->pdr);
+
+    /* The shared TEID is looked up with (TEID, QFI) */
+    fwd = upf_fwd_find_by_teid(0x200, 1);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, ul2, fwd->pdr);
+    fwd = upf_fwd_find_by_teid(0x200, 2);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, ul3, fwd->pdr);
+    fwd = upf_fwd_find_by_teid(0x200, 0);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, ul2, fwd->pdr);
+    ABTS_PTR_EQUAL(tc, NULL, upf_fwd_find_by_teid(0x200, 3));
+    ABTS_PTR_EQUAL(tc, NULL, upf_fwd_find_by_teid(0x300, 0));
+
+    /* UE IP address */
+    fwd = test_find_by_ue_ip(AF_INET, &addr);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, sess, fwd->sess);
+    ABTS_PTR_EQUAL(tc, dl, fwd->pdr);
+    fwd = test_find_by_ue_ip(AF_INET6, addr6);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, dl, fwd->pdr);
+    unknown = htobe32(0x0a2d0003);
+    ABTS_PTR_EQUAL(tc, NULL, test_find_by_ue_ip(AF_INET, &unknown));
+
+    /* N4 Modification : QFI 2 is removed */
+    ogs_pfcp_pdr_remove(ul3);
+    upf_fwd_update(sess);
+
+    ABTS_PTR_EQUAL(tc, NULL, upf_fwd_find_by_teid(0x200, 2));
+    fwd = upf_fwd_find_by_teid(0x200, 1);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, ul2, fwd->pdr);
+    fwd = upf_fwd_find_by_teid(0x100, 0);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, ul1, fwd->pdr);
+    ABTS_PTR_NOTNULL(tc, test_find_by_ue_ip(AF_INET, &addr));
+
+    /* The shared TEID is moved to another session */
+    other = test_sess_add(2);
+    ABTS_PTR_NOTNULL(tc, other);
+    pdr = test_pdr_add(other, OGS_PFCP_INTERFACE_ACCESS, 0x200, 1);
+    ogs_pfcp_object_teid_hash_set(OGS_PFCP_OBJ_SESS_TYPE, pdr);
+    upf_fwd_update(other);
+
+    fwd = upf_fwd_find_by_teid(0x200, 1);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, other, fwd->sess);
+    ABTS_PTR_EQUAL(tc, pdr, fwd->pdr);
+
+    /* The old session removes only the keys it still owns */
+    upf_fwd_remove(sess);
+    fwd = upf_fwd_find_by_teid(0x200, 1);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, pdr, fwd->pdr);
+    fwd = upf_fwd_find_by_teid(0x200, 0);
+    ABTS_PTR_NOTNULL(tc, fwd);
+    ABTS_PTR_EQUAL(tc, pdr, fwd->pdr);
+    ABTS_PTR_EQUAL(tc, NULL, upf_fwd_find_by_teid(0x100, 0));
+    ABTS_PTR_EQUAL(tc, NULL, test_find_by_ue_ip(AF_INET, &addr));
+    ABTS_PTR_EQUAL(tc, NULL, test_find_by_ue_ip(AF_INET6, addr6));
+
+    /* N4 Modification : SDF Filter on the shared TEID takes the slow path */
+    ABTS_PTR_NOTNULL(tc, ogs_pfcp_rule_add(pdr));
+    upf_fwd_update(other);
+
+    ABTS_PTR_EQUAL(tc, NULL, upf_fwd_find_by_teid(0x200, 0));
+    ABTS_PTR_EQUAL(tc, NULL, upf_fwd_find_by_teid(0x200, 1));
+
+    /* N4 Deletion */
+    rv = upf_sess_remove(other);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    upf_fwd_update(sess);
+    ABTS_PTR_NOTNULL(tc, upf_fwd_find_by_teid(0x100, 0));
+    ABTS_PTR_EQUAL(tc, NULL, upf_fwd_find_by_teid(0x200, 1));
+    ABTS_PTR_NOTNULL(tc, test_find_by_ue_ip(AF_INET, &addr));
+
+    rv = upf_sess_remove(sess);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_PTR_EQUAL(tc, NULL, upf_fwd_find_by_teid(0x100, 0));
+    ABTS_PTR_EQUAL(tc, NULL, test_find_by_ue_ip(AF_INET, &addr));
+    ABTS_PTR_EQUAL(tc, NULL, test_find_by_ue_ip(AF_INET6, addr6));
+
+    /* All entries are gone, or upf_fwd_final() asserts */
+    upf_context_final();
+    ogs_pfcp_context_final();
+}
+
+abts_suite *test_context(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    /* The metrics are not initialized again in the same process */
+    ogs_app_context_init();
+    upf_metrics_init();
+
+    abts_run_test(suite, upf_context_test1, NULL);
+    abts_run_test(suite, upf_context_test2, NULL);
+
+    upf_metrics_final();
+    ogs_app_context_final();
+
+    return suite;
+}
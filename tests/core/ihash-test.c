@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-core.h"
+#include "core/abts.h"
+
+static void test1_func(abts_case *tc, void *data)
+{
+    ogs_ihash_t *ht = NULL;
+    char *a = "a", *b = "b", *c = "c";
+
+    ht = ogs_ihash_make();
+    ABTS_PTR_NOTNULL(tc, ht);
+    ABTS_INT_EQUAL(tc, 0, ogs_ihash_count(ht));
+
+    ogs_ihash_set(ht, 0, a);
+    ogs_ihash_set(ht, 0x12345678, b);
+    ogs_ihash_set(ht, 0xffffffffffffffffULL, c);
+    ABTS_INT_EQUAL(tc, 3, ogs_ihash_count(ht));
+
+    ABTS_PTR_EQUAL(tc, a, ogs_ihash_get(ht, 0));
+    ABTS_PTR_EQUAL(tc, b, ogs_ihash_get(ht, 0x12345678));
+    ABTS_PTR_EQUAL(tc, c, ogs_ihash_get(ht, 0xffffffffffffffffULL));
+    ABTS_PTR_EQUAL(tc, NULL, ogs_ihash_get(ht, 1));
+
+    /* Overwrite */
+    ogs_ihash_set(ht, 0x12345678, c);
+    ABTS_PTR_EQUAL(tc, c, ogs_ihash_get(ht, 0x12345678));
+    ABTS_INT_EQUAL(tc, 3, ogs_ihash_count(ht));
+
+    /* Delete */
+    ogs_ihash_set(ht, 0, NULL);
+    ABTS_PTR_EQUAL(tc, NULL, ogs_ihash_get(ht, 0));
+    ABTS_INT_EQUAL(tc, 2, ogs_ihash_count(ht));
+
+    /* Deleting a missing key does nothing */
+    ogs_ihash_set(ht, 0, NULL);
+    ABTS_INT_EQUAL(tc, 2, ogs_ihash_count(ht));
+
+    ogs_ihash_clear(ht);
+    ABTS_INT_EQUAL(tc, 0, ogs_ihash_count(ht));
+    ABTS_PTR_EQUAL(tc, NULL, ogs_ihash_get(ht, 0x12345678));
+
+    ogs_ihash_destroy(ht);
+}
+
+#define TEST2_NUM_OF_KEY    4096
+#define TEST2_NUM_OF_OP     200000
+
+static void test2_func(abts_case *tc, void *data)
+{
+    ogs_ihash_t *ht = NULL;
+    static void *expected[TEST2_NUM_OF_KEY];
+    unsigned int count = 0;
+    int i, n;
+
+    ht = ogs_ihash_make();
+    ABTS_PTR_NOTNULL(tc, ht);
+    memset(expected, 0, sizeof(expected));
+
+    /* Random set/delete across several incremental rehashes */
+    for (n = 0; n < TEST2_NUM_OF_OP; n++) {
+        i = ogs_random32() % TEST2_NUM_OF_KEY;
+
+        if (ogs_random32() % 3) {
+            if (!expected[i]) count++;
+            expected[i] = &expected[i];
+        } else {
+            if (expected[i]) count--;
+            expected[i] = NULL;
+        }
+        ogs_ihash_set(ht, (uint64_t)i << 32, expected[i]);
+
+        ogs_assert(ogs_ihash_get(ht, (uint64_t)i << 32) == expected[i]);
+        ogs_assert(ogs_ihash_count(ht) == count);
+    }
+
+    for (i = 0; i < TEST2_NUM_OF_KEY; i++)
+        ABTS_PTR_EQUAL(tc, expected[i], ogs_ihash_get(ht, (uint64_t)i << 32));
+
+    ogs_ihash_destroy(ht);
+}
+
+#define TEST3_NUM_OF_KEY    (1024*1024)
+
+static void test3_func(abts_case *tc, void *data)
+{
+    ogs_hash_t *hash = NULL;
+    ogs_ihash_t *ihash = NULL;
+    ogs_time_t start, usecs[2][3];
+    static uint32_t teid[TEST3_NUM_OF_KEY];
+    int i;
+
+    /* ogs_hash_t keeps the key pointer, so each key needs its own storage */
+    for (i = 0; i < TEST3_NUM_OF_KEY; i++)
+        teid[i] = ogs_random32();
+
+    /* ogs_hash_t */
+    hash = ogs_hash_make();
+    ABTS_PTR_NOTNULL(tc, hash);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < TEST3_NUM_OF_KEY; i++)
+        ogs_hash_set(hash, &teid[i], sizeof(teid[i]), &teid[i]);
+    usecs[0][0] = ogs_get_monotonic_time() - start;
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < TEST3_NUM_OF_KEY; i++)
+        ogs_assert(ogs_hash_get(hash, &teid[i], sizeof(teid[i])));
+    usecs[0][1] = ogs_get_monotonic_time() - start;
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < TEST3_NUM_OF_KEY; i++)
+        ogs_hash_set(hash, &teid[i], sizeof(teid[i]), NULL);
+    usecs[0][2] = ogs_get_monotonic_time() - start;
+
+    ABTS_INT_EQUAL(tc, 0, ogs_hash_count(hash));
+    ogs_hash_destroy(hash);
+
+    /* ogs_ihash_t */
+    ihash = ogs_ihash_make();
+    ABTS_PTR_NOTNULL(tc, ihash);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < TEST3_NUM_OF_KEY; i++)
+        ogs_ihash_set(ihash, teid[i], &teid[i]);
+    usecs[1][0] = ogs_get_monotonic_time() - start;
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < TEST3_NUM_OF_KEY; i++)
+        ogs_assert(ogs_ihash_get(ihash, teid[i]));
+    usecs[1][1] = ogs_get_monotonic_time() - start;
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < TEST3_NUM_OF_KEY; i++)
+        ogs_ihash_set(ihash, teid[i], NULL);
+    usecs[1][2] = ogs_get_monotonic_time() - start;
+
+    ABTS_INT_EQUAL(tc, 0, ogs_ihash_count(ihash));
+    ogs_ihash_destroy(ihash);
+
+    ogs_info("%d keys : insert / lookup / delete", TEST3_NUM_OF_KEY);
+    ogs_info("ogs_hash_t  : %lld / %lld / %lld usecs",
+            (long long)usecs[0][0], (long long)usecs[0][1],
+            (long long)usecs[0][2]);
+    ogs_info("ogs_ihash_t : %lld / %lld / %lld usecs",
+            (long long)usecs[1][0], (long long)usecs[1][1],
+            (long long)usecs[1][2]);
+}
+
+abts_suite *test_ihash(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, test1_func, NULL);
+    abts_run_test(suite, test2_func, NULL);
+    abts_run_test(suite, test3_func, NULL);
+
+    return suite;
+}
@@ -70,12 +70,93 @@ static void test2_func(abts_case *tc, void *data)
     ogs_pkbuf_free(p3);
 }
 
+/*
+ * 2048-byte buffers from the per-thread magazines
+ * Run with '-e info' to see the result.
+ */
+#define TEST3_MAX_THREAD    4
+#define TEST3_NUM_OF_PACKET 200000
+#define TEST3_BURST         32
+#define TEST3_HEADROOM      16
+#define TEST3_PAYLOAD_LEN   1400
+
+static ogs_pkbuf_pool_t *test3_pool;
+
+static void test3_main(void *data)
+{
+    ogs_pkbuf_t *pkbuf[TEST3_BURST];
+    int i, j;
+
+    for (i = 0; i < TEST3_NUM_OF_PACKET / TEST3_BURST; i++) {
+        for (j = 0; j < TEST3_BURST; j++) {
+            pkbuf[j] = ogs_pkbuf_alloc(test3_pool, OGS_MAX_PKT_LEN);
+            ogs_assert(pkbuf[j]);
+            ogs_pkbuf_reserve(pkbuf[j], TEST3_HEADROOM);
+            ogs_pkbuf_put(pkbuf[j], TEST3_PAYLOAD_LEN);
+        }
+        for (j = 0; j < TEST3_BURST; j++)
+            ogs_pkbuf_free(pkbuf[j]);
+    }
+}
+
+static void test3_func(abts_case *tc, void *data)
+{
+    ogs_thread_t *thread[TEST3_MAX_THREAD];
+    ogs_pkbuf_t *pkbuf = NULL, *copybuf = NULL;
+    ogs_time_t start, usecs[TEST3_MAX_THREAD+1];
+    int i, n;
+
+#if OGS_USE_TALLOC
+    test3_pool = talloc_pool(__ogs_talloc_core, 1000*1024);
+#else
+    ogs_pkbuf_config_t config;
+
+    memset(&config, 0, sizeof config);
+    config.cluster_2048_pool = 4096;
+    test3_pool = ogs_pkbuf_pool_create(&config);
+#endif
+    ABTS_PTR_NOTNULL(tc, test3_pool);
+
+    /* The copy still holds the data after the original is gone */
+    pkbuf = ogs_pkbuf_alloc(test3_pool, OGS_MAX_PKT_LEN);
+    ABTS_PTR_NOTNULL(tc, pkbuf);
+    ogs_pkbuf_put_u32(pkbuf, 0x12345678);
+    copybuf = ogs_pkbuf_copy(pkbuf);
+    ABTS_PTR_NOTNULL(tc, copybuf);
+    ogs_pkbuf_free(pkbuf);
+    ABTS_INT_EQUAL(tc, 4, copybuf->len);
+    ABTS_INT_EQUAL(tc, 0x12, copybuf->data[0]);
+    ABTS_INT_EQUAL(tc, 0x78, copybuf->data[3]);
+    ogs_pkbuf_free(copybuf);
+
+    for (n = 1; n <= TEST3_MAX_THREAD; n *= 2) {
+        start = ogs_get_monotonic_time();
+        for (i = 0; i < n; i++) {
+            thread[i] = ogs_thread_create(test3_main, NULL);
+            ABTS_PTR_NOTNULL(tc, thread[i]);
+        }
+        for (i = 0; i < n; i++)
+            ogs_thread_destroy(thread[i]);
+        usecs[n] = ogs_get_monotonic_time() - start;
+    }
+
+    ogs_pkbuf_pool_destroy(test3_pool);
+#if OGS_USE_TALLOC
+    ogs_free(test3_pool);
+#endif
+
+    for (n = 1; n <= TEST3_MAX_THREAD; n *= 2)
+        ogs_info("%d thread(s) : %d packets per thread, %lld usecs",
+                n, TEST3_NUM_OF_PACKET, (long long)usecs[n]);
+}
+
 abts_suite *test_pkbuf(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, test1_func, NULL);
     abts_run_test(suite, test2_func, NULL);
+    abts_run_test(suite, test3_func, NULL);
 
     return suite;
 }
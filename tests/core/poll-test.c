@@ -657,6 +657,133 @@ static void test8_func(abts_case *tc, void *data)
     ogs_pollset_destroy(pollset);
 }
 
+static ogs_socket_t test9_fd[2];
+static ogs_poll_t *test9_poll[2];
+static int test9_called = 0;
+
+static void test9_handler(short when, ogs_socket_t fd, void *data)
+{
+    int i;
+
+    /* Remove the other poll which may be ready in the same batch */
+    for (i = 0; i < 2; i++) {
+        if (test9_poll[i] && test9_fd[i] != fd) {
+            ogs_pollset_remove(test9_poll[i]);
+            test9_poll[i] = NULL;
+        }
+    }
+
+    test9_called++;
+}
+
+static void test9_func(abts_case *tc, void *data)
+{
+    int rv, i;
+    ogs_pollset_t *pollset = ogs_pollset_create(512);
+    ABTS_PTR_NOTNULL(tc, pollset);
+
+    rv = ogs_socketpair(AF_SOCKPAIR, SOCK_STREAM, 0, test9_fd);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    for (i = 0; i < 2; i++) {
+        test9_poll[i] = ogs_pollset_add(pollset, OGS_POLLOUT,
+                test9_fd[i], test9_handler, NULL);
+        ABTS_PTR_NOTNULL(tc, test9_poll[i]);
+    }
+
+    rv = ogs_pollset_poll(pollset, OGS_INFINITE_TIME);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_INT_EQUAL(tc, 1, test9_called);
+
+    for (i = 0; i < 2; i++) {
+        if (test9_poll[i])
+            ogs_pollset_remove(test9_poll[i]);
+        ogs_closesocket(test9_fd[i]);
+    }
+
+    ogs_pollset_destroy(pollset);
+}
+
+#define TEST10_NUM_OF_FD    256
+#define TEST10_NUM_OF_POLL  4000
+
+static int test10_called = 0;
+
+static void test10_handler(short when, ogs_socket_t fd, void *data)
+{
+    test10_called++;
+}
+
+static void test10_func(abts_case *tc, void *data)
+{
+    int rv, i;
+    ogs_socket_t fd[TEST10_NUM_OF_FD];
+    ogs_poll_t *poll[TEST10_NUM_OF_FD];
+    ogs_time_t start, usecs;
+    ogs_pollset_t *pollset = ogs_pollset_create(512);
+    ABTS_PTR_NOTNULL(tc, pollset);
+
+    for (i = 0; i < TEST10_NUM_OF_FD; i += 2) {
+        rv = ogs_socketpair(AF_SOCKPAIR, SOCK_STREAM, 0, &fd[i]);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    }
+
+    /* Always writable : every fd is dispatched on each poll */
+    for (i = 0; i < TEST10_NUM_OF_FD; i++) {
+        poll[i] = ogs_pollset_add(pollset, OGS_POLLOUT,
+                fd[i], test10_handler, NULL);
+        ABTS_PTR_NOTNULL(tc, poll[i]);
+    }
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < TEST10_NUM_OF_POLL; i++)
+        ogs_assert(OGS_OK == ogs_pollset_poll(pollset, OGS_INFINITE_TIME));
+    usecs = ogs_get_monotonic_time() - start;
+
+    ABTS_INT_EQUAL(tc, TEST10_NUM_OF_FD * TEST10_NUM_OF_POLL, test10_called);
+
+    ogs_info("%d events dispatched in %lld usecs (%lld nsecs per event)",
+            test10_called, (long long)usecs,
+            (long long)(usecs * 1000 / test10_called));
+
+    for (i = 0; i < TEST10_NUM_OF_FD; i++) {
+        ogs_pollset_remove(poll[i]);
+        ogs_closesocket(fd[i]);
+    }
+
+    ogs_pollset_destroy(pollset);
+}
+
+/* A producer notifies while the pollset thread is draining */
+static void test11_drain_hook(ogs_pollset_t *pollset)
+{
+    ogs_assert(OGS_OK == ogs_pollset_notify(pollset));
+}
+
+static void test11_func(abts_case *tc, void *data)
+{
+    int rv;
+    ogs_pollset_t *pollset = ogs_pollset_create(512);
+    ABTS_PTR_NOTNULL(tc, pollset);
+
+    ogs_notify_drain_hook = test11_drain_hook;
+    rv = ogs_pollset_notify(pollset);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    rv = ogs_pollset_poll(pollset, ogs_time_from_msec(100));
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ogs_notify_drain_hook = NULL;
+
+    /* The next notification still wakes up the pollset */
+    rv = ogs_pollset_notify(pollset);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    rv = ogs_pollset_poll(pollset, ogs_time_from_msec(100));
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    rv = ogs_pollset_poll(pollset, ogs_time_from_msec(100));
+    ABTS_INT_EQUAL(tc, OGS_TIMEUP, rv);
+
+    ogs_pollset_destroy(pollset);
+}
+
 abts_suite *test_poll(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -672,6 +799,9 @@ abts_suite *test_poll(abts_suite *suite)
     abts_run_test(suite, test6_func, NULL);
     abts_run_test(suite, test7_func, NULL);
     abts_run_test(suite, test8_func, NULL);
+    abts_run_test(suite, test9_func, NULL);
+    abts_run_test(suite, test10_func, NULL);
+    abts_run_test(suite, test11_func, NULL);
 
     return suite;
 }
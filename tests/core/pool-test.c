@@ -228,6 +228,123 @@ static void test3_func(abts_case *tc, void *data)
     ogs_pool_final(&testpool);
 }
 
+typedef struct {
+    char data[1000];
+} elastic_node_t;
+
+#define SIZE_OF_EPOOL   300
+
+static OGS_POOL(epool, elastic_node_t);
+
+static void test4_func(abts_case *tc, void *data)
+{
+    elastic_node_t *node[SIZE_OF_EPOOL+1];
+    elastic_node_t *stale = NULL;
+    bool elastic = ogs_core()->pool.elastic;
+    bool trim = ogs_core()->pool.trim;
+    int i, slabs;
+
+    ogs_core()->pool.elastic = true;
+    ogs_core()->pool.trim = true;
+
+    ogs_pool_elastic_init(&epool, SIZE_OF_EPOOL);
+    ABTS_PTR_NOTNULL(tc, epool.slab);
+    ABTS_INT_EQUAL(tc, 0, ogs_pool_slab_count(epool.slab));
+
+    for (i = 0; i < SIZE_OF_EPOOL; i++) {
+        ogs_pool_alloc(&epool, &node[i]);
+        ABTS_PTR_NOTNULL(tc, node[i]);
+        memset(node[i], i, sizeof(*node[i]));
+    }
+    ogs_pool_alloc(&epool, &node[SIZE_OF_EPOOL]);
+    ABTS_PTR_EQUAL(tc, NULL, node[SIZE_OF_EPOOL]);
+    ABTS_INT_EQUAL(tc, 0, ogs_pool_avail(&epool));
+    ABTS_INT_EQUAL(tc, SIZE_OF_EPOOL, ogs_pool_hwm(&epool));
+
+    slabs = ogs_pool_slab_count(epool.slab);
+    ABTS_TRUE(tc, slabs > 1);
+
+    for (i = 0; i < SIZE_OF_EPOOL; i++) {
+        int index = ogs_pool_index(&epool, node[i]);
+        ABTS_TRUE(tc, index >= 1 && index <= SIZE_OF_EPOOL);
+        ABTS_PTR_EQUAL(tc, node[i], ogs_pool_find(&epool, index));
+        ABTS_PTR_EQUAL(tc, node[i], ogs_pool_cycle(&epool, node[i]));
+        ABTS_INT_EQUAL(tc, i & 0xff, (uint8_t)node[i]->data[999]);
+    }
+    ABTS_PTR_EQUAL(tc, NULL, ogs_pool_find(&epool, 0));
+    ABTS_PTR_EQUAL(tc, NULL, ogs_pool_find(&epool, SIZE_OF_EPOOL+1));
+
+    stale = node[SIZE_OF_EPOOL-1];
+    for (i = SIZE_OF_EPOOL-1; i >= 0; i--)
+        ogs_pool_free(&epool, node[i]);
+    ABTS_INT_EQUAL(tc, SIZE_OF_EPOOL, ogs_pool_avail(&epool));
+    ABTS_INT_EQUAL(tc, SIZE_OF_EPOOL, ogs_pool_hwm(&epool));
+
+    /* Only one empty slab is kept */
+    ABTS_INT_EQUAL(tc, 1, ogs_pool_slab_count(epool.slab));
+    ABTS_INT_EQUAL(tc, slabs, ogs_pool_slab_hwm(epool.slab));
+    ABTS_PTR_EQUAL(tc, NULL, ogs_pool_cycle(&epool, stale));
+
+    ogs_pool_alloc(&epool, &node[0]);
+    ABTS_PTR_NOTNULL(tc, node[0]);
+    ABTS_PTR_EQUAL(tc, node[0],
+            ogs_pool_find(&epool, ogs_pool_index(&epool, node[0])));
+    ogs_pool_free(&epool, node[0]);
+
+    ogs_pool_final(&epool);
+
+    ogs_core()->pool.elastic = elastic;
+    ogs_core()->pool.trim = trim;
+}
+
+static void test5_func(abts_case *tc, void *data)
+{
+    elastic_node_t *node[SIZE_OF_EPOOL];
+    elastic_node_t *stale = NULL;
+    bool elastic = ogs_core()->pool.elastic;
+    int i, index;
+
+    ogs_core()->pool.elastic = true;
+
+    ogs_pool_elastic_init(&epool, SIZE_OF_EPOOL);
+    ABTS_PTR_NOTNULL(tc, epool.slab);
+
+    /* A freed index is not reused on the next alloc */
+    for (i = 0; i < 3; i++) {
+        ogs_pool_alloc(&epool, &node[i]);
+        ABTS_PTR_NOTNULL(tc, node[i]);
+    }
+    stale = node[1];
+    index = ogs_pool_index(&epool, stale);
+    ogs_pool_free(&epool, node[1]);
+
+    ogs_pool_alloc(&epool, &node[1]);
+    ABTS_PTR_NOTNULL(tc, node[1]);
+    ABTS_TRUE(tc, index != ogs_pool_index(&epool, node[1]));
+    ABTS_PTR_EQUAL(tc, NULL, ogs_pool_cycle(&epool, stale));
+
+    for (i = 3; i < SIZE_OF_EPOOL; i++) {
+        ogs_pool_alloc(&epool, &node[i]);
+        ABTS_PTR_NOTNULL(tc, node[i]);
+    }
+    ABTS_TRUE(tc, ogs_pool_slab_count(epool.slab) > 1);
+
+    /* The freed nodes are reused in the order they were freed */
+    ogs_pool_free(&epool, node[SIZE_OF_EPOOL-1]);
+    ogs_pool_free(&epool, node[0]);
+    ogs_pool_alloc(&epool, &stale);
+    ABTS_PTR_EQUAL(tc, node[SIZE_OF_EPOOL-1], stale);
+    ogs_pool_alloc(&epool, &stale);
+    ABTS_PTR_EQUAL(tc, node[0], stale);
+
+    for (i = 0; i < SIZE_OF_EPOOL; i++)
+        ogs_pool_free(&epool, node[i]);
+
+    ogs_pool_final(&epool);
+
+    ogs_core()->pool.elastic = elastic;
+}
+
 abts_suite *test_pool(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -235,6 +352,8 @@ abts_suite *test_pool(abts_suite *suite)
     abts_run_test(suite, test1_func, NULL);
     abts_run_test(suite, test2_func, NULL);
     abts_run_test(suite, test3_func, NULL);
+    abts_run_test(suite, test4_func, NULL);
+    abts_run_test(suite, test5_func, NULL);
 
     return suite;
 }
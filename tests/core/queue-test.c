@@ -166,12 +166,133 @@ static void test_queue_timeout(abts_case *tc, void *data)
     ogs_queue_destroy(q);
 }
 
+#define BULK_PRODUCERS      4
+#define BULK_ITEMS          100000
+
+static void bulk_producer(void *data)
+{
+    uintptr_t base = (uintptr_t)data;
+    uintptr_t i;
+    int rv;
+
+    for (i = 0; i < BULK_ITEMS; i++) {
+        rv = ogs_queue_push(queue, (void *)(base + i));
+        if (rv == OGS_DONE)
+            break;
+    }
+}
+
+static void test_queue_bulk(abts_case *tc, void *data)
+{
+    uintptr_t next[BULK_PRODUCERS];
+    ogs_thread_t *thread[BULK_PRODUCERS];
+    void *item[16];
+    unsigned int i, num, total = 0, mismatch = 0;
+    int rv;
+
+    queue = ogs_queue_create(QUEUE_SIZE);
+    ABTS_PTR_NOTNULL(tc, queue);
+
+    rv = ogs_queue_trypop_bulk(queue, item, OGS_ARRAY_SIZE(item), &num);
+    ABTS_INT_EQUAL(tc, OGS_RETRY, rv);
+    ABTS_INT_EQUAL(tc, 0, num);
+
+    for (i = 0; i < BULK_PRODUCERS; i++) {
+        next[i] = 0;
+        thread[i] = ogs_thread_create(bulk_producer,
+                (void *)((uintptr_t)(i + 1) << 24));
+        ABTS_PTR_NOTNULL(tc, thread[i]);
+    }
+
+    /* Items of each producer come out in the order they were pushed */
+    while (total < BULK_PRODUCERS * BULK_ITEMS) {
+        rv = ogs_queue_trypop_bulk(queue, item, OGS_ARRAY_SIZE(item), &num);
+        if (rv == OGS_RETRY) {
+            rv = ogs_queue_timedpop(queue, &item[0], ogs_time_from_sec(5));
+            ABTS_INT_EQUAL(tc, OGS_OK, rv);
+            if (rv != OGS_OK)
+                break;
+            num = 1;
+        }
+        for (i = 0; i < num; i++) {
+            uintptr_t v = (uintptr_t)item[i];
+            unsigned int p = (v >> 24) - 1;
+
+            if (p >= BULK_PRODUCERS || (v & 0xffffff) != next[p]) {
+                mismatch++;
+                continue;
+            }
+            next[p]++;
+        }
+        total += num;
+    }
+    ABTS_INT_EQUAL(tc, 0, mismatch);
+
+    for (i = 0; i < BULK_PRODUCERS; i++) {
+        ABTS_TRUE(tc, next[i] == BULK_ITEMS);
+        ogs_thread_destroy(thread[i]);
+    }
+
+    ABTS_INT_EQUAL(tc, 0, ogs_queue_size(queue));
+
+    rv = ogs_queue_term(queue);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    rv = ogs_queue_trypop_bulk(queue, item, OGS_ARRAY_SIZE(item), &num);
+    ABTS_INT_EQUAL(tc, OGS_DONE, rv);
+
+    ogs_queue_destroy(queue);
+}
+
+static int interrupted_rv;
+static bool interrupted_done;
+
+static void interrupted_consumer(void *data)
+{
+    void *v;
+
+    interrupted_rv = ogs_queue_pop(queue, &v);
+    __atomic_store_n(&interrupted_done, true, __ATOMIC_RELEASE);
+}
+
+static void test_queue_interrupt(abts_case *tc, void *data)
+{
+    ogs_thread_t *thread;
+    int i;
+
+    queue = ogs_queue_create(QUEUE_SIZE);
+    ABTS_PTR_NOTNULL(tc, queue);
+
+    interrupted_rv = OGS_OK;
+    interrupted_done = false;
+
+    thread = ogs_thread_create(interrupted_consumer, NULL);
+    ABTS_PTR_NOTNULL(tc, thread);
+
+    /* Until the consumer is blocked in the empty queue */
+    for (i = 0; i < 500; i++) {
+        ogs_msleep(10);
+        ogs_queue_interrupt_all(queue);
+        if (__atomic_load_n(&interrupted_done, __ATOMIC_ACQUIRE))
+            break;
+    }
+    ogs_thread_destroy(thread);
+
+    ABTS_TRUE(tc, interrupted_done);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, interrupted_rv);
+
+    ogs_queue_term(queue);
+    ogs_queue_destroy(queue);
+}
+
 abts_suite *test_queue(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, test_queue_producer_consumer, NULL);
     abts_run_test(suite, test_queue_timeout, NULL);
+    abts_run_test(suite, test_queue_bulk, NULL);
+    abts_run_test(suite, test_queue_interrupt, NULL);
 
     return suite;
 }
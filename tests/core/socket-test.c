@@ -424,6 +424,136 @@ static void test8_func(abts_case *tc, void *data)
     ABTS_INT_EQUAL(tc, OGS_OK, rv);
 }
 
+#define MMSG_BATCH 32
+#define MMSG_ROUND 1000
+
+static void mmsg_round(abts_case *tc,
+        ogs_sock_t *tx, ogs_sock_t *rx, ogs_sockaddr_t *to,
+        ogs_pkbuf_t **pkbuf, bool use_mmsg)
+{
+    ogs_sockaddr_t *dst[MMSG_BATCH];
+    ogs_sockaddr_t from[MMSG_BATCH];
+    ssize_t size;
+    int i, n;
+
+    for (i = 0; i < MMSG_BATCH; i++) {
+        ogs_pkbuf_trim(pkbuf[i], 0);
+        ogs_pkbuf_put_data(pkbuf[i], DATASTR, strlen(DATASTR));
+        dst[i] = to;
+    }
+
+    if (use_mmsg == true) {
+        n = ogs_sendmmsg(tx->fd, pkbuf, dst, MMSG_BATCH, 0);
+        ABTS_INT_EQUAL(tc, MMSG_BATCH, n);
+    } else {
+        for (i = 0; i < MMSG_BATCH; i++) {
+            size = ogs_sendto(tx->fd,
+                    pkbuf[i]->data, pkbuf[i]->len, 0, dst[i]);
+            ABTS_INT_EQUAL(tc, strlen(DATASTR), size);
+        }
+    }
+
+    for (i = 0; i < MMSG_BATCH; i++) {
+        ogs_pkbuf_trim(pkbuf[i], 0);
+        ogs_pkbuf_put(pkbuf[i], OGS_MAX_PKT_LEN);
+    }
+
+    if (use_mmsg == true) {
+        n = 0;
+        while (n < MMSG_BATCH) {
+            i = ogs_recvmmsg(rx->fd, pkbuf + n, from + n, MMSG_BATCH - n, 0);
+            ABTS_TRUE(tc, i > 0);
+            if (i <= 0) break;
+            n += i;
+        }
+        for (i = 0; i < n; i++)
+            ABTS_INT_EQUAL(tc, strlen(DATASTR), pkbuf[i]->len);
+    } else {
+        for (i = 0; i < MMSG_BATCH; i++) {
+            size = ogs_recvfrom(rx->fd,
+                    pkbuf[i]->data, pkbuf[i]->len, 0, &from[i]);
+            ABTS_INT_EQUAL(tc, strlen(DATASTR), size);
+        }
+    }
+}
+
+static void test9_func(abts_case *tc, void *data)
+{
+    int rv, i, j;
+    ogs_sock_t *tx, *rx;
+    ogs_sockaddr_t *addr, *addr2;
+    ogs_pkbuf_t *pkbuf[MMSG_BATCH];
+    ogs_time_t start, elapsed[2];
+
+    rv = ogs_getaddrinfo(&addr, AF_INET, "127.0.0.1", PORT, AI_PASSIVE);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    rx = ogs_udp_server(addr, NULL);
+    ABTS_PTR_NOTNULL(tc, rx);
+
+    rv = ogs_getaddrinfo(&addr2, AF_INET, "127.0.0.1", PORT2, AI_PASSIVE);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    tx = ogs_udp_server(addr2, NULL);
+    ABTS_PTR_NOTNULL(tc, tx);
+
+    for (i = 0; i < MMSG_BATCH; i++) {
+        pkbuf[i] = ogs_pkbuf_alloc(NULL, OGS_MAX_PKT_LEN);
+        ABTS_PTR_NOTNULL(tc, pkbuf[i]);
+    }
+
+    /* Compare sendto/recvfrom with sendmmsg/recvmmsg */
+    for (j = 0; j < 2; j++) {
+        start = ogs_get_monotonic_time();
+        for (i = 0; i < MMSG_ROUND; i++)
+            mmsg_round(tc, tx, rx, addr, pkbuf, j == 1);
+        elapsed[j] = ogs_get_monotonic_time() - start;
+    }
+
+    ogs_info("UDP loopback %d packets : "
+            "sendto/recvfrom %lld pps, sendmmsg/recvmmsg %lld pps",
+            MMSG_BATCH * MMSG_ROUND,
+            (long long)MMSG_BATCH * MMSG_ROUND * OGS_USEC_PER_SEC /
+                ogs_max(elapsed[0], 1),
+            (long long)MMSG_BATCH * MMSG_ROUND * OGS_USEC_PER_SEC /
+                ogs_max(elapsed[1], 1));
+
+    for (i = 0; i < MMSG_BATCH; i++)
+        ogs_pkbuf_free(pkbuf[i]);
+
+    ogs_sock_destroy(tx);
+    ogs_sock_destroy(rx);
+
+    rv = ogs_freeaddrinfo(addr2);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    rv = ogs_freeaddrinfo(addr);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+}
+
+static void test10_func(abts_case *tc, void *data)
+{
+    ogs_sock_t *udp[2];
+    ogs_sockaddr_t *addr;
+    ogs_sockopt_t option;
+    int rv;
+
+    rv = ogs_getaddrinfo(&addr, AF_INET, "127.0.0.1", PORT, AI_PASSIVE);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    ogs_sockopt_init(&option);
+    option.so_reuseport = true;
+
+    /* Both sockets share the same address with SO_REUSEPORT */
+    udp[0] = ogs_udp_server(addr, &option);
+    ABTS_PTR_NOTNULL(tc, udp[0]);
+    udp[1] = ogs_udp_server(addr, &option);
+    ABTS_PTR_NOTNULL(tc, udp[1]);
+
+    ogs_sock_destroy(udp[1]);
+    ogs_sock_destroy(udp[0]);
+
+    rv = ogs_freeaddrinfo(addr);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+}
+
 abts_suite *test_socket(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -436,6 +566,10 @@ abts_suite *test_socket(abts_suite *suite)
     abts_run_test(suite, test6_func, NULL);
     abts_run_test(suite, test7_func, NULL);
     abts_run_test(suite, test8_func, NULL);
+    abts_run_test(suite, test9_func, NULL);
+#if defined(SO_REUSEPORT)
+    abts_run_test(suite, test10_func, NULL);
+#endif
 
     return suite;
 }
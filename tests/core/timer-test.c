@@ -41,6 +41,15 @@ void test_expire_func_2(void *data)
     expire_check[index]++;
 }
 
+/* If data is given, it is the tick of the timing wheel */
+static ogs_timer_mgr_t *test_timer_mgr_create(void *data)
+{
+    if (data)
+        return ogs_timer_mgr_create_wheel(512, *(ogs_time_t *)data);
+
+    return ogs_timer_mgr_create(512);
+}
+
 /* basic timer Test */
 static void test1_func(abts_case *tc, void *data)
 {
@@ -51,7 +60,7 @@ static void test1_func(abts_case *tc, void *data)
 
     memset(expire_check, 0, TEST_DURATION/TEST_TIMER_PRECISION);
 
-    timer = ogs_timer_mgr_create(512);
+    timer = test_timer_mgr_create(data);
     pollset = ogs_pollset_create(512);
     ogs_assert(timer);
     for(n = 0; n < sizeof(timer_duration)/sizeof(ogs_time_t); n++) {
@@ -126,7 +135,7 @@ static void test2_func(abts_case *tc, void *data)
     memset(expire_check, 0, TEST_DURATION/TEST_TIMER_PRECISION);
     memset(tm_num, 0, sizeof(int)*(TEST_DURATION/TEST_TIMER_PRECISION));
 
-    timer = ogs_timer_mgr_create(512);
+    timer = test_timer_mgr_create(data);
     ogs_assert(timer);
 
     for(n = 0; n < TEST_TIMER_NUM; n++) {
@@ -168,7 +177,7 @@ static void test3_func(abts_case *tc, void *data)
     memset(expire_check, 0, TEST_DURATION/TEST_TIMER_PRECISION);
     memset(tm_num, 0, sizeof(int)*(TEST_DURATION/TEST_TIMER_PRECISION));
 
-    timer = ogs_timer_mgr_create(512);
+    timer = test_timer_mgr_create(data);
     ogs_assert(timer);
 
     for(n = 0; n < TEST_TIMER_NUM; n++) {
@@ -208,13 +217,141 @@ static void test3_func(abts_case *tc, void *data)
     ogs_timer_mgr_destroy(timer);
 }
 
+static ogs_time_t test4_fired[3];
+static ogs_timer_t *test4_timer[3];
+
+static void test4_expire_func(void *data)
+{
+    int index = (uintptr_t)data;
+
+    test4_fired[index] = ogs_get_monotonic_time();
+
+    /* Stop the other timer which expired in the same tick */
+    if (index == 1)
+        ogs_timer_stop(test4_timer[2]);
+}
+
+/* timing wheel: cascade, rounding and stop in the callback */
+static void test4_func(abts_case *tc, void *data)
+{
+    int n;
+    ogs_timer_mgr_t *timer = NULL;
+    ogs_time_t start, deadline;
+
+    memset(test4_fired, 0, sizeof(test4_fired));
+
+    /* 1 usec tick, so the 300ms timer starts at the third level */
+    timer = ogs_timer_mgr_create_wheel(512, 1);
+    ABTS_PTR_NOTNULL(tc, timer);
+
+    for (n = 0; n < 3; n++) {
+        test4_timer[n] = ogs_timer_add(
+                timer, test4_expire_func, (void *)(uintptr_t)n);
+        ABTS_PTR_NOTNULL(tc, test4_timer[n]);
+    }
+
+    start = ogs_get_monotonic_time();
+    ogs_timer_start(test4_timer[0], ogs_time_from_msec(300));
+    ogs_timer_start(test4_timer[1], ogs_time_from_msec(20));
+    ogs_timer_start(test4_timer[2], ogs_time_from_msec(20));
+
+    deadline = start + ogs_time_from_msec(1000);
+    while (ogs_timer_mgr_next(timer) != OGS_INFINITE_TIME &&
+            ogs_get_monotonic_time() < deadline) {
+        ogs_usleep(ogs_timer_mgr_next(timer));
+        ogs_timer_mgr_expire(timer);
+    }
+
+    ABTS_TRUE(tc, test4_fired[0] >= start + ogs_time_from_msec(300));
+    ABTS_TRUE(tc, test4_fired[1] >= start + ogs_time_from_msec(20));
+    ABTS_TRUE(tc, test4_fired[1] < test4_fired[0]);
+    ABTS_TRUE(tc, ogs_timer_running(test4_timer[0]) == false);
+
+    /* Either timer[1] or timer[2] fired first and stopped the other */
+    ABTS_TRUE(tc, test4_fired[2] == 0 || test4_fired[2] < test4_fired[1]);
+
+    for (n = 0; n < 3; n++)
+        ogs_timer_delete(test4_timer[n]);
+
+    ogs_timer_mgr_destroy(timer);
+}
+
+#define TEST5_NUM_OF_TIMER  100000
+#define TEST5_NUM_OF_ROUND  10
+
+/* start/restart/stop churn : red-black tree vs timing wheel */
+static void test5_func(abts_case *tc, void *data)
+{
+    ogs_timer_mgr_t *timer = NULL;
+    static ogs_timer_t *timer_array[TEST5_NUM_OF_TIMER];
+    static ogs_time_t duration[TEST5_NUM_OF_TIMER];
+    ogs_time_t start, usecs[2][3];
+    int i, j, n;
+
+    for (i = 0; i < TEST5_NUM_OF_TIMER; i++)
+        duration[i] = ogs_time_from_msec(1000 + ogs_random32() % 30000);
+
+    for (n = 0; n < 2; n++) {
+        if (n == 0)
+            timer = ogs_timer_mgr_create(TEST5_NUM_OF_TIMER);
+        else
+            timer = ogs_timer_mgr_create_wheel(
+                    TEST5_NUM_OF_TIMER, ogs_time_from_msec(10));
+        ABTS_PTR_NOTNULL(tc, timer);
+
+        for (i = 0; i < TEST5_NUM_OF_TIMER; i++) {
+            timer_array[i] = ogs_timer_add(timer, test_expire_func_2, NULL);
+            ogs_assert(timer_array[i]);
+        }
+
+        start = ogs_get_monotonic_time();
+        for (i = 0; i < TEST5_NUM_OF_TIMER; i++)
+            ogs_timer_start(timer_array[i], duration[i]);
+        usecs[n][0] = ogs_get_monotonic_time() - start;
+
+        start = ogs_get_monotonic_time();
+        for (j = 0; j < TEST5_NUM_OF_ROUND; j++) {
+            for (i = 0; i < TEST5_NUM_OF_TIMER; i++)
+                ogs_timer_start(timer_array[i], duration[i]);
+        }
+        usecs[n][1] = (ogs_get_monotonic_time() - start) / TEST5_NUM_OF_ROUND;
+
+        start = ogs_get_monotonic_time();
+        for (i = 0; i < TEST5_NUM_OF_TIMER; i++)
+            ogs_timer_stop(timer_array[i]);
+        usecs[n][2] = ogs_get_monotonic_time() - start;
+
+        ABTS_INT_EQUAL(tc, OGS_INFINITE_TIME, ogs_timer_mgr_next(timer));
+
+        for (i = 0; i < TEST5_NUM_OF_TIMER; i++)
+            ogs_timer_delete(timer_array[i]);
+
+        ogs_timer_mgr_destroy(timer);
+    }
+
+    ogs_info("%d timers : start / restart / stop", TEST5_NUM_OF_TIMER);
+    ogs_info("rbtree : %lld / %lld / %lld usecs",
+            (long long)usecs[0][0], (long long)usecs[0][1],
+            (long long)usecs[0][2]);
+    ogs_info("wheel  : %lld / %lld / %lld usecs",
+            (long long)usecs[1][0], (long long)usecs[1][1],
+            (long long)usecs[1][2]);
+}
+
 abts_suite *test_timer(abts_suite *suite)
 {
+    static ogs_time_t tick = 5000;
+
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, test1_func, NULL);
     abts_run_test(suite, test2_func, NULL);
     abts_run_test(suite, test3_func, NULL);
+    abts_run_test(suite, test1_func, &tick);
+    abts_run_test(suite, test2_func, &tick);
+    abts_run_test(suite, test3_func, &tick);
+    abts_run_test(suite, test4_func, NULL);
+    abts_run_test(suite, test5_func, NULL);
 
     return suite;
 }
@@ -313,11 +313,72 @@ static void gtp_message_test1(abts_case *tc, void *data)
     ogs_pkbuf_free(pkbuf);
 }
 
+static void gtp_message_test2(abts_case *tc, void *data)
+{
+#define GTP_MESSAGE_TEST2_COUNT 100000
+    /* Create Session Request of gtp_message_test1 */
+    const char *_payload =
+        "0100080055153011 340010f44c000600 9471527600414b00 0800536120009178"
+        "840056000d001855 f501102255f50100 019d015300030055 f501520001000657"
+        "0009008a80000084 0a32360a57000901 87000000000a3236 254700220005766f"
+        "6c7465036e673204 6d6e6574066d6e63 303130066d636335 3535046770727380"
+        "000100fc63000100 014f000500010000 00007f0001000048 000800000003e800"
+        "0007d04e001a0080 8021100100001081 0600000000830600 000000000d00000a"
+        "005d001f00490001 0005500016004505 0000000000000000 0000000000000000"
+        "0000000072000200 40005f0002005400";
+    char hexbuf[OGS_HUGE_LEN];
+    ogs_gtp2_create_session_request_t req;
+    ogs_pkbuf_t *pkbuf = NULL, *built = NULL;
+    ogs_time_t start, parse_time, build_time;
+    int i, parsed = 0, matched = 0;
+
+    pkbuf = ogs_pkbuf_alloc(NULL, 240);
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put_data(pkbuf,
+            ogs_hex_from_string(_payload, hexbuf, sizeof(hexbuf)), 240);
+
+    /* Benchmark : run with '-e info' to see the result */
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < GTP_MESSAGE_TEST2_COUNT; i++) {
+        memset(&req, 0, sizeof(req));
+        if (ogs_tlv_parse_msg(&req,
+                    &ogs_gtp2_tlv_desc_create_session_request,
+                    pkbuf, OGS_TLV_MODE_T1_L2_I1) == OGS_OK)
+            parsed++;
+    }
+    parse_time = ogs_get_monotonic_time() - start;
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < GTP_MESSAGE_TEST2_COUNT; i++) {
+        built = ogs_tlv_build_msg(&ogs_gtp2_tlv_desc_create_session_request,
+                &req, OGS_TLV_MODE_T1_L2_I1);
+        ogs_assert(built);
+        if (built->len == pkbuf->len &&
+            memcmp(built->data, pkbuf->data, pkbuf->len) == 0)
+            matched++;
+        ogs_pkbuf_free(built);
+    }
+    build_time = ogs_get_monotonic_time() - start;
+
+    ABTS_INT_EQUAL(tc, GTP_MESSAGE_TEST2_COUNT, parsed);
+    ABTS_INT_EQUAL(tc, GTP_MESSAGE_TEST2_COUNT, matched);
+
+    ogs_info("Create Session Request (%d bytes) : "
+            "parse %lld msg/s, build %lld msg/s", pkbuf->len,
+            (long long)GTP_MESSAGE_TEST2_COUNT * 1000000 /
+                (parse_time ? parse_time : 1),
+            (long long)GTP_MESSAGE_TEST2_COUNT * 1000000 /
+                (build_time ? build_time : 1));
+
+    ogs_pkbuf_free(pkbuf);
+}
+
 abts_suite *test_gtp_message(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, gtp_message_test1, NULL);
+    abts_run_test(suite, gtp_message_test2, NULL);
 
     return suite;
 }
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-metrics.h"
+#include "core/abts.h"
+
+#define NUM_OF_TEST_ID          64
+#define NUM_OF_TEST_ADD         10000
+#define NUM_OF_TEST_THREAD      8
+#define NUM_OF_TEST_EXITED      (OGS_METRICS_MAX_FAST_THREAD * 2)
+#define NUM_OF_TEST_ALIVE       (OGS_METRICS_MAX_FAST_THREAD + 8)
+
+static ogs_metrics_fast_t *test_fast;
+static int test_release;
+
+static ogs_metrics_spec_t *test_spec_new(const char *name)
+{
+    const char *labels[] = { "qfi" };
+    ogs_metrics_spec_t *spec = NULL;
+
+    spec = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_COUNTER,
+            name, "Fast counter for the test", 0, 1, labels);
+    ogs_assert(spec);
+
+    return spec;
+}
+
+/* Each thread adds its own id, one per label id */
+static void test1_main(void *data)
+{
+    int i, id;
+
+    for (i = 0; i < NUM_OF_TEST_ADD; i++)
+        for (id = 0; id < NUM_OF_TEST_ID; id++)
+            ogs_metrics_fast_add(test_fast, id, id + 1);
+}
+
+static void metrics_test1(abts_case *tc, void *data)
+{
+    ogs_metrics_spec_t *spec = NULL;
+    ogs_metrics_fast_t *fast = NULL;
+    ogs_thread_t *thread[NUM_OF_TEST_THREAD];
+    int i, id;
+
+    /* Registration */
+    spec = test_spec_new("test_fast1");
+    fast = ogs_metrics_fast_new(spec, 1);
+    ABTS_PTR_NOTNULL(tc, fast);
+    ogs_metrics_fast_inc(fast, 0);
+    ABTS_INT_EQUAL(tc, 1, ogs_metrics_fast_get(fast, 0));
+    ogs_metrics_fast_free(fast);
+
+    test_fast = ogs_metrics_fast_new(
+            test_spec_new("test_fast2"), NUM_OF_TEST_ID);
+    ABTS_PTR_NOTNULL(tc, test_fast);
+    for (id = 0; id < NUM_OF_TEST_ID; id++)
+        ABTS_INT_EQUAL(tc, 0, ogs_metrics_fast_get(test_fast, id));
+
+    /* The rows of all the threads are folded per label id */
+    for (i = 0; i < NUM_OF_TEST_THREAD; i++) {
+        thread[i] = ogs_thread_create(test1_main, NULL);
+        ABTS_PTR_NOTNULL(tc, thread[i]);
+    }
+    test1_main(NULL);
+    for (i = 0; i < NUM_OF_TEST_THREAD; i++)
+        ogs_thread_destroy(thread[i]);
+
+    for (id = 0; id < NUM_OF_TEST_ID; id++)
+        ABTS_TRUE(tc, ogs_metrics_fast_get(test_fast, id) ==
+                (uint64_t)(id + 1) * NUM_OF_TEST_ADD *
+                    (NUM_OF_TEST_THREAD + 1));
+
+    ogs_metrics_fast_fold();
+    ogs_metrics_fast_fold();
+
+    ogs_metrics_fast_free(test_fast);
+}
+
+static void test2_main(void *data)
+{
+    ogs_metrics_fast_inc(test_fast, 1);
+}
+
+static void test3_main(void *data)
+{
+    ogs_metrics_fast_inc(test_fast, 2);
+
+    while (__atomic_load_n(&test_release, __ATOMIC_ACQUIRE) == 0)
+        ogs_usleep(1000);
+}
+
+static void metrics_test2(abts_case *tc, void *data)
+{
+    ogs_thread_t *thread[NUM_OF_TEST_ALIVE];
+    int i;
+
+    test_fast = ogs_metrics_fast_new(
+            test_spec_new("test_fast3"), NUM_OF_TEST_ID);
+    ABTS_PTR_NOTNULL(tc, test_fast);
+
+    /* The row of an exited thread is given to the next thread */
+    for (i = 0; i < NUM_OF_TEST_EXITED; i++) {
+        thread[0] = ogs_thread_create(test2_main, NULL);
+        ABTS_PTR_NOTNULL(tc, thread[0]);
+        ogs_thread_destroy(thread[0]);
+    }
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_EXITED, ogs_metrics_fast_get(test_fast, 1));
+
+    /* More threads than rows are alive : the rest share one row */
+    test_release = 0;
+    for (i = 0; i < NUM_OF_TEST_ALIVE; i++) {
+        thread[i] = ogs_thread_create(test3_main, NULL);
+        ABTS_PTR_NOTNULL(tc, thread[i]);
+    }
+    __atomic_store_n(&test_release, 1, __ATOMIC_RELEASE);
+    for (i = 0; i < NUM_OF_TEST_ALIVE; i++)
+        ogs_thread_destroy(thread[i]);
+
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_ALIVE, ogs_metrics_fast_get(test_fast, 2));
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_EXITED, ogs_metrics_fast_get(test_fast, 1));
+    ABTS_INT_EQUAL(tc, 0, ogs_metrics_fast_get(test_fast, 0));
+
+    ogs_metrics_fast_fold();
+
+    ogs_metrics_fast_free(test_fast);
+}
+
+abts_suite *test_metrics(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    /* The metrics context is initialized only once in a process */
+    ogs_app_context_init();
+    ogs_metrics_context_init();
+
+    abts_run_test(suite, metrics_test1, NULL);
+    abts_run_test(suite, metrics_test2, NULL);
+
+    ogs_metrics_context_final();
+    ogs_app_context_final();
+
+    return suite;
+}
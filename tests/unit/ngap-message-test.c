@@ -184,6 +184,45 @@ static void ngap_message_test4(abts_case *tc, void *data)
     ogs_pkbuf_free(pkbuf);
 }
 
+static void ngap_message_test5(abts_case *tc, void *data)
+{
+    /* NGSetupRequest */
+    const char *payload =
+        "0015003f00000500 1b00080045f01000 0000040052400903 0035484c41423032"
+        "0066000d00000062 280045f010000000 0800154001400111 4009203035484c41"
+        "423032";
+
+    ogs_ngap_message_t message[12];
+    ogs_pkbuf_t *pkbuf;
+    int i, rv;
+    char hexbuf[OGS_HUGE_LEN];
+
+    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put_data(pkbuf,
+            ogs_hex_from_string(payload, hexbuf, sizeof(hexbuf)), 67);
+
+    /* More messages alive than arenas : the rest are on the heap */
+    for (i = 0; i < OGS_ARRAY_SIZE(message); i++) {
+        rv = ogs_ngap_decode(&message[i], pkbuf);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        ABTS_INT_EQUAL(tc, NGAP_NGAP_PDU_PR_initiatingMessage,
+                message[i].present);
+        ABTS_INT_EQUAL(tc, NGAP_ProcedureCode_id_NGSetup,
+                message[i].choice.initiatingMessage->procedureCode);
+    }
+    for (i = OGS_ARRAY_SIZE(message) - 1; i >= 0; i--)
+        ogs_ngap_free(&message[i]);
+
+    /* Truncated message */
+    ogs_pkbuf_trim(pkbuf, 20);
+    rv = ogs_ngap_decode(&message[0], pkbuf);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+    ogs_ngap_free(&message[0]);
+
+    ogs_pkbuf_free(pkbuf);
+}
+
 abts_suite *test_ngap_message(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -194,6 +233,7 @@ abts_suite *test_ngap_message(abts_suite *suite)
     abts_run_test(suite, ngap_message_test2, NULL);
     abts_run_test(suite, ngap_message_test3, NULL);
     abts_run_test(suite, ngap_message_test4, NULL);
+    abts_run_test(suite, ngap_message_test5, NULL);
 
     return suite;
 }
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-pfcp.h"
+#include "core/abts.h"
+
+static void pfcp_message_test1(abts_case *tc, void *data)
+{
+    int rv, i;
+    /* Session Establishment Request */
+    const char *_payload =
+        "003c0005 007f000004"
+        "0039000d 02 0000000000000001 7f000004"
+        "00010028 00380002 0001 001d0004 000000ff"
+        "0002000e 00140001 00 005d0005 020a2d0002"
+        "006c0004 00000001"
+        "00010028 00380002 0002 001d0004 000000ff"
+        "0002000e 00140001 01 005d0005 060a2d0002"
+        "006c0004 00000002"
+        "0003000e 006c0004 00000001 002c0002 0200"
+        "0003000e 006c0004 00000002 002c0002 0200"
+        "0007001b 006d0004 00000001 00190001 00"
+        "001a000a 00000003e8 00000007d0";
+    char hexbuf[OGS_HUGE_LEN];
+
+    ogs_pfcp_session_establishment_request_t req;
+    uint8_t mbr[10] = "\x00\x00\x00\x03\xe8\x00\x00\x00\x07\xd0";
+    uint8_t ue_ip[2][5] = {
+        "\x02\x0a\x2d\x00\x02", "\x06\x0a\x2d\x00\x02" };
+
+    ogs_pkbuf_t *pkbuf = NULL;
+
+    memset(&req, 0, sizeof(req));
+
+    req.node_id.presence = 1;
+    req.node_id.data = (uint8_t *)"\x00\x7f\x00\x00\x04";
+    req.node_id.len = 5;
+
+    req.cp_f_seid.presence = 1;
+    req.cp_f_seid.data = (uint8_t *)
+        "\x02\x00\x00\x00\x00\x00\x00\x00\x01\x7f\x00\x00\x04";
+    req.cp_f_seid.len = 13;
+
+    for (i = 0; i < 2; i++) {
+        req.create_pdr[i].presence = 1;
+        req.create_pdr[i].pdr_id.presence = 1;
+        req.create_pdr[i].pdr_id.u16 = i + 1;
+        req.create_pdr[i].precedence.presence = 1;
+        req.create_pdr[i].precedence.u32 = 255;
+        req.create_pdr[i].pdi.presence = 1;
+        req.create_pdr[i].pdi.source_interface.presence = 1;
+        req.create_pdr[i].pdi.source_interface.u8 = i;
+        req.create_pdr[i].pdi.ue_ip_address.presence = 1;
+        req.create_pdr[i].pdi.ue_ip_address.data = ue_ip[i];
+        req.create_pdr[i].pdi.ue_ip_address.len = 5;
+        req.create_pdr[i].far_id.presence = 1;
+        req.create_pdr[i].far_id.u32 = i + 1;
+
+        req.create_far[i].presence = 1;
+        req.create_far[i].far_id.presence = 1;
+        req.create_far[i].far_id.u32 = i + 1;
+        req.create_far[i].apply_action.presence = 1;
+        req.create_far[i].apply_action.u16 = OGS_PFCP_APPLY_ACTION_FORW;
+    }
+
+    req.create_qer[0].presence = 1;
+    req.create_qer[0].qer_id.presence = 1;
+    req.create_qer[0].qer_id.u32 = 1;
+    req.create_qer[0].gate_status.presence = 1;
+    req.create_qer[0].gate_status.u8 = 0;
+    req.create_qer[0].maximum_bitrate.presence = 1;
+    req.create_qer[0].maximum_bitrate.data = mbr;
+    req.create_qer[0].maximum_bitrate.len = sizeof(mbr);
+
+    pkbuf = ogs_tlv_build_msg(
+            &ogs_pfcp_msg_desc_pfcp_session_establishment_request,
+            &req, OGS_TLV_MODE_T2_L2);
+    ABTS_PTR_NOTNULL(tc, pkbuf);
+    ABTS_INT_EQUAL(tc, 181, pkbuf->len);
+    ABTS_TRUE(tc, memcmp(pkbuf->data, ogs_hex_from_string(
+                    _payload, hexbuf, sizeof(hexbuf)), pkbuf->len) == 0);
+
+    /* Building does not change the message */
+    ABTS_INT_EQUAL(tc, 2, req.create_pdr[1].pdr_id.u16);
+    ABTS_INT_EQUAL(tc, 255, req.create_pdr[1].precedence.u32);
+
+    memset(&req, 0, sizeof(req));
+    rv = ogs_tlv_parse_msg(&req,
+            &ogs_pfcp_msg_desc_pfcp_session_establishment_request,
+            pkbuf, OGS_TLV_MODE_T2_L2);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    ABTS_INT_EQUAL(tc, 1, req.node_id.presence);
+    ABTS_INT_EQUAL(tc, 5, req.node_id.len);
+    ABTS_INT_EQUAL(tc, 1, req.cp_f_seid.presence);
+    ABTS_INT_EQUAL(tc, 13, req.cp_f_seid.len);
+
+    for (i = 0; i < 2; i++) {
+        ABTS_INT_EQUAL(tc, 1, req.create_pdr[i].presence);
+        ABTS_INT_EQUAL(tc, i + 1, req.create_pdr[i].pdr_id.u16);
+        ABTS_INT_EQUAL(tc, 255, req.create_pdr[i].precedence.u32);
+        ABTS_INT_EQUAL(tc, 1, req.create_pdr[i].pdi.presence);
+        ABTS_INT_EQUAL(tc, i, req.create_pdr[i].pdi.source_interface.u8);
+        ABTS_INT_EQUAL(tc, 0, req.create_pdr[i].pdi.local_f_teid.presence);
+        ABTS_INT_EQUAL(tc, 5, req.create_pdr[i].pdi.ue_ip_address.len);
+        ABTS_TRUE(tc, memcmp(ue_ip[i],
+                    req.create_pdr[i].pdi.ue_ip_address.data, 5) == 0);
+        ABTS_INT_EQUAL(tc, i + 1, req.create_pdr[i].far_id.u32);
+
+        ABTS_INT_EQUAL(tc, 1, req.create_far[i].presence);
+        ABTS_INT_EQUAL(tc, i + 1, req.create_far[i].far_id.u32);
+        ABTS_INT_EQUAL(tc, OGS_PFCP_APPLY_ACTION_FORW,
+                req.create_far[i].apply_action.u16);
+    }
+    ABTS_INT_EQUAL(tc, 0, req.create_pdr[2].presence);
+    ABTS_INT_EQUAL(tc, 0, req.create_far[2].presence);
+    ABTS_INT_EQUAL(tc, 0, req.create_urr[0].presence);
+
+    ABTS_INT_EQUAL(tc, 1, req.create_qer[0].presence);
+    ABTS_INT_EQUAL(tc, 1, req.create_qer[0].qer_id.u32);
+    ABTS_INT_EQUAL(tc, 1, req.create_qer[0].gate_status.presence);
+    ABTS_INT_EQUAL(tc, sizeof(mbr), req.create_qer[0].maximum_bitrate.len);
+    ABTS_TRUE(tc, memcmp(mbr,
+                req.create_qer[0].maximum_bitrate.data, sizeof(mbr)) == 0);
+    ABTS_INT_EQUAL(tc, 0, req.create_qer[1].presence);
+    ABTS_INT_EQUAL(tc, 0, req.create_bar.presence);
+    ABTS_INT_EQUAL(tc, 0, req.pdn_type.presence);
+
+    /* Truncated in the middle of Create QER */
+    ogs_pkbuf_trim(pkbuf, pkbuf->len - 4);
+    memset(&req, 0, sizeof(req));
+    rv = ogs_tlv_parse_msg(&req,
+            &ogs_pfcp_msg_desc_pfcp_session_establishment_request,
+            pkbuf, OGS_TLV_MODE_T2_L2);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+
+    ogs_pkbuf_free(pkbuf);
+}
+
+static void pfcp_message_test2(abts_case *tc, void *data)
+{
+#define PFCP_MESSAGE_TEST2_COUNT 100000
+    /* Session Establishment Request of pfcp_message_test1 */
+    const char *_payload =
+        "003c0005 007f000004"
+        "0039000d 02 0000000000000001 7f000004"
+        "00010028 00380002 0001 001d0004 000000ff"
+        "0002000e 00140001 00 005d0005 020a2d0002"
+        "006c0004 00000001"
+        "00010028 00380002 0002 001d0004 000000ff"
+        "0002000e 00140001 01 005d0005 060a2d0002"
+        "006c0004 00000002"
+        "0003000e 006c0004 00000001 002c0002 0200"
+        "0003000e 006c0004 00000002 002c0002 0200"
+        "0007001b 006d0004 00000001 00190001 00"
+        "001a000a 00000003e8 00000007d0";
+    char hexbuf[OGS_HUGE_LEN];
+    ogs_pfcp_session_establishment_request_t req;
+    ogs_pkbuf_t *pkbuf = NULL, *built = NULL;
+    ogs_time_t start, parse_time, build_time;
+    int i, parsed = 0, matched = 0;
+
+    pkbuf = ogs_pkbuf_alloc(NULL, 181);
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put_data(pkbuf,
+            ogs_hex_from_string(_payload, hexbuf, sizeof(hexbuf)), 181);
+
+    /* Benchmark : run with '-e info' to see the result */
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < PFCP_MESSAGE_TEST2_COUNT; i++) {
+        memset(&req, 0, sizeof(req));
+        if (ogs_tlv_parse_msg(&req,
+                    &ogs_pfcp_msg_desc_pfcp_session_establishment_request,
+                    pkbuf, OGS_TLV_MODE_T2_L2) == OGS_OK)
+            parsed++;
+    }
+    parse_time = ogs_get_monotonic_time() - start;
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < PFCP_MESSAGE_TEST2_COUNT; i++) {
+        built = ogs_tlv_build_msg(
+                &ogs_pfcp_msg_desc_pfcp_session_establishment_request,
+                &req, OGS_TLV_MODE_T2_L2);
+        ogs_assert(built);
+        if (built->len == pkbuf->len &&
+            memcmp(built->data, pkbuf->data, pkbuf->len) == 0)
+            matched++;
+        ogs_pkbuf_free(built);
+    }
+    build_time = ogs_get_monotonic_time() - start;
+
+    ABTS_INT_EQUAL(tc, PFCP_MESSAGE_TEST2_COUNT, parsed);
+    ABTS_INT_EQUAL(tc, PFCP_MESSAGE_TEST2_COUNT, matched);
+
+    ogs_info("Session Establishment Request (%d bytes) : "
+            "parse %lld msg/s, build %lld msg/s", pkbuf->len,
+            (long long)PFCP_MESSAGE_TEST2_COUNT * 1000000 /
+                (parse_time ? parse_time : 1),
+            (long long)PFCP_MESSAGE_TEST2_COUNT * 1000000 /
+                (build_time ? build_time : 1));
+
+    ogs_pkbuf_free(pkbuf);
+}
+
+abts_suite *test_pfcp_message(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, pfcp_message_test1, NULL);
+    abts_run_test(suite, pfcp_message_test2, NULL);
+
+    return suite;
+}
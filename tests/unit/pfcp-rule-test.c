@@ -0,0 +1,584 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-pfcp.h"
+#include "core/abts.h"
+
+#include <netinet/ip.h>
+#include <netinet/ip6.h>
+#include <netinet/udp.h>
+
+#define TEST_MAX_NUM_OF_RULE 500
+
+static ogs_pfcp_sess_t test_sess;
+static ogs_pfcp_pdr_t test_pdr[OGS_MAX_NUM_OF_PDR];
+static uint8_t test_pdr_slot[OGS_MAX_NUM_OF_PDR];
+static ogs_pfcp_rule_t test_rule[TEST_MAX_NUM_OF_RULE];
+static int test_num_of_rule;
+
+static void test_sess_init(int num_of_pdr)
+{
+    int i;
+
+    memset(&test_sess, 0, sizeof(test_sess));
+    memset(test_pdr, 0, sizeof(test_pdr));
+    test_num_of_rule = 0;
+
+    for (i = 0; i < num_of_pdr; i++) {
+        ogs_pfcp_pdr_t *pdr = &test_pdr[i];
+
+        test_pdr_slot[i] = i + 1;
+        pdr->id_node = &test_pdr_slot[i];
+        pdr->id = i + 1;
+        pdr->precedence = i + 1;
+        pdr->sess = &test_sess;
+        ogs_list_add(&test_sess.pdr_list, pdr);
+    }
+}
+
+static void test_rule_add(abts_case *tc, int id, const char *description)
+{
+    ogs_pfcp_rule_t *rule = NULL;
+    char flow[OGS_HUGE_LEN];
+    int rv;
+
+    ogs_assert(test_num_of_rule < TEST_MAX_NUM_OF_RULE);
+    rule = &test_rule[test_num_of_rule++];
+    memset(rule, 0, sizeof(*rule));
+
+    ogs_cpystrn(flow, description, sizeof(flow));
+    rv = ogs_ipfw_compile_rule(&rule->ipfw, flow);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    rule->pdr = &test_pdr[id-1];
+    ogs_list_add(&test_pdr[id-1].rule_list, rule);
+}
+
+static ogs_pkbuf_t *test_packet4(uint8_t proto,
+        uint32_t src, uint16_t sport, uint32_t dst, uint16_t dport)
+{
+    ogs_pkbuf_t *pkbuf = NULL;
+    struct ip *ip_h = NULL;
+    struct udphdr *udph = NULL;
+
+    pkbuf = ogs_pkbuf_alloc(NULL, sizeof(*ip_h) + sizeof(*udph));
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put(pkbuf, sizeof(*ip_h) + sizeof(*udph));
+    memset(pkbuf->data, 0, pkbuf->len);
+
+    ip_h = (struct ip *)pkbuf->data;
+    ip_h->ip_v = 4;
+    ip_h->ip_hl = 5;
+    ip_h->ip_p = proto;
+    ip_h->ip_src.s_addr = htobe32(src);
+    ip_h->ip_dst.s_addr = htobe32(dst);
+
+    udph = (struct udphdr *)(ip_h + 1);
+    udph->uh_sport = htobe16(sport);
+    udph->uh_dport = htobe16(dport);
+
+    return pkbuf;
+}
+
+static ogs_pkbuf_t *test_packet6(uint8_t proto,
+        uint32_t src, uint16_t sport, uint32_t dst, uint16_t dport)
+{
+    ogs_pkbuf_t *pkbuf = NULL;
+    struct ip6_hdr *ip6_h = NULL;
+    struct udphdr *udph = NULL;
+    uint32_t addr[4];
+
+    pkbuf = ogs_pkbuf_alloc(NULL, sizeof(*ip6_h) + sizeof(*udph));
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put(pkbuf, sizeof(*ip6_h) + sizeof(*udph));
+    memset(pkbuf->data, 0, pkbuf->len);
+
+    ip6_h = (struct ip6_hdr *)pkbuf->data;
+    ip6_h->ip6_vfc = 0x60;
+    ip6_h->ip6_nxt = proto;
+    ip6_h->ip6_plen = htobe16(sizeof(*udph));
+
+    /* 2001:db8::<src> and 2001:db8:cafe::<dst> */
+    addr[0] = htobe32(0x20010db8); addr[1] = 0; addr[2] = 0;
+    addr[3] = htobe32(src);
+    memcpy(ip6_h->ip6_src.s6_addr, addr, OGS_IPV6_LEN);
+    addr[1] = htobe32(0xcafe0000);
+    addr[3] = htobe32(dst);
+    memcpy(ip6_h->ip6_dst.s6_addr, addr, OGS_IPV6_LEN);
+
+    udph = (struct udphdr *)(ip6_h + 1);
+    udph->uh_sport = htobe16(sport);
+    udph->uh_dport = htobe16(dport);
+
+    return pkbuf;
+}
+
+/* The result of the linear search over all PDRs */
+static uint32_t test_linear_match(ogs_pkbuf_t *pkbuf)
+{
+    ogs_pfcp_pdr_t *pdr = NULL;
+    uint32_t matched = 0;
+
+    ogs_list_for_each(&test_sess.pdr_list, pdr) {
+        if (ogs_list_first(&pdr->rule_list) == NULL ||
+            ogs_pfcp_pdr_rule_find_by_packet(pdr, pkbuf) != NULL)
+            matched |= OGS_PFCP_PDR_MASK(pdr);
+    }
+
+    return matched;
+}
+
+static void pfcp_rule_test1(abts_case *tc, void *data)
+{
+    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_pfcp_classifier_t *classifier = NULL;
+    int rv;
+
+    test_sess_init(5);
+
+    test_rule_add(tc, 1,
+        "permit out udp from 10.0.0.1 5060 to 10.45.0.2 30000-30010");
+    test_rule_add(tc, 2, "permit out tcp from any 80-443 to any");
+    test_rule_add(tc, 2, "permit out tcp from 10.1.0.0/16 to any 8080");
+    test_rule_add(tc, 3, "permit out ip from 2001:db8::/32 to any");
+    test_rule_add(tc, 4, "permit out 50 from any to any");
+    /* PDR 5 has no SDF filter */
+
+    rv = ogs_pfcp_classifier_compile(&test_sess);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    classifier = test_sess.classifier;
+    ABTS_PTR_NOTNULL(tc, classifier);
+
+    pkbuf = test_packet4(IPPROTO_UDP, 0x0a000001, 5060, 0x0a2d0002, 30005);
+    ABTS_INT_EQUAL(tc, 0x11, ogs_pfcp_classifier_match(classifier, pkbuf));
+    ABTS_INT_EQUAL(tc, 0x11, test_linear_match(pkbuf));
+    ogs_pkbuf_free(pkbuf);
+
+    pkbuf = test_packet4(IPPROTO_UDP, 0x0a000001, 5060, 0x0a2d0002, 30011);
+    ABTS_INT_EQUAL(tc, 0x10, ogs_pfcp_classifier_match(classifier, pkbuf));
+    ABTS_INT_EQUAL(tc, 0x10, test_linear_match(pkbuf));
+    ogs_pkbuf_free(pkbuf);
+
+    pkbuf = test_packet4(IPPROTO_TCP, 0x08080808, 443, 0x0a2d0002, 1234);
+    ABTS_INT_EQUAL(tc, 0x12, ogs_pfcp_classifier_match(classifier, pkbuf));
+    ABTS_INT_EQUAL(tc, 0x12, test_linear_match(pkbuf));
+    ogs_pkbuf_free(pkbuf);
+
+    pkbuf = test_packet4(IPPROTO_TCP, 0x0a010203, 1000, 0x0a2d0002, 8080);
+    ABTS_INT_EQUAL(tc, 0x12, ogs_pfcp_classifier_match(classifier, pkbuf));
+    ABTS_INT_EQUAL(tc, 0x12, test_linear_match(pkbuf));
+    ogs_pkbuf_free(pkbuf);
+
+    pkbuf = test_packet4(50, 0x0a010203, 0, 0x0a2d0002, 0);
+    ABTS_INT_EQUAL(tc, 0x18, ogs_pfcp_classifier_match(classifier, pkbuf));
+    ABTS_INT_EQUAL(tc, 0x18, test_linear_match(pkbuf));
+    ogs_pkbuf_free(pkbuf);
+
+    pkbuf = test_packet6(IPPROTO_UDP, 1, 5060, 2, 30005);
+    ABTS_INT_EQUAL(tc, 0x14, ogs_pfcp_classifier_match(classifier, pkbuf));
+    ABTS_INT_EQUAL(tc, 0x14, test_linear_match(pkbuf));
+    ogs_pkbuf_free(pkbuf);
+
+    ogs_pfcp_classifier_clear(&test_sess);
+    ABTS_PTR_EQUAL(tc, NULL, test_sess.classifier);
+}
+
+static void pfcp_rule_test2(abts_case *tc, void *data)
+{
+    const int num_of_rule[] = { 1, 10, 100, 500 };
+    const int num_of_packet = 10000;
+    static const char *proto[] = { "ip", "tcp", "udp" };
+    static const uint8_t proto_num[] = { 0, IPPROTO_TCP, IPPROTO_UDP };
+    static ogs_pkbuf_t *pkbuf[10000];
+    static uint32_t expected[10000];
+    int i, j, n, rv;
+
+    /* Microbenchmark : run with '-e info' to see the result */
+    for (n = 0; n < OGS_ARRAY_SIZE(num_of_rule); n++) {
+        ogs_time_t start, linear, classifier;
+        int mismatch = 0;
+
+        test_sess_init(OGS_MAX_NUM_OF_PDR);
+
+        /* The last PDR has no SDF filter as the default bearer */
+        for (i = 0; i < num_of_rule[n]; i++) {
+            char flow[OGS_HUGE_LEN];
+
+            if (i % 2)
+                ogs_snprintf(flow, sizeof(flow),
+                    "permit out %s from 10.%d.%d.0/24 %d to 10.45.0.0/16 "
+                    "%d-%d",
+                    proto[i % 3], (i >> 8) & 0xff, i & 0xff,
+                    1000 + i, 20000 + i, 20000 + i + 10);
+            else
+                ogs_snprintf(flow, sizeof(flow),
+                    "permit out %s from 10.%d.%d.%d to any %d",
+                    proto[i % 3], 100 + (i % 7), (i >> 8) & 0xff,
+                    i & 0xff, 5000 + i);
+
+            test_rule_add(tc, (i % (OGS_MAX_NUM_OF_PDR-1)) + 1, flow);
+        }
+
+        for (i = 0; i < num_of_packet; i++) {
+            j = ogs_random32() % num_of_rule[n];
+
+            if (i % 4 == 3)
+                pkbuf[i] = test_packet6(IPPROTO_UDP,
+                        ogs_random32(), 5000, ogs_random32(), 20000);
+            else if (j % 2)
+                pkbuf[i] = test_packet4(
+                        proto_num[j % 3] ? proto_num[j % 3] : IPPROTO_UDP,
+                        0x0a000000 | (j << 8) | (ogs_random32() & 0xff),
+                        1000 + j + (i % 3), 0x0a2d0000 | i,
+                        20000 + j + (ogs_random32() % 16));
+            else
+                pkbuf[i] = test_packet4(
+                        i % 5 ? IPPROTO_UDP : IPPROTO_TCP,
+                        0x0a000000 | ((100 + (j % 7)) << 16) | j,
+                        1234, 0x0a2d0000 | i, 5000 + j + (i % 2));
+
+            expected[i] = test_linear_match(pkbuf[i]);
+        }
+
+        rv = ogs_pfcp_classifier_compile(&test_sess);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+        start = ogs_get_monotonic_time();
+        for (i = 0; i < num_of_packet; i++)
+            test_linear_match(pkbuf[i]);
+        linear = ogs_get_monotonic_time() - start;
+
+        start = ogs_get_monotonic_time();
+        for (i = 0; i < num_of_packet; i++) {
+            if (ogs_pfcp_classifier_match(
+                        test_sess.classifier, pkbuf[i]) != expected[i])
+                mismatch++;
+        }
+        classifier = ogs_get_monotonic_time() - start;
+
+        ABTS_INT_EQUAL(tc, 0, mismatch);
+
+        ogs_info("%3d rules : linear %lld usecs, classifier %lld usecs "
+                "(%d packets)", num_of_rule[n],
+                (long long)linear, (long long)classifier, num_of_packet);
+
+        ogs_pfcp_classifier_clear(&test_sess);
+        for (i = 0; i < num_of_packet; i++)
+            ogs_pkbuf_free(pkbuf[i]);
+    }
+}
+
+static void pfcp_rule_test3(abts_case *tc, void *data)
+{
+    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_pfcp_classifier_t *classifier = NULL;
+    int rv;
+
+    /* The PDR ID is chosen by the peer and is not used for the bitmap */
+    test_sess_init(4);
+    test_pdr[0].id = 0;
+    test_pdr[1].id = 17;
+    test_pdr[2].id = 0xffff;
+    test_pdr[3].id = 0xffff;
+
+    test_rule_add(tc, 1, "permit out udp from any to 10.45.0.2 5060");
+    test_rule_add(tc, 2, "permit out tcp from any to any");
+    test_rule_add(tc, 3, "permit out ip from 10.0.0.0/8 to any");
+    /* PDR 4 has no SDF filter */
+
+    rv = ogs_pfcp_classifier_compile(&test_sess);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    classifier = test_sess.classifier;
+    ABTS_PTR_NOTNULL(tc, classifier);
+
+    pkbuf = test_packet4(IPPROTO_UDP, 0x0a000001, 1234, 0x0a2d0002, 5060);
+    ABTS_INT_EQUAL(tc, 0xd, ogs_pfcp_classifier_match(classifier, pkbuf));
+    ABTS_INT_EQUAL(tc, 0xd, test_linear_match(pkbuf));
+    ogs_pkbuf_free(pkbuf);
+
+    pkbuf = test_packet4(IPPROTO_TCP, 0x08080808, 443, 0x0a2d0002, 1234);
+    ABTS_INT_EQUAL(tc, 0xa, ogs_pfcp_classifier_match(classifier, pkbuf));
+    ABTS_INT_EQUAL(tc, 0xa, test_linear_match(pkbuf));
+    ogs_pkbuf_free(pkbuf);
+
+    ogs_pfcp_classifier_clear(&test_sess);
+
+    /* A PDR without a slot falls back to the linear match */
+    test_pdr[3].id_node = NULL;
+    rv = ogs_pfcp_classifier_compile(&test_sess);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+    ABTS_PTR_EQUAL(tc, NULL, test_sess.classifier);
+}
+
+/*
+ * ogs_pfcp_up_handle_pdr() encapsulates the G-PDU in the headroom
+ * of the received buffer (OGS_TUN_MAX_HEADROOM) without copying it.
+ */
+#define TEST4_GTPU_PORT     12152
+#define TEST4_PAYLOAD_LEN   1400
+#define TEST4_TEID          0x12345678
+
+static void pfcp_rule_test4(abts_case *tc, void *data)
+{
+    ogs_pfcp_pdr_t pdr;
+    ogs_pfcp_far_t far;
+    ogs_pfcp_qer_t qer;
+    ogs_gtp_node_t gnode;
+    ogs_pfcp_user_plane_report_t report;
+    ogs_sockaddr_t *addr = NULL;
+    ogs_sock_t *udp = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+    unsigned char *head = NULL, *payload = NULL;
+    uint8_t buf[OGS_MAX_PKT_LEN];
+    ssize_t size;
+    bool handled;
+    int rv, i;
+
+    rv = ogs_getaddrinfo(&addr, AF_INET, "127.0.0.1", TEST4_GTPU_PORT, 0);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    udp = ogs_udp_server(addr, NULL);
+    ABTS_PTR_NOTNULL(tc, udp);
+
+    memset(&gnode, 0, sizeof(gnode));
+    memcpy(&gnode.addr, addr, sizeof(gnode.addr));
+    gnode.sock = ogs_sock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    ABTS_PTR_NOTNULL(tc, gnode.sock);
+
+    memset(&far, 0, sizeof(far));
+    far.apply_action = OGS_PFCP_APPLY_ACTION_FORW;
+    far.dst_if = OGS_PFCP_INTERFACE_ACCESS;
+    far.outer_header_creation.teid = TEST4_TEID;
+    far.gnode = &gnode;
+
+    memset(&qer, 0, sizeof(qer));
+    qer.qfi = 1;
+
+    memset(&pdr, 0, sizeof(pdr));
+    pdr.id = 1;
+    pdr.far = &far;
+    pdr.qer = &qer;
+
+    /* As received from the TUN device */
+    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_PKT_LEN);
+    ABTS_PTR_NOTNULL(tc, pkbuf);
+    ogs_pkbuf_reserve(pkbuf, OGS_GTPV1U_5GC_HEADER_LEN);
+    ogs_pkbuf_put(pkbuf, TEST4_PAYLOAD_LEN);
+    for (i = 0; i < TEST4_PAYLOAD_LEN; i++)
+        pkbuf->data[i] = i;
+
+    head = pkbuf->head;
+    payload = pkbuf->data;
+
+    /*
+     * While a batch is started, the sent buffer is held
+     * until ogs_gtp_tx_batch_flush(), so it can still be inspected.
+     */
+    ogs_gtp_tx_batch_start();
+
+    handled = ogs_pfcp_up_handle_pdr(
+            &pdr, OGS_GTPU_MSGTYPE_GPDU, pkbuf, &report);
+    ABTS_TRUE(tc, handled);
+    ABTS_INT_EQUAL(tc, 0, report.type.downlink_data_report);
+
+    /* Same buffer : the GTP-U header took the whole headroom */
+    ABTS_PTR_EQUAL(tc, head, pkbuf->head);
+    ABTS_PTR_EQUAL(tc, payload - OGS_GTPV1U_5GC_HEADER_LEN, pkbuf->data);
+    ABTS_INT_EQUAL(tc, 0, ogs_pkbuf_headroom(pkbuf));
+    ABTS_INT_EQUAL(tc,
+            OGS_GTPV1U_5GC_HEADER_LEN + TEST4_PAYLOAD_LEN, pkbuf->len);
+
+    ogs_gtp_tx_batch_flush();
+
+    size = ogs_recv(udp->fd, buf, sizeof(buf), 0);
+    ABTS_INT_EQUAL(tc, OGS_GTPV1U_5GC_HEADER_LEN + TEST4_PAYLOAD_LEN, size);
+    ABTS_INT_EQUAL(tc, OGS_GTPU_MSGTYPE_GPDU, buf[1]);
+    ABTS_INT_EQUAL(tc, TEST4_TEID,
+            be32toh(((ogs_gtp2_header_t *)buf)->teid));
+    for (i = 0; i < TEST4_PAYLOAD_LEN; i++)
+        if (buf[OGS_GTPV1U_5GC_HEADER_LEN + i] != (uint8_t)i) break;
+    ABTS_INT_EQUAL(tc, TEST4_PAYLOAD_LEN, i);
+
+    ogs_sock_destroy(gnode.sock);
+    ogs_sock_destroy(udp);
+
+    rv = ogs_freeaddrinfo(addr);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+}
+
+/* 800bps : One byte is credited every 10ms */
+#define TEST_QER_MBR            800
+#define TEST_QER_MAX_BURST      OGS_MAX_PKT_LEN
+
+static void test_qer_init(ogs_pfcp_qer_t *qer, uint64_t ul, uint64_t dl)
+{
+    memset(qer, 0, sizeof(*qer));
+    ogs_thread_mutex_init(&qer->policer.mutex);
+
+    qer->gate_status.uplink = OGS_PFCP_GATE_OPEN;
+    qer->gate_status.downlink = OGS_PFCP_GATE_OPEN;
+    qer->mbr.uplink = ul;
+    qer->mbr.downlink = dl;
+    ogs_pfcp_qer_update_policer(qer);
+}
+
+static void test_qer_final(ogs_pfcp_qer_t *qer)
+{
+    ogs_thread_mutex_destroy(&qer->policer.mutex);
+}
+
+static void pfcp_rule_test5(abts_case *tc, void *data)
+{
+    ogs_pfcp_qer_t qer;
+
+    test_qer_init(&qer, TEST_QER_MBR, 0);
+
+    /* At least one packet of the maximum size */
+    ABTS_TRUE(tc, qer.policer.ul.depth ==
+            (uint64_t)TEST_QER_MAX_BURST * 8 * OGS_USEC_PER_SEC);
+    ABTS_TRUE(tc, qer.policer.ul.tokens == qer.policer.ul.depth);
+
+    /* The last byte of the bucket conforms, the next one exceeds */
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, true, TEST_QER_MAX_BURST - 1));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, true, 1));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, true, 1));
+
+    /* Downlink has no MBR */
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, false, TEST_QER_MAX_BURST));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, false, TEST_QER_MAX_BURST));
+
+    /* A new MBR starts with a full bucket of 100ms */
+    qer.mbr.downlink = 80000000;
+    ogs_pfcp_qer_update_policer(&qer);
+    ABTS_TRUE(tc, qer.policer.dl.depth ==
+            (uint64_t)80000000 * ogs_time_from_msec(100));
+    ABTS_TRUE(tc, qer.policer.dl.tokens == qer.policer.dl.depth);
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, false, 1000000));
+
+    /* The same MBR keeps the bucket */
+    ogs_pfcp_qer_update_policer(&qer);
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, true, 1));
+
+    test_qer_final(&qer);
+}
+
+static void pfcp_rule_test6(abts_case *tc, void *data)
+{
+    ogs_pfcp_qer_t qer;
+
+    test_qer_init(&qer, TEST_QER_MBR, TEST_QER_MBR);
+
+    /* Empty the bucket */
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, true, TEST_QER_MAX_BURST));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, true, 1));
+
+    /* 50ms of idle time is 5 bytes */
+    qer.policer.ul.last -= ogs_time_from_msec(50);
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, true, 6));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, true, 5));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, true, 1));
+
+    /* 10s of idle time is 1000 bytes, less than the bucket */
+    qer.policer.ul.last -= ogs_time_from_sec(10);
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, true, 1001));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, true, 1000));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, true, 1));
+
+    /* Long idle time is clamped to the bucket */
+    qer.policer.ul.last -= ogs_time_from_sec(3600);
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, true, TEST_QER_MAX_BURST + 1));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, true, TEST_QER_MAX_BURST));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, true, 1));
+
+    /* Short idle time on a partial bucket is clamped as well */
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, false, 3));
+    qer.policer.dl.last -= ogs_time_from_msec(50);
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, false, TEST_QER_MAX_BURST));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, false, 1));
+
+    test_qer_final(&qer);
+}
+
+static void pfcp_rule_test7(abts_case *tc, void *data)
+{
+    ogs_pfcp_qer_t qer;
+
+    test_qer_init(&qer, TEST_QER_MBR, 0);
+
+    /* UL gate closed */
+    qer.gate_status.uplink = OGS_PFCP_GATE_CLOSE;
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_GATE_CLOSED,
+            ogs_pfcp_qer_police(&qer, true, TEST_QER_MAX_BURST));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, false, TEST_QER_MAX_BURST));
+
+    /* Dropped packets do not take tokens */
+    qer.gate_status.uplink = OGS_PFCP_GATE_OPEN;
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_PASS,
+            ogs_pfcp_qer_police(&qer, true, TEST_QER_MAX_BURST));
+
+    /* DL gate closed */
+    qer.gate_status.downlink = OGS_PFCP_GATE_CLOSE;
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_GATE_CLOSED,
+            ogs_pfcp_qer_police(&qer, false, 1));
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_MBR_EXCEEDED,
+            ogs_pfcp_qer_police(&qer, true, 1));
+
+    /* The gate is checked before the MBR */
+    qer.gate_status.uplink = OGS_PFCP_GATE_CLOSE;
+    ABTS_INT_EQUAL(tc, OGS_PFCP_QER_GATE_CLOSED,
+            ogs_pfcp_qer_police(&qer, true, 1));
+
+    test_qer_final(&qer);
+}
+
+abts_suite *test_pfcp_rule(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, pfcp_rule_test1, NULL);
+    abts_run_test(suite, pfcp_rule_test2, NULL);
+    abts_run_test(suite, pfcp_rule_test3, NULL);
+    abts_run_test(suite, pfcp_rule_test4, NULL);
+    abts_run_test(suite, pfcp_rule_test5, NULL);
+    abts_run_test(suite, pfcp_rule_test6, NULL);
+    abts_run_test(suite, pfcp_rule_test7, NULL);
+
+    return suite;
+}
@@ -1330,6 +1330,72 @@ static void s1ap_message_test10(abts_case *tc, void *data)
     ogs_pkbuf_free(s1apbuf);
 }
 
+static void s1ap_message_test11(abts_case *tc, void *data)
+{
+    /* InitialUE(Attach Request) */
+    const char *payload =
+        "000c406f000006000800020001001a00"
+        "3c3b17df675aa8050741020bf600f110"
+        "000201030003e605f070000010000502"
+        "15d011d15200f11030395c0a003103e5"
+        "e0349011035758a65d0100e0c1004300"
+        "060000f1103039006440080000f1108c"
+        "3378200086400130004b00070000f110"
+        "000201";
+
+    ogs_s1ap_message_t message[12];
+    ogs_pkbuf_t *pkbuf, *s1apbuf;
+    int i, rv;
+    char hexbuf[OGS_HUGE_LEN];
+
+    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put_data(pkbuf,
+            ogs_hex_from_string(payload, hexbuf, sizeof(hexbuf)), 115);
+
+    /* More messages alive than arenas : the rest are on the heap */
+    for (i = 0; i < OGS_ARRAY_SIZE(message); i++) {
+        rv = ogs_s1ap_decode(&message[i], pkbuf);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        ABTS_INT_EQUAL(tc, S1AP_S1AP_PDU_PR_initiatingMessage,
+                message[i].present);
+        ABTS_INT_EQUAL(tc, S1AP_ProcedureCode_id_initialUEMessage,
+                message[i].choice.initiatingMessage->procedureCode);
+    }
+
+    /* Encoding releases an arena message and a heap message */
+    s1apbuf = ogs_s1ap_encode(&message[0]);
+    ABTS_PTR_NOTNULL(tc, s1apbuf);
+    ABTS_INT_EQUAL(tc, pkbuf->len, s1apbuf->len);
+    ABTS_TRUE(tc, memcmp(pkbuf->data, s1apbuf->data, pkbuf->len) == 0);
+    ogs_pkbuf_free(s1apbuf);
+
+    s1apbuf = ogs_s1ap_encode(&message[OGS_ARRAY_SIZE(message) - 1]);
+    ABTS_PTR_NOTNULL(tc, s1apbuf);
+    ABTS_INT_EQUAL(tc, pkbuf->len, s1apbuf->len);
+    ABTS_TRUE(tc, memcmp(pkbuf->data, s1apbuf->data, pkbuf->len) == 0);
+    ogs_pkbuf_free(s1apbuf);
+
+    /* Released out of order, and an arena is reused in between */
+    for (i = 2; i < OGS_ARRAY_SIZE(message) - 1; i += 2)
+        ogs_s1ap_free(&message[i]);
+
+    rv = ogs_s1ap_decode(&message[0], pkbuf);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    for (i = 1; i < OGS_ARRAY_SIZE(message) - 1; i += 2)
+        ogs_s1ap_free(&message[i]);
+    ogs_s1ap_free(&message[0]);
+
+    /* Truncated message */
+    ogs_pkbuf_trim(pkbuf, 40);
+    rv = ogs_s1ap_decode(&message[0], pkbuf);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+    ogs_s1ap_free(&message[0]);
+
+    ogs_pkbuf_free(pkbuf);
+}
+
 abts_suite *test_s1ap_message(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -1346,6 +1412,7 @@ abts_suite *test_s1ap_message(abts_suite *suite)
     abts_run_test(suite, s1ap_message_test8, NULL);
     abts_run_test(suite, s1ap_message_test9, NULL);
     abts_run_test(suite, s1ap_message_test10, NULL);
+    abts_run_test(suite, s1ap_message_test11, NULL);
 
     return suite;
 }
@@ -621,7 +621,7 @@ static void sbi_message_test6(abts_case *tc, void *data)
     content = cJSON_Print(item);
     cJSON_Delete(item);
     ogs_assert(content);
-    ABTS_INT_EQUAL(tc, 148, (int)strlen(content));
+    ABTS_INT_EQUAL(tc, 140, (int)strlen(content));
     ogs_free(content);
 }
 
@@ -784,6 +784,290 @@ static void sbi_message_test7(abts_case *tc, void *data)
         ogs_sbi_service_type_from_name(OGS_SBI_SERVICE_NAME_NNSSAAF_NSSAA));
 }
 
+static void sbi_message_round_trip(abts_case *tc,
+        ogs_sbi_message_t *message, const char *method, const char *uri,
+        int status)
+{
+    int rv;
+    ogs_sbi_message_t recvmsg;
+    ogs_sbi_response_t *response = NULL, *response2 = NULL;
+
+    response = ogs_sbi_build_response(message, status);
+    ABTS_PTR_NOTNULL(tc, response);
+    ABTS_PTR_NOTNULL(tc, response->http.content);
+    ABTS_INT_EQUAL(tc, strlen(response->http.content),
+            response->http.content_length);
+    ABTS_TRUE(tc, strchr(response->http.content, '\n') == NULL);
+
+    response->h.method = ogs_strdup(method);
+    ogs_assert(response->h.method);
+    response->h.uri = ogs_strdup(uri);
+    ogs_assert(response->h.uri);
+
+    rv = ogs_sbi_parse_response(&recvmsg, response);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    response2 = ogs_sbi_build_response(&recvmsg, status);
+    ABTS_PTR_NOTNULL(tc, response2);
+    ABTS_PTR_NOTNULL(tc, response2->http.content);
+    ABTS_STR_EQUAL(tc, response->http.content, response2->http.content);
+
+    ogs_sbi_message_free(&recvmsg);
+    ogs_sbi_response_free(response);
+    ogs_sbi_response_free(response2);
+}
+
+static const char *nf_profile =
+    "{\n"
+    "    \"nfInstanceId\": \"c3d5b7f0-4f53-41ed-8d1b-6f1cf4b9b3a1\",\n"
+    "    \"nfType\": \"SMF\",\n"
+    "    \"nfStatus\": \"REGISTERED\",\n"
+    "    \"heartBeatTimer\": 10,\n"
+    "    \"ipv4Addresses\": [ \"127.0.0.4\" ],\n"
+    "    \"allowedNfTypes\": [ \"AMF\", \"SCP\" ],\n"
+    "    \"priority\": 0,\n"
+    "    \"capacity\": 100,\n"
+    "    \"nfServices\": [ {\n"
+    "        \"serviceInstanceId\": \"c3d60a00-4f53-41ed-8d1b-6f1cf4b9b3a1\",\n"
+    "        \"serviceName\": \"nsmf-pdusession\",\n"
+    "        \"versions\": [ {\n"
+    "            \"apiVersionInUri\": \"v1\",\n"
+    "            \"apiFullVersion\": \"1.0.0\"\n"
+    "        } ],\n"
+    "        \"scheme\": \"http\",\n"
+    "        \"nfServiceStatus\": \"REGISTERED\",\n"
+    "        \"ipEndPoints\": [ {\n"
+    "            \"ipv4Address\": \"127.0.0.4\",\n"
+    "            \"port\": 7777\n"
+    "        } ]\n"
+    "    } ],\n"
+    "    \"nfProfileChangesSupportInd\": true\n"
+    "}";
+
+static const char *ue_authentication_ctx =
+    "{\n"
+    "    \"authType\": \"5G_AKA\",\n"
+    "    \"5gAuthData\": {\n"
+    "        \"rand\": \"4d45b0eeb8386b629f136968837a7b0b\",\n"
+    "        \"hxresStar\": \"1ae2f4d4f7d2ff7b0c9a2c8d2e6a1c44\",\n"
+    "        \"autn\": \"4d8e1e5a1a8f8000c36c16b1c07b2a2a\"\n"
+    "    },\n"
+    "    \"_links\": {\n"
+    "        \"5g-aka\": {\n"
+    "            \"href\": \"http://127.0.0.11:7777/nausf-auth/v1/"
+                        "ue-authentications/1/5g-aka-confirmation\"\n"
+    "        }\n"
+    "    },\n"
+    "    \"servingNetworkName\": \"5G:mnc070.mcc999.3gppnetwork.org\"\n"
+    "}";
+
+static const char *policy_association =
+    "{\n"
+    "    \"triggers\": [ \"LOC_CH\", \"PRA_CH\" ],\n"
+    "    \"servAreaRes\": {\n"
+    "        \"restrictionType\": \"ALLOWED_AREAS\",\n"
+    "        \"areas\": [ { \"tacs\": [ \"000001\" ] } ]\n"
+    "    },\n"
+    "    \"rfsp\": 1,\n"
+    "    \"suppFeat\": \"1\"\n"
+    "}";
+
+static const char *sm_context_create_data =
+    "{\n"
+    "    \"supi\": \"imsi-999700000000001\",\n"
+    "    \"pei\": \"imeisv-4370816125816151\",\n"
+    "    \"dnn\": \"internet\",\n"
+    "    \"sNssai\": { \"sst\": 1 },\n"
+    "    \"servingNfId\": \"c3d5b7f0-4f53-41ed-8d1b-6f1cf4b9b3a2\",\n"
+    "    \"guami\": {\n"
+    "        \"plmnId\": { \"mcc\": \"999\", \"mnc\": \"70\" },\n"
+    "        \"amfId\": \"020040\"\n"
+    "    },\n"
+    "    \"servingNetwork\": { \"mcc\": \"999\", \"mnc\": \"70\" },\n"
+    "    \"n1SmMsg\": { \"contentId\": \"5gnas-sm\" },\n"
+    "    \"anType\": \"3GPP_ACCESS\",\n"
+    "    \"ratType\": \"NR\",\n"
+    "    \"smContextStatusUri\": \"http://127.0.0.5:7777/"
+                        "namf-callback/v1/imsi-999700000000001/"
+                        "sm-context-status/1\",\n"
+    "    \"pduSessionId\": 1\n"
+    "}";
+
+static void sbi_message_test8(abts_case *tc, void *data)
+{
+    ogs_sbi_message_t message;
+    OpenAPI_sm_context_create_data_t *SmContextCreateData = NULL;
+    OpenAPI_sm_context_create_data_t *SmContextCreateData2 = NULL;
+    cJSON *item = NULL;
+    char *content = NULL, *content2 = NULL;
+
+    /* NFProfile */
+    item = cJSON_Parse(nf_profile);
+    ABTS_PTR_NOTNULL(tc, item);
+    memset(&message, 0, sizeof(message));
+    message.NFProfile = OpenAPI_nf_profile_parseFromJSON(item);
+    ABTS_PTR_NOTNULL(tc, message.NFProfile);
+    cJSON_Delete(item);
+
+    sbi_message_round_trip(tc, &message, OGS_SBI_HTTP_METHOD_PUT,
+            "/nnrf-nfm/v1/nf-instances/c3d5b7f0-4f53-41ed-8d1b-6f1cf4b9b3a1",
+            OGS_SBI_HTTP_STATUS_OK);
+    OpenAPI_nf_profile_free(message.NFProfile);
+
+    /* UeAuthenticationCtx */
+    item = cJSON_Parse(ue_authentication_ctx);
+    ABTS_PTR_NOTNULL(tc, item);
+    memset(&message, 0, sizeof(message));
+    message.UeAuthenticationCtx =
+        OpenAPI_ue_authentication_ctx_parseFromJSON(item);
+    ABTS_PTR_NOTNULL(tc, message.UeAuthenticationCtx);
+    cJSON_Delete(item);
+
+    sbi_message_round_trip(tc, &message, OGS_SBI_HTTP_METHOD_POST,
+            "/nausf-auth/v1/ue-authentications",
+            OGS_SBI_HTTP_STATUS_CREATED);
+    OpenAPI_ue_authentication_ctx_free(message.UeAuthenticationCtx);
+
+    /* PolicyAssociation */
+    item = cJSON_Parse(policy_association);
+    ABTS_PTR_NOTNULL(tc, item);
+    memset(&message, 0, sizeof(message));
+    message.PolicyAssociation = OpenAPI_policy_association_parseFromJSON(item);
+    ABTS_PTR_NOTNULL(tc, message.PolicyAssociation);
+    cJSON_Delete(item);
+
+    sbi_message_round_trip(tc, &message, OGS_SBI_HTTP_METHOD_POST,
+            "/npcf-am-policy-control/v1/policies",
+            OGS_SBI_HTTP_STATUS_CREATED);
+    OpenAPI_policy_association_free(message.PolicyAssociation);
+
+    /* SmContextCreateData is copied without printing it */
+    item = cJSON_Parse(sm_context_create_data);
+    ABTS_PTR_NOTNULL(tc, item);
+    SmContextCreateData = OpenAPI_sm_context_create_data_parseFromJSON(item);
+    ABTS_PTR_NOTNULL(tc, SmContextCreateData);
+    cJSON_Delete(item);
+
+    SmContextCreateData2 = OpenAPI_sm_context_create_data_copy(
+            NULL, SmContextCreateData);
+    ABTS_PTR_NOTNULL(tc, SmContextCreateData2);
+
+    item = OpenAPI_sm_context_create_data_convertToJSON(SmContextCreateData);
+    ABTS_PTR_NOTNULL(tc, item);
+    content = cJSON_PrintUnformatted(item);
+    ABTS_PTR_NOTNULL(tc, content);
+    cJSON_Delete(item);
+
+    item = OpenAPI_sm_context_create_data_convertToJSON(SmContextCreateData2);
+    ABTS_PTR_NOTNULL(tc, item);
+    content2 = cJSON_PrintUnformatted(item);
+    ABTS_PTR_NOTNULL(tc, content2);
+    cJSON_Delete(item);
+
+    ABTS_STR_EQUAL(tc, content, content2);
+
+    ogs_free(content);
+    ogs_free(content2);
+    OpenAPI_sm_context_create_data_free(SmContextCreateData);
+    OpenAPI_sm_context_create_data_free(SmContextCreateData2);
+}
+
+#define SBI_MESSAGE_TEST9_COUNT 10000
+
+typedef void *(*sbi_message_parse_f)(cJSON *item);
+typedef cJSON *(*sbi_message_convert_f)(void *model);
+typedef void (*sbi_message_free_f)(void *model);
+
+static void sbi_message_benchmark(abts_case *tc, const char *name,
+        const char *json, sbi_message_parse_f parse,
+        sbi_message_convert_f convert, sbi_message_free_f release)
+{
+    cJSON *item = NULL;
+    void *model = NULL;
+    char *content = NULL, *built = NULL;
+    size_t length;
+    ogs_time_t start, parse_time, build_time;
+    int i, parsed = 0, matched = 0;
+
+    /* The model is measured on the compact encoding sent on the wire */
+    item = cJSON_Parse(json);
+    ogs_assert(item);
+    model = parse(item);
+    ogs_assert(model);
+    cJSON_Delete(item);
+
+    item = convert(model);
+    ogs_assert(item);
+    content = cJSON_PrintUnformatted(item);
+    ogs_assert(content);
+    cJSON_Delete(item);
+    release(model);
+    model = NULL;
+
+    length = strlen(content);
+
+    /* Benchmark : run with '-e info' to see the result */
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < SBI_MESSAGE_TEST9_COUNT; i++) {
+        item = cJSON_Parse(content);
+        ogs_assert(item);
+        if (model)
+            release(model);
+        model = parse(item);
+        if (model)
+            parsed++;
+        cJSON_Delete(item);
+    }
+    parse_time = ogs_get_monotonic_time() - start;
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < SBI_MESSAGE_TEST9_COUNT; i++) {
+        item = convert(model);
+        ogs_assert(item);
+        built = cJSON_PrintUnformatted(item);
+        ogs_assert(built);
+        cJSON_Delete(item);
+        if (strcmp(built, content) == 0)
+            matched++;
+        cJSON_free(built);
+    }
+    build_time = ogs_get_monotonic_time() - start;
+
+    ABTS_INT_EQUAL(tc, SBI_MESSAGE_TEST9_COUNT, parsed);
+    ABTS_INT_EQUAL(tc, SBI_MESSAGE_TEST9_COUNT, matched);
+
+    ogs_info("%s (%d bytes) : parse %lld bytes/s, build %lld bytes/s",
+            name, (int)length,
+            (long long)length * SBI_MESSAGE_TEST9_COUNT * 1000000 /
+                (parse_time ? parse_time : 1),
+            (long long)length * SBI_MESSAGE_TEST9_COUNT * 1000000 /
+                (build_time ? build_time : 1));
+
+    release(model);
+    cJSON_free(content);
+}
+
+static void sbi_message_test9(abts_case *tc, void *data)
+{
+    sbi_message_benchmark(tc, "NFProfile", nf_profile,
+            (sbi_message_parse_f)OpenAPI_nf_profile_parseFromJSON,
+            (sbi_message_convert_f)OpenAPI_nf_profile_convertToJSON,
+            (sbi_message_free_f)OpenAPI_nf_profile_free);
+    sbi_message_benchmark(tc, "UeAuthenticationCtx", ue_authentication_ctx,
+            (sbi_message_parse_f)OpenAPI_ue_authentication_ctx_parseFromJSON,
+            (sbi_message_convert_f)OpenAPI_ue_authentication_ctx_convertToJSON,
+            (sbi_message_free_f)OpenAPI_ue_authentication_ctx_free);
+    sbi_message_benchmark(tc, "PolicyAssociation", policy_association,
+            (sbi_message_parse_f)OpenAPI_policy_association_parseFromJSON,
+            (sbi_message_convert_f)OpenAPI_policy_association_convertToJSON,
+            (sbi_message_free_f)OpenAPI_policy_association_free);
+    sbi_message_benchmark(tc, "SmContextCreateData", sm_context_create_data,
+            (sbi_message_parse_f)OpenAPI_sm_context_create_data_parseFromJSON,
+            (sbi_message_convert_f)
+                OpenAPI_sm_context_create_data_convertToJSON,
+            (sbi_message_free_f)OpenAPI_sm_context_create_data_free);
+}
+
 abts_suite *test_sbi_message(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -795,6 +1079,8 @@ abts_suite *test_sbi_message(abts_suite *suite)
     abts_run_test(suite, sbi_message_test5, NULL);
     abts_run_test(suite, sbi_message_test6, NULL);
     abts_run_test(suite, sbi_message_test7, NULL);
+    abts_run_test(suite, sbi_message_test8, NULL);
+    abts_run_test(suite, sbi_message_test9, NULL);
 
     return suite;
 }
@@ -0,0 +1,529 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-sbi.h"
+#include "core/abts.h"
+
+#include <netinet/tcp.h>
+#include <nghttp2/nghttp2.h>
+
+/*
+ * The HTTP/2 server runs on the pollset of this thread,
+ * and the test client is driven by the same loop.
+ * The server listens on an ephemeral port of the loopback.
+ */
+static ogs_sbi_server_t *test_server;
+static uint16_t test_server_port;
+
+static struct {
+    size_t body_size;           /* Response body */
+    char *body;
+
+    int num_of_request;         /* Received by the server */
+    size_t content_length;      /* of the last request */
+    bool content_is_valid;
+} test_server_state;
+
+static struct {
+    ogs_socket_t fd;
+    nghttp2_session *session;
+
+    int total, started, done;
+    int status;
+    size_t bytes;
+
+    const char *method;
+    const char *content;        /* Request body */
+    size_t content_length;
+    bool content_length_header;
+    size_t sent;
+} test_client;
+
+static int test_server_cb(ogs_sbi_request_t *request, void *data)
+{
+    ogs_sbi_stream_t *stream = data;
+    ogs_sbi_response_t *response = NULL;
+    size_t i;
+
+    test_server_state.num_of_request++;
+    test_server_state.content_length = request->http.content_length;
+    test_server_state.content_is_valid = true;
+    for (i = 0; i < request->http.content_length; i++) {
+        if (request->http.content[i] != (char)('a' + i % 26)) {
+            test_server_state.content_is_valid = false;
+            break;
+        }
+    }
+
+    response = ogs_sbi_response_new();
+    ogs_assert(response);
+    response->status = OGS_SBI_HTTP_STATUS_OK;
+
+    if (test_server_state.body_size) {
+        response->http.content = ogs_malloc(test_server_state.body_size + 1);
+        ogs_assert(response->http.content);
+        memcpy(response->http.content,
+                test_server_state.body, test_server_state.body_size);
+        response->http.content_length = test_server_state.body_size;
+        ogs_sbi_header_set(response->http.headers,
+                OGS_SBI_CONTENT_TYPE, OGS_SBI_CONTENT_JSON_TYPE);
+    }
+
+    ogs_assert(true == ogs_sbi_server_send_response(stream, response));
+
+    return OGS_OK;
+}
+
+static void test_server_start(void)
+{
+    ogs_sockaddr_t *addr = NULL;
+    ogs_sockaddr_t local;
+    socklen_t addrlen = sizeof(local.sin);
+
+    ogs_app_context_init();
+    ogs_app()->pollset = ogs_pollset_create(ogs_app()->pool.socket);
+    ogs_assert(ogs_app()->pollset);
+
+    ogs_sbi_server_init(ogs_app()->pool.nf, ogs_app()->pool.stream);
+
+    ogs_assert(OGS_OK == ogs_getaddrinfo(&addr,
+                AF_INET, "127.0.0.1", 0, 0));
+    test_server = ogs_sbi_server_add(addr, NULL);
+    ogs_assert(test_server);
+    ogs_freeaddrinfo(addr);
+
+    ogs_assert(OGS_OK == ogs_sbi_server_start_all(test_server_cb));
+
+    ogs_assert(test_server->node.sock);
+    ogs_assert(getsockname(test_server->node.sock->fd,
+                &local.sa, &addrlen) == 0);
+    test_server_port = OGS_PORT(&local);
+
+    memset(&test_server_state, 0, sizeof(test_server_state));
+}
+
+static void test_server_stop(void)
+{
+    ogs_sbi_server_stop_all();
+    ogs_sbi_server_final();
+
+    ogs_pollset_destroy(ogs_app()->pollset);
+    ogs_app()->pollset = NULL;
+
+    ogs_app_context_final();
+}
+
+static ssize_t test_client_send_cb(nghttp2_session *session,
+        const uint8_t *data, size_t length, int flags, void *user_data)
+{
+    ssize_t sent = send(test_client.fd, data, length, 0);
+    if (sent < 0)
+        return errno == EAGAIN ?
+            NGHTTP2_ERR_WOULDBLOCK : NGHTTP2_ERR_CALLBACK_FAILURE;
+    return sent;
+}
+
+static ssize_t test_client_recv_cb(nghttp2_session *session,
+        uint8_t *buf, size_t length, int flags, void *user_data)
+{
+    ssize_t received = recv(test_client.fd, buf, length, 0);
+    if (received < 0)
+        return errno == EAGAIN ?
+            NGHTTP2_ERR_WOULDBLOCK : NGHTTP2_ERR_CALLBACK_FAILURE;
+    if (received == 0)
+        return NGHTTP2_ERR_EOF;
+    return received;
+}
+
+static int test_client_header_cb(nghttp2_session *session,
+        const nghttp2_frame *frame, const uint8_t *name, size_t namelen,
+        const uint8_t *value, size_t valuelen, uint8_t flags, void *user_data)
+{
+    if (namelen == 7 && memcmp(name, ":status", 7) == 0)
+        test_client.status = atoi((const char *)value);
+    return 0;
+}
+
+static int test_client_data_cb(nghttp2_session *session, uint8_t flags,
+        int32_t stream_id, const uint8_t *data, size_t len, void *user_data)
+{
+    test_client.bytes += len;
+    return 0;
+}
+
+static ssize_t test_client_read_body(nghttp2_session *session,
+        int32_t stream_id, uint8_t *buf, size_t length,
+        uint32_t *data_flags, nghttp2_data_source *source, void *user_data)
+{
+    size_t len = ogs_min(length,
+            test_client.content_length - test_client.sent);
+
+    memcpy(buf, test_client.content + test_client.sent, len);
+    test_client.sent += len;
+
+    if (test_client.sent == test_client.content_length)
+        *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+
+    return len;
+}
+
+static void test_client_submit(void)
+{
+    char length[32];
+    nghttp2_data_provider provider;
+    nghttp2_nv nva[5];
+    int num_of_nv = 0;
+
+#define TEST_NV(__nAME, __vALUE) do { \
+    nva[num_of_nv].name = (uint8_t *)(__nAME); \
+    nva[num_of_nv].namelen = strlen(__nAME); \
+    nva[num_of_nv].value = (uint8_t *)(__vALUE); \
+    nva[num_of_nv].valuelen = strlen(__vALUE); \
+    nva[num_of_nv].flags = NGHTTP2_NV_FLAG_NONE; \
+    num_of_nv++; \
+} while (0)
+
+    TEST_NV(":method", test_client.method);
+    TEST_NV(":scheme", "http");
+    TEST_NV(":authority", "127.0.0.1");
+    TEST_NV(":path", "/nudm-sdm/v2/imsi-001010000000001/am-data");
+
+    if (test_client.content_length_header) {
+        ogs_snprintf(length, sizeof(length),
+                "%d", (int)test_client.content_length);
+        TEST_NV("content-length", length);
+    }
+
+    test_client.sent = 0;
+    provider.source.ptr = NULL;
+    provider.read_callback = test_client_read_body;
+
+    ogs_assert(nghttp2_submit_request(test_client.session, NULL,
+            nva, num_of_nv,
+            test_client.content_length ? &provider : NULL, NULL) > 0);
+
+    test_client.started++;
+}
+
+static int test_client_close_cb(nghttp2_session *session,
+        int32_t stream_id, uint32_t error_code, void *user_data)
+{
+    test_client.done++;
+    if (test_client.started < test_client.total)
+        test_client_submit();
+    return 0;
+}
+
+static void test_client_open(void)
+{
+    nghttp2_session_callbacks *callbacks = NULL;
+    nghttp2_settings_entry iv[] = {
+        { NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, (1 << 30) },
+    };
+    ogs_sockaddr_t *addr = NULL;
+    int one = 1;
+
+    memset(&test_client, 0, sizeof(test_client));
+
+    ogs_assert(OGS_OK == ogs_getaddrinfo(&addr,
+                AF_INET, "127.0.0.1", test_server_port, 0));
+    test_client.fd = socket(AF_INET, SOCK_STREAM, 0);
+    ogs_assert(test_client.fd != INVALID_SOCKET);
+    ogs_assert(connect(test_client.fd,
+                &addr->sa, ogs_sockaddr_len(addr)) == 0);
+    ogs_freeaddrinfo(addr);
+
+    ogs_assert(setsockopt(test_client.fd,
+                IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)) == 0);
+    ogs_assert(OGS_OK == ogs_nonblocking(test_client.fd));
+
+    ogs_assert(nghttp2_session_callbacks_new(&callbacks) == 0);
+    nghttp2_session_callbacks_set_send_callback(
+            callbacks, test_client_send_cb);
+    nghttp2_session_callbacks_set_recv_callback(
+            callbacks, test_client_recv_cb);
+    nghttp2_session_callbacks_set_on_header_callback(
+            callbacks, test_client_header_cb);
+    nghttp2_session_callbacks_set_on_data_chunk_recv_callback(
+            callbacks, test_client_data_cb);
+    nghttp2_session_callbacks_set_on_stream_close_callback(
+            callbacks, test_client_close_cb);
+    ogs_assert(nghttp2_session_client_new(
+                &test_client.session, callbacks, NULL) == 0);
+    nghttp2_session_callbacks_del(callbacks);
+
+    ogs_assert(nghttp2_submit_settings(test_client.session,
+            NGHTTP2_FLAG_NONE, iv, OGS_ARRAY_SIZE(iv)) == 0);
+    ogs_assert(nghttp2_session_set_local_window_size(
+            test_client.session, NGHTTP2_FLAG_NONE, 0, (1 << 30)) == 0);
+}
+
+static void test_client_close(void)
+{
+    nghttp2_session_del(test_client.session);
+    ogs_closesocket(test_client.fd);
+}
+
+/*
+ * Returns false if the requests have not completed within the timeout.
+ * A timeout of 0 waits until all the requests are completed.
+ */
+static bool test_client_run(int total, int concurrency, ogs_time_t timeout)
+{
+    ogs_time_t deadline = ogs_get_monotonic_time() + timeout;
+    int i;
+
+    test_client.total = total;
+    test_client.started = test_client.done = 0;
+
+    for (i = 0; i < concurrency && i < total; i++)
+        test_client_submit();
+
+    while (test_client.done < total) {
+        if (nghttp2_session_send(test_client.session) != 0)
+            return false;
+        ogs_pollset_poll(ogs_app()->pollset, 0);
+        if (nghttp2_session_recv(test_client.session) != 0)
+            return false;
+
+        if (timeout && ogs_get_monotonic_time() > deadline)
+            return false;
+    }
+
+    return true;
+}
+
+static char *test_content_new(size_t size)
+{
+    char *content = ogs_malloc(size + 1);
+    size_t i;
+
+    ogs_assert(content);
+    for (i = 0; i < size; i++)
+        content[i] = 'a' + i % 26;
+    content[size] = 0;
+
+    return content;
+}
+
+static void sbi_server_test1(abts_case *tc, void *data)
+{
+    /* Bodies beyond the preallocation limit of the server */
+    const size_t size[] = { 100, 3*1024*1024 };
+    char *content = NULL;
+    int i, j;
+
+    test_server_start();
+    test_client_open();
+
+    for (i = 0; i < OGS_ARRAY_SIZE(size); i++) {
+        content = test_content_new(size[i]);
+
+        for (j = 0; j < 2; j++) {
+            test_client.method = "POST";
+            test_client.content = content;
+            test_client.content_length = size[i];
+            test_client.content_length_header = (j == 0);
+            test_client.status = 0;
+
+            test_server_state.num_of_request = 0;
+            test_server_state.content_length = 0;
+
+            ABTS_TRUE(tc, test_client_run(1, 1,
+                        ogs_time_from_sec(10)) == true);
+            ABTS_INT_EQUAL(tc, 200, test_client.status);
+            ABTS_INT_EQUAL(tc, 1, test_server_state.num_of_request);
+            ABTS_INT_EQUAL(tc, size[i], test_server_state.content_length);
+            ABTS_TRUE(tc, test_server_state.content_is_valid == true);
+        }
+
+        ogs_free(content);
+    }
+
+    test_client_close();
+    test_server_stop();
+}
+
+static void sbi_server_test2(abts_case *tc, void *data)
+{
+    const size_t body_size[] = { 600, 8000, 65536 };
+    const int concurrency = 32;
+    int num_of_request = 100;
+    ogs_time_t timeout = ogs_time_from_sec(10);
+    bool benchmark = false;
+    int i;
+
+    /* Benchmark : run with '-e info' to see the result */
+    if (ogs_log_get_domain_level(OGS_LOG_DOMAIN) >= OGS_LOG_INFO) {
+        benchmark = true;
+        num_of_request = 20000;
+        timeout = 0;
+    }
+
+    for (i = 0; i < OGS_ARRAY_SIZE(body_size); i++) {
+        ogs_time_t start, elapsed;
+
+        test_server_start();
+        test_server_state.body_size = body_size[i];
+        test_server_state.body = test_content_new(body_size[i]);
+
+        test_client_open();
+        test_client.method = "GET";
+
+        start = ogs_get_monotonic_time();
+        ABTS_TRUE(tc, test_client_run(
+                    num_of_request, concurrency, timeout) == true);
+        elapsed = ogs_get_monotonic_time() - start;
+
+        ABTS_INT_EQUAL(tc, num_of_request, test_server_state.num_of_request);
+        ABTS_TRUE(tc, test_client.bytes ==
+                (size_t)num_of_request * body_size[i]);
+
+        if (benchmark)
+            ogs_info("%5d bytes : %d requests in %lld usecs, %lld req/s "
+                    "(%d streams)", (int)body_size[i], num_of_request,
+                    (long long)elapsed,
+                    (long long)num_of_request * 1000000 /
+                        (elapsed ? elapsed : 1),
+                    concurrency);
+
+        test_client_close();
+        ogs_free(test_server_state.body);
+        test_server_stop();
+    }
+}
+
+static int test_sbi_client_cb(
+        int status, ogs_sbi_response_t *response, void *data)
+{
+    int *done = data;
+
+    ogs_assert(status == OGS_OK);
+    ogs_assert(response);
+    ogs_assert(response->status == OGS_SBI_HTTP_STATUS_OK);
+    ogs_sbi_response_free(response);
+
+    (*done)++;
+
+    return OGS_OK;
+}
+
+static void sbi_server_test3(abts_case *tc, void *data)
+{
+    const int num_of_request = 1000;
+    ogs_sbi_client_t *client = NULL;
+    ogs_sbi_request_t *request = NULL;
+    ogs_sockaddr_t *addr = NULL;
+    ogs_time_t deadline;
+    uint64_t num_of_latency = 0;
+    char stats[OGS_HUGE_LEN], expected[OGS_HUGE_LEN];
+    int i, done = 0;
+
+    /* The statistics of the libcurl client against the server */
+    test_server_start();
+
+    ogs_app()->timer_mgr = ogs_timer_mgr_create(ogs_app()->pool.timer);
+    ogs_assert(ogs_app()->timer_mgr);
+    ogs_sbi_client_init(ogs_app()->pool.nf, ogs_app()->pool.stream);
+
+    ogs_assert(OGS_OK == ogs_getaddrinfo(&addr,
+                AF_INET, "127.0.0.1", test_server_port, 0));
+    client = ogs_sbi_client_add(OpenAPI_uri_scheme_http, addr);
+    ogs_assert(client);
+    ogs_freeaddrinfo(addr);
+
+    for (i = 0; i < num_of_request; i++) {
+        request = ogs_sbi_request_new();
+        ogs_assert(request);
+        request->h.method = (char *)OGS_SBI_HTTP_METHOD_GET;
+        request->h.uri = ogs_msprintf("http://127.0.0.1:%d"
+                "/nudm-sdm/v2/imsi-001010000000001/am-data",
+                test_server_port);
+        ogs_assert(request->h.uri);
+
+        ABTS_TRUE(tc, ogs_sbi_client_send_request(
+                    client, test_sbi_client_cb, request, &done) == true);
+
+        ogs_free(request->h.uri);
+        request->h.uri = NULL;
+        request->h.method = NULL;
+        ogs_sbi_request_free(request);
+    }
+
+    deadline = ogs_get_monotonic_time() + ogs_time_from_sec(10);
+    while (done < num_of_request &&
+            ogs_get_monotonic_time() < deadline) {
+        ogs_time_t timeout = ogs_timer_mgr_next(ogs_app()->timer_mgr);
+
+        ogs_pollset_poll(ogs_app()->pollset,
+                ogs_min(timeout, ogs_time_from_msec(10)));
+        ogs_timer_mgr_expire(ogs_app()->timer_mgr);
+    }
+
+    ABTS_INT_EQUAL(tc, num_of_request, done);
+    ABTS_INT_EQUAL(tc, num_of_request, test_server_state.num_of_request);
+
+    ABTS_TRUE(tc, client->stats.request == num_of_request);
+    ABTS_TRUE(tc, client->stats.error == 0);
+    ABTS_TRUE(tc, client->stats.stream_hwm >= 1);
+    ABTS_TRUE(tc, client->stats.stream_hwm <= num_of_request);
+    for (i = 0; i < OGS_SBI_CLIENT_MAX_LATENCY; i++)
+        num_of_latency += client->stats.latency[i];
+    ABTS_TRUE(tc, num_of_latency == num_of_request);
+
+    ogs_snprintf(expected, sizeof(expected),
+            "request:%d error:0 stream-hwm:%d/%d latency(usec):[",
+            num_of_request, client->stats.stream_hwm, client->max_stream);
+    ogs_sbi_client_stats_print(client, stats, stats + sizeof(stats));
+    ABTS_TRUE(tc, strncmp(stats, expected, strlen(expected)) == 0);
+    ABTS_TRUE(tc, stats[strlen(stats)-1] == ']');
+
+    /* Benchmark : run with '-e info' to see the result */
+    ogs_info("%s", stats);
+
+    /* Only the buckets with responses are printed */
+    memset(client->stats.latency, 0, sizeof(client->stats.latency));
+    client->stats.latency[8] = 3;
+    client->stats.latency[9] = num_of_request - 4;
+    client->stats.latency[OGS_SBI_CLIENT_MAX_LATENCY-1] = 1;
+    ogs_snprintf(expected, sizeof(expected),
+            "request:%d error:0 stream-hwm:%d/%d "
+            "latency(usec):[<512:3,<1024:%d,+Inf:1]",
+            num_of_request, client->stats.stream_hwm, client->max_stream,
+            num_of_request - 4);
+    ABTS_STR_EQUAL(tc, expected,
+            ogs_sbi_client_stats_print(client, stats, stats + sizeof(stats)));
+
+    ogs_sbi_client_final();
+    ogs_timer_mgr_destroy(ogs_app()->timer_mgr);
+    ogs_app()->timer_mgr = NULL;
+
+    test_server_stop();
+}
+
+abts_suite *test_sbi_server(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, sbi_server_test1, NULL);
+    abts_run_test(suite, sbi_server_test2, NULL);
+    abts_run_test(suite, sbi_server_test3, NULL);
+
+    return suite;
+}
@@ -52,6 +52,9 @@ static void security_test1(abts_case *tc, void *data)
 
     uint8_t tmp[16];
 
+    milenage_vector_t vector[5];
+    int i;
+
     milenage_opc(ogs_hex_from_string(_k, k, sizeof(k)),
             ogs_hex_from_string(_op, op, sizeof(op)), opc);
     ABTS_TRUE(tc, memcmp(opc,
@@ -78,6 +81,22 @@ static void security_test1(abts_case *tc, void *data)
                 ogs_hex_from_string(_ak, tmp, sizeof(tmp)), 6) == 0);
     ABTS_TRUE(tc, memcmp(akstar, 
         ogs_hex_from_string(_akstar, tmp, sizeof(tmp)), 6) == 0);
+
+    for (i = 0; i < 5; i++) {
+        vector[i].opc = opc;
+        vector[i].amf = amf;
+        vector[i].k = k;
+        vector[i].sqn = sqn;
+        vector[i]._rand = rand;
+    }
+    milenage_generate_vectors(vector, 5);
+    for (i = 0; i < 5; i++) {
+        ABTS_TRUE(tc, memcmp(vector[i].autn + 8, mac_a, 8) == 0);
+        ABTS_TRUE(tc, memcmp(vector[i].res, res, 8) == 0);
+        ABTS_TRUE(tc, memcmp(vector[i].ck, ck, 16) == 0);
+        ABTS_TRUE(tc, memcmp(vector[i].ik, ik, 16) == 0);
+        ABTS_TRUE(tc, memcmp(vector[i].ak, ak, 6) == 0);
+    }
 }
 
 static void security_test2(abts_case *tc, void *data)
@@ -398,6 +417,94 @@ static void security_test9(abts_case *tc, void *data)
     ogs_pkbuf_free(pkbuf);
 }
 
+static void security_test10(abts_case *tc, void *data)
+{
+#define SECURITY_TEST10_MAX_LEN 1500
+    uint8_t key[16];
+    uint8_t message[SECURITY_TEST10_MAX_LEN];
+    uint32_t count, fresh, bearer, dir, length;
+    uint8_t mac_f9[4], mac_f9_portable[4];
+    uint32_t mac_eia3, mac_eia3_portable;
+    int i;
+
+    /* PCLMULQDQ and the portable code on random inputs */
+    for (i = 0; i < 2000; i++) {
+        ogs_random(key, sizeof(key));
+        ogs_random(message, sizeof(message));
+        count = ogs_random32();
+        fresh = ogs_random32();
+        bearer = ogs_random32() & 0x1f;
+        dir = ogs_random32() & 1;
+        length = ogs_random32() % (SECURITY_TEST10_MAX_LEN * 8) + 1;
+
+        snow_3g_use_pclmul(1);
+        snow_3g_f9(key, count, fresh, dir, message, length, mac_f9);
+        snow_3g_use_pclmul(0);
+        snow_3g_f9(key, count, fresh, dir, message, length, mac_f9_portable);
+        ABTS_TRUE(tc, memcmp(mac_f9, mac_f9_portable, 4) == 0);
+
+        zuc_use_pclmul(1);
+        zuc_eia3(key, count, bearer, dir, length, message, &mac_eia3);
+        zuc_use_pclmul(0);
+        zuc_eia3(key, count, bearer, dir, length, message,
+                &mac_eia3_portable);
+        ABTS_INT_EQUAL(tc, mac_eia3, mac_eia3_portable);
+    }
+
+    snow_3g_use_pclmul(1);
+    zuc_use_pclmul(1);
+}
+
+static void security_test11(abts_case *tc, void *data)
+{
+#define SECURITY_TEST11_LEN 1500
+#define SECURITY_TEST11_COUNT 20000
+    const char *name[] = { "f8", "f9", "eea3", "eia3" };
+    uint8_t key[16];
+    uint8_t message[SECURITY_TEST11_LEN];
+    uint8_t mac[4];
+    uint32_t mac32;
+    ogs_time_t start, elapsed;
+    int i, j;
+
+    ogs_random(key, sizeof(key));
+    ogs_random(message, sizeof(message));
+
+    /* Benchmark : run with '-e info' to see the result */
+    for (i = 0; i < OGS_ARRAY_SIZE(name); i++) {
+        start = ogs_get_monotonic_time();
+        for (j = 0; j < SECURITY_TEST11_COUNT; j++) {
+            switch (i) {
+            case 0:
+                snow_3g_f8(key, j, 0x1f, 1,
+                        message, SECURITY_TEST11_LEN * 8);
+                break;
+            case 1:
+                snow_3g_f9(key, j, 0x1f << 27, 1,
+                        message, SECURITY_TEST11_LEN * 8, mac);
+                break;
+            case 2:
+                zuc_eea3(key, j, 0x1f, 1,
+                        SECURITY_TEST11_LEN * 8, message, message);
+                break;
+            case 3:
+                zuc_eia3(key, j, 0x1f, 1,
+                        SECURITY_TEST11_LEN * 8, message, &mac32);
+                break;
+            default:
+                ogs_assert_if_reached();
+            }
+        }
+        elapsed = ogs_get_monotonic_time() - start;
+
+        ogs_info("%-4s : %d x %d bytes in %lld usecs, %lld MB/s",
+                name[i], SECURITY_TEST11_COUNT, SECURITY_TEST11_LEN,
+                (long long)elapsed,
+                (long long)SECURITY_TEST11_COUNT * SECURITY_TEST11_LEN /
+                    (elapsed ? elapsed : 1));
+    }
+}
+
 abts_suite *test_security(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -411,6 +518,8 @@ abts_suite *test_security(abts_suite *suite)
     abts_run_test(suite, security_test7, NULL);
     abts_run_test(suite, security_test8, NULL);
     abts_run_test(suite, security_test9, NULL);
+    abts_run_test(suite, security_test10, NULL);
+    abts_run_test(suite, security_test11, NULL);
 
     return suite;
 }
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-pfcp.h"
+#include "ogs-gtp.h"
+#include "core/abts.h"
+
+#define NUM_OF_TEST_XACT 100000
+
+static void test_app_init(void)
+{
+    ogs_app_context_init();
+
+    /* Remote and local transactions are outstanding at the same time */
+    ogs_app()->pool.xact = NUM_OF_TEST_XACT * 2;
+
+    ogs_app()->timer_mgr = ogs_timer_mgr_create(ogs_app()->pool.timer);
+    ogs_assert(ogs_app()->timer_mgr);
+
+    /* Remote transactions are deleted at the first holding timeout */
+    ogs_app()->time.message.pfcp.n1_holding_rcount = 1;
+    ogs_app()->time.message.pfcp.t1_holding_duration = ogs_time_from_msec(1);
+    ogs_app()->time.message.gtp.n3_holding_rcount = 1;
+    ogs_app()->time.message.gtp.t3_holding_duration = ogs_time_from_msec(1);
+}
+
+static void test_addr_init(ogs_sockaddr_t *addr)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->ogs_sa_family = AF_INET;
+    addr->sin.sin_addr.s_addr = htobe32(0x7f000001);
+}
+
+static void xact_test1(abts_case *tc, void *data)
+{
+    int rv, i;
+    ogs_pfcp_node_t node;
+    ogs_pfcp_header_t h, hdesc;
+    ogs_pfcp_xact_t *xact = NULL;
+    ogs_pfcp_xact_t **local = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_time_t start, elapsed;
+
+    test_app_init();
+    ogs_pfcp_xact_init();
+
+    memset(&node, 0, sizeof(node));
+    test_addr_init(&node.addr);
+
+    /* Session Establishment Requests from the peer */
+    for (i = 0; i < NUM_OF_TEST_XACT; i++) {
+        memset(&h, 0, sizeof(h));
+        h.type = OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE;
+        h.sqn = OGS_PFCP_XID_TO_SQN(i+1);
+
+        xact = NULL;
+        rv = ogs_pfcp_xact_receive(&node, &h, &xact);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        ABTS_PTR_NOTNULL(tc, xact);
+        ABTS_INT_EQUAL(tc, i+1, xact->xid);
+    }
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_XACT, ogs_list_count(&node.remote_list));
+
+    /* Retransmitted by the peer */
+    for (i = 0; i < NUM_OF_TEST_XACT; i++) {
+        memset(&h, 0, sizeof(h));
+        h.type = OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE;
+        h.sqn = OGS_PFCP_XID_TO_SQN(i+1);
+
+        rv = ogs_pfcp_xact_receive(&node, &h, &xact);
+        ABTS_INT_EQUAL(tc, OGS_RETRY, rv);
+    }
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_XACT, ogs_list_count(&node.remote_list));
+
+    /* Session Establishment Requests to the peer */
+    local = ogs_calloc(NUM_OF_TEST_XACT, sizeof(*local));
+    ogs_assert(local);
+
+    for (i = 0; i < NUM_OF_TEST_XACT; i++) {
+        local[i] = ogs_pfcp_xact_local_create(&node, NULL, NULL);
+        ABTS_PTR_NOTNULL(tc, local[i]);
+
+        pkbuf = ogs_pkbuf_alloc(NULL, OGS_TLV_MAX_HEADROOM);
+        ogs_assert(pkbuf);
+        ogs_pkbuf_reserve(pkbuf, OGS_TLV_MAX_HEADROOM);
+
+        memset(&hdesc, 0, sizeof(hdesc));
+        hdesc.type = OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE;
+        rv = ogs_pfcp_xact_update_tx(local[i], &hdesc, pkbuf);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    }
+
+    /* The responses are matched in the reverse order */
+    start = ogs_get_monotonic_time();
+    for (i = NUM_OF_TEST_XACT-1; i >= 0; i--) {
+        memset(&h, 0, sizeof(h));
+        h.type = OGS_PFCP_SESSION_ESTABLISHMENT_RESPONSE_TYPE;
+        h.sqn = OGS_PFCP_XID_TO_SQN(local[i]->xid);
+
+        xact = NULL;
+        rv = ogs_pfcp_xact_receive(&node, &h, &xact);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        ABTS_PTR_EQUAL(tc, local[i], xact);
+    }
+    elapsed = ogs_get_monotonic_time() - start;
+
+    /* Benchmark : run with '-e info' to see the result */
+    ogs_info("PFCP : %d responses matched in %lld usecs, %lld ns/msg",
+            NUM_OF_TEST_XACT, (long long)elapsed,
+            (long long)elapsed * 1000 / NUM_OF_TEST_XACT);
+
+    ogs_free(local);
+
+    /* All the holding timers are expired by the timer of the node */
+    ogs_msleep(10);
+    ogs_timer_mgr_expire(ogs_app()->timer_mgr);
+
+    ABTS_INT_EQUAL(tc, 0, ogs_list_count(&node.remote_list));
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_XACT, ogs_list_count(&node.local_list));
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_XACT, ogs_ihash_count(node.xact_hash));
+
+    ogs_pfcp_xact_delete_all(&node);
+
+    ABTS_INT_EQUAL(tc, 0, ogs_list_count(&node.local_list));
+    ABTS_PTR_EQUAL(tc, NULL, node.xact_hash);
+    ABTS_PTR_EQUAL(tc, NULL, node.xact_timer.timer);
+
+    ogs_pfcp_xact_final();
+    ogs_app_context_final();
+}
+
+static void xact_test2(abts_case *tc, void *data)
+{
+    int rv, i;
+    ogs_gtp_node_t gnode;
+    ogs_gtp2_header_t h, hdesc;
+    ogs_gtp_xact_t *xact = NULL;
+    ogs_gtp_xact_t **local = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_time_t start, elapsed;
+
+    test_app_init();
+    ogs_gtp_xact_init();
+
+    memset(&gnode, 0, sizeof(gnode));
+    test_addr_init(&gnode.addr);
+
+    /* Create Session Requests from the peer */
+    for (i = 0; i < NUM_OF_TEST_XACT; i++) {
+        memset(&h, 0, sizeof(h));
+        h.type = OGS_GTP2_CREATE_SESSION_REQUEST_TYPE;
+        h.teid_presence = 1;
+        h.sqn = OGS_GTP2_XID_TO_SQN(i+1);
+
+        xact = NULL;
+        rv = ogs_gtp_xact_receive(&gnode, &h, &xact);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        ABTS_PTR_NOTNULL(tc, xact);
+        ABTS_INT_EQUAL(tc, i+1, xact->xid);
+    }
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_XACT, ogs_list_count(&gnode.remote_list));
+
+    /* Retransmitted by the peer */
+    for (i = 0; i < NUM_OF_TEST_XACT; i++) {
+        memset(&h, 0, sizeof(h));
+        h.type = OGS_GTP2_CREATE_SESSION_REQUEST_TYPE;
+        h.teid_presence = 1;
+        h.sqn = OGS_GTP2_XID_TO_SQN(i+1);
+
+        rv = ogs_gtp_xact_receive(&gnode, &h, &xact);
+        ABTS_INT_EQUAL(tc, OGS_RETRY, rv);
+    }
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_XACT, ogs_list_count(&gnode.remote_list));
+
+    /* Create Session Requests to the peer */
+    local = ogs_calloc(NUM_OF_TEST_XACT, sizeof(*local));
+    ogs_assert(local);
+
+    for (i = 0; i < NUM_OF_TEST_XACT; i++) {
+        pkbuf = ogs_pkbuf_alloc(NULL, OGS_TLV_MAX_HEADROOM);
+        ogs_assert(pkbuf);
+        ogs_pkbuf_reserve(pkbuf, OGS_TLV_MAX_HEADROOM);
+
+        memset(&hdesc, 0, sizeof(hdesc));
+        hdesc.type = OGS_GTP2_CREATE_SESSION_REQUEST_TYPE;
+        local[i] = ogs_gtp_xact_local_create(&gnode, &hdesc, pkbuf, NULL, NULL);
+        ABTS_PTR_NOTNULL(tc, local[i]);
+    }
+
+    /* The responses are matched in the reverse order */
+    start = ogs_get_monotonic_time();
+    for (i = NUM_OF_TEST_XACT-1; i >= 0; i--) {
+        memset(&h, 0, sizeof(h));
+        h.type = OGS_GTP2_CREATE_SESSION_RESPONSE_TYPE;
+        h.teid_presence = 1;
+        h.sqn = OGS_GTP2_XID_TO_SQN(local[i]->xid);
+
+        xact = NULL;
+        rv = ogs_gtp_xact_receive(&gnode, &h, &xact);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        ABTS_PTR_EQUAL(tc, local[i], xact);
+    }
+    elapsed = ogs_get_monotonic_time() - start;
+
+    /* Benchmark : run with '-e info' to see the result */
+    ogs_info("GTPv2 : %d responses matched in %lld usecs, %lld ns/msg",
+            NUM_OF_TEST_XACT, (long long)elapsed,
+            (long long)elapsed * 1000 / NUM_OF_TEST_XACT);
+
+    ogs_free(local);
+
+    /* All the holding timers are expired by the timer of the node */
+    ogs_msleep(10);
+    ogs_timer_mgr_expire(ogs_app()->timer_mgr);
+
+    ABTS_INT_EQUAL(tc, 0, ogs_list_count(&gnode.remote_list));
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_XACT, ogs_list_count(&gnode.local_list));
+    ABTS_INT_EQUAL(tc, NUM_OF_TEST_XACT, ogs_ihash_count(gnode.xact_hash));
+
+    ogs_gtp_xact_delete_all(&gnode);
+
+    ABTS_INT_EQUAL(tc, 0, ogs_list_count(&gnode.local_list));
+    ABTS_PTR_EQUAL(tc, NULL, gnode.xact_hash);
+    ABTS_PTR_EQUAL(tc, NULL, gnode.xact_timer.timer);
+
+    ogs_gtp_xact_final();
+    ogs_app_context_final();
+}
+
+abts_suite *test_xact(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, xact_test1, NULL);
+    abts_run_test(suite, xact_test2, NULL);
+
+    return suite;
+}